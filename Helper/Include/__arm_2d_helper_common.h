@@ -263,6 +263,8 @@ extern "C" {
                 arm_2d_gray8_fill_colour_with_vertical_line_mask_and_opacity
 
 #   define arm_2d_draw_point        arm_2d_gray8_draw_point
+#   define arm_2d_draw_points       arm_2d_gray8_draw_points
+#   define arm_2d_draw_points_aa    arm_2d_gray8_draw_points_aa
 #elif __GLCD_CFG_COLOUR_DEPTH__ == 16
 
 #   define __arm_2d_color_t         arm_2d_color_rgb565_t
@@ -452,6 +454,8 @@ extern "C" {
                 arm_2d_rgb565_fill_colour_with_vertical_line_mask_and_opacity
 
 #   define arm_2d_draw_point        arm_2d_rgb565_draw_point
+#   define arm_2d_draw_points       arm_2d_rgb565_draw_points
+#   define arm_2d_draw_points_aa    arm_2d_rgb565_draw_points_aa
 #elif __GLCD_CFG_COLOUR_DEPTH__ == 32
 
 #   define __arm_2d_color_t         arm_2d_color_cccn888_t
@@ -641,6 +645,8 @@ extern "C" {
                 arm_2d_cccn888_fill_colour_with_vertical_line_mask_and_opacity
 
 #   define arm_2d_draw_point        arm_2d_cccn888_draw_point
+#   define arm_2d_draw_points       arm_2d_cccn888_draw_points
+#   define arm_2d_draw_points_aa    arm_2d_cccn888_draw_points_aa
 #else
 #   error Unsupported colour depth!
 #endif
@@ -320,6 +320,18 @@ typedef struct arm_2d_user_font_t {
     arm_2d_char_idx_t tLookUpTable[];
 } arm_2d_user_font_t;
 
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+/*!
+ * \brief a printf-like function used to output the profiler records
+ * \param[in] pTarget a user object, e.g. a FILE pointer
+ * \param[in] pchFormat the format string
+ * \return int the number of characters printed
+ */
+typedef int arm_2d_helper_profiler_printf_t(void *pTarget, 
+                                            const char *pchFormat, 
+                                            ...);
+#endif
+
 /*============================ GLOBAL VARIABLES ==============================*/
 /*============================ LOCAL VARIABLES ===============================*/
 /*============================ PROTOTYPES ====================================*/
@@ -336,6 +348,15 @@ void arm_2d_helper_init(void);
 extern
 void arm_2d_helper_backend_task(void);
 
+/*!
+ * \brief backend task for a given worker in asynchronose mode
+ * \note when __ARM_2D_CFG_ASYNC_WORKER_COUNT__ is larger than 1, please run 
+ *       one backend task for each worker, e.g. one RTOS thread per core.
+ * \param[in] chWorkerID the worker index, [0, __ARM_2D_CFG_ASYNC_WORKER_COUNT__)
+ */
+extern
+void arm_2d_helper_backend_worker_task(uint_fast8_t chWorkerID);
+
 /*! 
  * \brief convert ticks of a reference timer to millisecond 
  *
@@ -719,6 +740,26 @@ void arm_2d_helper_fill_tile_colour(const arm_2d_tile_t *ptTile,
                                     arm_2d_color_info_t tColourFormat,
                                     arm_2d_colour_t tColour);
 
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+/*!
+ * \brief fetch all records from the profiler and print them as Chrome 
+ *        trace-event JSON, which can be opened in chrome://tracing or Perfetto
+ * \note  OPs are shown in the thread of their default-OP slot, i.e.
+ *        0 ~ (__ARM_2D_CFG_DEFAULT_OP_COUNT__ - 1), and sub-tasks in the
+ *        thread (__ARM_2D_CFG_DEFAULT_OP_COUNT__ + the worker index).
+ *        The OP index, the colour format, the pixel count and the PFB index
+ *        are shown as the arguments of each event.
+ * \param[in] fnPrintf the printf-like function for the output
+ * \param[in] pTarget a user object passed to fnPrintf
+ * \return uint32_t the number of records printed
+ */
+extern
+ARM_NONNULL(1)
+uint32_t arm_2d_helper_profiler_dump_chrome_trace(
+                                    arm_2d_helper_profiler_printf_t *fnPrintf,
+                                    void *pTarget);
+#endif
+
 #if __ARM_2D_HELPER_CFG_LAYOUT_DEBUG_MODE__
 extern
 ARM_NONNULL(1)
@@ -58,6 +58,23 @@ extern "C" {
 #define ARM_2D_FPS_MODE_RENDER_ONLY     0
 #define ARM_2D_FPS_MODE_REAL            1
 
+#ifndef __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__
+/*!
+ * \note When band workers are available, the evtOnDrawing handler is called
+ *       from several threads at the same time. Hence the band-split rendering
+ *       is only enabled (see arm_2d_helper_pfb_enable_band_split()) for the 
+ *       drawing handlers that are re-entrant, i.e. they must not update any 
+ *       shared states (globals or statics) when bIsNewFrame is false, and 
+ *       they must only use thread-safe services, e.g. the default OP and the
+ *       lcd_printf which keep a dedicated context for each thread.
+ */
+#   define __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__      0   //!< the number of threads drawing PFBs (bands) in parallel, 0 means disabled
+#endif
+
+#ifndef __ARM_2D_HELPER_CFG_DIRTY_REGION_OPTIMIZATION_BUDGET__
+#   define __ARM_2D_HELPER_CFG_DIRTY_REGION_OPTIMIZATION_BUDGET__   4096    //!< the max number of region comparisons per frame in the dirty region optimization, 0 means no limit
+#endif
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 
 /*!
@@ -494,20 +511,54 @@ typedef struct arm_2d_helper_dma_copy_evt_t {
     void *pObj;
 } arm_2d_helper_dma_copy_evt_t;
 
+/*!
+ * \brief the screen rotation applied when a PFB is flushed to the panel
+ */
+typedef enum {
+    ARM_SCREEN_NO_ROTATION = 0,
+    ARM_SCREEN_ROTATE_90,
+    ARM_SCREEN_ROTATE_180,
+    ARM_SCREEN_ROTATE_270,
+} arm_2d_screen_rotation_t;
+
 /*!
  * \brief configuration structure for the 3fb (direct mode) helper service
  */
 typedef struct arm_2d_helper_3fb_cfg_t {
-    arm_2d_size_t tScreenSize;              //!< the screen size
+    arm_2d_size_t tScreenSize;              //!< the screen (panel) size
     uint8_t       chPixelBits;              //!< the number of bits in one pixel
     uintptr_t     pnAddress[3];             //!< addresses of the 3 full-frame-buffer
 
     arm_2d_helper_2d_copy_evt_t     evtOn2DCopy;
     arm_2d_helper_dma_copy_evt_t    evtOnDMACopy;
+
+    /*! \brief the screen rotation. When it isn't ARM_SCREEN_NO_ROTATION, PFBs
+     *         are rotated while they are copied to the drawing frame-buffer
+     *         and evtOn2DCopy is not used for PFBs.
+     */
+    arm_2d_screen_rotation_t        tRotation;
 } arm_2d_helper_3fb_cfg_t;
 
 #define ARM_2D_3FB_INVALID_IDX      3
 
+/*!
+ * \brief the number of recent frames whose updated areas are remembered by the
+ *        3FB (direct mode) helper service. When a frame-buffer falls behind by
+ *        more frames than this, it is synchronised with a full-frame copy.
+ */
+#ifndef ARM_2D_3FB_DAMAGE_HISTORY_DEPTH
+#   define ARM_2D_3FB_DAMAGE_HISTORY_DEPTH      4
+#endif
+
+/*!
+ * \brief the number of disjoint updated areas remembered for each frame by the
+ *        3FB (direct mode) helper service. When a frame updates more disjoint
+ *        areas than this, they are replaced by their minimal enclosure.
+ */
+#ifndef ARM_2D_3FB_DAMAGE_REGION_COUNT
+#   define ARM_2D_3FB_DAMAGE_REGION_COUNT       4
+#endif
+
 /*!
  * \brief the control block of the 3FB (direct mode) service
  */
@@ -523,6 +574,16 @@ ARM_PRIVATE(
         uint8_t         tState[3];
         uintptr_t       tSemaphore;                 //!< semaphore for async access
         bool            bFBCopyComplete;            //!< a flag to indicate the completion of a DMA copy
+        volatile bool   bSynchronising;             //!< a flag to indicate an on-going frame-buffer synchronisation
+
+        uint32_t        wFrameNo;                   //!< the number of the frame being drawn
+        uint32_t        wFBFrameNo[3];              //!< the number of the frame each FB holds
+
+        struct {
+            arm_2d_region_t tRegions[ARM_2D_3FB_DAMAGE_REGION_COUNT];  //!< the disjoint updated areas
+            uint32_t        wFrameNo;               //!< the frame in which the areas are updated
+            uint8_t         chCount;                //!< the number of the updated areas
+        } tDamage[ARM_2D_3FB_DAMAGE_HISTORY_DEPTH]; //!< the updated areas of the recent frames
     } Runtime;
 )
 } arm_2d_helper_3fb_t;
@@ -549,6 +610,7 @@ typedef struct arm_2d_region_list_item_t {
     struct arm_2d_region_list_item_t   *ptNext;                                 //!< the next node
 ARM_PRIVATE(
     struct arm_2d_region_list_item_t   *ptInternalNext;                         //!< the next node in the internal list
+    uint32_t                            wGridMask;                              //!< the grid cells covered by the region, used by the dirty region optimization
 )
     arm_2d_region_t                     tRegion;                                //!< the region
 
@@ -665,7 +727,8 @@ typedef struct arm_2d_helper_pfb_cfg_t {
         uint32_t       bDisableDynamicFPBSize           : 1;    //!< A flag to disable resize of the PFB block
         uint32_t       bSwapRGB16                       : 1;    //!< A flag to enable swapping high and low bytes of an RGB16 pixel
         uint32_t       bDebugDirtyRegions               : 1;    //!< A flag to show dirty regions on screen for debug
-        uint32_t                                        : 10;
+        uint32_t       u2ScanOrder                      : 2;    //!< issue PFBs in the scan order of a panel rotated by this arm_2d_screen_rotation_t
+        uint32_t                                        : 8;
         uint32_t       u3PixelWidthAlign                : 3;    //!< Pixel alignment in Width for dirty region (2^n)
         uint32_t       u3PixelHeightAlign               : 3;    //!< Pixel alignment in Height for dirty region (2^n)
         uint32_t       u4PoolReserve                    : 4;    //!< reserve specific number of PFB for other helper services
@@ -752,6 +815,31 @@ ARM_PRIVATE(
             arm_2d_pfb_t           *ptTail;
         }FlushFIFO;
         arm_2d_tile_t              *ptFrameBuffer;
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+        uint8_t                     chPFBIndex;                                 //!< the index of the PFB being drawn in the current frame
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+        struct {
+            arm_2d_display_list_t  *ptList;                                     //!< the display list used by the drawing handler
+            uint8_t                 chState;                                    //!< the state of the display list in this frame
+            uint8_t                                         : 8;
+            uint16_t                                        : 16;
+        } DisplayList;
+#endif
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+        struct {
+            arm_2d_size_t           tDispatchedSize;                            //!< the size of the PFB handed over to a band worker
+            uintptr_t               pBandComplete;                              //!< set when a band worker finishes a band
+            uint8_t                 chInFlight;                                 //!< the number of bands being drawn by band workers
+            uint8_t                 bEnabled                : 1;
+            uint8_t                 bDispatched             : 1;
+            uint8_t                                         : 6;
+            uint16_t                                        : 16;
+        } Band;
+#endif
     } Adapter;
 )
 
@@ -759,6 +847,12 @@ ARM_PRIVATE(
         int64_t lTimestamp;                                     //!< PLEASE DO NOT USE
         int32_t nTotalCycle;                                    //!< cycles used by drawing 
         int32_t nRenderingCycle;                                //!< cycles used in LCD flushing
+
+        struct {
+            uint16_t hwInput;                                   //!< the number of dirty regions fed to the optimizer
+            uint16_t hwOutput;                                  //!< the number of dirty regions left after the optimization
+            uint32_t wComparison;                               //!< the number of region comparisons done by the optimizer
+        } DirtyRegionOptimization;                              //!< dirty region optimization statistics of the current frame
     } Statistics;                                               //!< performance statistics
 
 };
@@ -1002,6 +1096,27 @@ extern
 ARM_NONNULL(1)
 void arm_2d_helper_show_navigation_layer(arm_2d_helper_pfb_t *ptThis);
 
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+/*!
+ * \brief use a display list for the drawing handler
+ * \details The OPs issued by the drawing handler in the first PFB of a frame
+ *          are recorded, and the rest PFBs (and dirty regions) of the same 
+ *          frame are drawn by replaying the display list instead of calling
+ *          the drawing handler, including the PFBs drawn by the band workers.
+ *          The records are kept across frames as long as the OPs are
+ *          unchanged. If the display list becomes invalid, e.g. a transform
+ *          OP is used or the memory is insufficient, the drawing handler is
+ *          called as usual.
+ * \note The display list takes effect from the next frame.
+ * \param[in] ptThis an initialised PFB helper control block
+ * \param[in] ptList an initialised display list, NULL means disabling it
+ */
+extern
+ARM_NONNULL(1)
+void arm_2d_helper_pfb_use_display_list(arm_2d_helper_pfb_t *ptThis,
+                                        arm_2d_display_list_t *ptList);
+#endif
+
 
 /*!
  * \brief enable filling canvas with specified colour
@@ -1106,6 +1221,21 @@ extern
 ARM_NONNULL(1)
 void arm_2d_helper_3fb_report_dma_copy_complete(arm_2d_helper_3fb_t *ptThis);
 
+/*!
+ * \brief report the completion of an asynchronous 2D copy (i.e. the 
+ *        evtOn2DCopy handler returned false) to the 3FB (direct mode) service
+ * \note Besides copying PFBs to the drawing frame-buffer, the 2D copy handler
+ *       is also used to bring the ready-to-draw frame-buffer up to date with 
+ *       the areas updated in recent frames. 
+ * \param[in] ptThis the helper service control block
+ * \retval true the 2D copy belongs to a PFB, please report the rendering 
+ *         completion to the PFB helper
+ * \retval false the 2D copy is consumed by the 3FB helper service
+ */
+extern
+ARM_NONNULL(1)
+bool arm_2d_helper_3fb_report_2d_copy_complete(arm_2d_helper_3fb_t *ptThis);
+
 /*!
  * \brief get a pointer for flushing
  * \param[in] ptThis the helper service control block
@@ -1240,6 +1370,39 @@ arm_2d_pfb_t * __arm_2d_helper_pfb_rotate270_rgb32(
                                             arm_2d_pfb_t *ptScratch,
                                             const arm_2d_size_t *ptScreenSize);
 
+/*!
+ * \brief calculate the panel region that a region on the (logical) screen
+ *        is mapped to after the screen rotation
+ * \param[in] ptRegion the region on the screen
+ * \param[in] tRotation the screen rotation
+ * \param[in] ptScreenSize the screen size before the rotation
+ * \return arm_2d_region_t the region on the panel
+ */
+extern
+ARM_NONNULL(1,3)
+arm_2d_region_t arm_2d_helper_pfb_get_rotated_region(
+                                        const arm_2d_region_t *ptRegion,
+                                        arm_2d_screen_rotation_t tRotation,
+                                        const arm_2d_size_t *ptScreenSize);
+
+/*!
+ * \brief copy a PFB to a target buffer (e.g. a panel frame-buffer) with the
+ *        specified screen rotation in one pass
+ * \note This function allows a display driver to rotate the screen in its
+ *       flushing copy without requiring a scratch PFB. The target region
+ *       can be calculated with arm_2d_helper_pfb_get_rotated_region().
+ * \param[in] ptPFB the PFB
+ * \param[in] tRotation the screen rotation
+ * \param[in] pTarget the address of the top-left pixel of the target region
+ * \param[in] iTargetStride the stride of the target buffer in pixels
+ */
+extern
+ARM_NONNULL(1,3)
+void arm_2d_helper_pfb_copy_rotated(const arm_2d_pfb_t *ptPFB,
+                                    arm_2d_screen_rotation_t tRotation,
+                                    void *pTarget,
+                                    int16_t iTargetStride);
+
 /*----------------------------------------------------------------------------*
  * Dirty Regions                                                              *
  *----------------------------------------------------------------------------*/
@@ -1319,6 +1482,45 @@ ARM_NONNULL(1)
 void arm_2d_helper_pfb_disable_dirty_region_optimization(
                                                 arm_2d_helper_pfb_t *ptThis);
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+/*!
+ * \brief enable band-split rendering (disabled by default)
+ * \details Except the first PFB of a frame, PFBs are handed over to the band
+ *          workers and drawn in parallel. Each band is flushed as soon as it
+ *          is finished.
+ * \note Only enable it when the evtOnDrawing handler (and the navigation 
+ *       layer handler) is re-entrant when the bIsNewFrame is false, i.e. the
+ *       states should only be updated when bIsNewFrame is true, and the 
+ *       drawing should always use the ptTile passed in rather than the 
+ *       default frame buffer. The scene player enables it for the scenes 
+ *       that set bReentrantDrawing, and for the built-in switching effects
+ *       between such scenes, and disables it for the others.
+ * \note The band-split rendering is bypassed when evtBeforeFlushing is used.
+ * \param[in] ptThis the PFB helper control block
+ */
+extern
+ARM_NONNULL(1)
+void arm_2d_helper_pfb_enable_band_split(arm_2d_helper_pfb_t *ptThis);
+
+/*!
+ * \brief disable band-split rendering
+ * \param[in] ptThis the PFB helper control block
+ */
+extern
+ARM_NONNULL(1)
+void arm_2d_helper_pfb_disable_band_split(arm_2d_helper_pfb_t *ptThis);
+
+/*!
+ * \brief the entry of a band worker thread, it never returns
+ * \note The RTOS port should create __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__
+ *       threads calling this function, and arm_2d_port_get_default_op_index()
+ *       should return (chWorkerID + 1) in those threads.
+ * \param[in] chWorkerID the index of the band worker
+ */
+extern
+void arm_2d_helper_pfb_band_worker_task(uint_fast8_t chWorkerID);
+#endif
+
 /*----------------------------------------------------------------------------*
  * The Dynamic Dirty Region Service                                           *
  *----------------------------------------------------------------------------*/
@@ -249,7 +249,8 @@ ARM_PRIVATE(
     struct {
         uint8_t bOnSwitchingIgnoreBG    : 1;                                    //!< ignore background during switching period
         uint8_t bOnSwitchingIgnoreScene : 1;                                    //!< ignore forground during switching period
-        uint8_t                         : 2;
+        uint8_t bReentrantDrawing       : 1;                                    //!< indicate that fnBackground and fnScene are re-entrant, i.e. the scene can be drawn by the band workers in parallel
+        uint8_t                         : 1;
         uint8_t                         : 3;
         uint8_t bUseDirtyRegionHelper   : 1;                                    //!< indicate whether use the built-in dirty region helper.
     };
@@ -104,6 +104,11 @@ uintptr_t arm_2d_port_new_semaphore(void);
 extern
 void arm_2d_helper_rtos_init(void);
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+extern
+void __arm_2d_helper_pfb_band_init(void);
+#endif
+
 /*============================ IMPLEMENTATION ================================*/
 
 void arm_2d_helper_init(void)
@@ -129,7 +134,13 @@ void arm_2d_helper_init(void)
     
     s_tHelper.Async.semResourceAvailable = arm_2d_port_new_semaphore();
     s_tHelper.Async.semTaskAvailable = arm_2d_port_new_semaphore();
-    
+#endif
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    __arm_2d_helper_pfb_band_init();
+#endif
+
+#if __ARM_2D_HAS_ASYNC__ || __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
     arm_2d_helper_rtos_init();
 #endif
 }
@@ -589,6 +600,72 @@ void arm_2d_helper_film_set_frame(arm_2d_helper_film_t *ptThis, int32_t nIndex)
         = (nIndex / this.hwColumn) * ptFrame->tRegion.tSize.iHeight;
 }
 
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+__OVERRIDE_WEAK
+int64_t arm_2d_port_get_profiler_timestamp(void)
+{
+    return arm_2d_helper_get_system_timestamp();
+}
+
+ARM_NONNULL(1)
+uint32_t arm_2d_helper_profiler_dump_chrome_trace(
+                                    arm_2d_helper_profiler_printf_t *fnPrintf,
+                                    void *pTarget)
+{
+    assert(NULL != fnPrintf);
+
+    arm_2d_profiler_record_t tRecords[16];
+    uint32_t wTotal = 0;
+    int64_t lOrigin = 0;
+    double dUSPerTick = 1000000.0 
+                      / (double)MAX(1, arm_2d_helper_get_reference_clock_frequency());
+
+    fnPrintf(pTarget, "{\"traceEvents\":[\n");
+
+    do {
+        uint_fast16_t hwCount = arm_2d_profiler_fetch_records(tRecords, 
+                                                              dimof(tRecords));
+        if (0 == hwCount) {
+            break;
+        }
+
+        for (uint_fast16_t n = 0; n < hwCount; n++) {
+            arm_2d_profiler_record_t *ptRecord = &tRecords[n];
+            bool bIsOP = (ARM_2D_PROFILER_EVT_OP == ptRecord->chType);
+
+            if (0 == wTotal) {
+                lOrigin = ptRecord->lTimestamp;
+            }
+
+            fnPrintf(pTarget, 
+                "%s{\"name\":\"%s %d\",\"cat\":\"%s\",\"ph\":\"X\","
+                "\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d,"
+                "\"args\":{\"op\":%d,\"colour\":%d,\"pixels\":%u,\"pfb\":%d}}",
+                (0 == wTotal) ? "" : ",\n",
+                bIsOP ? "OP" : "SubTask",
+                ptRecord->chOPIndex,
+                bIsOP ? "op" : "sub-task",
+                (double)(ptRecord->lTimestamp - lOrigin) * dUSPerTick,
+                (double)ptRecord->wElapsed * dUSPerTick,
+                bIsOP   ?   ptRecord->chThreadIndex
+                        :   __ARM_2D_CFG_DEFAULT_OP_COUNT__
+                        +   ptRecord->chThreadIndex,
+                ptRecord->chOPIndex,
+                ptRecord->chColourFormat,
+                (unsigned int)ptRecord->wPixelCount,
+                ptRecord->chPFBIndex);
+
+            wTotal++;
+        }
+    } while(true);
+
+    fnPrintf(pTarget, "\n],\"otherData\":{\"lost\":%u}}\n", 
+                      (unsigned int)arm_2d_profiler_get_lost_count());
+
+    return wTotal;
+}
+#endif
+
 #if __ARM_2D_HELPER_CFG_LAYOUT_DEBUG_MODE__
 ARM_NONNULL(1)
 void __arm_2d_helper_layout_debug_print_label(const arm_2d_tile_t *ptTile, 
@@ -720,10 +797,26 @@ arm_2d_op_core_t *arm_2d_op_depose(arm_2d_op_core_t *ptOP, size_t tSize)
     return ptOP;
 }
 
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+__OVERRIDE_WEAK 
+void arm_2d_notif_sub_task_fifo_task_arrive(void)
+{
+    /* wake up an idle worker */
+    arm_2d_port_set_semaphore(s_tHelper.Async.semTaskAvailable);
+}
+#endif
+
 void arm_2d_helper_backend_task(void)
+{
+    arm_2d_helper_backend_worker_task(0);
+}
+
+void arm_2d_helper_backend_worker_task(uint_fast8_t chWorkerID)
 {
     arm_fsm_rt_t tTaskResult;
-    arm_2d_task_t tTaskCB = {0};
+    arm_2d_task_t tTaskCB = {
+        .chWorkerID = chWorkerID,
+    };
     do {
         tTaskResult = arm_2d_task(&tTaskCB);
 
@@ -750,6 +843,11 @@ void arm_2d_helper_backend_task(void)
 void arm_2d_helper_backend_task(void)
 {
 }
+
+void arm_2d_helper_backend_worker_task(uint_fast8_t chWorkerID)
+{
+    ARM_2D_UNUSED(chWorkerID);
+}
 #endif
 
 
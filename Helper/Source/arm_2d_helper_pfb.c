@@ -77,11 +77,58 @@
 #undef  this
 #define this            (*ptThis)
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+#   if __ARM_2D_CFG_DEFAULT_OP_COUNT__ <= __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__
+#       error The band-split rendering requires one default OP for each band\
+ worker, please set __ARM_2D_CFG_DEFAULT_OP_COUNT__ to a value larger than\
+ __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__.
+#   endif
+
+/*! \note band workers access the PFB pool and the flush FIFO from different
+ *!       threads, hence the critical section must work across threads.
+ */
+#   define __arm_2d_helper_pfb_safe                                             \
+            arm_using(  uint32_t ARM_2D_SAFE_NAME(temp) =                       \
+                            arm_2d_port_enter_worker_critical_section(),        \
+                        arm_2d_port_leave_worker_critical_section(              \
+                            ARM_2D_SAFE_NAME(temp)))
+#else
+#   define __arm_2d_helper_pfb_safe         arm_irq_safe
+#endif
+
+/*! \note the dirty region optimization divides the screen into a grid of
+ *!       8 x 4 cells and only compares the regions sharing at least one cell,
+ *!       one bit for each cell in arm_2d_region_list_item_t::wGridMask
+ */
+#define __DIRTY_REGION_GRID_COLUMNS     8
+#define __DIRTY_REGION_GRID_ROWS        4
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
 
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+enum {
+    DISPLAY_LIST_START = 0,
+    DISPLAY_LIST_RECORDING,
+    DISPLAY_LIST_REPLAY,
+    DISPLAY_LIST_DISABLED,
+};
+#endif
+
 
 /*============================ LOCAL VARIABLES ===============================*/
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+static struct {
+    struct {
+        arm_2d_pfb_t           *ptHead;
+        arm_2d_pfb_t           *ptTail;
+    } JobFIFO;                                  /* PFBs waiting for a band worker */
+    uintptr_t                   semJobAvailable;
+    uint8_t                     chWorkerCount;  /* the number of running band workers */
+} s_tPFBBand;
+#endif
+
 /*============================ PROTOTYPES ====================================*/
 
 ARM_NONNULL(1)
@@ -103,7 +150,7 @@ arm_2d_pfb_t *__arm_2d_helper_pfb_new(arm_2d_helper_pfb_t *ptThis)
     
     arm_2d_pfb_t *ptPFB = NULL;
 
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         if (this.Adapter.chFreePFBCount) {
             this.Adapter.chFreePFBCount--;
             ARM_LIST_STACK_POP(this.Adapter.ptFreeList, ptPFB);
@@ -143,7 +190,7 @@ void __arm_2d_helper_pfb_free(arm_2d_helper_pfb_t *ptThis, arm_2d_pfb_t *ptPFB)
         return ;
     }
 
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         ARM_LIST_STACK_PUSH(this.Adapter.ptFreeList, ptPFB);
         this.Adapter.chFreePFBCount++;
     }
@@ -277,6 +324,12 @@ arm_2d_err_t arm_2d_helper_pfb_init(arm_2d_helper_pfb_t *ptThis,
         this.Adapter.pFPBPoolAvailable = arm_2d_port_new_semaphore();
     }
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    this.Adapter.Band.pBandComplete = arm_2d_port_new_semaphore();
+    /* band-split rendering is opt-in, see arm_2d_helper_pfb_enable_band_split() */
+    this.Adapter.Band.bEnabled = false;
+#endif
+
     /* initialize internal dirty region pool*/
     do {
         uint_fast8_t chCount = this.tCFG.DirtyRegion.chCount;
@@ -355,6 +408,9 @@ void arm_2d_helper_pfb_deinit(arm_2d_helper_pfb_t *ptThis)
 {
     assert(NULL != ptThis);
     arm_2d_port_free_semaphore(this.Adapter.pFPBPoolAvailable);
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    arm_2d_port_free_semaphore(this.Adapter.Band.pBandComplete);
+#endif
 }
 
 ARM_NONNULL(1)
@@ -412,13 +468,94 @@ void arm_2d_helper_show_navigation_layer(arm_2d_helper_pfb_t *ptThis)
     this.Adapter.bHideNavigationLayer = false;
 }
 
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+ARM_NONNULL(1)
+void arm_2d_helper_pfb_use_display_list(arm_2d_helper_pfb_t *ptThis,
+                                        arm_2d_display_list_t *ptList)
+{
+    assert(NULL != ptThis);
+    arm_2d_display_list_t *ptOldList = NULL;
+
+    __arm_2d_helper_pfb_safe {
+        ptOldList = this.Adapter.DisplayList.ptList;
+        this.Adapter.DisplayList.ptList = ptList;
+
+        /* take effect from the next frame */
+        this.Adapter.DisplayList.chState = DISPLAY_LIST_DISABLED;
+    }
+
+    if (NULL != ptOldList) {
+        arm_2d_display_list_end_recording(ptOldList);
+    }
+}
+
+/*!
+ * \brief call the drawing handler or replay the display list recorded in the 
+ *         first PFB of the current frame
+ * \param[in] ptThis the PFB control block
+ * \return arm_fsm_rt_t the result of the drawing
+ */
+static
+arm_fsm_rt_t __arm_2d_helper_pfb_draw_display_list(arm_2d_helper_pfb_t *ptThis)
+{
+    arm_2d_display_list_t *ptList = this.Adapter.DisplayList.ptList;
+    arm_fsm_rt_t tResult;
+
+    if (NULL != ptList && !this.Adapter.bIsDryRun) {
+        switch (this.Adapter.DisplayList.chState) {
+            case DISPLAY_LIST_START:
+                if (ARM_2D_ERR_NONE == arm_2d_display_list_begin_recording(
+                                                ptList, 
+                                                this.Adapter.ptFrameBuffer)) {
+                    this.Adapter.DisplayList.chState = DISPLAY_LIST_RECORDING;
+                } else {
+                    this.Adapter.DisplayList.chState = DISPLAY_LIST_DISABLED;
+                }
+                break;
+
+            case DISPLAY_LIST_REPLAY:
+                if (arm_2d_display_list_replay( ptList, 
+                                                this.Adapter.ptFrameBuffer)) {
+                    return arm_fsm_rt_cpl;
+                }
+                /* the display list is invalid, call the handler instead */
+                this.Adapter.DisplayList.chState = DISPLAY_LIST_DISABLED;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    tResult = this.tCFG.Dependency.evtOnDrawing.fnHandler(
+                                    this.tCFG.Dependency.evtOnDrawing.pTarget,
+                                    this.Adapter.ptFrameBuffer,
+                                    this.Adapter.bIsNewFrame);
+
+    if (    (DISPLAY_LIST_RECORDING == this.Adapter.DisplayList.chState)
+        &&  (arm_fsm_rt_on_going != tResult)
+        &&  (arm_fsm_rt_wait_for_obj != tResult)) {
+
+        /* the handler completes, stop recording */
+        if (    arm_2d_display_list_end_recording(ptList)
+            &&  (tResult >= 0)) {
+            this.Adapter.DisplayList.chState = DISPLAY_LIST_REPLAY;
+        } else {
+            this.Adapter.DisplayList.chState = DISPLAY_LIST_DISABLED;
+        }
+    }
+
+    return tResult;
+}
+#endif
+
 ARM_NONNULL(1)
 void __arm_2d_helper_pfb_enable_drawing_canvas_colour(arm_2d_helper_pfb_t *ptThis,
                                                       arm_2d_colour_t tColour)
 {
     assert(NULL != ptThis);
 
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         this.Adapter.bIgnoreCanvasColour = false;
         this.Adapter.tCanvas = tColour;
     }
@@ -439,7 +576,7 @@ void arm_2d_helper_pfb_flush(arm_2d_helper_pfb_t *ptThis)
     arm_2d_pfb_t *ptPFB = NULL;
     
     /* atomic access of this.Adapter.pfFlushing */
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         if (NULL != this.Adapter.ptFlushing) {
             arm_exit_irq_safe;
         }
@@ -483,12 +620,13 @@ void arm_2d_helper_pfb_flush(arm_2d_helper_pfb_t *ptThis)
 }
 
 static 
-void __arm_2d_helper_enqueue_pfb(arm_2d_helper_pfb_t *ptThis)
+void __arm_2d_helper_enqueue_pfb(arm_2d_helper_pfb_t *ptThis, 
+                                 arm_2d_pfb_t *ptPFB)
 {
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         ARM_LIST_QUEUE_ENQUEUE( this.Adapter.FlushFIFO.ptHead, 
                                 this.Adapter.FlushFIFO.ptTail, 
-                                this.Adapter.ptCurrent);
+                                ptPFB);
     }
     
     arm_2d_helper_pfb_flush(ptThis);
@@ -505,7 +643,7 @@ void __arm_2d_helper_pfb_report_rendering_complete( arm_2d_helper_pfb_t *ptThis,
      *       backward compatible.
      */
 
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         if (NULL == ptPFB) {
             ptPFB = this.Adapter.ptFlushing;
             this.Adapter.ptFlushing = NULL;
@@ -541,6 +679,22 @@ void __arm_2d_helper_pfb_report_rendering_complete( arm_2d_helper_pfb_t *ptThis,
     arm_2d_helper_pfb_flush(ptThis);
 }
 
+static
+void __arm_2d_helper_pfb_swap_rgb16(arm_2d_helper_pfb_t *ptThis, 
+                                    arm_2d_pfb_t *ptPFB)
+{
+    arm_2d_color_info_t tColourFormat = {
+        .u7ColourFormat = this.tCFG.FrameBuffer.u7ColourFormat,
+    };
+
+    /* swap the low and high byte for RGB565 and RGB16 */
+    if ((this.tCFG.FrameBuffer.bSwapRGB16)
+    &&  (tColourFormat.u3ColourSZ == ARM_2D_M_COLOUR_SZ_16BIT)) {
+        arm_2d_helper_swap_rgb16( ptPFB->tTile.phwBuffer, 
+                                  get_tile_buffer_pixel_count(ptPFB->tTile));
+    }
+}
+
 static
 void __arm_2d_helper_low_level_rendering(arm_2d_helper_pfb_t *ptThis)
 {
@@ -557,17 +711,7 @@ void __arm_2d_helper_low_level_rendering(arm_2d_helper_pfb_t *ptThis)
     };
 
     
-    arm_2d_color_info_t tColourFormat = {
-        .u7ColourFormat = this.tCFG.FrameBuffer.u7ColourFormat,
-    };
-
-    /* swap the low and high byte for RGB565 and RGB16 */
-    if ((this.tCFG.FrameBuffer.bSwapRGB16)
-    &&  (tColourFormat.u3ColourSZ == ARM_2D_M_COLOUR_SZ_16BIT)) {
-        arm_2d_helper_swap_rgb16( this.Adapter.ptCurrent->tTile.phwBuffer, 
-                                    get_tile_buffer_pixel_count(
-                                        this.Adapter.ptCurrent->tTile));
-    }
+    __arm_2d_helper_pfb_swap_rgb16(ptThis, this.Adapter.ptCurrent);
 
     /* handle screen rotation event */
     if (NULL != this.tCFG.Dependency.evtBeforeFlushing.fnHandler) {
@@ -591,7 +735,7 @@ void __arm_2d_helper_low_level_rendering(arm_2d_helper_pfb_t *ptThis)
         }
     }
 
-    __arm_2d_helper_enqueue_pfb(ptThis);
+    __arm_2d_helper_enqueue_pfb(ptThis, this.Adapter.ptCurrent);
 
     this.Adapter.bFirstIteration = false;
 
@@ -769,7 +913,7 @@ void arm_2d_helper_pfb_enable_dirty_region_optimization(
                                         uint_fast8_t chCount)
 {
     assert(NULL != ptThis);
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         this.Adapter.bEnableDirtyRegionOptimizationRequest = true;
         this.Adapter.bDisableDirtyRegionOptimizationRequest = false;
     }
@@ -793,12 +937,259 @@ void arm_2d_helper_pfb_disable_dirty_region_optimization(
 {
     assert(NULL != ptThis);
 
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         this.Adapter.bEnableDirtyRegionOptimizationRequest = false;
         this.Adapter.bDisableDirtyRegionOptimizationRequest = true;
     }
 }
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+/*----------------------------------------------------------------------------*
+ * Band-split Rendering                                                       *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(1)
+void arm_2d_helper_pfb_enable_band_split(arm_2d_helper_pfb_t *ptThis)
+{
+    assert(NULL != ptThis);
+
+    __arm_2d_helper_pfb_safe {
+        this.Adapter.Band.bEnabled = true;
+    }
+}
+
+ARM_NONNULL(1)
+void arm_2d_helper_pfb_disable_band_split(arm_2d_helper_pfb_t *ptThis)
+{
+    assert(NULL != ptThis);
+
+    __arm_2d_helper_pfb_safe {
+        this.Adapter.Band.bEnabled = false;
+    }
+}
+
+void __arm_2d_helper_pfb_band_init(void)
+{
+    s_tPFBBand.semJobAvailable = arm_2d_port_new_semaphore();
+}
+
+/*! 
+ * \brief hand over the current PFB to a band worker
+ * \retval true the PFB is taken by a band worker
+ * \retval false the PFB should be drawn by the PFB task
+ */
+ARM_NONNULL(1)
+static
+bool __arm_2d_helper_pfb_dispatch_band(arm_2d_helper_pfb_t *ptThis)
+{
+    /* NOTE: the states of a scene are updated in the first PFB of a frame 
+     *       (bIsNewFrame is true), hence it is always drawn by the PFB task
+     *       to avoid racing with the band workers.
+     */
+    if (    !this.Adapter.Band.bEnabled
+        ||  this.Adapter.bIsDryRun
+        ||  this.Adapter.bIsNewFrame
+        ||  this.tCFG.FrameBuffer.bDebugDirtyRegions
+        ||  (NULL != this.tCFG.Dependency.evtBeforeFlushing.fnHandler)
+        ||  (0 == s_tPFBBand.chWorkerCount)) {
+        return false;
+    }
+
+    arm_2d_pfb_t *ptPFB = this.Adapter.ptCurrent;
+    assert(NULL != ptPFB);
+
+    this.Adapter.Band.tDispatchedSize = ptPFB->tTile.tRegion.tSize;
+    this.Adapter.Band.bDispatched = true;
+
+    /* pass the location of the band to the worker */
+    ptPFB->tTile.tRegion.tLocation = (arm_2d_location_t) {
+        .iX = this.Adapter.tScanOffset.iX
+            + this.Adapter.tTargetRegion.tLocation.iX,
+        .iY = this.Adapter.tScanOffset.iY
+            + this.Adapter.tTargetRegion.tLocation.iY,
+    };
+
+    ARM_2D_LOG_INFO(
+        HELPER_PFB, 
+        1, 
+        "Band Split", 
+        "Dispatch PFB [%p] to band workers, x=%d y=%d w=%d h=%d",
+        (void *)ptPFB, 
+        ptPFB->tTile.tRegion.tLocation.iX,
+        ptPFB->tTile.tRegion.tLocation.iY,
+        ptPFB->tTile.tRegion.tSize.iWidth,
+        ptPFB->tTile.tRegion.tSize.iHeight
+    );
+
+    __arm_2d_helper_pfb_safe {
+        this.Adapter.Band.chInFlight++;
+        ARM_LIST_QUEUE_ENQUEUE( s_tPFBBand.JobFIFO.ptHead, 
+                                s_tPFBBand.JobFIFO.ptTail, 
+                                ptPFB);
+    }
+
+    arm_2d_port_set_semaphore(s_tPFBBand.semJobAvailable);
+
+    return true;
+}
+
+ARM_NONNULL(1,2)
+static
+void __arm_2d_helper_pfb_draw_band(arm_2d_helper_pfb_t *ptThis, 
+                                   arm_2d_pfb_t *ptPFB)
+{
+    arm_2d_location_t tLocation = ptPFB->tTile.tRegion.tLocation;
+    arm_fsm_rt_t tResult;
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    /* use the row of the band as the PFB index */
+    arm_2d_profiler_set_pfb_index(
+        (tLocation.iY - this.tCFG.tDisplayArea.tLocation.iY) 
+            / MAX(1, this.tCFG.FrameBuffer.tFrameSize.iHeight));
+#endif
+
+    /* the location of the root tile should be (0,0) during drawing */
+    ptPFB->tTile.tRegion.tLocation = (arm_2d_location_t) {0, 0};
+
+    arm_2d_region_t tVirtualScreenRegion = {
+        .tSize = this.tCFG.tDisplayArea.tSize,
+        .tLocation = {
+            .iX = -tLocation.iX,
+            .iY = -tLocation.iY,
+        },
+    };
+
+    arm_2d_tile_t tPFBTile;
+    arm_2d_tile_generate_child( &ptPFB->tTile, 
+                                &tVirtualScreenRegion, 
+                                &tPFBTile, 
+                                false);
+
+    tPFBTile.tInfo.bVirtualScreen = true;
+    tPFBTile.tInfo.tColourInfo.u7ColourFormat 
+        = this.tCFG.FrameBuffer.u7ColourFormat;
+    tPFBTile.tInfo.u3ExtensionID = ARM_2D_TILE_EXTENSION_PFB;
+    tPFBTile.tInfo.Extension.PFB.bIsDryRun = false;
+    tPFBTile.tInfo.Extension.PFB.bIsNewFrame = false;
+
+    if (!this.Adapter.bIgnoreCanvasColour) {
+
+        arm_2d_color_info_t tColourFormat = {
+            .u7ColourFormat = this.tCFG.FrameBuffer.u7ColourFormat,
+        };
+
+        arm_2d_helper_fill_tile_colour( &tPFBTile,
+                                        tColourFormat,
+                                        this.Adapter.tCanvas);
+    }
+
+    bool bReplayed = false;
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+    /* the list recorded in the first PFB is read-only during the band split */
+    if (    (NULL != this.Adapter.DisplayList.ptList)
+        &&  (DISPLAY_LIST_REPLAY == this.Adapter.DisplayList.chState)) {
+        bReplayed = arm_2d_display_list_replay( this.Adapter.DisplayList.ptList,
+                                                &tPFBTile);
+    }
+#endif
+
+    while(!bReplayed) {
+        tResult = this.tCFG.Dependency.evtOnDrawing.fnHandler(
+                                    this.tCFG.Dependency.evtOnDrawing.pTarget,
+                                    &tPFBTile,
+                                    false);
+        arm_2d_op_wait_async(NULL);
+
+        if (    (arm_fsm_rt_on_going != tResult)
+            &&  (arm_fsm_rt_wait_for_obj != tResult)) {
+            break;
+        }
+    }
+
+    if (    (NULL != this.tCFG.Dependency.Navigation.evtOnDrawing.fnHandler)
+        &&  (!this.Adapter.bHideNavigationLayer)) {
+        do {
+            tResult = this.tCFG.Dependency.Navigation.evtOnDrawing.fnHandler(
+                        this.tCFG.Dependency.Navigation.evtOnDrawing.pTarget,
+                        &tPFBTile,
+                        false);
+            arm_2d_op_wait_async(NULL);
+        } while(    (arm_fsm_rt_on_going == tResult)
+               ||   (arm_fsm_rt_wait_for_obj == tResult));
+    }
+
+    /* flush the band */
+    ptPFB->tTile.tRegion.tLocation = tLocation;
+    __arm_2d_helper_pfb_swap_rgb16(ptThis, ptPFB);
+    __arm_2d_helper_enqueue_pfb(ptThis, ptPFB);
+
+    __arm_2d_helper_pfb_safe {
+        this.Adapter.Band.chInFlight--;
+    }
+    arm_2d_port_set_semaphore(this.Adapter.Band.pBandComplete);
+}
+
+ARM_NONNULL(1)
+static
+void __arm_2d_helper_pfb_wait_for_bands(arm_2d_helper_pfb_t *ptThis)
+{
+    do {
+        uint_fast8_t chInFlight = 0;
+        __arm_2d_helper_pfb_safe {
+            chInFlight = this.Adapter.Band.chInFlight;
+        }
+
+        if (0 == chInFlight) {
+            break;
+        }
+
+        arm_2d_port_wait_for_semaphore(this.Adapter.Band.pBandComplete);
+    } while(true);
+}
+
+void arm_2d_helper_pfb_band_worker_task(uint_fast8_t chWorkerID)
+{
+    ARM_2D_UNUSED(chWorkerID);
+
+#if __ARM_2D_HAS_ASYNC__
+    /*! \note create a event flag and attach it to the default OP of this 
+     *!       worker 
+     */
+    arm_2d_op_attach_semaphore(NULL, arm_2d_port_new_semaphore());
+#endif
+
+    __arm_2d_helper_pfb_safe {
+        s_tPFBBand.chWorkerCount++;
+    }
+
+    do {
+        arm_2d_pfb_t *ptPFB = NULL;
+        bool bMoreJobs = false;
+
+        __arm_2d_helper_pfb_safe {
+            ARM_LIST_QUEUE_DEQUEUE( s_tPFBBand.JobFIFO.ptHead, 
+                                    s_tPFBBand.JobFIFO.ptTail, 
+                                    ptPFB);
+            bMoreJobs = (NULL != s_tPFBBand.JobFIFO.ptHead);
+        }
+
+        if (NULL == ptPFB) {
+            /* block current thread */
+            arm_2d_port_wait_for_semaphore(s_tPFBBand.semJobAvailable);
+            continue;
+        }
+
+        if (bMoreJobs) {
+            /* wake up another worker */
+            arm_2d_port_set_semaphore(s_tPFBBand.semJobAvailable);
+        }
+
+        __arm_2d_helper_pfb_draw_band(ptPFB->ptPFBHelper, ptPFB);
+    } while(true);
+}
+#endif
+
 
 ARM_NONNULL(1)
 static void __arm_2d_helper_dirty_region_pool_free(
@@ -822,7 +1213,7 @@ static void __arm_2d_helper_dirty_region_pool_free(
                     (void *)ptItem);
     } else {
 
-        arm_irq_safe {
+        __arm_2d_helper_pfb_safe {
             /* PUSH item to the pool in STACK-style */
             ptItem->ptInternalNext = this.Adapter.OptimizedDirtyRegions.ptFreeList;
             this.Adapter.OptimizedDirtyRegions.ptFreeList = ptItem;
@@ -847,7 +1238,7 @@ arm_2d_region_list_item_t *__arm_2d_helper_dirty_region_pool_new(
     assert(NULL != ptThis);
     arm_2d_region_list_item_t *ptItem = NULL;
     bool bFromHeap = false;
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         ptItem = this.Adapter.OptimizedDirtyRegions.ptFreeList;
         if (NULL != ptItem) {
             /* POP a dirty region item from the free list in STACK-style */
@@ -900,6 +1291,47 @@ arm_2d_region_list_item_t *__arm_2d_helper_dirty_region_pool_new(
     return ptItem;
 }
 
+ARM_NONNULL(1,2)
+static
+uint32_t __arm_2d_helper_get_dirty_region_grid_mask(arm_2d_helper_pfb_t *ptThis,
+                                                    const arm_2d_region_t *ptRegion)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptRegion);
+
+    int32_t nWidth = this.tCFG.tDisplayArea.tSize.iWidth;
+    int32_t nHeight = this.tCFG.tDisplayArea.tSize.iHeight;
+
+    if (nWidth <= 0 || nHeight <= 0) {
+        /* compare with all regions */
+        return UINT32_MAX;
+    }
+
+    /* inflate the region by 1 pixel, so adjacent regions share the same cell 
+     * and can be merged. 
+     * NOTE: the coordinates are clamped into the grid, hence regions outside
+     *       the screen share the cells on the border. 
+     */
+    int32_t nX0 = ptRegion->tLocation.iX - 1;
+    int32_t nY0 = ptRegion->tLocation.iY - 1;
+    int32_t nX1 = ptRegion->tLocation.iX + ptRegion->tSize.iWidth;
+    int32_t nY1 = ptRegion->tLocation.iY + ptRegion->tSize.iHeight;
+
+    nX0 = MAX(0, MIN(nX0, nWidth - 1)) * __DIRTY_REGION_GRID_COLUMNS / nWidth;
+    nX1 = MAX(0, MIN(nX1, nWidth - 1)) * __DIRTY_REGION_GRID_COLUMNS / nWidth;
+    nY0 = MAX(0, MIN(nY0, nHeight - 1)) * __DIRTY_REGION_GRID_ROWS / nHeight;
+    nY1 = MAX(0, MIN(nY1, nHeight - 1)) * __DIRTY_REGION_GRID_ROWS / nHeight;
+
+    uint32_t wRowMask = ((1ul << (nX1 + 1)) - 1ul) & ~((1ul << nX0) - 1ul);
+    uint32_t wMask = 0;
+
+    for (int32_t nRow = nY0; nRow <= nY1; nRow++) {
+        wMask |= wRowMask << (nRow * __DIRTY_REGION_GRID_COLUMNS);
+    }
+
+    return wMask;
+}
+
 ARM_NONNULL(1)
 static 
 void __arm_2d_helper_free_dirty_region_working_list(arm_2d_helper_pfb_t *ptThis, 
@@ -1132,6 +1564,8 @@ void __arm_2d_helper_update_dirty_region_working_list(
     assert(NULL != ptThis);
     assert(NULL != ptItem);
 
+    this.Statistics.DirtyRegionOptimization.hwInput++;
+
     do {
         arm_2d_region_list_item_t *ptDirtyRegion = ptItem;
 
@@ -1209,12 +1643,41 @@ label_move_to_next_candidate:
                 ptCandidate->tRegion.tSize.iHeight
             );
 
+            ptCandidate->wGridMask 
+                = __arm_2d_helper_get_dirty_region_grid_mask(ptThis, 
+                                                             &ptCandidate->tRegion);
+
             uint32_t wCandidatePixelCount = ptCandidate->tRegion.tSize.iHeight
                                             * ptCandidate->tRegion.tSize.iWidth;
             while(NULL != ptWorking) {
                 arm_2d_region_list_item_t *ptNextWorking = ptWorking->ptInternalNext;
                 arm_2d_region_t tEnclosureArea;
 
+                if (0 == (ptCandidate->wGridMask & ptWorking->wGridMask)) {
+                    /* far away from each other */
+                    ptWorking = ptNextWorking;
+                    continue;
+                }
+
+            #if __ARM_2D_HELPER_CFG_DIRTY_REGION_OPTIMIZATION_BUDGET__ > 0
+                if (this.Statistics.DirtyRegionOptimization.wComparison
+                >=  __ARM_2D_HELPER_CFG_DIRTY_REGION_OPTIMIZATION_BUDGET__) {
+                    /* run out of the budget in this frame, add the candidate 
+                     * to the working list directly. It is safe as overlapped
+                     * dirty regions are only refreshed more than once.
+                     */
+                    ARM_2D_LOG_INFO(
+                        DIRTY_REGION_OPTIMISATION, 
+                        2, 
+                        "UPDATE_WORKING_LIST", 
+                        "Run out of the optimization budget, skip the candidate [%p]", 
+                        (void *)ptCandidate
+                    );
+                    break;
+                }
+            #endif
+                this.Statistics.DirtyRegionOptimization.wComparison++;
+
                 ARM_2D_LOG_INFO(
                     DIRTY_REGION_OPTIMISATION, 
                     2, 
@@ -1803,6 +2266,132 @@ label_move_to_next_working:
 }
 
 
+/*! \brief move the scan offset to the first PFB of the target region
+ *  \note With FrameBuffer.u2ScanOrder, PFBs are issued in the raster order of
+ *        the rotated panel, i.e.
+ *        - 90 degree:  column by column from the left, bottom-up in a column
+ *        - 180 degree: row by row from the bottom, right-to-left in a row
+ *        - 270 degree: column by column from the right, top-down in a column
+ *  \param[in] ptThis the PFB helper control block
+ */
+static
+void __arm_2d_helper_pfb_scan_start(arm_2d_helper_pfb_t *ptThis)
+{
+    arm_2d_size_t tTargetSize = this.Adapter.tTargetRegion.tSize;
+    arm_2d_size_t tFrameSize = this.Adapter.tFrameSize;
+    uint_fast8_t chScanOrder = this.tCFG.FrameBuffer.u2ScanOrder;
+
+    this.Adapter.tScanOffset = (arm_2d_location_t){0, 0};
+
+    if (    (ARM_SCREEN_ROTATE_180 == chScanOrder)
+        ||  (ARM_SCREEN_ROTATE_270 == chScanOrder)) {
+        /* start from the last column */
+        this.Adapter.tScanOffset.iX
+            = ((tTargetSize.iWidth - 1) / tFrameSize.iWidth) * tFrameSize.iWidth;
+    }
+
+    if (    (ARM_SCREEN_ROTATE_90 == chScanOrder)
+        ||  (ARM_SCREEN_ROTATE_180 == chScanOrder)) {
+        /* start from the last row */
+        this.Adapter.tScanOffset.iY
+            = ((tTargetSize.iHeight - 1) / tFrameSize.iHeight) * tFrameSize.iHeight;
+    }
+}
+
+/*! \brief move the scan offset along one axis
+ *  \param[in,out] piOffset the offset on the axis
+ *  \param[in] iStep the PFB size on the axis
+ *  \param[in] iLength the size of the target region on the axis
+ *  \param[in] bReverse whether the axis is scanned backwards
+ *  \retval true the offset points to the next PFB
+ *  \retval false the axis is finished and the offset is rewound
+ */
+static
+bool __arm_2d_helper_pfb_scan_axis( int16_t *piOffset,
+                                    int16_t iStep,
+                                    int16_t iLength,
+                                    bool bReverse)
+{
+    if (bReverse) {
+        if (*piOffset <= 0) {
+            *piOffset = ((iLength - 1) / iStep) * iStep;
+            return false;
+        }
+        *piOffset -= iStep;
+        return true;
+    }
+
+    *piOffset += iStep;
+    if (*piOffset >= iLength) {
+        *piOffset = 0;
+        return false;
+    }
+    return true;
+}
+
+/*! \brief move the scan offset to the next PFB of the target region
+ *  \param[in] ptThis the PFB helper control block
+ *  \param[in] tPFBSize the size of the PFB that has just been drawn
+ *  \retval true the offset points to the next PFB
+ *  \retval false all PFBs of the target region have been issued
+ */
+static
+bool __arm_2d_helper_pfb_scan_next( arm_2d_helper_pfb_t *ptThis,
+                                    arm_2d_size_t tPFBSize)
+{
+    arm_2d_size_t tTargetSize = this.Adapter.tTargetRegion.tSize;
+    arm_2d_size_t tFrameSize = this.Adapter.tFrameSize;
+
+    switch (this.tCFG.FrameBuffer.u2ScanOrder) {
+        default:
+        case ARM_SCREEN_NO_ROTATION:
+            /* row by row from the top, left-to-right in a row */
+            if (__arm_2d_helper_pfb_scan_axis(  &this.Adapter.tScanOffset.iX,
+                                                tPFBSize.iWidth,
+                                                tTargetSize.iWidth,
+                                                false)) {
+                return true;
+            }
+            return __arm_2d_helper_pfb_scan_axis(   &this.Adapter.tScanOffset.iY,
+                                                    tPFBSize.iHeight,
+                                                    tTargetSize.iHeight,
+                                                    false);
+        case ARM_SCREEN_ROTATE_90:
+            if (__arm_2d_helper_pfb_scan_axis(  &this.Adapter.tScanOffset.iY,
+                                                tFrameSize.iHeight,
+                                                tTargetSize.iHeight,
+                                                true)) {
+                return true;
+            }
+            return __arm_2d_helper_pfb_scan_axis(   &this.Adapter.tScanOffset.iX,
+                                                    tPFBSize.iWidth,
+                                                    tTargetSize.iWidth,
+                                                    false);
+        case ARM_SCREEN_ROTATE_180:
+            if (__arm_2d_helper_pfb_scan_axis(  &this.Adapter.tScanOffset.iX,
+                                                tFrameSize.iWidth,
+                                                tTargetSize.iWidth,
+                                                true)) {
+                return true;
+            }
+            return __arm_2d_helper_pfb_scan_axis(   &this.Adapter.tScanOffset.iY,
+                                                    tFrameSize.iHeight,
+                                                    tTargetSize.iHeight,
+                                                    true);
+        case ARM_SCREEN_ROTATE_270:
+            if (__arm_2d_helper_pfb_scan_axis(  &this.Adapter.tScanOffset.iY,
+                                                tPFBSize.iHeight,
+                                                tTargetSize.iHeight,
+                                                false)) {
+                return true;
+            }
+            return __arm_2d_helper_pfb_scan_axis(   &this.Adapter.tScanOffset.iX,
+                                                    tFrameSize.iWidth,
+                                                    tTargetSize.iWidth,
+                                                    true);
+    }
+}
+
 /*! \brief begin a iteration of drawing and request a frame buffer from 
  *         low level display driver.
  *  \param[in] ptThis the PFB helper control block
@@ -1856,7 +2445,7 @@ label_iteration_begin_start:
                 "Entering this branch, usually means something went wrong. "
             );
 
-             arm_irq_safe {
+             __arm_2d_helper_pfb_safe {
                 /* allocating pfb only when the number of free PFB blocks is larger than
                 * the reserved threashold
                 */
@@ -1881,7 +2470,7 @@ label_iteration_begin_start:
             "Try to allocate a new PFB from the pool..."
         );
 
-        arm_irq_safe {
+        __arm_2d_helper_pfb_safe {
             /* allocating pfb only when the number of free PFB blocks is larger than
             * the reserved threashold
             */
@@ -1938,7 +2527,7 @@ label_iteration_begin_start:
                         );
                         
                         /* free pfb */
-                        arm_irq_safe {
+                        __arm_2d_helper_pfb_safe {
                             __arm_2d_helper_pfb_free(ptThis, this.Adapter.ptCurrent);
                             this.Adapter.ptCurrent = NULL;
                         }
@@ -1958,6 +2547,26 @@ label_iteration_begin_start:
                 this.Adapter.ptDirtyRegion = this.Adapter.OptimizedDirtyRegions.ptWorkingList;
                 this.Adapter.bIsUsingOptimizedDirtyRegionList = (NULL != this.Adapter.ptDirtyRegion);
 
+                do {
+                    uint_fast16_t hwCount = 0;
+                    arm_2d_region_list_item_t *ptItem = this.Adapter.ptDirtyRegion;
+                    while(NULL != ptItem) {
+                        hwCount++;
+                        ptItem = ptItem->ptInternalNext;
+                    }
+                    this.Statistics.DirtyRegionOptimization.hwOutput = hwCount;
+
+                    ARM_2D_LOG_INFO(
+                        DIRTY_REGION_OPTIMISATION, 
+                        0, 
+                        "Iteration Begin", 
+                        "Optimized %d dirty regions into %d with %d comparisons",
+                        this.Statistics.DirtyRegionOptimization.hwInput,
+                        this.Statistics.DirtyRegionOptimization.hwOutput,
+                        (int)this.Statistics.DirtyRegionOptimization.wComparison
+                    );
+                } while(0);
+
                 if (NULL == this.Adapter.ptDirtyRegion) {
                     assert(NULL != ptDirtyRegions);
 
@@ -1969,7 +2578,7 @@ label_iteration_begin_start:
                     );
 
                     /* free pfb */
-                    arm_irq_safe {
+                    __arm_2d_helper_pfb_safe {
                         __arm_2d_helper_pfb_free(ptThis, this.Adapter.ptCurrent);
                         this.Adapter.ptCurrent = NULL;
                     }
@@ -2114,7 +2723,7 @@ label_iteration_begin_start:
                     }
 
                     /* free pfb */
-                    arm_irq_safe {
+                    __arm_2d_helper_pfb_safe {
                         __arm_2d_helper_pfb_free(ptThis, this.Adapter.ptCurrent);
                         this.Adapter.ptCurrent = NULL;
                     }
@@ -2177,6 +2786,42 @@ label_iteration_begin_start:
                 // reset adapter frame size
                 this.Adapter.tFrameSize = this.tCFG.FrameBuffer.tFrameSize;
 
+            } else if ( (ARM_SCREEN_ROTATE_90 == this.tCFG.FrameBuffer.u2ScanOrder)
+                    ||  (ARM_SCREEN_ROTATE_270 == this.tCFG.FrameBuffer.u2ScanOrder)) {
+                /* a column of the screen is a row of the panel, hence use
+                 * PFBs as high as the target region
+                 */
+                uint32_t wPFBPixelCount = this.Adapter.wPFBPixelCount;
+
+                if (    this.Adapter.tTargetRegion.tSize.iHeight
+                    <   wPFBPixelCount) {
+                    // redefine the shape of PFB
+                    this.Adapter.tFrameSize.iHeight
+                        = this.Adapter.tTargetRegion.tSize.iHeight;
+
+                    int32_t nWidth = (int32_t)
+                        (   wPFBPixelCount
+                        /   (uint32_t)this.Adapter.tTargetRegion.tSize.iHeight);
+
+                    nWidth = MIN(nWidth, this.Adapter.tTargetRegion.tSize.iWidth);
+
+                    if (this.tCFG.FrameBuffer.u3PixelWidthAlign) {
+                        uint_fast8_t chPixelWidthAlignMask
+                            = (1 << this.tCFG.FrameBuffer.u3PixelWidthAlign)-1;
+
+                        nWidth &= ~chPixelWidthAlignMask;
+                    }
+
+                    if (0 == nWidth) {
+                        // reset adapter frame size
+                        this.Adapter.tFrameSize = this.tCFG.FrameBuffer.tFrameSize;
+                    } else {
+                        this.Adapter.tFrameSize.iWidth = (int16_t)nWidth;
+                    }
+                } else {
+                    // reset adapter frame size
+                    this.Adapter.tFrameSize = this.tCFG.FrameBuffer.tFrameSize;
+                }
             } else {
                 uint32_t wTargetPixelCount 
                     = this.Adapter.tTargetRegion.tSize.iWidth
@@ -2222,6 +2867,7 @@ label_iteration_begin_start:
                 }
             } 
 
+            __arm_2d_helper_pfb_scan_start(ptThis);
         }
         break;
     } while(true);
@@ -2435,34 +3081,28 @@ bool __arm_2d_helper_pfb_drawing_iteration_end(arm_2d_helper_pfb_t *ptThis)
         "End iteration in normal mode. Send PFB to display driver..."
     );
 
-    __arm_2d_helper_low_level_rendering(ptThis);
-    
-    arm_2d_tile_t *ptPartialFrameBuffer = &(this.Adapter.ptCurrent->tTile);
+    arm_2d_size_t tPFBSize;
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    if (this.Adapter.Band.bDispatched) {
+        /* the PFB has been handed over to a band worker */
+        this.Adapter.Band.bDispatched = false;
+        tPFBSize = this.Adapter.Band.tDispatchedSize;
+    } else
+#endif
+    {
+        __arm_2d_helper_low_level_rendering(ptThis);
+        tPFBSize = this.Adapter.ptCurrent->tTile.tRegion.tSize;
+    }
     
     if (!this.tCFG.FrameBuffer.bDoNOTUpdateDefaultFrameBuffer) {
         // update default frame buffer
         arm_2d_set_default_frame_buffer(NULL);
     }
 
-    this.Adapter.tScanOffset.iX 
-        += ptPartialFrameBuffer->tRegion.tSize.iWidth;
-
-    if (    this.Adapter.tScanOffset.iX 
-        >=  this.Adapter.tTargetRegion.tSize.iWidth) {
-
-        this.Adapter.tScanOffset.iX = 0;
-
-        this.Adapter.tScanOffset.iY 
-            += ptPartialFrameBuffer->tRegion.tSize.iHeight;
-        
-        if (    this.Adapter.tScanOffset.iY 
-            >=  this.Adapter.tTargetRegion.tSize.iHeight) {
-            // finished
-            this.Adapter.tScanOffset.iY = 0;
-
-            return __arm_2d_helper_pfb_get_next_dirty_region(ptThis);
-            
-        }
+    if (!__arm_2d_helper_pfb_scan_next(ptThis, tPFBSize)) {
+        // finished
+        return __arm_2d_helper_pfb_get_next_dirty_region(ptThis);
     }
 
     return true;
@@ -2550,7 +3190,7 @@ arm_2d_err_t arm_2d_helper_pfb_update_dependency(
     assert(NULL != ptThis);
     assert(NULL != ptDependency);
     
-    arm_irq_safe {
+    __arm_2d_helper_pfb_safe {
         if (chMask & ARM_2D_PFB_DEPEND_ON_LOW_LEVEL_RENDERING) {
             this.tCFG.Dependency.evtOnLowLevelRendering 
                 = ptDependency->evtOnLowLevelRendering;
@@ -2616,9 +3256,29 @@ ARM_PT_BEGIN(this.Adapter.chPT)
 
     this.Statistics.nTotalCycle = 0;
     this.Statistics.nRenderingCycle = 0;
+    this.Statistics.DirtyRegionOptimization.hwInput = 0;
+    this.Statistics.DirtyRegionOptimization.hwOutput = 0;
+    this.Statistics.DirtyRegionOptimization.wComparison = 0;
     this.Adapter.bIsNewFrame = true;
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    this.Adapter.chPFBIndex = 0;
+#endif
 
-    arm_irq_safe {
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+    if (NULL != this.Adapter.DisplayList.ptList) {
+        if (DISPLAY_LIST_RECORDING == this.Adapter.DisplayList.chState) {
+            /* the handler of the previous frame did not complete */
+            arm_2d_display_list_end_recording(this.Adapter.DisplayList.ptList);
+        }
+
+        /* record the drawing handler again in the new frame, the records
+         * are kept if the OPs are unchanged
+         */
+        this.Adapter.DisplayList.chState = DISPLAY_LIST_START;
+    }
+#endif
+
+    __arm_2d_helper_pfb_safe {
         if (this.Adapter.bEnableDirtyRegionOptimizationRequest) {
             this.Adapter.bEnableDirtyRegionOptimizationRequest = false;
             this.Adapter.bIsDirtyRegionOptimizationEnabled = true;
@@ -2724,6 +3384,14 @@ ARM_PT_BEGIN(this.Adapter.chPT)
             "Get a PFB"
         );
 
+    #if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+        if (__arm_2d_helper_pfb_dispatch_band(ptThis)) {
+            __arm_2d_helper_perf_counter_start( &this.Statistics.lTimestamp,
+                                                ARM_2D_PERFC_DRIVER); 
+            continue;   /* request the next PFB */
+        }
+    #endif
+
     ARM_PT_ENTRY()
         
         ARM_2D_LOG_INFO(
@@ -2738,6 +3406,10 @@ ARM_PT_BEGIN(this.Adapter.chPT)
 
         __arm_2d_helper_perf_counter_start( &this.Statistics.lTimestamp,
                                             ARM_2D_PERFC_RENDER);
+
+    #if __ARM_2D_CFG_SUPPORT_PROFILER__
+        arm_2d_profiler_set_pfb_index(this.Adapter.chPFBIndex);
+    #endif
         
         if (!this.Adapter.bIgnoreCanvasColour) {
 
@@ -2752,10 +3424,14 @@ ARM_PT_BEGIN(this.Adapter.chPT)
         }
 
         /* draw all the gui elements on target frame buffer */
+    #if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+        tResult = __arm_2d_helper_pfb_draw_display_list(ptThis);
+    #else
         tResult = this.tCFG.Dependency.evtOnDrawing.fnHandler(
                                         this.tCFG.Dependency.evtOnDrawing.pTarget,
                                         this.Adapter.ptFrameBuffer,
                                         this.Adapter.bIsNewFrame);
+    #endif
 
         // just in case some one forgot to do this...
         arm_2d_op_wait_async(NULL);
@@ -2867,6 +3543,9 @@ ARM_PT_BEGIN(this.Adapter.chPT)
         }
 
         this.Adapter.bIsNewFrame = false;
+    #if __ARM_2D_CFG_SUPPORT_PROFILER__
+        this.Adapter.chPFBIndex++;
+    #endif
         __arm_2d_helper_perf_counter_start( &this.Statistics.lTimestamp,
                                             ARM_2D_PERFC_DRIVER); 
     } while(__arm_2d_helper_pfb_drawing_iteration_end(ptThis));
@@ -2878,6 +3557,16 @@ label_pfb_task_rt_cpl:
 
 ARM_PT_END()
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    /* wait until all bands of this frame are drawn */
+    __arm_2d_helper_perf_counter_start( &this.Statistics.lTimestamp,
+                                        ARM_2D_PERFC_RENDER); 
+    __arm_2d_helper_pfb_wait_for_bands(ptThis);
+    this.Statistics.nTotalCycle += 
+        __arm_2d_helper_perf_counter_stop(  &this.Statistics.lTimestamp,
+                                            ARM_2D_PERFC_RENDER); 
+#endif
+
     if (this.Adapter.bIsDirtyRegionOptimizationEnabled) {
         ARM_2D_LOG_INFO(
             DIRTY_REGION_OPTIMISATION, 
@@ -3066,6 +3755,177 @@ void arm_2d_helper_3fb_report_dma_copy_complete(arm_2d_helper_3fb_t *ptThis)
     arm_2d_port_set_semaphore(this.Runtime.tSemaphore);
 }
 
+ARM_NONNULL(1)
+bool arm_2d_helper_3fb_report_2d_copy_complete(arm_2d_helper_3fb_t *ptThis)
+{
+    if (this.Runtime.bSynchronising) {
+        /* the 2D copy is issued by __arm_2d_helper_3fb_sync_fb() */
+        arm_2d_helper_3fb_report_dma_copy_complete(ptThis);
+        return false;
+    }
+
+    return true;
+}
+
+ARM_NONNULL(1)
+static void __arm_2d_helper_3fb_wait_for_copy(arm_2d_helper_3fb_t *ptThis)
+{
+    while(true) {
+        if (this.Runtime.bFBCopyComplete) {
+            break;
+        }
+        while(!arm_2d_port_wait_for_semaphore(this.Runtime.tSemaphore));
+    }
+}
+
+/*!
+ * \brief merge the overlapped regions in a list, so no pixel is copied twice
+ * \return uint_fast8_t the number of regions left
+ */
+ARM_NONNULL(1)
+static uint_fast8_t __arm_2d_helper_3fb_merge_regions(arm_2d_region_t *ptRegions,
+                                                      uint_fast8_t chCount)
+{
+    for (uint_fast8_t i = 0; i < chCount; i++) {
+        for (uint_fast8_t j = i + 1; j < chCount; j++) {
+            if (!arm_2d_region_intersect(&ptRegions[i], &ptRegions[j], NULL)) {
+                continue;
+            }
+            arm_2d_region_get_minimal_enclosure(&ptRegions[i],
+                                                &ptRegions[j],
+                                                &ptRegions[i]);
+            ptRegions[j] = ptRegions[--chCount];
+            j = i;      /* the enclosure may overlap others, check again */
+        }
+    }
+
+    return chCount;
+}
+
+ARM_NONNULL(1,2)
+static void __arm_2d_helper_3fb_add_damage(arm_2d_helper_3fb_t *ptThis,
+                                           const arm_2d_region_t *ptRegion)
+{
+    uint32_t wFrameNo = this.Runtime.wFrameNo;
+    arm_2d_region_t tRegions[ARM_2D_3FB_DAMAGE_REGION_COUNT + 1];
+    arm_2d_region_t tScreen = {
+        .tSize = this.tCFG.tScreenSize,
+    };
+    uint_fast8_t chCount = 0;
+
+    if (!arm_2d_region_intersect(&tScreen, ptRegion, &tRegions[0])) {
+        return ;
+    }
+
+    uint_fast8_t chSlot = wFrameNo % ARM_2D_3FB_DAMAGE_HISTORY_DEPTH;
+
+    if (this.Runtime.tDamage[chSlot].wFrameNo != wFrameNo) {
+        /* the first update in this frame */
+        this.Runtime.tDamage[chSlot].wFrameNo = wFrameNo;
+        this.Runtime.tDamage[chSlot].tRegions[0] = tRegions[0];
+        this.Runtime.tDamage[chSlot].chCount = 1;
+        return ;
+    }
+
+    chCount = this.Runtime.tDamage[chSlot].chCount;
+    tRegions[chCount] = tRegions[0];
+    memcpy( tRegions,
+            this.Runtime.tDamage[chSlot].tRegions,
+            sizeof(arm_2d_region_t) * chCount);
+
+    chCount = __arm_2d_helper_3fb_merge_regions(tRegions, chCount + 1);
+
+    if (chCount > ARM_2D_3FB_DAMAGE_REGION_COUNT) {
+        /* too many disjoint areas, use their minimal enclosure instead */
+        for (uint_fast8_t n = 1; n < chCount; n++) {
+            arm_2d_region_get_minimal_enclosure(&tRegions[0],
+                                                &tRegions[n],
+                                                &tRegions[0]);
+        }
+        chCount = 1;
+    }
+
+    memcpy( this.Runtime.tDamage[chSlot].tRegions,
+            tRegions,
+            sizeof(arm_2d_region_t) * chCount);
+    this.Runtime.tDamage[chSlot].chCount = (uint8_t)chCount;
+}
+
+/*!
+ * \brief bring the target FB up to date with the source FB
+ * \note Only the areas updated in the frames the target FB hasn't seen are
+ *       copied (with the 2D copy handler). A full-frame copy is used when 
+ *       those frames are no longer in the damage history.
+ */
+ARM_NONNULL(1)
+static void __arm_2d_helper_3fb_sync_fb(arm_2d_helper_3fb_t *ptThis,
+                                        uint_fast8_t chSource,
+                                        uint_fast8_t chTarget)
+{
+    uint32_t wTargetFrameNo = this.Runtime.wFBFrameNo[chTarget];
+    uint32_t wSourceFrameNo = this.Runtime.wFBFrameNo[chSource];
+    uint_fast8_t chBytePerPixel = this.tCFG.chPixelBits >> 3;
+
+    if ((wSourceFrameNo - wTargetFrameNo) > ARM_2D_3FB_DAMAGE_HISTORY_DEPTH) {
+        /* full-frame copy */
+        this.Runtime.bFBCopyComplete = false;
+        __arm_2d_helper_3fb_dma_copy(ptThis, 
+                                    this.tCFG.evtOnDMACopy.pObj,
+                                    this.tCFG.pnAddress[chSource],
+                                    this.tCFG.pnAddress[chTarget],
+                                    this.tCFG.tScreenSize.iWidth * this.tCFG.tScreenSize.iHeight,
+                                    chBytePerPixel);
+
+        __arm_2d_helper_3fb_wait_for_copy(ptThis);
+    } else {
+        arm_2d_region_t tRegions[  ARM_2D_3FB_DAMAGE_HISTORY_DEPTH
+                                *   ARM_2D_3FB_DAMAGE_REGION_COUNT];
+        uint_fast8_t chCount = 0;
+
+        /* collect the areas updated since the target FB was synchronised */
+        for (uint32_t wFrameNo = wTargetFrameNo + 1; 
+            wFrameNo != wSourceFrameNo + 1; 
+            wFrameNo++) {
+            uint_fast8_t chSlot = wFrameNo % ARM_2D_3FB_DAMAGE_HISTORY_DEPTH;
+            if (this.Runtime.tDamage[chSlot].wFrameNo != wFrameNo) {
+                continue;
+            }
+            for (uint_fast8_t n = 0; n < this.Runtime.tDamage[chSlot].chCount; n++) {
+                tRegions[chCount++] = this.Runtime.tDamage[chSlot].tRegions[n];
+            }
+        }
+
+        /* merge the overlapped areas to avoid copying the same pixels twice */
+        chCount = __arm_2d_helper_3fb_merge_regions(tRegions, chCount);
+
+        uint32_t wStrideInByte = chBytePerPixel * this.tCFG.tScreenSize.iWidth;
+
+        this.Runtime.bSynchronising = true;
+        for (uint_fast8_t n = 0; n < chCount; n++) {
+            uintptr_t nOffset = tRegions[n].tLocation.iY * wStrideInByte
+                              + tRegions[n].tLocation.iX * chBytePerPixel;
+
+            this.Runtime.bFBCopyComplete = false;
+            if (!this.tCFG.evtOn2DCopy.fnHandler(
+                                        ptThis,
+                                        this.tCFG.evtOn2DCopy.pObj,
+                                        this.tCFG.pnAddress[chSource] + nOffset,
+                                        wStrideInByte,
+                                        this.tCFG.pnAddress[chTarget] + nOffset,
+                                        wStrideInByte,
+                                        tRegions[n].tSize.iWidth,
+                                        tRegions[n].tSize.iHeight,
+                                        chBytePerPixel)) {
+                /* wait for arm_2d_helper_3fb_report_2d_copy_complete() */
+                __arm_2d_helper_3fb_wait_for_copy(ptThis);
+            }
+        }
+        this.Runtime.bSynchronising = false;
+    }
+
+    this.Runtime.wFBFrameNo[chTarget] = wSourceFrameNo;
+}
+
 
 
 ARM_NONNULL(1)
@@ -3120,6 +3980,8 @@ __arm_2d_helper_3fb_get_drawing_pointer(arm_2d_helper_3fb_t *ptThis, bool bIsNew
     bool bPrepareForCopy = false;
 
     if (bIsNewFrame) {
+        this.Runtime.wFrameNo++;
+
         arm_irq_safe {
 
             /* drawing: no */
@@ -3156,20 +4018,10 @@ __arm_2d_helper_3fb_get_drawing_pointer(arm_2d_helper_3fb_t *ptThis, bool bIsNew
 
         if (bPrepareForCopy) {
 
-            this.Runtime.bFBCopyComplete = false;
-            __arm_2d_helper_3fb_dma_copy(ptThis, 
-                                        this.tCFG.evtOnDMACopy.pObj,
-                                        this.tCFG.pnAddress[chDrawingIndex],
-                                        this.tCFG.pnAddress[chReadyToDrawIndex],
-                                        this.tCFG.tScreenSize.iWidth * this.tCFG.tScreenSize.iHeight,
-                                        this.tCFG.chPixelBits >> 3);
-
-            while(true) {
-                if (this.Runtime.bFBCopyComplete) {
-                    break;
-                }
-                while(!arm_2d_port_wait_for_semaphore(this.Runtime.tSemaphore));
-            }
+            /* only copy the areas the ready-to-draw FB hasn't seen */
+            __arm_2d_helper_3fb_sync_fb(ptThis, 
+                                        chDrawingIndex, 
+                                        chReadyToDrawIndex);
 
             /* update state and pointers */
             arm_irq_safe {
@@ -3185,6 +4037,13 @@ __arm_2d_helper_3fb_get_drawing_pointer(arm_2d_helper_3fb_t *ptThis, bool bIsNew
         }
     }
 
+    arm_irq_safe {
+        chDrawingIndex = this.Runtime.u2Drawing;
+    }
+    if (ARM_2D_3FB_INVALID_IDX != chDrawingIndex) {
+        this.Runtime.wFBFrameNo[chDrawingIndex] = this.Runtime.wFrameNo;
+    }
+
     return pnAddress;
 }
 
@@ -3207,6 +4066,36 @@ bool __arm_2d_helper_3fb_draw_bitmap( arm_2d_helper_3fb_t *ptThis,
     uint_fast8_t chBytePerPixel = this.tCFG.chPixelBits >> 3;
     uint32_t wLCDStrideInByte = chBytePerPixel * iLCDWidth;
 
+    if (ARM_SCREEN_NO_ROTATION != this.tCFG.tRotation) {
+        /* rotate the PFB while copying it to the drawing frame-buffer */
+        arm_2d_size_t tScreenSize = this.tCFG.tScreenSize;
+        if (ARM_SCREEN_ROTATE_180 != this.tCFG.tRotation) {
+            tScreenSize.iWidth = iLCDHeight;
+            tScreenSize.iHeight = iLCDWidth;
+        }
+
+        arm_2d_region_t tPanelRegion = arm_2d_helper_pfb_get_rotated_region(
+                                                    &ptPFB->tTile.tRegion,
+                                                    this.tCFG.tRotation,
+                                                    &tScreenSize);
+        assert(tPanelRegion.tLocation.iX >= 0);
+        assert(tPanelRegion.tLocation.iY >= 0);
+        assert(tPanelRegion.tLocation.iX + tPanelRegion.tSize.iWidth <= iLCDWidth);
+        assert(tPanelRegion.tLocation.iY + tPanelRegion.tSize.iHeight <= iLCDHeight);
+
+        __arm_2d_helper_3fb_add_damage(ptThis, &tPanelRegion);
+
+        arm_2d_helper_pfb_copy_rotated(
+                ptPFB,
+                this.tCFG.tRotation,
+                (void *)(   pnAddress
+                        +   (   tPanelRegion.tLocation.iY * iLCDWidth
+                            +   tPanelRegion.tLocation.iX) * chBytePerPixel),
+                iLCDWidth);
+
+        return true;
+    }
+
     int16_t iX = ptPFB->tTile.tRegion.tLocation.iX;
     int16_t iY = ptPFB->tTile.tRegion.tLocation.iY;
     int16_t iPFBWidth = ptPFB->tTile.tRegion.tSize.iWidth;
@@ -3221,6 +4110,12 @@ bool __arm_2d_helper_3fb_draw_bitmap( arm_2d_helper_3fb_t *ptThis,
     int16_t iHeight = MIN(iPFBHeight, iLCDHeight);
     int16_t iWidth = MIN(iPFBWidth, iLCDWidth);
 
+    __arm_2d_helper_3fb_add_damage(ptThis, 
+                                   &(arm_2d_region_t) {
+                                        .tLocation = {iX, iY},
+                                        .tSize = {iWidth, iHeight},
+                                   });
+
     return this.tCFG.evtOn2DCopy.fnHandler(ptThis,
                                             this.tCFG.evtOnDMACopy.pObj,
                                             pnSource,
@@ -3291,7 +4186,10 @@ void __arm_2d_rotate_90_rgb16(  uint16_t * __restrict phwOrigin,
     }
 #else
 
-    if ((0 == (iOriginWidth & 0x3)) && (0 == (iOutputWidth & 0x3))) {
+    if (    (0 == (iOriginWidth & 0x3))
+        &&  (0 == (iOriginHeight & 0x3))
+        &&  (0 == (iOutputWidth & 0x3))
+        &&  (0 == ((uintptr_t)phwOutput & 0x3))) {
         int_fast16_t iOriginY = iOriginHeight;
         uint16_t * __restrict phwDesColumnStart = phwOutput + (iOriginHeight - 1);
 
@@ -3811,6 +4709,157 @@ arm_2d_pfb_t * __arm_2d_helper_pfb_rotate180_rgb32( arm_2d_pfb_t *ptOrigin,
     return ptScratch;
 }
 
+/*----------------------------------------------------------------------------*
+ * Rotated Copy                                                               *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(1,3)
+arm_2d_region_t arm_2d_helper_pfb_get_rotated_region(
+                                        const arm_2d_region_t *ptRegion,
+                                        arm_2d_screen_rotation_t tRotation,
+                                        const arm_2d_size_t *ptScreenSize)
+{
+    assert(NULL != ptRegion);
+    assert(NULL != ptScreenSize);
+
+    int16_t iX = ptRegion->tLocation.iX;
+    int16_t iY = ptRegion->tLocation.iY;
+    int16_t iWidth = ptRegion->tSize.iWidth;
+    int16_t iHeight = ptRegion->tSize.iHeight;
+
+    switch (tRotation) {
+        case ARM_SCREEN_ROTATE_90:
+            return (arm_2d_region_t) {
+                .tLocation = {
+                    ptScreenSize->iHeight - (iY + iHeight - 1) - 1,
+                    iX,
+                },
+                .tSize = {iHeight, iWidth},
+            };
+        case ARM_SCREEN_ROTATE_180:
+            return (arm_2d_region_t) {
+                .tLocation = {
+                    ptScreenSize->iWidth - (iX + iWidth - 1) - 1,
+                    ptScreenSize->iHeight - (iY + iHeight - 1) - 1,
+                },
+                .tSize = {iWidth, iHeight},
+            };
+        case ARM_SCREEN_ROTATE_270:
+            return (arm_2d_region_t) {
+                .tLocation = {
+                    iY,
+                    ptScreenSize->iWidth - (iX + iWidth - 1) - 1,
+                },
+                .tSize = {iHeight, iWidth},
+            };
+        default:
+            return *ptRegion;
+    }
+}
+
+ARM_NONNULL(1,3)
+void arm_2d_helper_pfb_copy_rotated(const arm_2d_pfb_t *ptPFB,
+                                    arm_2d_screen_rotation_t tRotation,
+                                    void *pTarget,
+                                    int16_t iTargetStride)
+{
+    assert(NULL != ptPFB);
+    assert(NULL != pTarget);
+
+    int16_t iWidth = ptPFB->tTile.tRegion.tSize.iWidth;
+    int16_t iHeight = ptPFB->tTile.tRegion.tSize.iHeight;
+    arm_2d_size_t tSize = {iWidth, iHeight};
+
+    /* the colour format of a PFB is saved in the PFB rather than its tile */
+    arm_2d_color_info_t tColourInfo = {
+        .u7ColourFormat = ptPFB->u7ColourFormat,
+    };
+
+    switch (tColourInfo.u3ColourSZ) {
+        case ARM_2D_COLOUR_SZ_8BIT: {
+            uint8_t *pchOrigin = ptPFB->tTile.pchBuffer;
+            uint8_t *pchTarget = (uint8_t *)pTarget;
+
+            switch (tRotation) {
+                case ARM_SCREEN_ROTATE_90:
+                    __arm_2d_rotate_90_c8bit(pchOrigin, pchTarget,
+                                             iWidth, iHeight, iTargetStride);
+                    break;
+                case ARM_SCREEN_ROTATE_180:
+                    __arm_2d_impl_c8bit_copy_xy_mirror(pchOrigin, iWidth,
+                                                       pchTarget, iTargetStride,
+                                                       &tSize);
+                    break;
+                case ARM_SCREEN_ROTATE_270:
+                    __arm_2d_rotate_270_c8bit(pchOrigin, pchTarget,
+                                              iWidth, iHeight, iTargetStride);
+                    break;
+                default:
+                    __arm_2d_impl_c8bit_copy(pchOrigin, iWidth,
+                                             pchTarget, iTargetStride,
+                                             &tSize);
+                    break;
+            }
+            break;
+        }
+        case ARM_2D_COLOUR_SZ_16BIT: {
+            uint16_t *phwOrigin = ptPFB->tTile.phwBuffer;
+            uint16_t *phwTarget = (uint16_t *)pTarget;
+
+            switch (tRotation) {
+                case ARM_SCREEN_ROTATE_90:
+                    __arm_2d_rotate_90_rgb16(phwOrigin, phwTarget,
+                                             iWidth, iHeight, iTargetStride);
+                    break;
+                case ARM_SCREEN_ROTATE_180:
+                    __arm_2d_impl_rgb16_copy_xy_mirror(phwOrigin, iWidth,
+                                                       phwTarget, iTargetStride,
+                                                       &tSize);
+                    break;
+                case ARM_SCREEN_ROTATE_270:
+                    __arm_2d_rotate_270_rgb16(phwOrigin, phwTarget,
+                                              iWidth, iHeight, iTargetStride);
+                    break;
+                default:
+                    __arm_2d_impl_rgb16_copy(phwOrigin, iWidth,
+                                             phwTarget, iTargetStride,
+                                             &tSize);
+                    break;
+            }
+            break;
+        }
+        case ARM_2D_COLOUR_SZ_32BIT: {
+            uint32_t *pwOrigin = ptPFB->tTile.pwBuffer;
+            uint32_t *pwTarget = (uint32_t *)pTarget;
+
+            switch (tRotation) {
+                case ARM_SCREEN_ROTATE_90:
+                    __arm_2d_rotate_90_rgb32(pwOrigin, pwTarget,
+                                             iWidth, iHeight, iTargetStride);
+                    break;
+                case ARM_SCREEN_ROTATE_180:
+                    __arm_2d_impl_rgb32_copy_xy_mirror(pwOrigin, iWidth,
+                                                       pwTarget, iTargetStride,
+                                                       &tSize);
+                    break;
+                case ARM_SCREEN_ROTATE_270:
+                    __arm_2d_rotate_270_rgb32(pwOrigin, pwTarget,
+                                              iWidth, iHeight, iTargetStride);
+                    break;
+                default:
+                    __arm_2d_impl_rgb32_copy(pwOrigin, iWidth,
+                                             pwTarget, iTargetStride,
+                                             &tSize);
+                    break;
+            }
+            break;
+        }
+        default:
+            assert(false);  /* unsupported colour size */
+            break;
+    }
+}
+
 /*----------------------------------------------------------------------------*
  * API for Dirty Region List                                                  *
  *----------------------------------------------------------------------------*/
@@ -4864,6 +5913,13 @@ bool arm_2d_helper_pfb_is_region_being_drawing(
                                                     false)) {
             bResult = true;
         }
+
+    #if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+        if (arm_2d_display_list_is_recording()) {
+            /* the display list should contain all the OPs of a frame */
+            bResult = true;
+        }
+    #endif
     } while(0);
 
     return bResult;
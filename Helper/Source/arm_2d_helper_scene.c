@@ -1105,6 +1105,10 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
     
     int16_t iTargetDistance = 0;
     int16_t iOffset = 0;
+
+    /* use local tiles, so the band workers can run this drawer in parallel */
+    arm_2d_tile_t tSceneWindow;
+    arm_2d_tile_t tTemp;
     
     switch(this.Switch.tConfig.Feature.chMode) {
         case ARM_2D_SCENE_SWITCH_CFG_ERASE_LEFT:
@@ -1119,11 +1123,16 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
             assert(false);      /* this should not happen */
     }
 
-    this.Runtime.bCallOldSceneFrameCPL = false;
-    this.Runtime.bCallNewSceneFrameCPL = false;
+    /* the runtime flags are only updated in the first PFB of a frame, i.e. 
+     * before the band workers start 
+     */
+    if (bIsNewFrame) {
+        this.Runtime.bCallOldSceneFrameCPL = false;
+        this.Runtime.bCallNewSceneFrameCPL = false;
 
-    this.Runtime.bCallOldSceneBGCPL = false;
-    this.Runtime.bCallNewSceneBGCPL = false;
+        this.Runtime.bCallOldSceneBGCPL = false;
+        this.Runtime.bCallNewSceneBGCPL = false;
+    }
 
     /* internal statemachine */
     if (bIsNewFrame) {
@@ -1213,16 +1222,16 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
                 tWindow.tSize.iWidth -= iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
                 if (NULL == ptWindow) {
                     break;
                 }
 
                 tWindow.tSize.iWidth = iTargetDistance;
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
             case ARM_2D_SCENE_SWITCH_CFG_ERASE_RIGHT:
@@ -1231,32 +1240,32 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
 
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
                 if (NULL == ptWindow) {
                     break;
                 }
                 tWindow.tSize.iWidth = iTargetDistance;
                 tWindow.tLocation.iX = -iOffset;
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
             case ARM_2D_SCENE_SWITCH_CFG_ERASE_UP:
                 tWindow.tSize.iHeight -= iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
                 if (NULL == ptWindow) {
                     break;
                 }
 
                 tWindow.tSize.iHeight = iTargetDistance;
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1266,7 +1275,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
 
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
 
                 if (NULL == ptWindow) {
@@ -1275,9 +1284,9 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
 
                 tWindow.tSize.iHeight = iTargetDistance;
                 tWindow.tLocation.iY = -iOffset;
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1290,12 +1299,14 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
 
         if (NULL != ptWindow) {
 
-            this.Runtime.bCallOldSceneFrameCPL = true;
-            this.Runtime.bCallOldSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreOldSceneBG;
+            if (bIsNewFrame) {
+                this.Runtime.bCallOldSceneFrameCPL = true;
+                this.Runtime.bCallOldSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreOldSceneBG;
+            }
 
             __draw_erase_scene( ptThis, 
                                 ptScene, 
-                                &this.Switch.Erase.tSceneWindow, 
+                                &tSceneWindow, 
                                 bIsNewFrame,
                                 this.Switch.tConfig.Feature.bIgnoreOldSceneBG,
                                 this.Switch.tConfig.Feature.bIgnoreOldScene);
@@ -1316,7 +1327,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
 
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
                 if (NULL == ptWindow) {
                     break;
@@ -1324,9 +1335,9 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
                                             
                 tWindow.tSize.iWidth = iTargetDistance;
                 tWindow.tLocation.iX = -(iTargetDistance - iOffset);
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1334,16 +1345,16 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
                 tWindow.tSize.iWidth = iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
                 if (NULL == ptWindow) {
                     break;
                 }
 
                 tWindow.tSize.iWidth = iTargetDistance;
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1353,7 +1364,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
 
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
                 if (NULL == ptWindow) {
                     break;
@@ -1361,9 +1372,9 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
 
                 tWindow.tSize.iHeight = iTargetDistance;
                 tWindow.tLocation.iY = -(iTargetDistance - iOffset);
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1371,7 +1382,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
                 tWindow.tSize.iHeight = iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tTemp, 
+                                                        &tTemp, 
                                                         false);
 
                 if (NULL == ptWindow) {
@@ -1379,9 +1390,9 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
                 }
 
                 tWindow.tSize.iHeight = iTargetDistance;
-                ptWindow = arm_2d_tile_generate_child(  &this.Switch.Erase.tTemp, 
+                ptWindow = arm_2d_tile_generate_child(  &tTemp, 
                                                         &tWindow, 
-                                                        &this.Switch.Erase.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
             default:
@@ -1393,12 +1404,14 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_erase)
         
         if (NULL != ptWindow) {
 
-            this.Runtime.bCallNewSceneFrameCPL = true;
-            this.Runtime.bCallNewSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreNewSceneBG;
+            if (bIsNewFrame) {
+                this.Runtime.bCallNewSceneFrameCPL = true;
+                this.Runtime.bCallNewSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreNewSceneBG;
+            }
 
             __draw_erase_scene( ptThis, 
                                 ptScene, 
-                                &this.Switch.Erase.tSceneWindow, 
+                                &tSceneWindow, 
                                 bIsNewFrame,
                                 this.Switch.tConfig.Feature.bIgnoreNewSceneBG,
                                 this.Switch.tConfig.Feature.bIgnoreNewScene);
@@ -1428,6 +1441,9 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
     
     int16_t iTargetDistance = 0;
     //int16_t iOffset = 0;
+
+    /* use a local tile, so the band workers can run this drawer in parallel */
+    arm_2d_tile_t tSceneWindow;
     
     switch(this.Switch.tConfig.Feature.chMode) {
         case ARM_2D_SCENE_SWITCH_CFG_SLIDE_LEFT:
@@ -1442,11 +1458,16 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
             assert(false);      /* this should not happen */
     }
 
-    this.Runtime.bCallOldSceneFrameCPL = false;
-    this.Runtime.bCallNewSceneFrameCPL = false;
+    /* the runtime flags are only updated in the first PFB of a frame, i.e. 
+     * before the band workers start 
+     */
+    if (bIsNewFrame) {
+        this.Runtime.bCallOldSceneFrameCPL = false;
+        this.Runtime.bCallNewSceneFrameCPL = false;
 
-    this.Runtime.bCallOldSceneBGCPL = false;
-    this.Runtime.bCallNewSceneBGCPL = false;
+        this.Runtime.bCallOldSceneBGCPL = false;
+        this.Runtime.bCallNewSceneBGCPL = false;
+    }
     
     /* internal statemachine */
     if (bIsNewFrame) {
@@ -1539,21 +1560,21 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
                 tWindow.tLocation.iX = -this.Switch.Slide.iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
             case ARM_2D_SCENE_SWITCH_CFG_SLIDE_RIGHT:
                 tWindow.tLocation.iX = this.Switch.Slide.iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
             case ARM_2D_SCENE_SWITCH_CFG_SLIDE_UP:
                 tWindow.tLocation.iY = -this.Switch.Slide.iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1561,7 +1582,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
                 tWindow.tLocation.iY = this.Switch.Slide.iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1574,12 +1595,14 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
 
         if (NULL != ptWindow) {
         
-            this.Runtime.bCallOldSceneFrameCPL = true;
-            this.Runtime.bCallOldSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreOldSceneBG;
+            if (bIsNewFrame) {
+                this.Runtime.bCallOldSceneFrameCPL = true;
+                this.Runtime.bCallOldSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreOldSceneBG;
+            }
 
             __draw_erase_scene( ptThis, 
                                 ptScene, 
-                                &this.Switch.Slide.tSceneWindow, 
+                                &tSceneWindow, 
                                 bIsNewFrame,
                                 this.Switch.tConfig.Feature.bIgnoreOldSceneBG,
                                 this.Switch.tConfig.Feature.bIgnoreOldScene);
@@ -1597,7 +1620,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
                 tWindow.tLocation.iX = iTargetDistance - this.Switch.Slide.iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1605,7 +1628,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
                 tWindow.tLocation.iX = -(iTargetDistance - this.Switch.Slide.iOffset);
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1613,7 +1636,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
                 tWindow.tLocation.iY = iTargetDistance - this.Switch.Slide.iOffset;
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
 
@@ -1621,7 +1644,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
                 tWindow.tLocation.iY = -(iTargetDistance - this.Switch.Slide.iOffset);
                 ptWindow = arm_2d_tile_generate_child(  ptTile, 
                                                         &tWindow, 
-                                                        &this.Switch.Slide.tSceneWindow, 
+                                                        &tSceneWindow, 
                                                         false);
                 break;
             default:
@@ -1633,12 +1656,14 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
         
         if (ptWindow) {
 
-            this.Runtime.bCallNewSceneFrameCPL = true;
-            this.Runtime.bCallNewSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreNewSceneBG;
+            if (bIsNewFrame) {
+                this.Runtime.bCallNewSceneFrameCPL = true;
+                this.Runtime.bCallNewSceneBGCPL = !this.Switch.tConfig.Feature.bIgnoreNewSceneBG;
+            }
 
             __draw_erase_scene( ptThis, 
                                 ptScene, 
-                                &this.Switch.Slide.tSceneWindow, 
+                                &tSceneWindow, 
                                 bIsNewFrame,
                                 this.Switch.tConfig.Feature.bIgnoreNewSceneBG,
                                 this.Switch.tConfig.Feature.bIgnoreNewScene);
@@ -1651,6 +1676,42 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_mode_slide)
     return arm_fsm_rt_cpl;
 }
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+/*!
+ * \brief check whether the band workers can draw the scene switching
+ * \note the built-in switching drawers only update their states in the first 
+ *       PFB of a frame, hence it depends on the scenes being switched and the
+ *       default background
+ */
+ARM_NONNULL(1)
+static 
+bool __arm_2d_scene_player_is_switching_reentrant(arm_2d_scene_player_t *ptThis)
+{
+    /* the user switching drawer might not be re-entrant */
+    if (&__pfb_draw_scene_mode_user == this.Switch.ptMode->fnSwitchDrawer) {
+        return false;
+    }
+
+    /* the user default background might not be re-entrant */
+    if (this.Switch.tConfig.Feature.u2DefaultBG >= 2) {
+        return false;
+    }
+
+    arm_2d_scene_t *ptScene = this.SceneFIFO.ptHead;
+    if (NULL != ptScene) {
+        if (!ptScene->bReentrantDrawing) {
+            return false;
+        }
+        ptScene = ptScene->ptNext;
+        if ((NULL != ptScene) && !ptScene->bReentrantDrawing) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
 static
 IMPL_PFB_ON_DRAW(__pfb_draw_scene_background_handler)
 {
@@ -1760,6 +1821,17 @@ arm_fsm_rt_t arm_2d_scene_player_task(arm_2d_scene_player_t *ptThis)
         case DRAW_FRAME_START:
             ARM_2D_INVOKE_RT_VOID(ptScene->fnOnFrameStart, ptScene);
 
+        #if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+            /* only the scenes with re-entrant drawing handlers are drawn in bands */
+            if (ptScene->bReentrantDrawing) {
+                arm_2d_helper_pfb_enable_band_split(
+                                            &this.use_as__arm_2d_helper_pfb_t);
+            } else {
+                arm_2d_helper_pfb_disable_band_split(
+                                            &this.use_as__arm_2d_helper_pfb_t);
+            }
+        #endif
+
             if (ptScene->bUseDirtyRegionHelper) {
                 arm_2d_helper_dirty_region_on_frame_start(&ptScene->tDirtyRegionHelper);
             }
@@ -1912,6 +1984,16 @@ arm_fsm_rt_t arm_2d_scene_player_task(arm_2d_scene_player_t *ptThis)
                 __arm_2d_helper_pfb_disable_drawing_canvas_colour(
                                             &this.use_as__arm_2d_helper_pfb_t);
 
+            #if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+                if (__arm_2d_scene_player_is_switching_reentrant(ptThis)) {
+                    arm_2d_helper_pfb_enable_band_split(
+                                            &this.use_as__arm_2d_helper_pfb_t);
+                } else {
+                    arm_2d_helper_pfb_disable_band_split(
+                                            &this.use_as__arm_2d_helper_pfb_t);
+                }
+            #endif
+
                 /* update drawer */
                 ARM_2D_HELPER_PFB_UPDATE_ON_DRAW_HANDLER(
                     &this.use_as__arm_2d_helper_pfb_t,
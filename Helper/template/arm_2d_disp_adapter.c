@@ -91,8 +91,56 @@
 
 #endif
 
+#if     __DISP%Instance%_CFG_VIRTUAL_RESOURCE_HELPER__                          \
+    &&  __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+/* the number of bytes in one line of a cache block */
+#   define __DISP%Instance%_VRES_CACHE_LINE_SIZE__                              \
+            (   __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_WIDTH__       \
+            *   (__DISP%Instance%_CFG_COLOUR_DEPTH__ >> 3))
+
+#   define __DISP%Instance%_VRES_CACHE_BLOCK_SIZE__                             \
+            (   __DISP%Instance%_VRES_CACHE_LINE_SIZE__                         \
+            *   __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_HEIGHT__)
+
+#   define __DISP%Instance%_VRES_CACHE_BLOCK_COUNT__                            \
+            (   __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__              \
+            /   __DISP%Instance%_VRES_CACHE_BLOCK_SIZE__)
+
+#   if __DISP%Instance%_VRES_CACHE_BLOCK_COUNT__ < 1
+#       error The virtual resource cache is smaller than one block, please \
+increase __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ or reduce the block size.
+#   endif
+#endif
+
+/* Without the 3FB helper service, the asynchronous flushing rotates PFBs into
+ * a scratch PFB, as the rotated content must stay valid until the flushing is
+ * complete. The synchronous flushing rotates PFBs strip by strip instead.
+ */
+#if     __DISP%Instance%_CFG_ROTATE_SCREEN__                                    \
+    &&  !__DISP%Instance%_CFG_ENABLE_3FB_HELPER_SERVICE__                       \
+    &&  __DISP%Instance%_CFG_ENABLE_ASYNC_FLUSHING__
+#   define __DISP%Instance%_ROTATE_WITH_SCRATCH_PFB__   1
+#else
+#   define __DISP%Instance%_ROTATE_WITH_SCRATCH_PFB__   0
+#endif
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
+
+#if     __DISP%Instance%_CFG_VIRTUAL_RESOURCE_HELPER__                          \
+    &&  __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+typedef struct __disp_adapter%Instance%_vres_cache_block_t {
+    uintptr_t   pAsset;                 /* the asset address in external memory */
+    int16_t     iAssetWidth;
+    int16_t     iBlockX;
+    int16_t     iBlockY;
+    uint8_t     chPixelSize;
+    bool        bValid;
+    bool        bLoading;               /* the content is still being read */
+    uint8_t     chPinCount;             /* the number of threads copying it */
+    uint32_t    wLastUsed;
+} __disp_adapter%Instance%_vres_cache_block_t;
+#endif
 /*============================ GLOBAL VARIABLES ==============================*/
 extern uint32_t SystemCoreClock;
 
@@ -142,6 +190,19 @@ struct {
 } DISP%Instance%_CONSOLE;
 #endif
 
+#if     __DISP%Instance%_CFG_VIRTUAL_RESOURCE_HELPER__                          \
+    &&  __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+static
+struct {
+    __disp_adapter%Instance%_vres_cache_block_t 
+                tBlocks[__DISP%Instance%_VRES_CACHE_BLOCK_COUNT__];
+    uint32_t    wTick;
+    disp_adapter%Instance%_vres_cache_statistics_t Statistics;
+    uint32_t    wBuffer[__DISP%Instance%_VRES_CACHE_BLOCK_COUNT__]
+                       [(__DISP%Instance%_VRES_CACHE_BLOCK_SIZE__ + 3) >> 2];
+} s_tVRESCache;
+#endif
+
 /*============================ IMPLEMENTATION ================================*/
 static void __on_frame_start(arm_2d_scene_t *ptScene)
 {
@@ -391,8 +452,10 @@ void *disp_adapter%Instance%_3fb_get_flush_pointer(void)
 
 void disp_adapter%Instance%_insert_2d_copy_complete_event_handler(void)
 {
-    arm_2d_helper_pfb_report_rendering_complete(
-                    &DISP%Instance%_ADAPTER.use_as__arm_2d_helper_pfb_t);
+    if (arm_2d_helper_3fb_report_2d_copy_complete(&s_tDirectModeHelper)) {
+        arm_2d_helper_pfb_report_rendering_complete(
+                        &DISP%Instance%_ADAPTER.use_as__arm_2d_helper_pfb_t);
+    }
 }
 
 /* using asynchronous flushing, e.g. using DMA + ISR to offload CPU etc. 
@@ -456,11 +519,62 @@ IMPL_PFB_ON_LOW_LV_RENDERING(__disp_adapter%Instance%_pfb_render_handler)
     ARM_2D_PARAM(pTarget);
     ARM_2D_PARAM(bIsNewFrame);
 
+#if __DISP%Instance%_CFG_ROTATE_SCREEN__
+    /* rotate the PFB strip by strip while flushing it, so neither an extra
+     * PFB nor a second pass over the PFB is required
+     */
+    static uint32_t s_wRotationStrip[
+                    (   __DISP%Instance%_CFG_SCEEN_WIDTH__
+                    *   __DISP%Instance%_CFG_ROTATION_STRIP_LINES__
+                    *   sizeof(COLOUR_INT) + 3) / 4];
+
+    const arm_2d_size_t c_tScreenSize = {
+        __DISP%Instance%_CFG_SCEEN_WIDTH__,
+        __DISP%Instance%_CFG_SCEEN_HEIGHT__,
+    };
+    const arm_2d_screen_rotation_t c_tRotation
+        = (arm_2d_screen_rotation_t)__DISP%Instance%_CFG_ROTATE_SCREEN__;
+
+    int16_t iWidth = ptTile->tRegion.tSize.iWidth;
+    int16_t iHeight = ptTile->tRegion.tSize.iHeight;
+    int16_t iLines = (int16_t)(  sizeof(s_wRotationStrip)
+                              /  (sizeof(COLOUR_INT) * (size_t)iWidth));
+    if (iLines >= 4) {
+        /* keep the 4-pixel fast path of the rotation */
+        iLines &= ~0x03;
+    }
+
+    arm_2d_pfb_t tStrip = *ptPFB;
+
+    for (int16_t iY = 0; iY < iHeight; iY += iLines) {
+        tStrip.tTile.pchBuffer
+            = ptTile->pchBuffer + iY * iWidth * (int32_t)sizeof(COLOUR_INT);
+        tStrip.tTile.tRegion.tLocation.iY = ptTile->tRegion.tLocation.iY + iY;
+        tStrip.tTile.tRegion.tSize.iHeight = MIN(iLines, iHeight - iY);
+
+        arm_2d_region_t tPanelRegion = arm_2d_helper_pfb_get_rotated_region(
+                                                    &tStrip.tTile.tRegion,
+                                                    c_tRotation,
+                                                    &c_tScreenSize);
+
+        arm_2d_helper_pfb_copy_rotated( &tStrip,
+                                        c_tRotation,
+                                        s_wRotationStrip,
+                                        tPanelRegion.tSize.iWidth);
+
+        Disp%Instance%_DrawBitmap(tPanelRegion.tLocation.iX,
+                        tPanelRegion.tLocation.iY,
+                        tPanelRegion.tSize.iWidth,
+                        tPanelRegion.tSize.iHeight,
+                        (const uint8_t *)s_wRotationStrip);
+    }
+#else
     Disp%Instance%_DrawBitmap(ptTile->tRegion.tLocation.iX,
                     ptTile->tRegion.tLocation.iY,
                     ptTile->tRegion.tSize.iWidth,
                     ptTile->tRegion.tSize.iHeight,
                     (const uint8_t *)ptTile->pchBuffer);
+#endif
 
     arm_2d_helper_pfb_report_rendering_complete(
                     &DISP%Instance%_ADAPTER.use_as__arm_2d_helper_pfb_t);
@@ -555,7 +669,7 @@ static bool __on_each_frame_complete(void *ptTarget)
 }
 
 
-#if __DISP%Instance%_CFG_ROTATE_SCREEN__
+#if __DISP%Instance%_ROTATE_WITH_SCRATCH_PFB__
 /*!
  * \brief before-flushing event handler
  * \param[in] ptOrigin the original PFB
@@ -625,7 +739,7 @@ static void __user_scene_player_init(void)
     &&  !__DISP%Instance%_CFG_USE_HEAP_FOR_VIRTUAL_RESOURCE_HELPER__
         + __DISP%Instance%_CFG_VIRTUAL_RESOURCE_HELPER__
 #else
-        + (__DISP%Instance%_CFG_ROTATE_SCREEN__ > 0)
+        + __DISP%Instance%_ROTATE_WITH_SCRATCH_PFB__
 #endif
         ,{
             .evtOnLowLevelRendering = {
@@ -635,7 +749,11 @@ static void __user_scene_player_init(void)
             .evtOnEachFrameCPL = {
                 .fnHandler = &__on_each_frame_complete,
             },
-#if __DISP%Instance%_CFG_ROTATE_SCREEN__
+#if __DISP%Instance%_ROTATE_WITH_SCRATCH_PFB__
+            /* the 3FB helper and the synchronous flushing rotate PFBs while
+             * flushing them, hence only the asynchronous flushing requires a
+             * scratch PFB
+             */
             .evtBeforeFlushing = {
                 .fnHandler = &__before_flushing,
             },
@@ -646,6 +764,9 @@ static void __user_scene_player_init(void)
 #endif
 #if __DISP%Instance%_CFG_DEBUG_DIRTY_REGIONS__
         .FrameBuffer.bDebugDirtyRegions = true,
+#endif
+#if __DISP%Instance%_CFG_SCAN_IN_PANEL_ORDER__
+        .FrameBuffer.u2ScanOrder = __DISP%Instance%_CFG_ROTATE_SCREEN__,
 #endif
         .FrameBuffer.u3PixelWidthAlign = __DISP%Instance%_CFG_PFB_PIXEL_ALIGN_WIDTH__,
         .FrameBuffer.u3PixelHeightAlign = __DISP%Instance%_CFG_PFB_PIXEL_ALIGN_HEIGHT__,
@@ -674,10 +795,20 @@ static void __user_scene_player_init(void)
     
     
         arm_2d_helper_3fb_cfg_t tCFG = {
+#if     __DISP%Instance%_CFG_ROTATE_SCREEN__ == 1                               \
+    ||  __DISP%Instance%_CFG_ROTATE_SCREEN__ == 3
+            /* the panel size */
+            .tScreenSize = {
+                __DISP%Instance%_CFG_SCEEN_HEIGHT__,
+                __DISP%Instance%_CFG_SCEEN_WIDTH__,
+            },
+#else
             .tScreenSize = {
                 __DISP%Instance%_CFG_SCEEN_WIDTH__,
                 __DISP%Instance%_CFG_SCEEN_HEIGHT__,
             },
+#endif
+            .tRotation = (arm_2d_screen_rotation_t)__DISP%Instance%_CFG_ROTATE_SCREEN__,
             .chPixelBits = __DISP%Instance%_CFG_COLOUR_DEPTH__,
             .pnAddress = {
                 [0] = ((uintptr_t)__DISP_ADAPTER%Instance%_3FB_FB0_ADDRESS__),
@@ -947,6 +1078,269 @@ void __disp_adapter%Instance%_free(void *pMem)
 
 
 
+#if __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+
+void disp_adapter%Instance%_vres_cache_invalidate(arm_2d_vres_t *ptVRES)
+{
+    uintptr_t pAsset = (uintptr_t)NULL;
+
+    if (NULL != ptVRES) {
+        pAsset = __disp_adapter%Instance%_vres_get_asset_address(
+                                                            ptVRES->pTarget, 
+                                                            ptVRES);
+    }
+
+    arm_irq_safe {
+        for (int_fast16_t n = 0; n < dimof(s_tVRESCache.tBlocks); n++) {
+            if (NULL == ptVRES || s_tVRESCache.tBlocks[n].pAsset == pAsset) {
+                s_tVRESCache.tBlocks[n].bValid = false;
+            }
+        }
+    }
+}
+
+disp_adapter%Instance%_vres_cache_statistics_t 
+disp_adapter%Instance%_vres_cache_get_statistics(bool bReset)
+{
+    disp_adapter%Instance%_vres_cache_statistics_t tStatistics;
+
+    arm_irq_safe {
+        tStatistics = s_tVRESCache.Statistics;
+
+        if (bReset) {
+            memset(&s_tVRESCache.Statistics, 0, sizeof(s_tVRESCache.Statistics));
+        }
+    }
+
+    return tStatistics;
+}
+
+/*!
+ * \brief find a block in the cache and pin it, load it from the external
+ *        memory on a miss
+ * \note The lookup and the eviction are protected by arm_irq_safe, as several
+ *       threads may draw at the same time. The external memory is read with
+ *       the lock released, hence a block is pinned until the caller has
+ *       copied it and calls __disp_adapter%Instance%_vres_cache_unpin_block().
+ * \retval NULL the block is loaded by another thread or all blocks are pinned,
+ *         the caller should read the external memory directly
+ * \return __disp_adapter%Instance%_vres_cache_block_t * the pinned block
+ */
+static
+__disp_adapter%Instance%_vres_cache_block_t *
+__disp_adapter%Instance%_vres_cache_get_block(  uintptr_t pObj,
+                                                arm_2d_vres_t *ptVRES,
+                                                uintptr_t pAsset,
+                                                int_fast16_t iBlockX,
+                                                int_fast16_t iBlockY,
+                                                int_fast16_t iBlockWidth,
+                                                size_t nPixelSize)
+{
+    __disp_adapter%Instance%_vres_cache_block_t *ptVictim = NULL;
+    __disp_adapter%Instance%_vres_cache_block_t *ptFound = NULL;
+    int16_t iAssetWidth = ptVRES->tTile.tRegion.tSize.iWidth;
+    bool bMiss = false;
+
+    arm_irq_safe {
+        uint32_t wTick = ++s_tVRESCache.wTick;
+        bool bBusy = false;
+
+        for (int_fast16_t n = 0; n < dimof(s_tVRESCache.tBlocks); n++) {
+            __disp_adapter%Instance%_vres_cache_block_t *ptBlock
+                = &s_tVRESCache.tBlocks[n];
+
+            if (    ptBlock->bValid
+                &&  ptBlock->pAsset == pAsset
+                &&  ptBlock->iBlockX == iBlockX
+                &&  ptBlock->iBlockY == iBlockY
+                &&  ptBlock->iAssetWidth == iAssetWidth
+                &&  ptBlock->chPixelSize == nPixelSize) {
+
+                if (ptBlock->bLoading) {
+                    /* another thread is reading it from the external memory */
+                    bBusy = true;
+                } else {
+                    ptBlock->chPinCount++;
+                    ptBlock->wLastUsed = wTick;
+                    ptFound = ptBlock;
+                }
+                break;
+            }
+
+            if (ptBlock->chPinCount > 0) {
+                /* a pinned block cannot be evicted */
+                continue;
+            }
+
+            if (!ptBlock->bValid) {
+                /* a free block always wins */
+                if (NULL == ptVictim || ptVictim->bValid) {
+                    ptVictim = ptBlock;
+                }
+                continue;
+            }
+
+            if (    NULL == ptVictim
+                ||  (   ptVictim->bValid
+                    &&  ptBlock->wLastUsed < ptVictim->wLastUsed)) {
+                ptVictim = ptBlock;
+            }
+        }
+
+        if (NULL != ptFound) {
+            s_tVRESCache.Statistics.wHit++;
+        } else if (bBusy || NULL == ptVictim) {
+            s_tVRESCache.Statistics.wBypass++;
+        } else {
+            s_tVRESCache.Statistics.wMiss++;
+
+            /* evict the least recently used block */
+            ptVictim->bValid = true;
+            ptVictim->bLoading = true;
+            ptVictim->chPinCount = 1;
+            ptVictim->pAsset = pAsset;
+            ptVictim->iAssetWidth = iAssetWidth;
+            ptVictim->iBlockX = iBlockX;
+            ptVictim->iBlockY = iBlockY;
+            ptVictim->chPixelSize = nPixelSize;
+            ptVictim->wLastUsed = wTick;
+
+            ptFound = ptVictim;
+            bMiss = true;
+        }
+    }
+
+    if (!bMiss) {
+        return ptFound;
+    }
+
+    int_fast16_t iX = iBlockX * iBlockWidth;
+    int_fast16_t iY = iBlockY 
+                    * __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_HEIGHT__;
+    int_fast16_t iWidth = MIN(iBlockWidth, iAssetWidth - iX);
+    int_fast16_t iHeight = MIN( 
+                    __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_HEIGHT__,
+                    ptVRES->tTile.tRegion.tSize.iHeight - iY);
+
+    uintptr_t pSrc = pAsset + ((int32_t)iY * iAssetWidth + iX) * nPixelSize;
+    uintptr_t pDes = (uintptr_t)s_tVRESCache.wBuffer[ptFound - s_tVRESCache.tBlocks];
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        __disp_adapter%Instance%_vres_read_memory(  pObj, 
+                                                    (void *)pDes, 
+                                                    pSrc, 
+                                                    iWidth * nPixelSize);
+
+        pDes += __DISP%Instance%_VRES_CACHE_LINE_SIZE__;
+        pSrc += iAssetWidth * nPixelSize;
+    }
+
+    arm_irq_safe {
+        ptFound->bLoading = false;
+    }
+
+    return ptFound;
+}
+
+static
+void __disp_adapter%Instance%_vres_cache_unpin_block(
+                        __disp_adapter%Instance%_vres_cache_block_t *ptBlock)
+{
+    arm_irq_safe {
+        assert(ptBlock->chPinCount > 0);
+        ptBlock->chPinCount--;
+    }
+}
+
+/*!
+ * \brief assemble the target region from cached blocks
+ */
+static
+void __disp_adapter%Instance%_vres_cache_load(  uintptr_t pObj, 
+                                                arm_2d_vres_t *ptVRES, 
+                                                arm_2d_region_t *ptRegion,
+                                                uintptr_t pBuffer,
+                                                size_t nPixelSize)
+{
+    uintptr_t pAsset = __disp_adapter%Instance%_vres_get_asset_address(pObj, ptVRES);
+    int_fast16_t iBlockWidth = __DISP%Instance%_VRES_CACHE_LINE_SIZE__ / nPixelSize;
+    int_fast16_t iBlockHeight 
+        = __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_HEIGHT__;
+    size_t nTargetStride = ptRegion->tSize.iWidth * nPixelSize;
+
+    int_fast16_t iX0 = ptRegion->tLocation.iX;
+    int_fast16_t iY0 = ptRegion->tLocation.iY;
+    int_fast16_t iX1 = iX0 + ptRegion->tSize.iWidth;
+    int_fast16_t iY1 = iY0 + ptRegion->tSize.iHeight;
+
+    assert(iX0 >= 0 && iY0 >= 0);
+    assert(iX1 <= ptVRES->tTile.tRegion.tSize.iWidth);
+    assert(iY1 <= ptVRES->tTile.tRegion.tSize.iHeight);
+
+    for (int_fast16_t iBlockY = iY0 / iBlockHeight; 
+         iBlockY * iBlockHeight < iY1; 
+         iBlockY++) {
+
+        int_fast16_t iTop = MAX(iY0, iBlockY * iBlockHeight);
+        int_fast16_t iBottom = MIN(iY1, (iBlockY + 1) * iBlockHeight);
+
+        for (int_fast16_t iBlockX = iX0 / iBlockWidth; 
+             iBlockX * iBlockWidth < iX1; 
+             iBlockX++) {
+
+            int_fast16_t iLeft = MAX(iX0, iBlockX * iBlockWidth);
+            int_fast16_t iRight = MIN(iX1, (iBlockX + 1) * iBlockWidth);
+            size_t nBytesPerLine = (iRight - iLeft) * nPixelSize;
+
+            uint8_t *pchDes = (uint8_t *)pBuffer
+                            + (iTop - iY0) * nTargetStride
+                            + (iLeft - iX0) * nPixelSize;
+
+            __disp_adapter%Instance%_vres_cache_block_t *ptBlock =
+                __disp_adapter%Instance%_vres_cache_get_block(  pObj,
+                                                                ptVRES,
+                                                                pAsset,
+                                                                iBlockX,
+                                                                iBlockY,
+                                                                iBlockWidth,
+                                                                nPixelSize);
+            if (NULL == ptBlock) {
+                /* read around the cache */
+                size_t nSourceStride = ptVRES->tTile.tRegion.tSize.iWidth
+                                     * nPixelSize;
+                uintptr_t pSrc = pAsset
+                               + (uintptr_t)iTop * nSourceStride
+                               + iLeft * nPixelSize;
+
+                for (int_fast16_t y = iTop; y < iBottom; y++) {
+                    __disp_adapter%Instance%_vres_read_memory(  pObj,
+                                                                pchDes,
+                                                                pSrc,
+                                                                nBytesPerLine);
+                    pchDes += nTargetStride;
+                    pSrc += nSourceStride;
+                }
+                continue;
+            }
+
+            const uint8_t *pchSrc = (const uint8_t *)
+                s_tVRESCache.wBuffer[ptBlock - s_tVRESCache.tBlocks];
+            pchSrc += (iTop - iBlockY * iBlockHeight) 
+                    * __DISP%Instance%_VRES_CACHE_LINE_SIZE__;
+            pchSrc += (iLeft - iBlockX * iBlockWidth) * nPixelSize;
+
+            for (int_fast16_t y = iTop; y < iBottom; y++) {
+                memcpy(pchDes, pchSrc, nBytesPerLine);
+                pchDes += nTargetStride;
+                pchSrc += __DISP%Instance%_VRES_CACHE_LINE_SIZE__;
+            }
+
+            __disp_adapter%Instance%_vres_cache_unpin_block(ptBlock);
+        }
+    }
+}
+#endif
+
 intptr_t __disp_adapter%Instance%_vres_asset_loader (
                                             uintptr_t pObj, 
                                             arm_2d_vres_t *ptVRES, 
@@ -997,6 +1391,11 @@ intptr_t __disp_adapter%Instance%_vres_asset_loader (
 #endif
     /* load content into the buffer */
     if (nBitsPerPixel < 8) {
+    #if __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+        arm_irq_safe {
+            s_tVRESCache.Statistics.wBypass++;
+        }
+    #endif
         /* A1, A2 and A4 support */
         uintptr_t pSrc = __disp_adapter%Instance%_vres_get_asset_address(pObj, ptVRES);
         uintptr_t pDes = (uintptr_t)pBuffer;
@@ -1018,6 +1417,13 @@ intptr_t __disp_adapter%Instance%_vres_asset_loader (
             pSrc += iSourceStride;
         }
     } else {
+    #if __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+        __disp_adapter%Instance%_vres_cache_load(   pObj, 
+                                                    ptVRES, 
+                                                    ptRegion, 
+                                                    (uintptr_t)pBuffer, 
+                                                    nPixelSize);
+    #else
         uintptr_t pSrc = __disp_adapter%Instance%_vres_get_asset_address(pObj, ptVRES);
         uintptr_t pDes = (uintptr_t)pBuffer;
         int16_t iTargetStride = ptRegion->tSize.iWidth;
@@ -1036,6 +1442,7 @@ intptr_t __disp_adapter%Instance%_vres_asset_loader (
             pDes += iTargetStride * nPixelSize;
             pSrc += iSourceStride * nPixelSize;
         }
+    #endif
     } while(0);
     
     return (intptr_t)pBuffer;
@@ -81,10 +81,26 @@ extern "C" {
 //     <3=>   270 Degree
 // <i> Rotate the Screen for specified degrees.
 // <i> NOTE: This is extremely slow. Please avoid using it whenever it is possible.
+// <i> When the 3FB helper service is enabled, the rotation is done while copying PFBs to the frame-buffer and no extra PFB is required.
+// <i> Otherwise, with the synchronous flushing, PFBs are rotated strip by strip while they are flushed and no extra PFB is required either.
 #ifndef __DISP%Instance%_CFG_ROTATE_SCREEN__
 #   define __DISP%Instance%_CFG_ROTATE_SCREEN__                             0
 #endif
 
+// <o>Lines of a rotation strip <1-64>
+// <i> Without the 3FB helper service and the asynchronous flushing, a rotated screen is flushed in strips of this number of screen lines.
+// <i> Default: 4
+#ifndef __DISP%Instance%_CFG_ROTATION_STRIP_LINES__
+#   define __DISP%Instance%_CFG_ROTATION_STRIP_LINES__                      4
+#endif
+
+// <q>Issue PFBs in the scan order of the panel
+// <i> When the screen is rotated, issue PFBs in the raster order of the panel, e.g. column by column for 90 and 270 degree, so the panel is updated from its top to its bottom.
+// <i> This feature is disabled by default.
+#ifndef __DISP%Instance%_CFG_SCAN_IN_PANEL_ORDER__
+#   define __DISP%Instance%_CFG_SCAN_IN_PANEL_ORDER__                       0
+#endif
+
 // <o>Width of the PFB block
 // <i> The width of your PFB block size used in disp%Instance%
 #ifndef __DISP%Instance%_CFG_PFB_BLOCK_WIDTH__
@@ -233,6 +249,28 @@ extern "C" {
 #ifndef __DISP%Instance%_CFG_USE_HEAP_FOR_VIRTUAL_RESOURCE_HELPER__
 #   define __DISP%Instance%_CFG_USE_HEAP_FOR_VIRTUAL_RESOURCE_HELPER__      0
 #endif
+
+// <o>Size of the virtual resource block cache in bytes <0-0x7FFFFFFF>
+// <i> Keep the content loaded from external memory in blocks aligned to the resource, so the same area is not fetched again for every PFB and every frame. The least recently used block is evicted when the budget is used up. 0 means no cache.
+// <i> Use the hit and miss counters to tune the size: a cache smaller than the resources drawn in a frame keeps evicting blocks and may read more than no cache.
+// <i> This feature is disabled by default.
+#ifndef __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__
+#   define __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__               0
+#endif
+
+// <o>Width of a virtual resource cache block <8-1024>
+// <i> The block width in pixels of the screen colour depth. For resources in other pixel sizes, a block keeps the same number of bytes per line.
+// <i> Default: 32
+#ifndef __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_WIDTH__
+#   define __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_WIDTH__        32
+#endif
+
+// <o>Height of a virtual resource cache block <1-1024>
+// <i> The block height in pixels.
+// <i> Default: 16
+#ifndef __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_HEIGHT__
+#   define __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_BLOCK_HEIGHT__       16
+#endif
 // <<< end of configuration section >>>
 
 #ifndef __DISP%Instance%_COLOUR_FORMAT__
@@ -294,6 +332,19 @@ extern "C" {
         ARM_2D_SAFE_NAME(ret);})
 
 /*============================ TYPES =========================================*/
+
+#if     __DISP%Instance%_CFG_VIRTUAL_RESOURCE_HELPER__                          \
+    &&  __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+/*!
+ * \brief the statistics of the virtual resource block cache
+ */
+typedef struct disp_adapter%Instance%_vres_cache_statistics_t {
+    uint32_t wHit;              //!< blocks found in the cache
+    uint32_t wMiss;             //!< blocks loaded from the external memory
+    uint32_t wBypass;           //!< reads around the cache (A1/A2/A4 or busy)
+} disp_adapter%Instance%_vres_cache_statistics_t;
+#endif
+
 /*============================ GLOBAL VARIABLES ==============================*/
 ARM_NOINIT
 extern
@@ -372,6 +423,29 @@ void __disp_adapter%Instance%_vres_read_memory( intptr_t pObj,
                                                 uintptr_t pAddress,
                                                 size_t nSizeInByte);
 
+#   if __DISP%Instance%_CFG_VIRTUAL_RESOURCE_CACHE_SIZE__ > 0
+/*!
+ * \brief drop cached blocks of a virtual resource
+ * \note Call this function when the content in the external memory is 
+ *       changed, e.g. after an OTA update of the assets.
+ *
+ * \param[in] ptVRES the target virtual resource, NULL means all blocks
+ */
+extern
+void disp_adapter%Instance%_vres_cache_invalidate(arm_2d_vres_t *ptVRES);
+
+/*!
+ * \brief get the statistics of the virtual resource block cache
+ *
+ * \param[in] bReset whether to clear the counters after reading them
+ * \return disp_adapter%Instance%_vres_cache_statistics_t the statistics
+ */
+extern
+disp_adapter%Instance%_vres_cache_statistics_t 
+disp_adapter%Instance%_vres_cache_get_statistics(bool bReset);
+#   endif
+
+
 #endif
 
 #if __DISP%Instance%_CFG_ENABLE_ASYNC_FLUSHING__
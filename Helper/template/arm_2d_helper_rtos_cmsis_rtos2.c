@@ -65,6 +65,10 @@ void *__arm_2d_helper_perf_counter_get(arm_2d_perfc_type_t tType);
 
 /*============================ LOCAL VARIABLES ===============================*/
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+static osThreadId_t s_tBandThreadID[__ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__];
+#endif
+
 /*============================ IMPLEMENTATION ================================*/
 
 __OVERRIDE_WEAK
@@ -120,7 +124,7 @@ void arm_2d_port_set_semaphore(uintptr_t pSemaphore)
 __NO_RETURN
 void arm_2d_backend_thread(void *argument)
 {
-    ARM_2D_UNUSED(argument);
+    uint_fast8_t chWorkerID = (uint_fast8_t)(uintptr_t)argument;
 
 #if defined(__PERF_COUNTER__) && defined(__PERF_CNT_USE_RTOS__)
     /* init the cycle counter for the current task */
@@ -132,31 +136,83 @@ void arm_2d_backend_thread(void *argument)
         if (NULL == ptInfo) {
             break;
         }
-        static task_cycle_info_agent_t s_tAgent;
+        static task_cycle_info_agent_t s_tAgent[__ARM_2D_CFG_ASYNC_WORKER_COUNT__];
         
         /* initialize the cross tasks task-cycle-info object */
-        init_task_cycle_info(ptInfo);
-        register_task_cycle_agent(ptInfo, &s_tAgent);
+        if (0 == chWorkerID) {
+            init_task_cycle_info(ptInfo);
+        }
+        register_task_cycle_agent(ptInfo, &s_tAgent[chWorkerID]);
 
     } while(0);
 #endif
 
-    arm_2d_helper_backend_task();
+    arm_2d_helper_backend_worker_task(chWorkerID);
     
     osThreadExit();
 }
 
 
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+__OVERRIDE_WEAK
+uint_fast8_t arm_2d_port_get_default_op_index(void)
+{
+    osThreadId_t tThreadID = osThreadGetId();
+
+    for (uint_fast8_t n = 0; n < __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__; n++) {
+        if (tThreadID == s_tBandThreadID[n]) {
+            return n + 1;
+        }
+    }
+
+    return 0;
+}
+
+__NO_RETURN
+void arm_2d_band_thread(void *argument)
+{
+    uint_fast8_t chWorkerID = (uint_fast8_t)(uintptr_t)argument;
+
+    /* register the thread before using any default OP */
+    s_tBandThreadID[chWorkerID] = osThreadGetId();
+
+    arm_2d_helper_pfb_band_worker_task(chWorkerID);
+
+    osThreadExit();
+}
+#endif
+
 void arm_2d_helper_rtos_init(void)
 {
-    static uint64_t s_dwThreadStack[2048 / sizeof(uint64_t)];
-     
-    const osThreadAttr_t c_tThreadAttribute = {
-      .stack_mem  = &s_dwThreadStack[0],
-      .stack_size = sizeof(s_dwThreadStack)
-    };
-
-    osThreadNew(arm_2d_backend_thread, NULL, &c_tThreadAttribute);
+#if __ARM_2D_HAS_ASYNC__
+    static uint64_t s_dwThreadStack[__ARM_2D_CFG_ASYNC_WORKER_COUNT__]
+                                   [2048 / sizeof(uint64_t)];
+
+    /* one backend thread for each worker */
+    for (uint_fast8_t n = 0; n < __ARM_2D_CFG_ASYNC_WORKER_COUNT__; n++) {
+        const osThreadAttr_t c_tThreadAttribute = {
+          .stack_mem  = &s_dwThreadStack[n][0],
+          .stack_size = sizeof(s_dwThreadStack[n])
+        };
+
+        osThreadNew(arm_2d_backend_thread, (void *)(uintptr_t)n, &c_tThreadAttribute);
+    }
+#endif
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    static uint64_t s_dwBandThreadStack[__ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__]
+                                       [4096 / sizeof(uint64_t)];
+
+    /* one thread for each band worker */
+    for (uint_fast8_t n = 0; n < __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__; n++) {
+        const osThreadAttr_t c_tThreadAttribute = {
+          .stack_mem  = &s_dwBandThreadStack[n][0],
+          .stack_size = sizeof(s_dwBandThreadStack[n])
+        };
+
+        osThreadNew(arm_2d_band_thread, (void *)(uintptr_t)n, &c_tThreadAttribute);
+    }
+#endif
 }
 
 #if defined(__clang__)
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*============================ INCLUDES ======================================*/
+
+#include "arm_2d_helper.h"
+#include "arm_2d_disp_adapters.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wmissing-field-initializers"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#elif __IS_COMPILER_GCC__
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+typedef struct {
+    pthread_mutex_t tMutex;
+    pthread_cond_t  tCondition;
+    bool            bSet;
+} __arm_2d_pthread_semaphore_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+#if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+static pthread_once_t s_tWorkerLockOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t s_tWorkerLock;
+#endif
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+static pthread_t s_tBandThread[__ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__];
+static volatile bool s_bBandThreadValid[__ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__];
+#endif
+
+/*============================ IMPLEMENTATION ================================*/
+
+__OVERRIDE_WEAK
+arm_2d_runtime_feature_t ARM_2D_RUNTIME_FEATURE = {
+    .TREAT_OUT_OF_RANGE_AS_COMPLETE         = 1,
+    .HAS_DEDICATED_THREAD_FOR_2D_TASK       = __ARM_2D_HAS_ASYNC__,
+};
+
+
+/*----------------------------------------------------------------------------*
+ * RTOS Port                                                                  *
+ *----------------------------------------------------------------------------*/
+
+__OVERRIDE_WEAK
+uintptr_t arm_2d_port_new_semaphore(void)
+{
+    __arm_2d_pthread_semaphore_t *ptSemaphore
+        = (__arm_2d_pthread_semaphore_t *)
+            malloc(sizeof(__arm_2d_pthread_semaphore_t));
+    assert(NULL != ptSemaphore);
+
+    pthread_mutex_init(&ptSemaphore->tMutex, NULL);
+    pthread_cond_init(&ptSemaphore->tCondition, NULL);
+    ptSemaphore->bSet = false;
+
+    return (uintptr_t)ptSemaphore;
+}
+
+__OVERRIDE_WEAK
+void arm_2d_port_free_semaphore(uintptr_t pSemaphore)
+{
+    __arm_2d_pthread_semaphore_t *ptSemaphore
+        = (__arm_2d_pthread_semaphore_t *)pSemaphore;
+
+    if (NULL != ptSemaphore) {
+        pthread_cond_destroy(&ptSemaphore->tCondition);
+        pthread_mutex_destroy(&ptSemaphore->tMutex);
+        free(ptSemaphore);
+    }
+}
+
+__OVERRIDE_WEAK
+bool arm_2d_port_wait_for_semaphore(uintptr_t pSemaphore)
+{
+    __arm_2d_pthread_semaphore_t *ptSemaphore
+        = (__arm_2d_pthread_semaphore_t *)pSemaphore;
+
+    if (NULL != ptSemaphore) {
+        pthread_mutex_lock(&ptSemaphore->tMutex);
+        while (!ptSemaphore->bSet) {
+            pthread_cond_wait(&ptSemaphore->tCondition, &ptSemaphore->tMutex);
+        }
+        ptSemaphore->bSet = false;
+        pthread_mutex_unlock(&ptSemaphore->tMutex);
+    }
+    return true;
+}
+
+__OVERRIDE_WEAK
+void arm_2d_port_set_semaphore(uintptr_t pSemaphore)
+{
+    __arm_2d_pthread_semaphore_t *ptSemaphore
+        = (__arm_2d_pthread_semaphore_t *)pSemaphore;
+
+    if (NULL != ptSemaphore) {
+        pthread_mutex_lock(&ptSemaphore->tMutex);
+        ptSemaphore->bSet = true;
+        pthread_cond_signal(&ptSemaphore->tCondition);
+        pthread_mutex_unlock(&ptSemaphore->tMutex);
+    }
+}
+
+#if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+static void __arm_2d_worker_lock_init(void)
+{
+    /* the critical sections can be nested, hence a recursive mutex */
+    pthread_mutexattr_t tAttribute;
+    pthread_mutexattr_init(&tAttribute);
+    pthread_mutexattr_settype(&tAttribute, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&s_tWorkerLock, &tAttribute);
+    pthread_mutexattr_destroy(&tAttribute);
+}
+
+__OVERRIDE_WEAK
+uint32_t arm_2d_port_enter_worker_critical_section(void)
+{
+    /* the pool is initialised before arm_2d_helper_rtos_init() is called */
+    pthread_once(&s_tWorkerLockOnce, __arm_2d_worker_lock_init);
+#if __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+    if (0 != pthread_mutex_trylock(&s_tWorkerLock)) {
+        pthread_mutex_lock(&s_tWorkerLock);
+        arm_2d_notif_worker_lock_contention();
+    }
+#else
+    pthread_mutex_lock(&s_tWorkerLock);
+#endif
+    return 0;
+}
+
+__OVERRIDE_WEAK
+void arm_2d_port_leave_worker_critical_section(uint32_t wState)
+{
+    ARM_2D_UNUSED(wState);
+    pthread_mutex_unlock(&s_tWorkerLock);
+}
+#endif
+
+
+/*----------------------------------------------------------------------------*
+ * Application main thread                                                    *
+ *----------------------------------------------------------------------------*/
+
+#if __ARM_2D_HAS_ASYNC__
+static void *arm_2d_backend_thread(void *argument)
+{
+    uint_fast8_t chWorkerID = (uint_fast8_t)(uintptr_t)argument;
+
+    arm_2d_helper_backend_worker_task(chWorkerID);
+
+    return NULL;
+}
+#endif
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+__OVERRIDE_WEAK
+uint_fast8_t arm_2d_port_get_default_op_index(void)
+{
+    pthread_t tSelf = pthread_self();
+
+    for (uint_fast8_t n = 0; n < __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__; n++) {
+        if (s_bBandThreadValid[n] && pthread_equal(tSelf, s_tBandThread[n])) {
+            return n + 1;
+        }
+    }
+
+    return 0;
+}
+
+static void *arm_2d_band_thread(void *argument)
+{
+    uint_fast8_t chWorkerID = (uint_fast8_t)(uintptr_t)argument;
+
+    /* register the thread before using any default OP */
+    s_tBandThread[chWorkerID] = pthread_self();
+    s_bBandThreadValid[chWorkerID] = true;
+
+    arm_2d_helper_pfb_band_worker_task(chWorkerID);
+
+    return NULL;
+}
+#endif
+
+
+void arm_2d_helper_rtos_init(void)
+{
+#if __ARM_2D_HAS_ASYNC__
+    static pthread_t s_tBackendThread[__ARM_2D_CFG_ASYNC_WORKER_COUNT__];
+
+    /* one backend thread for each worker */
+    for (uint_fast8_t n = 0; n < __ARM_2D_CFG_ASYNC_WORKER_COUNT__; n++) {
+        pthread_create( &s_tBackendThread[n],
+                        NULL,
+                        arm_2d_backend_thread,
+                        (void *)(uintptr_t)n);
+    }
+#endif
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    /* one thread for each band worker */
+    for (uint_fast8_t n = 0; n < __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__; n++) {
+        pthread_t tThread;
+        pthread_create( &tThread,
+                        NULL,
+                        arm_2d_band_thread,
+                        (void *)(uintptr_t)n);
+    }
+#endif
+}
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif __IS_COMPILER_GCC__
+#   pragma GCC diagnostic pop
+#endif
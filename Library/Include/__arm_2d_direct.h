@@ -9525,6 +9525,39 @@ void __arm_2d_impl_cccn888_filter_iir_blur(
                             uint8_t chBlurDegree,
                             arm_2d_scratch_mem_t *ptScratchMemory);
 
+void __arm_2d_impl_gray8_filter_separable_blur(
+                            const uint8_t *__RESTRICT pchSourceBase,
+                            int16_t iSourceStride,
+                            arm_2d_size_t *__RESTRICT ptSourceSize,
+                            uint8_t *__RESTRICT pchTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionInSource,
+                            uint8_t chKernel,
+                            uint8_t chRadius,
+                            uint8_t *__RESTRICT pchScratch);
+
+void __arm_2d_impl_rgb565_filter_separable_blur(
+                            const uint16_t *__RESTRICT phwSourceBase,
+                            int16_t iSourceStride,
+                            arm_2d_size_t *__RESTRICT ptSourceSize,
+                            uint16_t *__RESTRICT phwTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionInSource,
+                            uint8_t chKernel,
+                            uint8_t chRadius,
+                            uint8_t *__RESTRICT pchScratch);
+
+void __arm_2d_impl_cccn888_filter_separable_blur(
+                            const uint32_t *__RESTRICT pwSourceBase,
+                            int16_t iSourceStride,
+                            arm_2d_size_t *__RESTRICT ptSourceSize,
+                            uint32_t *__RESTRICT pwTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionInSource,
+                            uint8_t chKernel,
+                            uint8_t chRadius,
+                            uint8_t *__RESTRICT pchScratch);
+
 void __arm_2d_impl_ccca8888_tile_copy_to_gray8_with_opacity(
                                     uint32_t *__RESTRICT pwSourceBase,
                                     int16_t iSourceStride,
@@ -10573,6 +10606,119 @@ void __arm_2d_impl_cccn888_tile_copy_with_src_chn_mask_and_opacity(
                                     arm_2d_size_t *__RESTRICT ptCopySize,
                                     uint_fast16_t hwOpacity);
 
+void __arm_2d_impl_gray8_linear_gradient(
+                                    uint8_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint8_t *__RESTRICT pLUT,
+                                    int32_t nT,
+                                    int32_t nDTDX,
+                                    int32_t nDTDY);
+
+void __arm_2d_impl_gray8_radial_gradient(
+                                    uint8_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint8_t *__RESTRICT pLUT,
+                                    int32_t nDX,
+                                    int32_t nDY,
+                                    uint32_t wLimit,
+                                    uint32_t wScale,
+                                    uint8_t chShift);
+
+void __arm_2d_impl_gray8_conic_gradient(
+                                    uint8_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint8_t *__RESTRICT pLUT,
+                                    int32_t nDX,
+                                    int32_t nDY,
+                                    uint16_t hwStartAngle);
+
+void __arm_2d_impl_rgb565_linear_gradient(
+                                    uint16_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint16_t *__RESTRICT pLUT,
+                                    int32_t nT,
+                                    int32_t nDTDX,
+                                    int32_t nDTDY);
+
+void __arm_2d_impl_rgb565_radial_gradient(
+                                    uint16_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint16_t *__RESTRICT pLUT,
+                                    int32_t nDX,
+                                    int32_t nDY,
+                                    uint32_t wLimit,
+                                    uint32_t wScale,
+                                    uint8_t chShift);
+
+void __arm_2d_impl_rgb565_conic_gradient(
+                                    uint16_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint16_t *__RESTRICT pLUT,
+                                    int32_t nDX,
+                                    int32_t nDY,
+                                    uint16_t hwStartAngle);
+
+void __arm_2d_impl_cccn888_linear_gradient(
+                                    uint32_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint32_t *__RESTRICT pLUT,
+                                    int32_t nT,
+                                    int32_t nDTDX,
+                                    int32_t nDTDY);
+
+void __arm_2d_impl_cccn888_radial_gradient(
+                                    uint32_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint32_t *__RESTRICT pLUT,
+                                    int32_t nDX,
+                                    int32_t nDY,
+                                    uint32_t wLimit,
+                                    uint32_t wScale,
+                                    uint8_t chShift);
+
+void __arm_2d_impl_cccn888_conic_gradient(
+                                    uint32_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptSize,
+                                    const uint32_t *__RESTRICT pLUT,
+                                    int32_t nDX,
+                                    int32_t nDY,
+                                    uint16_t hwStartAngle);
+
+void __arm_2d_impl_ccca8888_tile_copy_opacity(
+                                    uint32_t *__RESTRICT pwSourceBase,
+                                    int16_t iSourceStride,
+                                    uint32_t *__RESTRICT pwTargetBase,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint_fast16_t hwRatio);
+
+void __arm_2d_impl_ccca8888_colour_filling_mask_opacity(
+                                    uint32_t *__RESTRICT pwTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint32_t wColour,
+                                    uint_fast16_t hwOpacity);
+
+void __arm_2d_impl_ccca8888_transform_only(
+                                    __arm_2d_param_copy_orig_t *ptParam,
+                                    __arm_2d_transform_info_t *ptInfo);
+
+void __arm_2d_impl_ccca8888_transform_only_opacity(
+                                    __arm_2d_param_copy_orig_t *ptParam,
+                                    __arm_2d_transform_info_t *ptInfo,
+                                    uint_fast16_t hwRatio);
+
 #if defined(__clang__)
 #   pragma clang diagnostic pop
 #elif __IS_COMPILER_ARM_COMPILER_5__
@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_draw_path.h
+ * Description:  APIs for the anti-aliased path (polygon, line and arc) filling
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef __ARM_2D_DRAW_PATH_H__
+#define __ARM_2D_DRAW_PATH_H__
+
+/*============================ INCLUDES ======================================*/
+#include "arm_2d_types.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#endif
+
+/*!
+ * \addtogroup Drawing 3 Drawing Operations
+ * @{
+ */
+
+/*============================ MACROS ========================================*/
+
+/*! \brief the number of rows rasterised in one go
+ *! \note the scratch memory of the rasteriser is proportional to this value
+ */
+#define ARM_2D_DRAW_PATH_BAND_HEIGHT        8
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+#define arm_2d_gray8_fill_path( __TARGET_ADDR,  /* target tile address */       \
+                                __REGION_ADDR,  /* target region address */     \
+                                __PATH_ADDR,    /* path address */              \
+                                __COLOUR,       /* target colour */             \
+                                ...)            /* opacity */                   \
+            arm_2dp_gray8_fill_path(NULL,                                       \
+                                    (__TARGET_ADDR),                            \
+                                    (__REGION_ADDR),                            \
+                                    (__PATH_ADDR),                              \
+                                    (__COLOUR),                                 \
+                                    (255,##__VA_ARGS__))
+
+#define arm_2d_rgb565_fill_path(__TARGET_ADDR,  /* target tile address */       \
+                                __REGION_ADDR,  /* target region address */     \
+                                __PATH_ADDR,    /* path address */              \
+                                __COLOUR,       /* target colour */             \
+                                ...)            /* opacity */                   \
+            arm_2dp_rgb565_fill_path(NULL,                                      \
+                                    (__TARGET_ADDR),                            \
+                                    (__REGION_ADDR),                            \
+                                    (__PATH_ADDR),                              \
+                                    (__COLOUR),                                 \
+                                    (255,##__VA_ARGS__))
+
+#define arm_2d_cccn888_fill_path(__TARGET_ADDR, /* target tile address */       \
+                                __REGION_ADDR,  /* target region address */     \
+                                __PATH_ADDR,    /* path address */              \
+                                __COLOUR,       /* target colour */             \
+                                ...)            /* opacity */                   \
+            arm_2dp_cccn888_fill_path(NULL,                                     \
+                                    (__TARGET_ADDR),                            \
+                                    (__REGION_ADDR),                            \
+                                    (__PATH_ADDR),                              \
+                                    (__COLOUR),                                 \
+                                    (255,##__VA_ARGS__))
+
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief the rules deciding which part of a path is inside
+ */
+typedef enum {
+    ARM_2D_PATH_FILL_NON_ZERO = 0,          //!< inside when the winding number isn't zero
+    ARM_2D_PATH_FILL_EVEN_ODD,              //!< inside when the winding number is odd
+} arm_2d_path_fill_rule_t;
+
+/*!
+ * \brief an edge of a path
+ */
+typedef struct arm_2d_path_edge_t {
+    arm_2d_point_float_t tStart;
+    arm_2d_point_float_t tEnd;
+} arm_2d_path_edge_t;
+
+/*!
+ * \brief a path, i.e. a set of closed contours stored as edges
+ * \note the coordinates are relative to the target region and use the pixel
+ *       centre at (x + 0.5, y + 0.5), i.e. a square from (0, 0) to (1, 1)
+ *       covers exactly one pixel.
+ */
+typedef struct arm_2d_path_t {
+ARM_PRIVATE(
+    arm_2d_path_edge_t *ptEdges;
+    uint16_t hwCapacity;
+    uint16_t hwCount;
+
+    arm_2d_point_float_t tContourStart;
+    arm_2d_point_float_t tCurrent;
+
+    arm_2d_point_float_t tMin;                      /* the bounding box */
+    arm_2d_point_float_t tMax;
+
+    uint8_t chFillRule;
+    uint8_t bContourOpen    : 1;
+    uint8_t bOverflow       : 1;                    /* some edges are lost */
+    uint8_t bHasBoundingBox : 1;
+    uint8_t                 : 5;
+    uint16_t                : 16;
+)
+} arm_2d_path_t;
+
+/*!
+ *  \brief the control block for path-filling-operations
+ *  \note arm_2d_op_fill_path_t inherits from arm_2d_op_t explicitly
+ */
+typedef struct arm_2d_op_fill_path_t {
+ARM_PRIVATE(
+    implement(arm_2d_op_t);                         /* inherit from base class arm_2d_op_t*/
+
+    arm_2d_region_t tRegion;                        /* the bounding box of the path on the target tile */
+    arm_2d_location_t tOrigin;                      /* the origin of the path on the target tile */
+    const arm_2d_path_t *ptPath;
+    union {
+        uint8_t  chColour;
+        uint16_t hwColour;
+        uint32_t wColour;
+    };
+    uint8_t chOpacity;
+)
+
+    /*! \note an optional scratch memory provided by users, when it is empty
+     *!       the scratch memory is allocated for each PFB.
+     */
+    arm_2d_scratch_mem_t tScratchMemory;
+
+} arm_2d_op_fill_path_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*----------------------------------------------------------------------------*
+ * Path construction                                                          *
+ *----------------------------------------------------------------------------*/
+
+/*!
+ *  \brief initialise a path with a user provided edge buffer
+ *  \param[in] ptPath the target path
+ *  \param[in] ptEdges the edge buffer
+ *  \param[in] hwCapacity the number of edges the buffer can hold
+ *  \param[in] tRule the fill rule
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_init(  arm_2d_path_t *ptPath,
+                                arm_2d_path_edge_t *ptEdges,
+                                uint16_t hwCapacity,
+                                arm_2d_path_fill_rule_t tRule);
+
+/*!
+ *  \brief remove all contours from a path
+ *  \param[in] ptPath the target path
+ */
+extern
+ARM_NONNULL(1)
+void arm_2d_path_reset(arm_2d_path_t *ptPath);
+
+/*!
+ *  \brief start a new contour, the current contour is closed
+ *  \param[in] ptPath the target path
+ *  \param[in] fX the x coordinate
+ *  \param[in] fY the y coordinate
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1)
+arm_2d_err_t arm_2d_path_move_to(arm_2d_path_t *ptPath, float fX, float fY);
+
+/*!
+ *  \brief add a straight edge to the current contour
+ *  \param[in] ptPath the target path
+ *  \param[in] fX the x coordinate of the end point
+ *  \param[in] fY the y coordinate of the end point
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1)
+arm_2d_err_t arm_2d_path_line_to(arm_2d_path_t *ptPath, float fX, float fY);
+
+/*!
+ *  \brief close the current contour
+ *  \note open contours are closed implicitly when filling a path
+ *  \param[in] ptPath the target path
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1)
+arm_2d_err_t arm_2d_path_close(arm_2d_path_t *ptPath);
+
+/*!
+ *  \brief add a closed polygon to a path
+ *  \param[in] ptPath the target path
+ *  \param[in] ptPoints the vertices
+ *  \param[in] hwCount the number of vertices
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_add_polygon(   arm_2d_path_t *ptPath,
+                                        const arm_2d_point_float_t *ptPoints,
+                                        uint16_t hwCount);
+
+/*!
+ *  \brief add a line with the given thickness (and butt caps) to a path
+ *  \param[in] ptPath the target path
+ *  \param[in] ptStart the start point
+ *  \param[in] ptEnd the end point
+ *  \param[in] fThickness the thickness of the line
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1,2,3)
+arm_2d_err_t arm_2d_path_add_line(  arm_2d_path_t *ptPath,
+                                    const arm_2d_point_float_t *ptStart,
+                                    const arm_2d_point_float_t *ptEnd,
+                                    float fThickness);
+
+/*!
+ *  \brief add an arc with the given thickness to a path
+ *  \details The arc is approximated with straight edges, and the number of
+ *           edges grows with the square root of the radius.
+ *  \param[in] ptPath the target path
+ *  \param[in] ptCentre the centre of the arc
+ *  \param[in] fRadius the radius of the centre line of the arc
+ *  \param[in] fThickness the thickness of the arc, when it is no less than
+ *             twice the radius, the arc becomes a pie slice
+ *  \param[in] fStartAngle the start angle in radian
+ *  \param[in] fEndAngle the end angle in radian
+ *  \note the angle 0 points to the positive X axis and, as the Y axis points
+ *        downwards, a positive angle turns clockwise on the screen. Please
+ *        use ARM_2D_ANGLE() to convert degrees into radians.
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_add_arc(   arm_2d_path_t *ptPath,
+                                    const arm_2d_point_float_t *ptCentre,
+                                    float fRadius,
+                                    float fThickness,
+                                    float fStartAngle,
+                                    float fEndAngle);
+
+/*!
+ *  \brief add a filled circle to a path
+ *  \param[in] ptPath the target path
+ *  \param[in] ptCentre the centre of the circle
+ *  \param[in] fRadius the radius of the circle
+ *  \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_add_circle(arm_2d_path_t *ptPath,
+                                    const arm_2d_point_float_t *ptCentre,
+                                    float fRadius);
+
+/*!
+ *  \brief get the size of the scratch memory required by the path filling
+ *  \param[in] iWidth the width of the largest area filled in one go, i.e.
+ *             the PFB width when the path is wider than a PFB
+ *  \return uint32_t the size in bytes
+ */
+extern
+uint32_t arm_2d_fill_path_get_scratch_size(int16_t iWidth);
+
+/*----------------------------------------------------------------------------*
+ * Fill a path                                                                *
+ *----------------------------------------------------------------------------*/
+
+/*!
+ *  \brief fill a path with a given 8bit colour
+ *  \details The coverage of each pixel is calculated analytically, written
+ *           into an A8 mask and blended with the existing colour-filling-with
+ *           -mask kernels. Only the rows and columns inside the current PFB
+ *           are rasterised.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, the path is relative to its top-left
+ *             corner and is clipped by it. NULL means the whole target tile
+ *  \param[in] ptPath the path, which must be kept unchanged until the
+ *             operation is complete
+ *  \note the OP cannot be recorded by a display list, as only the pointer of
+ *        the path is kept in the control block
+ *  \param[in] chColour the colour
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_gray8_fill_path(   arm_2d_op_fill_path_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_path_t *ptPath,
+                                        uint8_t chColour,
+                                        uint8_t chOpacity);
+
+/*!
+ *  \brief fill a path with a given RGB565 colour
+ *  \details The coverage of each pixel is calculated analytically, written
+ *           into an A8 mask and blended with the existing colour-filling-with
+ *           -mask kernels. Only the rows and columns inside the current PFB
+ *           are rasterised.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, the path is relative to its top-left
+ *             corner and is clipped by it. NULL means the whole target tile
+ *  \param[in] ptPath the path, which must be kept unchanged until the
+ *             operation is complete
+ *  \note the OP cannot be recorded by a display list, as only the pointer of
+ *        the path is kept in the control block
+ *  \param[in] hwColour the colour
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_rgb565_fill_path(  arm_2d_op_fill_path_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_path_t *ptPath,
+                                        uint16_t hwColour,
+                                        uint8_t chOpacity);
+
+/*!
+ *  \brief fill a path with a given CCCN888 colour
+ *  \details The coverage of each pixel is calculated analytically, written
+ *           into an A8 mask and blended with the existing colour-filling-with
+ *           -mask kernels. Only the rows and columns inside the current PFB
+ *           are rasterised.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, the path is relative to its top-left
+ *             corner and is clipped by it. NULL means the whole target tile
+ *  \param[in] ptPath the path, which must be kept unchanged until the
+ *             operation is complete
+ *  \note the OP cannot be recorded by a display list, as only the pointer of
+ *        the path is kept in the control block
+ *  \param[in] wColour the colour
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_cccn888_fill_path( arm_2d_op_fill_path_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_path_t *ptPath,
+                                        uint32_t wColour,
+                                        uint8_t chOpacity);
+
+/*! @} */
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+
+#endif /* __ARM_2D_DRAW_PATH_H__ */
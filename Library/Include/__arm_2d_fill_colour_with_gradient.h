@@ -0,0 +1,591 @@
+/*
+ * Copyright (C) 2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_fill_colour_with_gradient.h
+ * Description:  APIs for colour-filling-with-gradient (linear, radial, conic)
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef __ARM_2D_FILL_COLOUR_WITH_GRADIENT_H__
+#define __ARM_2D_FILL_COLOUR_WITH_GRADIENT_H__
+
+/*============================ INCLUDES ======================================*/
+#include "arm_2d_types.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#endif
+
+/*!
+ * \addtogroup gAlpha 4 Alpha Blending Operations
+ * @{
+ */
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+#define arm_2d_gray8_fill_colour_with_linear_gradient(                          \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __START,        /*   start point */         \
+                                    __END,          /*   end point */           \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_gray8_fill_colour_with_linear_gradient(                     \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__START),                                     \
+                                 (__END),                                       \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_rgb565_fill_colour_with_linear_gradient(                         \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __START,        /*   start point */         \
+                                    __END,          /*   end point */           \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_rgb565_fill_colour_with_linear_gradient(                    \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__START),                                     \
+                                 (__END),                                       \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_cccn888_fill_colour_with_linear_gradient(                        \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __START,        /*   start point */         \
+                                    __END,          /*   end point */           \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_cccn888_fill_colour_with_linear_gradient(                   \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__START),                                     \
+                                 (__END),                                       \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_gray8_fill_colour_with_radial_gradient(                          \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __CENTRE,       /*   centre */              \
+                                    __RADIUS,       /*   radius */              \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_gray8_fill_colour_with_radial_gradient(                     \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__CENTRE),                                    \
+                                 (__RADIUS),                                    \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_rgb565_fill_colour_with_radial_gradient(                         \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __CENTRE,       /*   centre */              \
+                                    __RADIUS,       /*   radius */              \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_rgb565_fill_colour_with_radial_gradient(                    \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__CENTRE),                                    \
+                                 (__RADIUS),                                    \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_cccn888_fill_colour_with_radial_gradient(                        \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __CENTRE,       /*   centre */              \
+                                    __RADIUS,       /*   radius */              \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_cccn888_fill_colour_with_radial_gradient(                   \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__CENTRE),                                    \
+                                 (__RADIUS),                                    \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_gray8_fill_colour_with_conic_gradient(                           \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __CENTRE,       /*   centre */              \
+                                    __START_ANGLE,  /*   start angle */         \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_gray8_fill_colour_with_conic_gradient(                      \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__CENTRE),                                    \
+                                 (__START_ANGLE),                               \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_rgb565_fill_colour_with_conic_gradient(                          \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __CENTRE,       /*   centre */              \
+                                    __START_ANGLE,  /*   start angle */         \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_rgb565_fill_colour_with_conic_gradient(                     \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__CENTRE),                                    \
+                                 (__START_ANGLE),                               \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+#define arm_2d_cccn888_fill_colour_with_conic_gradient(                         \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __CENTRE,       /*   centre */              \
+                                    __START_ANGLE,  /*   start angle */         \
+                                    __STOPS,        /*   colour stops */        \
+                                    __STOP_COUNT)   /*   number of stops */     \
+            arm_2dp_cccn888_fill_colour_with_conic_gradient(                    \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                  NULL,                                         \
+                                 (__CENTRE),                                    \
+                                 (__START_ANGLE),                               \
+                                 (__STOPS),                                     \
+                                 (__STOP_COUNT),                                \
+                                  255)
+
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief a colour stop of a gradient
+ * \note the stops of a gradient must be sorted by their positions
+ */
+typedef struct arm_2d_gradient_stop_t {
+    uint8_t chPosition;                         //!< the position of the stop, 0 ~ 255
+    uint8_t                 : 8;
+    uint16_t                : 16;
+    union {
+        uint8_t  chColour;                      //!< 8bit colour
+        uint16_t hwColour;                      //!< 16bit colour
+        uint32_t wColour;                       //!< 32bit colour
+    };
+} arm_2d_gradient_stop_t;
+
+/*!
+ * \brief the shapes of gradients
+ */
+typedef enum {
+    ARM_2D_GRADIENT_LINEAR = 0,
+    ARM_2D_GRADIENT_RADIAL,
+    ARM_2D_GRADIENT_CONIC,
+} arm_2d_gradient_type_t;
+
+/*!
+ *  \brief the control block for colour-filling-with-gradient-operations
+ *  \note arm_2d_op_fill_cl_gradient_t inherits from arm_2d_op_t explicitly
+ *  \note the OPs cannot be recorded by a display list, as the colour stops and
+ *        the mask are referenced by pointers
+ */
+typedef struct arm_2d_op_fill_cl_gradient_t {
+ARM_PRIVATE(
+    implement(arm_2d_op_t);                         /* inherit from base class arm_2d_op_t*/
+
+    arm_2d_region_t tRegion;                        /* the target region clipped with the mask */
+    const arm_2d_tile_t *ptMask;
+    const arm_2d_gradient_stop_t *ptStops;
+    uint8_t chStopCount;
+    uint8_t chType;
+    uint8_t chOpacity;
+    uint8_t                 : 8;
+
+    union {
+        struct {
+            arm_2d_location_t tStart;
+            arm_2d_location_t tEnd;
+        } Linear;
+        struct {
+            arm_2d_location_t tCentre;
+            int16_t iRadius;
+        } Radial;
+        struct {
+            arm_2d_location_t tCentre;
+            uint16_t hwStartAngle;                  /* in 1/65536 turn */
+        } Conic;
+    };
+)
+} arm_2d_op_fill_cl_gradient_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*----------------------------------------------------------------------------*
+ * Linear Gradient                                                            *
+ *----------------------------------------------------------------------------*/
+
+/*!
+ *  \brief fill the target region with a linear gradient
+ *  \details The position 0 is on the line through tStart and perpendicular to
+ *           the direction from tStart to tEnd, and the position 255 is on the
+ *           parallel line through tEnd. Pixels beyond them take the colour of
+ *           the first and the last stop respectively.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tStart the start point relative to the target region
+ *  \param[in] tEnd the end point relative to the target region
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_gray8_fill_colour_with_linear_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tStart,
+                                    arm_2d_location_t tEnd,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*!
+ *  \brief fill the target region with a linear gradient
+ *  \details The position 0 is on the line through tStart and perpendicular to
+ *           the direction from tStart to tEnd, and the position 255 is on the
+ *           parallel line through tEnd. Pixels beyond them take the colour of
+ *           the first and the last stop respectively.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tStart the start point relative to the target region
+ *  \param[in] tEnd the end point relative to the target region
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_rgb565_fill_colour_with_linear_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tStart,
+                                    arm_2d_location_t tEnd,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*!
+ *  \brief fill the target region with a linear gradient
+ *  \details The position 0 is on the line through tStart and perpendicular to
+ *           the direction from tStart to tEnd, and the position 255 is on the
+ *           parallel line through tEnd. Pixels beyond them take the colour of
+ *           the first and the last stop respectively.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tStart the start point relative to the target region
+ *  \param[in] tEnd the end point relative to the target region
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_cccn888_fill_colour_with_linear_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tStart,
+                                    arm_2d_location_t tEnd,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*----------------------------------------------------------------------------*
+ * Radial Gradient                                                            *
+ *----------------------------------------------------------------------------*/
+
+/*!
+ *  \brief fill the target region with a radial gradient
+ *  \details The position 0 is at the centre and the position 255 is on the
+ *           circle with the given radius. Pixels outside the circle take the
+ *           colour of the last stop.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tCentre the centre relative to the target region
+ *  \param[in] iRadius the radius, it must be positive
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_gray8_fill_colour_with_radial_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    int16_t iRadius,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*!
+ *  \brief fill the target region with a radial gradient
+ *  \details The position 0 is at the centre and the position 255 is on the
+ *           circle with the given radius. Pixels outside the circle take the
+ *           colour of the last stop.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tCentre the centre relative to the target region
+ *  \param[in] iRadius the radius, it must be positive
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_rgb565_fill_colour_with_radial_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    int16_t iRadius,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*!
+ *  \brief fill the target region with a radial gradient
+ *  \details The position 0 is at the centre and the position 255 is on the
+ *           circle with the given radius. Pixels outside the circle take the
+ *           colour of the last stop.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tCentre the centre relative to the target region
+ *  \param[in] iRadius the radius, it must be positive
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_cccn888_fill_colour_with_radial_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    int16_t iRadius,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*----------------------------------------------------------------------------*
+ * Conic Gradient                                                             *
+ *----------------------------------------------------------------------------*/
+
+/*!
+ *  \brief fill the target region with a conic (sweep) gradient
+ *  \details The position grows clockwise around the centre from 0 at the
+ *           start angle to 255 after a full turn.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tCentre the centre relative to the target region
+ *  \param[in] fStartAngle the start angle in radian, 0 points to the positive
+ *             X axis. Please use ARM_2D_ANGLE() to convert degrees.
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_gray8_fill_colour_with_conic_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    float fStartAngle,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*!
+ *  \brief fill the target region with a conic (sweep) gradient
+ *  \details The position grows clockwise around the centre from 0 at the
+ *           start angle to 255 after a full turn.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tCentre the centre relative to the target region
+ *  \param[in] fStartAngle the start angle in radian, 0 points to the positive
+ *             X axis. Please use ARM_2D_ANGLE() to convert degrees.
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_rgb565_fill_colour_with_conic_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    float fStartAngle,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*!
+ *  \brief fill the target region with a conic (sweep) gradient
+ *  \details The position grows clockwise around the centre from 0 at the
+ *           start angle to 255 after a full turn.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region, NULL means the whole target tile
+ *  \param[in] ptMask an optional A8 mask aligned with the top-left corner of
+ *             the target region, NULL means no mask
+ *  \param[in] tCentre the centre relative to the target region
+ *  \param[in] fStartAngle the start angle in radian, 0 points to the positive
+ *             X axis. Please use ARM_2D_ANGLE() to convert degrees.
+ *  \param[in] ptStops the colour stops sorted by their positions. They must
+ *             be kept unchanged until the operation is complete.
+ *  \param[in] chStopCount the number of colour stops
+ *  \param[in] chOpacity the opacity
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_cccn888_fill_colour_with_conic_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    float fStartAngle,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity);
+
+/*! @} */
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+
+#endif /* __ARM_2D_FILL_COLOUR_WITH_GRADIENT_H__ */
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_filter_separable_blur.h
+ * Description:  APIs for the separable Box/Gaussian Blur
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef __ARM_2D_FILTER_SEPARABLE_BLUR_H__
+#define __ARM_2D_FILTER_SEPARABLE_BLUR_H__
+
+/*============================ INCLUDES ======================================*/
+#include "arm_2d_types.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#endif
+
+/*!
+ * \addtogroup gFilter 7 Filter Operations
+ * @{
+ */
+
+/*============================ MACROS ========================================*/
+
+/*! \brief the largest radius supported by the separable blur
+ *! \note the weights of a Gaussian kernel with radius r add up to 2^(2r), the
+ *!       limit keeps the weighted sum of a channel within 32 bits
+ */
+#define ARM_2D_FILTER_SEPARABLE_BLUR_MAX_RADIUS     8
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief the kernels of the separable blur
+ */
+typedef enum {
+    ARM_2D_FILTER_BLUR_KERNEL_BOX = 0,          //!< all taps have the same weight
+    ARM_2D_FILTER_BLUR_KERNEL_GAUSSIAN,         //!< binomial weights, i.e. an integer Gaussian approximation
+} arm_2d_filter_blur_kernel_t;
+
+typedef struct arm_2d_filter_separable_blur_descriptor_t {
+ARM_PRIVATE(
+    implement(arm_2d_op_src_t);                     /* inherit from base class arm_2d_op_src_t*/
+
+    arm_2d_region_t tRegion;                        /* the target region clipped with the source size */
+    uint8_t chKernel;
+    uint8_t chRadius;
+)
+
+    /*! \note an optional scratch memory provided by users, when it is empty
+     *!       the filter uses the pooled scratch memory instead.
+     */
+    arm_2d_scratch_mem_t tScratchMemory;
+
+}arm_2d_filter_separable_blur_descriptor_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+
+extern
+ARM_NONNULL(2,3)
+/*!
+ *  \brief blur a source tile into a specified region on the target tile
+ *  \details The blur runs in two passes (rows then columns) and reads a guard
+ *           band of chRadius pixels around the visible area from the source
+ *           tile. The edges of the source tile are extended (clamped), hence
+ *           the result doesn't depend on the size or the traversal order of
+ *           the PFBs, and the cost of each pixel is fixed.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptSource the source tile, it must have the same colour format
+ *             as the target and must not be a virtual resource or the target
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region
+ *  \param[in] tKernel the kernel of the blur
+ *  \param[in] chRadius the radius of the kernel (0 ~
+ *             ARM_2D_FILTER_SEPARABLE_BLUR_MAX_RADIUS)
+ *  \note when tScratchMemory of the control block is empty, the scratch memory
+ *        is taken from a pool which grows to the largest PFB it has seen and
+ *        is reused by all following PFBs and frames.
+ *  \note the OP cannot be recorded by a display list, as the source tile is
+ *        read by the backend directly.
+ *  \return arm_fsm_rt_t the operations result
+ */
+arm_fsm_rt_t arm_2dp_gray8_filter_separable_blur(
+                    arm_2d_filter_separable_blur_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptSource,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    arm_2d_filter_blur_kernel_t tKernel,
+                    uint8_t chRadius);
+
+extern
+ARM_NONNULL(2,3)
+/*!
+ *  \brief blur a source tile into a specified region on the target tile
+ *  \details The blur runs in two passes (rows then columns) and reads a guard
+ *           band of chRadius pixels around the visible area from the source
+ *           tile. The edges of the source tile are extended (clamped), hence
+ *           the result doesn't depend on the size or the traversal order of
+ *           the PFBs, and the cost of each pixel is fixed.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptSource the source tile, it must have the same colour format
+ *             as the target and must not be a virtual resource or the target
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region
+ *  \param[in] tKernel the kernel of the blur
+ *  \param[in] chRadius the radius of the kernel (0 ~
+ *             ARM_2D_FILTER_SEPARABLE_BLUR_MAX_RADIUS)
+ *  \note when tScratchMemory of the control block is empty, the scratch memory
+ *        is taken from a pool which grows to the largest PFB it has seen and
+ *        is reused by all following PFBs and frames.
+ *  \note the OP cannot be recorded by a display list, as the source tile is
+ *        read by the backend directly.
+ *  \return arm_fsm_rt_t the operations result
+ */
+arm_fsm_rt_t arm_2dp_rgb565_filter_separable_blur(
+                    arm_2d_filter_separable_blur_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptSource,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    arm_2d_filter_blur_kernel_t tKernel,
+                    uint8_t chRadius);
+
+extern
+ARM_NONNULL(2,3)
+/*!
+ *  \brief blur a source tile into a specified region on the target tile
+ *  \details The blur runs in two passes (rows then columns) and reads a guard
+ *           band of chRadius pixels around the visible area from the source
+ *           tile. The edges of the source tile are extended (clamped), hence
+ *           the result doesn't depend on the size or the traversal order of
+ *           the PFBs, and the cost of each pixel is fixed.
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptSource the source tile, it must have the same colour format
+ *             as the target and must not be a virtual resource or the target
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptRegion the target region
+ *  \param[in] tKernel the kernel of the blur
+ *  \param[in] chRadius the radius of the kernel (0 ~
+ *             ARM_2D_FILTER_SEPARABLE_BLUR_MAX_RADIUS)
+ *  \note when tScratchMemory of the control block is empty, the scratch memory
+ *        is taken from a pool which grows to the largest PFB it has seen and
+ *        is reused by all following PFBs and frames.
+ *  \note the OP cannot be recorded by a display list, as the source tile is
+ *        read by the backend directly.
+ *  \note the unused channel (n) of the target pixels is kept unchanged
+ *  \return arm_fsm_rt_t the operations result
+ */
+arm_fsm_rt_t arm_2dp_cccn888_filter_separable_blur(
+                    arm_2d_filter_separable_blur_descriptor_t *ptOP,
+                    const arm_2d_tile_t *ptSource,
+                    const arm_2d_tile_t *ptTarget,
+                    const arm_2d_region_t *ptRegion,
+                    arm_2d_filter_blur_kernel_t tKernel,
+                    uint8_t chRadius);
+
+/*!
+ *  \brief get the size of the scratch memory required by the separable blur
+ *  \param[in] iWidth the width of the largest area blurred in one go, i.e.
+ *             the PFB width when the target region is wider than a PFB
+ *  \param[in] chRadius the radius of the kernel
+ *  \param[in] chColourSZ the colour size, e.g. ARM_2D_COLOUR_SZ_16BIT
+ *  \return uint32_t the size in bytes
+ */
+extern
+uint32_t arm_2d_filter_separable_blur_get_scratch_size(
+                                                int16_t iWidth,
+                                                uint8_t chRadius,
+                                                uint8_t chColourSZ);
+
+/*!
+ *  \brief free the pooled scratch memory used by the separable blur
+ *  \note call this function only when no separable blur is in progress
+ */
+extern
+void arm_2d_filter_separable_blur_free_scratch_pool(void);
+
+/*! @} */
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+
+#endif /* __ARM_2D_FILTER_SEPARABLE_BLUR_H__ */
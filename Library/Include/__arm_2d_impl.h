@@ -63,11 +63,20 @@ extern "C" {
 #undef OP_CORE
 #define OP_CORE         this.use_as__arm_2d_op_core_t
 
-#define ARM_2D_IMPL(__TYPE, ...)                                                \
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+#   define ARM_2D_IMPL(__TYPE, ...)                                             \
+            __TYPE *ptThis = (__TYPE *)(NULL,##__VA_ARGS__);                    \
+            if (NULL == ptThis) {                                               \
+                ptThis = (__TYPE *)&ARM_2D_CTRL.DefaultOP[                      \
+                                    arm_2d_port_get_default_op_index()];        \
+            }
+#else
+#   define ARM_2D_IMPL(__TYPE, ...)                                             \
             __TYPE *ptThis = (__TYPE *)(NULL,##__VA_ARGS__);                    \
             if (NULL == ptThis) {                                               \
                 ptThis = (__TYPE *)&ARM_2D_CTRL.DefaultOP;                      \
             }
+#endif
 
 /*============================ MACROFIED FUNCTIONS ===========================*/
 
@@ -279,6 +288,24 @@ extern "C" {
             } while(0)
 #endif
 
+#ifndef __ARM_2D_PIXEL_BLENDING_OPA_CCCA8888
+/* premultiplied source-over, the alpha channel is blended as well */
+#   define __ARM_2D_PIXEL_BLENDING_OPA_CCCA8888(__SRC_ADDR, __DES_ADDR, __OPA)  \
+            do {                                                                \
+                uint_fast16_t hwOpa = (__OPA);                                  \
+                const uint8_t *pchSrc = (uint8_t *)(__SRC_ADDR);                \
+                uint8_t *pchDes = (uint8_t *)(__DES_ADDR);                      \
+                uint_fast16_t hwTrans = 256 - ((pchSrc[3] * hwOpa) >> 8);       \
+                uint_fast8_t ARM_2D_SAFE_NAME(n) = sizeof(uint32_t);            \
+                                                                                \
+                do {                                                            \
+                    *pchDes = ( ((uint_fast16_t)(*pchSrc++) * hwOpa) >> 8)      \
+                            + ( ((uint_fast16_t)(*pchDes) * hwTrans) >> 8);     \
+                     pchDes++;                                                  \
+                } while(--ARM_2D_SAFE_NAME(n));                                 \
+            } while(0)
+#endif
+
 #ifndef __ARM_2D_PIXEL_AVERAGE_RGB565
 #   define __ARM_2D_PIXEL_AVERAGE_RGB565(__PIXEL_IN, __ALPHA)                   \
     do {                                                                        \
@@ -300,6 +327,17 @@ extern "C" {
     } while(0)
 #endif
 
+#ifndef __ARM_2D_PIXEL_AVERAGE_CCCA8888
+#   define __ARM_2D_PIXEL_AVERAGE_CCCA8888(__PIXEL_IN, __ALPHA)                  \
+    do {                                                                        \
+        arm_2d_color_ccca8888_t tTempColour = {.tValue = (__PIXEL_IN)};         \
+        tPixel.BGRA[0] += tTempColour.u8C[0] * (__ALPHA);                       \
+        tPixel.BGRA[1] += tTempColour.u8C[1] * (__ALPHA);                       \
+        tPixel.BGRA[2] += tTempColour.u8C[2] * (__ALPHA);                       \
+        tPixel.BGRA[3] += tTempColour.u8A * (__ALPHA);                          \
+    } while(0)
+#endif
+
 #ifndef __ARM_2D_PIXEL_AVERAGE_GRAY8
 #   define __ARM_2D_PIXEL_AVERAGE_GRAY8(__PIXEL_IN, __ALPHA)                    \
     do {                                                                        \
@@ -316,6 +354,15 @@ typedef struct __arm_2d_point_adj_alpha_t{
     }tMatrix[4];
 } __arm_2d_point_adj_alpha_t;
 
+/*!
+ * \brief the columns [iStart, iEnd) of a target row in which the transformed 
+ *        points may hit the source
+ */
+typedef struct __arm_2d_transform_span_t {
+    int16_t iStart;
+    int16_t iEnd;
+} __arm_2d_transform_span_t;
+
 /*!
  * \brief private enum for mask validation 
  */
@@ -429,6 +476,7 @@ enum {
     __ARM_2D_OP_IDX_FILL_COLOUR_WITH_VERTICAL_LINE_MASK_AND_OPACITY,
 
     __ARM_2D_OP_IDX_DRAW_POINT,
+    __ARM_2D_OP_IDX_DRAW_POINTS,
     __ARM_2D_OP_IDX_DRAW_PATTERN,
 
     __ARM_2D_OP_IDX_COLOUR_FORMAT_CONVERSION,
@@ -458,6 +506,10 @@ enum {
     //__ARM_2D_OP_IDX_TRANSFORM_WITH_TARGET_MASK_AND_OPACITY,                   //!< todo in v1.xx
 
     __ARM_2D_OP_IDX_FILETER_IIR_BLUR,
+    __ARM_2D_OP_IDX_FILTER_SEPARABLE_BLUR,
+
+    __ARM_2D_OP_IDX_FILL_PATH,
+    __ARM_2D_OP_IDX_FILL_COLOUR_WITH_GRADIENT,
 
     /*------------ arm-2d operation idx end --------------*/
 
@@ -557,7 +609,25 @@ ARM_PRIVATE(
     uint8_t         bIsCPL              : 1;
     uint8_t                             : 7;
     uint16_t                            : 16;
-    
+
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+    __arm_2d_sub_task_t         *ptNewerInFlight;                               //!< the links of the in-flight list
+    __arm_2d_sub_task_t         *ptOlderInFlight;
+    uint32_t                    wSequence;                                      //!< the issue order
+    bool                        bInFlight;                                      //!< issued but not yet completed
+    uint8_t                     bWaitForAll         : 1;                        //!< too many dependencies, wait for all earlier sub-tasks
+    uint8_t                                         : 7;
+    uint8_t                     chWaitCount;                                    //!< the number of valid items in WaitFor[]
+    uint8_t                                         : 8;
+    struct {
+        __arm_2d_sub_task_t     *ptTask;
+        uint32_t                wSequence;                                      //!< ptTask is completed when its sequence changes
+    } WaitFor[4];                                                               //!< the earlier sub-tasks this one depends on
+    __arm_2d_tile_param_t       *ptTargetParam;                                 //!< the tile written by this sub-task
+    __arm_2d_tile_param_t       *ptReadParam[4];                                //!< the tiles read by this sub-task
+    __arm_2d_tile_param_t       tBackendSource;                                 //!< the source read by the backend directly, see bBackendReadsSource
+#endif
+
     union {
         __arm_2d_tile_param_t           tTileProcess;
         __arm_2d_param_target_msk_t     tTileMaskProcess;
@@ -577,10 +647,26 @@ ARM_PRIVATE(
 struct __arm_2d_op_control {
 ARM_PRIVATE(
     __arm_2d_sub_task_t   *ptFreeList;
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+    struct {
+        __arm_2d_sub_task_t   *ptHead;
+        __arm_2d_sub_task_t   *ptTail;
+    } TaskFIFO[__ARM_2D_CFG_ASYNC_WORKER_COUNT__];                              //!< one sub-task queue per worker
+
+    struct {
+        __arm_2d_sub_task_t   *ptNewest;
+        __arm_2d_sub_task_t   *ptOldest;
+    } InFlight;                                                                 //!< issued but not yet completed sub-tasks
+    uint32_t              wSequence;
+    uint8_t               chNextWorker;
+    uint8_t               bFrontendBusy;
+    uint16_t                            : 16;
+#else
     struct {
         __arm_2d_sub_task_t   *ptHead;
         __arm_2d_sub_task_t   *ptTail;
     } TaskFIFO;
+#endif
     
     struct {
         arm_2d_op_core_t   *ptHead;
@@ -593,6 +679,29 @@ ARM_PRIVATE(
     uint16_t                            : 16;
     
     arm_2d_tile_t           *ptDefaultFrameBuffer;
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+    arm_2d_display_list_t   *ptRecordingList;                                   //!< the display list which is recording
+    uint8_t                 chRecordingOPIndex;                                 //!< the default OP used by the recording thread
+    uint8_t                             : 8;
+    uint16_t                            : 16;
+#endif
+
+#if __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+    arm_2d_op_early_reject_statistics_t EarlyReject;
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    struct {
+        arm_2d_profiler_record_t *ptRecords;                                    //!< the ring buffer
+        uint16_t            hwSize;                                             //!< the number of records in the ring buffer
+        uint16_t            hwHead;                                             //!< the oldest record
+        uint16_t            hwCount;                                            //!< the number of valid records
+        uint16_t                        : 16;
+        uint32_t            wLost;                                              //!< the number of records overwritten
+        uint8_t             chPFBIndex[__ARM_2D_CFG_DEFAULT_OP_COUNT__];        //!< the PFB index set by each drawing thread
+    } Profiler;
+#endif
     
     union {
         arm_2d_op_t                         tBasic;
@@ -614,7 +723,11 @@ ARM_PRIVATE(
         arm_2d_op_msk_t                     tBasicMask;
         arm_2d_op_src_msk_t                 tSourceMask;
         arm_2d_op_src_orig_msk_t            tSourceOrigMask;
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+    } DefaultOP[__ARM_2D_CFG_DEFAULT_OP_COUNT__];   /* one for each drawing thread */
+#else
     } DefaultOP;
+#endif
 )};
 
 
@@ -658,6 +771,47 @@ arm_fsm_rt_t __arm_2d_op_depose(arm_2d_op_core_t *ptThis,
 
 extern 
 void __arm_2d_sub_task_depose(arm_2d_op_core_t *ptOP);
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+/*! \brief add an OP to the display list which is recording
+ *! \note  This API is called by __arm_2d_op_invoke() before the OP is executed
+ */
+extern
+void __arm_2d_display_list_record(arm_2d_op_core_t *ptOP);
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+/*! \brief add a record to the profiler ring buffer
+ *! \param[in] ptOP the OP which the event belongs to
+ *! \param[in] chType the type of the record, see arm_2d_profiler_evt_t
+ *! \param[in] chThreadIndex the default-OP slot of an OP or the worker index
+ *!            of a sub-task
+ *! \param[in] lStart the timestamp when the event starts
+ *! \param[in] wPixelCount the number of target pixels
+ */
+extern
+void __arm_2d_profiler_record(  arm_2d_op_core_t *ptOP,
+                                uint_fast8_t chType,
+                                uint_fast8_t chThreadIndex,
+                                int64_t lStart,
+                                uint32_t wPixelCount);
+
+/*! \brief get the default-OP slot of the calling thread
+ */
+extern
+uint_fast8_t __arm_2d_profiler_get_thread_index(void);
+
+/*! \brief get the number of target pixels of an OP
+ */
+extern
+uint32_t __arm_2d_profiler_get_op_pixel_count(arm_2d_op_core_t *ptOP);
+
+/*! \brief get the number of target pixels of a sub-task
+ */
+extern
+uint32_t __arm_2d_profiler_get_sub_task_pixel_count(__arm_2d_sub_task_t *ptTask);
+#endif
+
 /*----------------------------------------------------------------------------*
  * Utilities                                                                  *
  *----------------------------------------------------------------------------*/
@@ -669,6 +823,25 @@ extern
 __arm_2d_point_adj_alpha_t 
 __arm_2d_point_get_adjacent_alpha_q16(arm_2d_point_fx_t *ptPoint);
 
+/*!
+ * \brief get the span of a target row in which the transformed points may hit
+ *        the source, the pixels outside the span can be skipped
+ * \param[in] regrCoefs the regression coefficients of the first and the last
+ *            columns
+ * \param[in] iY the row index
+ * \param[in] iWidth the number of pixels in a row
+ * \param[in] ptOrigValidRegion the valid region of the source
+ * \return __arm_2d_transform_span_t the span, which is empty when iStart
+ *         equals iEnd
+ */
+extern
+ARM_NONNULL(1,4)
+__arm_2d_transform_span_t 
+__arm_2d_transform_get_row_span(const arm_2d_rot_linear_regr_t regrCoefs[2],
+                                int_fast16_t iY,
+                                int_fast16_t iWidth,
+                                const arm_2d_region_t *ptOrigValidRegion);
+
 extern
 arm_2d_err_t  __arm_mask_validate(  const arm_2d_tile_t *ptSource,
                                     const arm_2d_tile_t *ptSrcMask,
@@ -703,6 +876,9 @@ const arm_2d_tile_t *__arm_2d_tile_get_root(const arm_2d_tile_t *ptTile,
 extern 
 arm_fsm_rt_t __arm_2d_sw_draw_point(__arm_2d_sub_task_t *ptTask);      
 
+extern 
+arm_fsm_rt_t __arm_2d_sw_draw_points(__arm_2d_sub_task_t *ptTask);
+
 extern 
 arm_fsm_rt_t __arm_2d_c8bit_sw_draw_pattern( __arm_2d_sub_task_t *ptTask);
 
@@ -1625,6 +1801,9 @@ arm_fsm_rt_t __arm_2d_rgb565_sw_transform_only(__arm_2d_sub_task_t *ptTask);
 extern
 arm_fsm_rt_t __arm_2d_cccn888_sw_transform_only(__arm_2d_sub_task_t *ptTask);
 
+extern
+arm_fsm_rt_t __arm_2d_ccca8888_sw_transform_only(__arm_2d_sub_task_t *ptTask);
+
 extern
 arm_fsm_rt_t 
 __arm_2d_gray8_sw_transform_with_colour_keying_and_opacity(__arm_2d_sub_task_t *ptTask);
@@ -1649,6 +1828,10 @@ extern
 arm_fsm_rt_t 
 __arm_2d_cccn888_sw_transform_only_with_opacity(__arm_2d_sub_task_t *ptTask);
 
+extern
+arm_fsm_rt_t 
+__arm_2d_ccca8888_sw_transform_only_with_opacity(__arm_2d_sub_task_t *ptTask);
+
 extern
 arm_fsm_rt_t 
 __arm_2d_gray8_sw_transform_with_src_mask(__arm_2d_sub_task_t *ptTask);
@@ -1684,6 +1867,40 @@ arm_fsm_rt_t __arm_2d_rgb565_sw_filter_iir_blur( __arm_2d_sub_task_t *ptTask);
 
 extern
 arm_fsm_rt_t __arm_2d_cccn888_sw_filter_iir_blur( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_gray8_sw_filter_separable_blur( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_rgb565_sw_filter_separable_blur( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_cccn888_sw_filter_separable_blur( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_gray8_sw_fill_path( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_rgb565_sw_fill_path( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_cccn888_sw_fill_path( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_gray8_sw_fill_colour_with_gradient( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_rgb565_sw_fill_colour_with_gradient( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_cccn888_sw_fill_colour_with_gradient( __arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_ccca8888_sw_tile_copy_with_opacity(__arm_2d_sub_task_t *ptTask);
+
+extern
+arm_fsm_rt_t __arm_2d_ccca8888_sw_colour_filling_with_mask_and_opacity(
+                                                __arm_2d_sub_task_t *ptTask);
 /*========================== POST INCLUDES ===================================*/
 #include "__arm_2d_direct.h"
 
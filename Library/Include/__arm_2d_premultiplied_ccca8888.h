@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_premultiplied_ccca8888.h
+ * Description:  APIs for blending into premultiplied CCCA8888 targets
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef __ARM_2D_PREMULTIPLIED_CCCA8888_H__
+#define __ARM_2D_PREMULTIPLIED_CCCA8888_H__
+
+/*============================ INCLUDES ======================================*/
+#include "arm_2d_types.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#endif
+
+/*!
+ * \addtogroup gAlpha 4 Alpha Blending Operations
+ * @{
+ */
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+#define arm_2d_ccca8888_tile_copy_with_opacity(                                 \
+                                        __SRC_ADDR,   /* source tile address */ \
+                                        __DES_ADDR,   /* target tile address */ \
+                                        __REGION_ADDR,/* region address */      \
+                                        __ALPHA)      /* alpha */               \
+            arm_2dp_ccca8888_tile_copy_with_opacity(  NULL,                     \
+                                            (__SRC_ADDR),                       \
+                                            (__DES_ADDR),                       \
+                                            (__REGION_ADDR),                    \
+                                            (__ALPHA))
+
+#define arm_2d_ccca8888_fill_colour_with_mask(                                  \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __ALPHA_ADDR,   /*   alpha tile address */  \
+                                    __COLOUR)       /*   colour */              \
+            arm_2dp_ccca8888_fill_colour_with_mask_and_opacity(                 \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                 (__ALPHA_ADDR),                                \
+                                 (__COLOUR),                                    \
+                                  255)
+
+#define arm_2d_ccca8888_fill_colour_with_mask_and_opacity(                      \
+                                    __TARGET_ADDR,  /*   target tile address*/  \
+                                    __REGION_ADDR,  /*   target region address*/\
+                                    __ALPHA_ADDR,   /*   alpha tile address */  \
+                                    __COLOUR,       /*   colour */              \
+                                    __OPACITY)                                  \
+            arm_2dp_ccca8888_fill_colour_with_mask_and_opacity(                 \
+                                  NULL,                                         \
+                                 (__TARGET_ADDR),                               \
+                                 (__REGION_ADDR),                               \
+                                 (__ALPHA_ADDR),                                \
+                                 (__COLOUR),                                    \
+                                 (__OPACITY))
+
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+
+/*!
+ * \brief blend a premultiplied ccca8888 tile onto a premultiplied ccca8888
+ *        target with a specified opacity (source-over)
+ * \note  both the source and the target store colour channels that have
+ *        already been multiplied by their alpha. The alpha channel of the
+ *        target is updated, hence the result can be used as a layer later.
+ * \param[in] ptOP the control block, NULL means using the default control block
+ * \param[in] ptSource the source tile
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the target region
+ * \param[in] chRatio the opacity
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_ccca8888_tile_copy_with_opacity(
+                                            arm_2d_op_alpha_t *ptOP,
+                                            const arm_2d_tile_t *ptSource,
+                                            const arm_2d_tile_t *ptTarget,
+                                            const arm_2d_region_t *ptRegion,
+                                            uint_fast8_t chRatio);
+
+/*!
+ * \brief fill a premultiplied ccca8888 target with a colour, an A8 mask and
+ *        an opacity (source-over)
+ * \note  tColour is a straight (non-premultiplied) colour. Its alpha channel
+ *        is combined with the mask and the opacity before blending.
+ * \param[in] ptOP the control block, NULL means using the default control block
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the target region
+ * \param[in] ptAlpha the mask tile
+ * \param[in] tColour the target colour
+ * \param[in] chOpacity the opacity
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_ccca8888_fill_colour_with_mask_and_opacity(
+                                        arm_2d_op_fill_cl_msk_opc_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_tile_t *ptAlpha,
+                                        arm_2d_color_ccca8888_t tColour,
+                                        uint8_t chOpacity);
+
+/*! @} */
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
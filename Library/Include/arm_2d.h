@@ -138,6 +138,110 @@ typedef struct {
     uint8_t                 : 8;
 } arm_2d_version_t;
 
+/*!
+ * \brief a type for the contention counters of the sub-task pool and FIFO
+ * \note only available when __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__ is 1
+ */
+typedef struct {
+    uint32_t    wPoolAccess;        //!< the number of sub-task allocations and releases
+    uint32_t    wPoolRetry;         //!< the number of failed CAS attempts on the sub-task pool
+    uint32_t    wFIFOAccess;        //!< the number of sub-task enqueues and dequeues
+    uint32_t    wFIFORetry;         //!< the number of failed CAS attempts on the sub-task FIFO
+    uint32_t    wLockBusy;          //!< the number of times a worker found the critical section busy
+} arm_2d_async_contention_t;
+
+/*!
+ * \brief a type for the statistics of the sub-task pool and FIFO
+ * \note only available when __ARM_2D_CFG_ASYNC_POOL_STATISTICS__ is 1
+ */
+typedef struct {
+    uint16_t    hwPoolSize;         //!< the number of sub-tasks in the pool (including the ones added from the arena)
+    uint16_t    hwInUse;            //!< the number of sub-tasks in use
+    uint16_t    hwHighWaterMark;    //!< the maximum number of sub-tasks in use at the same time
+    uint16_t    hwGrowCount;        //!< the number of sub-tasks added from the arena
+    uint16_t    hwFIFODepth;        //!< the number of sub-tasks waiting in the FIFO
+    uint16_t    hwFIFOMaxDepth;     //!< the maximum depth of the FIFO
+    uint32_t    wBookingFailure;    //!< the number of times an OP could not book enough sub-tasks and had to wait
+    uint32_t    wFIFODepthSum;      //!< the sum of the FIFO depths sampled on each enqueue
+    uint32_t    wFIFOSampleCount;   //!< the number of FIFO depth samples
+} arm_2d_async_pool_statistics_t;
+
+/*!
+ * \brief a type for the statistics of the OP early-reject stage
+ * \note only available when __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__ is 1
+ */
+typedef struct {
+    uint32_t    wChecked;           //!< the number of OPs checked by the early-reject stage
+    uint32_t    wRejected;          //!< the number of OPs found outside the root tile and rejected
+} arm_2d_op_early_reject_statistics_t;
+
+/*!
+ * \brief a type for the statistics of a display list
+ * \note only available when __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__ is 1
+ */
+typedef struct {
+    uint32_t    wRecordings;        //!< the number of recordings
+    uint32_t    wReused;            //!< the number of recordings keeping all the records
+    uint32_t    wInvalid;           //!< the number of recordings ending with an invalid list
+    uint32_t    wReplays;           //!< the number of replays
+    uint32_t    wReplayedOPs;       //!< the number of OPs issued by the replays
+    uint32_t    wCulledOPs;         //!< the number of records skipped as they miss the canvas
+    uint32_t    wUsed;              //!< the memory used by the records
+    uint16_t    hwCount;            //!< the number of records
+    uint16_t                : 16;
+} arm_2d_display_list_statistics_t;
+
+/*!
+ * \brief a display list which records the OPs of a frame and replays them 
+ *        on other PFBs (or dirty regions) of the same frame and the
+ *        following frames
+ * \note only available when __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__ is 1
+ */
+typedef struct arm_2d_display_list_t {
+ARM_PRIVATE(
+    uint8_t                 *pchBuffer;         //!< the memory used to keep the records
+    uint32_t                wSize;              //!< the size of the memory
+    uint32_t                wUsed;              //!< the used memory
+
+    struct __arm_2d_display_list_entry_t *ptHead;   //!< the first record
+    struct __arm_2d_display_list_entry_t *ptTail;   //!< the last record
+    struct __arm_2d_display_list_entry_t *ptVerify; //!< the next record to compare with
+
+    const arm_2d_tile_t     *ptCanvas;          //!< the canvas used in recording
+    uint16_t                hwCount;            //!< the number of records
+    uint8_t                 bRecording  : 1;    //!< the list is recording
+    uint8_t                 bValid      : 1;    //!< the list can be replayed
+    uint8_t                 bVerifying  : 1;    //!< the OPs are compared with the records
+    uint8_t                             : 5;
+    uint8_t                             : 8;
+
+    arm_2d_display_list_statistics_t tStatistics;   //!< the statistics
+)
+} arm_2d_display_list_t;
+
+/*!
+ * \brief the type of profiler records
+ */
+typedef enum {
+    ARM_2D_PROFILER_EVT_OP = 0,                 //!< an OP processed by the frontend
+    ARM_2D_PROFILER_EVT_SUB_TASK,               //!< a sub-task dispatched by arm_2d_task()
+} arm_2d_profiler_evt_t;
+
+/*!
+ * \brief a profiler record
+ * \note only available when __ARM_2D_CFG_SUPPORT_PROFILER__ is 1
+ */
+typedef struct arm_2d_profiler_record_t {
+    int64_t     lTimestamp;                     //!< the timestamp when the event starts
+    uint32_t    wElapsed;                       //!< the elapsed time in timestamp ticks
+    uint32_t    wPixelCount;                    //!< the number of target pixels
+    uint8_t     chOPIndex;                      //!< the OP index, i.e. arm_2d_op_info_t::chOpIndex
+    uint8_t     chColourFormat;                 //!< the colour format, i.e. arm_2d_color_info_t::chScheme
+    uint8_t     chPFBIndex;                     //!< the index of the PFB in the frame
+    uint8_t     chType;                         //!< the type of the record, see arm_2d_profiler_evt_t
+    uint8_t     chThreadIndex;                  //!< the default-OP slot for OPs, the worker index for sub-tasks
+} arm_2d_profiler_record_t;
+
 /*============================ GLOBAL VARIABLES ==============================*/
 
 /*!
@@ -271,6 +375,262 @@ arm_2d_op_status_t arm_2d_get_op_status(arm_2d_op_core_t *ptOP);
 extern
 arm_fsm_rt_t arm_2d_task(arm_2d_task_t *ptTask);
 
+#if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+/*!
+ * \brief enter a critical section shared by all arm_2d_task() workers and 
+ *        all threads that call arm-2d APIs at the same time
+ * \note  The default implementation only disables interrupts, which is not 
+ *        enough when workers run on different cores or host threads. Please
+ *        override it with a spin-lock or a mutex in that case.
+ * \note  The critical section can be nested.
+ * \return uint32_t a value passed to the paired leave function
+ */
+extern
+uint32_t arm_2d_port_enter_worker_critical_section(void);
+
+/*!
+ * \brief leave the critical section shared by all arm_2d_task() workers
+ * \param[in] wState the value returned by the paired enter function
+ */
+extern
+void arm_2d_port_leave_worker_critical_section(uint32_t wState);
+#endif
+
+#if __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+/*!
+ * \brief get a snapshot of the contention counters
+ * \param[out] ptCounters the buffer for the counters
+ */
+extern
+void arm_2d_async_get_contention_counters(arm_2d_async_contention_t *ptCounters);
+
+/*!
+ * \brief reset the contention counters
+ */
+extern
+void arm_2d_async_reset_contention_counters(void);
+
+#   if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+/*!
+ * \brief the port calls this function when it finds the worker critical 
+ *        section busy, i.e. another worker holds it
+ * \note  This function should be called after the critical section is 
+ *        entered.
+ */
+extern
+void arm_2d_notif_worker_lock_contention(void);
+#   endif
+#endif
+
+#if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+/*!
+ * \brief get a snapshot of the sub-task pool and FIFO statistics
+ * \note the average FIFO depth is wFIFODepthSum / wFIFOSampleCount
+ * \param[out] ptStatistics the buffer for the statistics
+ */
+extern
+void arm_2d_async_get_pool_statistics(
+                                arm_2d_async_pool_statistics_t *ptStatistics);
+
+/*!
+ * \brief reset the sub-task pool and FIFO statistics
+ * \note the high-water marks restart from the current usage and the pool
+ *       size (including hwGrowCount) is kept
+ */
+extern
+void arm_2d_async_reset_pool_statistics(void);
+#endif
+
+#if __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+/*!
+ * \brief set the arena used to grow the sub-task pool on demand
+ * \note when an OP cannot book enough sub-tasks, the missing ones are taken
+ *       from the arena instead of letting the OP wait. The memory taken is 
+ *       never returned, so the arena is consumed only up to the peak usage.
+ * \param[in] pArena the memory of the arena
+ * \param[in] tSize the size of the arena in bytes
+ * \return arm_2d_err_t error code
+ */
+extern
+arm_2d_err_t arm_2d_async_set_pool_arena(void *pArena, size_t tSize);
+
+/*!
+ * \brief get the size of a sub-task, i.e. the bytes one sub-task takes in
+ *        the arena
+ * \return size_t the size in bytes
+ */
+extern
+size_t arm_2d_async_get_sub_task_size(void);
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+/*!
+ * \brief initialise a display list
+ * \param[in] ptThis the target display list
+ * \param[in] pBuffer the memory used to keep the records
+ * \param[in] wSize the size of the memory
+ * \return arm_2d_err_t the operation result
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_display_list_init(  arm_2d_display_list_t *ptThis,
+                                        void *pBuffer,
+                                        uint32_t wSize);
+
+/*!
+ * \brief record the OPs issued by the calling thread until
+ *        arm_2d_display_list_end_recording() is called
+ * \note  The OPs are still executed as usual during the recording.
+ * \note  When the list is valid, the OPs are compared with the records by
+ *        values instead of clearing the list. The records are kept as long
+ *        as the OP stream is unchanged, and the records after the first
+ *        difference are replaced, i.e. a list can be replayed on all the PFBs
+ *        of the following frames if the scene is static.
+ * \note  Only the built-in copy, fill, fill-colour, draw-point, draw-pattern
+ *        and colour-conversion OPs using the default OP (i.e. ptOP is NULL)
+ *        can be recorded. Other OPs (e.g. transforms, filters, draw-points,
+ *        fill-path, gradients and all user OPs) make the list invalid.
+ * \param[in] ptThis the target display list
+ * \param[in] ptCanvas the canvas (e.g. the PFB tile) passed to the drawing 
+ *            handlers
+ * \retval ARM_2D_ERR_NONE the recording starts
+ * \retval ARM_2D_ERR_BUSY another display list is recording
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_display_list_begin_recording(
+                                            arm_2d_display_list_t *ptThis,
+                                            const arm_2d_tile_t *ptCanvas);
+
+/*!
+ * \brief stop recording
+ * \param[in] ptThis the target display list
+ * \retval true the list is valid and can be replayed
+ * \retval false the list is invalid
+ */
+extern
+ARM_NONNULL(1)
+bool arm_2d_display_list_end_recording(arm_2d_display_list_t *ptThis);
+
+/*!
+ * \brief check whether a display list is recording OPs
+ * \note  a list stops recording once it becomes invalid
+ * \retval true a display list is recording
+ * \retval false no display list is recording
+ */
+extern
+bool arm_2d_display_list_is_recording(void);
+
+/*!
+ * \brief replay the recorded OPs on a given canvas
+ * \note  Only the records overlapping with the visible part of the canvas are 
+ *        executed. The source tiles and the drawing handlers must remain 
+ *        unchanged between the recording and the replay.
+ * \note  The replay does not modify the records, i.e. several threads (e.g.
+ *        the band workers) can replay the same list at the same time with
+ *        their own default OPs, but not during the recording.
+ * \param[in] ptThis the target display list
+ * \param[in] ptCanvas the canvas, e.g. another PFB of the same frame
+ * \retval true the records are replayed
+ * \retval false the list is invalid, please call the drawing handlers instead
+ */
+extern
+ARM_NONNULL(1,2)
+bool arm_2d_display_list_replay(arm_2d_display_list_t *ptThis,
+                                const arm_2d_tile_t *ptCanvas);
+
+/*!
+ * \brief get a snapshot of the statistics of a display list
+ * \param[in] ptThis the target display list
+ * \param[out] ptStatistics the buffer for the statistics
+ */
+extern
+ARM_NONNULL(1,2)
+void arm_2d_display_list_get_statistics(
+                            arm_2d_display_list_t *ptThis,
+                            arm_2d_display_list_statistics_t *ptStatistics);
+#endif
+
+#if __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+/*!
+ * \brief get a snapshot of the statistics of the OP early-reject stage
+ * \param[out] ptStatistics the buffer for the statistics
+ */
+extern
+ARM_NONNULL(1)
+void arm_2d_get_op_early_reject_statistics(
+                            arm_2d_op_early_reject_statistics_t *ptStatistics);
+
+/*!
+ * \brief reset the statistics of the OP early-reject stage
+ */
+extern
+void arm_2d_reset_op_early_reject_statistics(void);
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+/*!
+ * \brief start the profiler with a given ring buffer
+ * \note  When the ring buffer is full, the oldest records are overwritten.
+ * \param[in] ptRecords the ring buffer, NULL means stopping the profiler
+ * \param[in] hwCount the number of records in the ring buffer
+ */
+extern
+void arm_2d_profiler_init(  arm_2d_profiler_record_t *ptRecords,
+                            uint_fast16_t hwCount);
+
+/*!
+ * \brief set the index of the PFB being drawn by the calling thread, the 
+ *        index is saved in the following records
+ * \note  The PFB helper calls this function for each PFB.
+ * \param[in] chIndex the index of the PFB in the frame
+ */
+extern
+void arm_2d_profiler_set_pfb_index(uint_fast8_t chIndex);
+
+/*!
+ * \brief fetch (and remove) the oldest records from the ring buffer
+ * \param[out] ptBuffer the buffer for the records
+ * \param[in] hwCount the number of records the buffer can hold
+ * \return uint_fast16_t the number of records fetched
+ */
+extern
+ARM_NONNULL(1)
+uint_fast16_t arm_2d_profiler_fetch_records(arm_2d_profiler_record_t *ptBuffer,
+                                            uint_fast16_t hwCount);
+
+/*!
+ * \brief get the number of records overwritten since the profiler started
+ * \return uint32_t the number of lost records
+ */
+extern
+uint32_t arm_2d_profiler_get_lost_count(void);
+
+/*!
+ * \brief get the timestamp used by the profiler
+ * \note  The default implementation always returns 0, please override it. 
+ *        When the PFB helper is used, it is overridden with 
+ *        arm_2d_helper_get_system_timestamp().
+ * \return int64_t the timestamp
+ */
+extern
+int64_t arm_2d_port_get_profiler_timestamp(void);
+#endif
+
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+/*!
+ * \brief get the index of the default OP used by the calling thread
+ * \note  When passing NULL as ptOP, an arm-2d API uses a default OP. Each 
+ *        thread that draws at the same time must use a dedicated default OP.
+ *        The default implementation always returns 0, please override it to
+ *        return a unique index (less than __ARM_2D_CFG_DEFAULT_OP_COUNT__) 
+ *        for each thread.
+ * \return uint_fast8_t the index of the default OP
+ */
+extern
+uint_fast8_t arm_2d_port_get_default_op_index(void);
+#endif
+
 /*!
  * \brief allocate a memory block with specified memory type
  * 
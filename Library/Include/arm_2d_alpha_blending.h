@@ -4183,6 +4183,8 @@ arm_fsm_rt_t arm_2dp_cccn888_tile_fill_with_des_mask_and_xy_mirror(
 #include "__arm_2d_fill_colour_with_horizontal_line_mask.h"
 #include "__arm_2d_fill_colour_with_vertical_line_mask.h"
 #include "__arm_2d_tile_copy_with_source_mask_and_opacity.h"
+#include "__arm_2d_fill_colour_with_gradient.h"
+#include "__arm_2d_premultiplied_ccca8888.h"
 
 #if defined(__clang__)
 #pragma clang diagnostic pop
@@ -34,6 +34,7 @@
 /*============================ INCLUDES ======================================*/
 
 #include "arm_2d_types.h"
+#include "__arm_2d_draw_path.h"
 
 #ifdef   __cplusplus
 extern "C" {
@@ -119,6 +120,95 @@ extern "C" {
                                      (255,##__VA_ARGS__))
 
 
+#define arm_2dp_c8bit_draw_points       arm_2dp_gray8_draw_points
+#define arm_2dp_rgb16_draw_points       arm_2dp_rgb565_draw_points
+#define arm_2dp_rgb32_draw_points       arm_2dp_cccn888_draw_points
+
+#define arm_2dp_c8bit_draw_points_aa    arm_2dp_gray8_draw_points_aa
+#define arm_2dp_rgb16_draw_points_aa    arm_2dp_rgb565_draw_points_aa
+#define arm_2dp_rgb32_draw_points_aa    arm_2dp_cccn888_draw_points_aa
+
+#define arm_2d_gray8_draw_points(   __TARGET_ADDR,  /* target tile address */   \
+                                    __POINTS_ADDR,  /* point array address */   \
+                                    __COUNT,        /* number of points */      \
+                                    __COLOUR,       /* target colour */         \
+                                    ...)            /* per-point opacity */     \
+            arm_2dp_gray8_draw_points(  NULL,                                   \
+                                        (__TARGET_ADDR),                        \
+                                        (__POINTS_ADDR),                        \
+                                        (__COUNT),                              \
+                                        (__COLOUR),                             \
+                                        (NULL,##__VA_ARGS__),                   \
+                                        (255))
+
+#define arm_2d_rgb565_draw_points(  __TARGET_ADDR,  /* target tile address */   \
+                                    __POINTS_ADDR,  /* point array address */   \
+                                    __COUNT,        /* number of points */      \
+                                    __COLOUR,       /* target colour */         \
+                                    ...)            /* per-point opacity */     \
+            arm_2dp_rgb565_draw_points( NULL,                                   \
+                                        (__TARGET_ADDR),                        \
+                                        (__POINTS_ADDR),                        \
+                                        (__COUNT),                              \
+                                        (__COLOUR),                             \
+                                        (NULL,##__VA_ARGS__),                   \
+                                        (255))
+
+#define arm_2d_cccn888_draw_points( __TARGET_ADDR,  /* target tile address */   \
+                                    __POINTS_ADDR,  /* point array address */   \
+                                    __COUNT,        /* number of points */      \
+                                    __COLOUR,       /* target colour */         \
+                                    ...)            /* per-point opacity */     \
+            arm_2dp_cccn888_draw_points(NULL,                                   \
+                                        (__TARGET_ADDR),                        \
+                                        (__POINTS_ADDR),                        \
+                                        (__COUNT),                              \
+                                        (__COLOUR),                             \
+                                        (NULL,##__VA_ARGS__),                   \
+                                        (255))
+
+#define arm_2d_gray8_draw_points_aa(__TARGET_ADDR,  /* target tile address */   \
+                                    __POINTS_ADDR,  /* Q16 point array */       \
+                                    __COUNT,        /* number of points */      \
+                                    __COLOUR,       /* target colour */         \
+                                    ...)            /* per-point opacity */     \
+            arm_2dp_gray8_draw_points_aa(   NULL,                               \
+                                            (__TARGET_ADDR),                    \
+                                            (__POINTS_ADDR),                    \
+                                            (__COUNT),                          \
+                                            (__COLOUR),                         \
+                                            (NULL,##__VA_ARGS__),               \
+                                            (255))
+
+#define arm_2d_rgb565_draw_points_aa(                                           \
+                                    __TARGET_ADDR,  /* target tile address */   \
+                                    __POINTS_ADDR,  /* Q16 point array */       \
+                                    __COUNT,        /* number of points */      \
+                                    __COLOUR,       /* target colour */         \
+                                    ...)            /* per-point opacity */     \
+            arm_2dp_rgb565_draw_points_aa(  NULL,                               \
+                                            (__TARGET_ADDR),                    \
+                                            (__POINTS_ADDR),                    \
+                                            (__COUNT),                          \
+                                            (__COLOUR),                         \
+                                            (NULL,##__VA_ARGS__),               \
+                                            (255))
+
+#define arm_2d_cccn888_draw_points_aa(                                          \
+                                    __TARGET_ADDR,  /* target tile address */   \
+                                    __POINTS_ADDR,  /* Q16 point array */       \
+                                    __COUNT,        /* number of points */      \
+                                    __COLOUR,       /* target colour */         \
+                                    ...)            /* per-point opacity */     \
+            arm_2dp_cccn888_draw_points_aa( NULL,                               \
+                                            (__TARGET_ADDR),                    \
+                                            (__POINTS_ADDR),                    \
+                                            (__COUNT),                          \
+                                            (__COLOUR),                         \
+                                            (NULL,##__VA_ARGS__),               \
+                                            (255))
+
+
 #define arm_2d_c8bit_draw_pattern(  __PATTERN_ADDR, /* pattern tile address */  \
                                     __TARGET_ADDR,  /* target tile address*/    \
                                     __REGION_ADDR,  /* target region address*/  \
@@ -223,6 +313,36 @@ typedef struct arm_2d_op_drw_pt_t {
     arm_2d_region_t tTargetRegion;
 } arm_2d_op_drw_pt_t;
 
+/*! 
+ *  \brief the control block for drawing a batch of points
+ *  \note arm_2d_op_drw_pts_t inherits from arm_2d_op_t explicitly 
+ *  \note the OP cannot be recorded by a display list, as the locations and
+ *        the opacities are referenced by pointers
+ */
+typedef struct arm_2d_op_drw_pts_t {
+    inherit(arm_2d_op_core_t);                  //!< base
+    struct {
+        const arm_2d_tile_t     *ptTile;        //!< target tile 
+        const arm_2d_region_t   *ptRegion;      //!< target region
+    } Target;
+    union {
+        uint8_t  chColour;                      //!< 8bit colour
+        uint16_t hwColour;                      //!< 16bit colour
+        uint32_t wColour;                       //!< 32bit colour
+    };
+    struct {
+        union {
+            const arm_2d_location_t *ptLocations;   //!< integer coordinates
+            const arm_2d_point_fx_t *ptQ16;         //!< Q16 coordinates
+        };
+        const uint8_t           *pchOpacity;    //!< per-point opacity (optional)
+        uint16_t                hwCount;        //!< number of points
+    } Points;
+    uint8_t chOpacity;                          //!< opacity for all points
+    uint8_t bAntiAlias                  : 1;    //!< use Q16 sub-pixel points
+    uint8_t                             : 7;
+} arm_2d_op_drw_pts_t;
+
 /*!
  *  \brief the control block for draw-bit-pattern operations
  *  \note arm_2d_op_drw_patn_t inherits from arm_2d_op_src_t explicitly 
@@ -431,6 +551,153 @@ arm_fsm_rt_t arm_2d_rgba8888_draw_point(const arm_2d_tile_t *ptTarget,
 #endif 
 
 
+/*----------------------------------------------------------------------------*
+ * Draw a batch of points with specified colour                               *
+ *----------------------------------------------------------------------------*/
+
+/*!
+ *  \brief draw a batch of points with a given gray8 colour
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptPoints an array of point coordinates in the target tile
+ *  \param[in] hwCount the number of points
+ *  \param[in] chColour an 8bit colour
+ *  \param[in] pchOpacity an optional array of per-point opacity, NULL means
+ *             all points use chOpacity
+ *  \param[in] chOpacity the opacity applied to all points
+ *  \return arm_fsm_rt_t the operation result
+ *
+ *  \note The whole batch is clipped against the target tile (and the PFB) 
+ *        only once, points outside the visible area are silently skipped, 
+ *        hence there is no need to check each point with 
+ *        arm_2d_is_point_inside_region() before calling this API.
+ *  \note The point array (and the opacity array) must stay valid until the
+ *        operation is complete.
+ */
+extern
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_gray8_draw_points( arm_2d_op_drw_pts_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_location_t *ptPoints,
+                                        uint_fast16_t hwCount,
+                                        uint_fast8_t chColour,
+                                        const uint8_t *pchOpacity,
+                                        uint8_t chOpacity);
+
+/*!
+ *  \brief draw a batch of points with a given rgb565 colour
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptPoints an array of point coordinates in the target tile
+ *  \param[in] hwCount the number of points
+ *  \param[in] hwColour a 16bit colour
+ *  \param[in] pchOpacity an optional array of per-point opacity, NULL means
+ *             all points use chOpacity
+ *  \param[in] chOpacity the opacity applied to all points
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_rgb565_draw_points(arm_2d_op_drw_pts_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_location_t *ptPoints,
+                                        uint_fast16_t hwCount,
+                                        uint_fast16_t hwColour,
+                                        const uint8_t *pchOpacity,
+                                        uint8_t chOpacity);
+
+/*!
+ *  \brief draw a batch of points with a given cccn888 colour
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptPoints an array of point coordinates in the target tile
+ *  \param[in] hwCount the number of points
+ *  \param[in] wColour a 32bit colour
+ *  \param[in] pchOpacity an optional array of per-point opacity, NULL means
+ *             all points use chOpacity
+ *  \param[in] chOpacity the opacity applied to all points
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_cccn888_draw_points(   arm_2d_op_drw_pts_t *ptOP,
+                                            const arm_2d_tile_t *ptTarget,
+                                            const arm_2d_location_t *ptPoints,
+                                            uint_fast16_t hwCount,
+                                            uint32_t wColour,
+                                            const uint8_t *pchOpacity,
+                                            uint8_t chOpacity);
+
+/*!
+ *  \brief draw a batch of anti-aliased points with a given gray8 colour
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptPoints an array of Q16 point coordinates in the target tile
+ *  \param[in] hwCount the number of points
+ *  \param[in] chColour an 8bit colour
+ *  \param[in] pchOpacity an optional array of per-point opacity, NULL means
+ *             all points use chOpacity
+ *  \param[in] chOpacity the opacity applied to all points
+ *  \return arm_fsm_rt_t the operation result
+ *
+ *  \note Each point is spread over the 2x2 pixels around its sub-pixel 
+ *        position with bilinear weights.
+ */
+extern
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_gray8_draw_points_aa(  arm_2d_op_drw_pts_t *ptOP,
+                                            const arm_2d_tile_t *ptTarget,
+                                            const arm_2d_point_fx_t *ptPoints,
+                                            uint_fast16_t hwCount,
+                                            uint_fast8_t chColour,
+                                            const uint8_t *pchOpacity,
+                                            uint8_t chOpacity);
+
+/*!
+ *  \brief draw a batch of anti-aliased points with a given rgb565 colour
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptPoints an array of Q16 point coordinates in the target tile
+ *  \param[in] hwCount the number of points
+ *  \param[in] hwColour a 16bit colour
+ *  \param[in] pchOpacity an optional array of per-point opacity, NULL means
+ *             all points use chOpacity
+ *  \param[in] chOpacity the opacity applied to all points
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_rgb565_draw_points_aa( arm_2d_op_drw_pts_t *ptOP,
+                                            const arm_2d_tile_t *ptTarget,
+                                            const arm_2d_point_fx_t *ptPoints,
+                                            uint_fast16_t hwCount,
+                                            uint_fast16_t hwColour,
+                                            const uint8_t *pchOpacity,
+                                            uint8_t chOpacity);
+
+/*!
+ *  \brief draw a batch of anti-aliased points with a given cccn888 colour
+ *  \param[in] ptOP the control block, NULL means using the default control block
+ *  \param[in] ptTarget the target tile
+ *  \param[in] ptPoints an array of Q16 point coordinates in the target tile
+ *  \param[in] hwCount the number of points
+ *  \param[in] wColour a 32bit colour
+ *  \param[in] pchOpacity an optional array of per-point opacity, NULL means
+ *             all points use chOpacity
+ *  \param[in] chOpacity the opacity applied to all points
+ *  \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_cccn888_draw_points_aa(arm_2d_op_drw_pts_t *ptOP,
+                                            const arm_2d_tile_t *ptTarget,
+                                            const arm_2d_point_fx_t *ptPoints,
+                                            uint_fast16_t hwCount,
+                                            uint32_t wColour,
+                                            const uint8_t *pchOpacity,
+                                            uint8_t chOpacity);
+
+
 /*----------------------------------------------------------------------------*
  * Draw a bit patterns                                                        *
  *----------------------------------------------------------------------------*/
@@ -78,6 +78,23 @@ extern "C" {
 #   define __ARM_2D_HAS_HELIUM_FLOAT__                  0       //!< target MCU has no Helium floating point extension
 #endif
 
+#undef __ARM_2D_HAS_PORTABLE_SIMD__
+
+#ifndef __ARM_2D_CFG_ENABLE_PORTABLE_SIMD__
+#   define __ARM_2D_CFG_ENABLE_PORTABLE_SIMD__          1       //!< use the compiler vector extensions when Helium is not available
+#endif
+
+#if     __ARM_2D_CFG_ENABLE_PORTABLE_SIMD__                                     \
+    &&  !__ARM_2D_HAS_HELIUM__                                                  \
+    &&  (defined(__GNUC__) || defined(__clang__))                               \
+    &&  (defined(__ARM_NEON) || defined(__SSE2__))                              \
+    &&  defined(__BYTE_ORDER__)                                                 \
+    &&  (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#   define __ARM_2D_HAS_PORTABLE_SIMD__                 1       //!< target has a SIMD unit (Neon or SSE2) usable via the compiler vector extensions
+#else
+#   define __ARM_2D_HAS_PORTABLE_SIMD__                 0       //!< no portable SIMD acceleration
+#endif
+
 #if defined(__ARM_FEATURE_CDE) && __ARM_FEATURE_CDE
 #   define __ARM_2D_HAS_ACI__                           1       //!< target MCU has ACI implementation
 #else
@@ -113,6 +130,130 @@ extern "C" {
 #   endif
 #endif
 
+#ifndef __ARM_2D_CFG_ASYNC_WORKER_COUNT__
+#   define __ARM_2D_CFG_ASYNC_WORKER_COUNT__            1       //!< the number of arm_2d_task() workers draining the sub-task pool
+#endif
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ < 1 || __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 8
+#   warning __ARM_2D_CFG_ASYNC_WORKER_COUNT__ should be in the range of 1 to 8,\
+ set it to the default value 1.
+#   undef __ARM_2D_CFG_ASYNC_WORKER_COUNT__
+#   define __ARM_2D_CFG_ASYNC_WORKER_COUNT__            1
+#endif
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+#   if !defined(__ARM_2D_HAS_ASYNC__) || !__ARM_2D_HAS_ASYNC__
+#       warning The multi-worker backend requires __ARM_2D_HAS_ASYNC__ to be\
+ 1, __ARM_2D_CFG_ASYNC_WORKER_COUNT__ is forced to 1.
+#       undef __ARM_2D_CFG_ASYNC_WORKER_COUNT__
+#       define __ARM_2D_CFG_ASYNC_WORKER_COUNT__        1
+#   endif
+#endif
+
+#ifndef __ARM_2D_CFG_DEFAULT_OP_COUNT__
+#   if  defined(__ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__)                    \
+    &&  __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+/* one default OP for the PFB task and one for each band worker */
+#       define __ARM_2D_CFG_DEFAULT_OP_COUNT__                                  \
+            (__ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ + 1)
+#   else
+#       define __ARM_2D_CFG_DEFAULT_OP_COUNT__          1       //!< the number of threads that can use the default OP (i.e. pass NULL as ptOP) at the same time
+#   endif
+#endif
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ < 1
+#   warning __ARM_2D_CFG_DEFAULT_OP_COUNT__ should be at least 1, set it to\
+ the default value 1.
+#   undef __ARM_2D_CFG_DEFAULT_OP_COUNT__
+#   define __ARM_2D_CFG_DEFAULT_OP_COUNT__              1
+#endif
+
+#undef __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1 || __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+#   define __ARM_2D_HAS_WORKER_CRITICAL_SECTION__       1       //!< arm-2d APIs are called from more than one thread at the same time
+#else
+#   define __ARM_2D_HAS_WORKER_CRITICAL_SECTION__       0
+#endif
+
+#ifndef __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#   define __ARM_2D_CFG_ASYNC_LOCK_FREE__               0       //!< use a lock-free sub-task pool and FIFO (requires C11 atomics)
+#endif
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#   if !defined(__ARM_2D_HAS_ASYNC__) || !__ARM_2D_HAS_ASYNC__
+#       undef __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#       define __ARM_2D_CFG_ASYNC_LOCK_FREE__           0
+#   elif defined(__ARM_ARCH_6M__)
+#       warning The lock-free sub-task pool requires LDREX/STREX which is not\
+ available on Armv6-M, __ARM_2D_CFG_ASYNC_LOCK_FREE__ is forced to 0.
+#       undef __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#       define __ARM_2D_CFG_ASYNC_LOCK_FREE__           0
+#   elif    !defined(__cplusplus)                                               \
+        &&  (   !defined(__STDC_VERSION__)                                      \
+            ||  __STDC_VERSION__ < 201112L                                      \
+            ||  defined(__STDC_NO_ATOMICS__))
+#       warning The lock-free sub-task pool requires C11 atomics,\
+ __ARM_2D_CFG_ASYNC_LOCK_FREE__ is forced to 0.
+#       undef __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#       define __ARM_2D_CFG_ASYNC_LOCK_FREE__           0
+#   endif
+#endif
+
+#ifndef __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+#   define __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__     0       //!< count the accesses and the contentions of the sub-task pool and FIFO
+#endif
+#if !defined(__ARM_2D_HAS_ASYNC__) || !__ARM_2D_HAS_ASYNC__
+#   undef __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+#   define __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__     0
+#endif
+
+#ifndef __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+#   define __ARM_2D_CFG_ASYNC_POOL_STATISTICS__         0       //!< track the high-water mark of the sub-task pool, the booking failures and the FIFO depth
+#endif
+#if !defined(__ARM_2D_HAS_ASYNC__) || !__ARM_2D_HAS_ASYNC__
+#   undef __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+#   define __ARM_2D_CFG_ASYNC_POOL_STATISTICS__         0
+#endif
+
+#ifndef __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+#   define __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__          0       //!< grow the sub-task pool from a user arena when it runs out of sub-tasks
+#endif
+#if __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+#   if !defined(__ARM_2D_HAS_ASYNC__) || !__ARM_2D_HAS_ASYNC__
+#       undef __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+#       define __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__      0
+#   elif __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#       warning The lock-free sub-task pool has a fixed capacity,\
+ __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__ is forced to 0.
+#       undef __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+#       define __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__      0
+#   endif
+#endif
+
+#ifndef __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+#   define __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__          0       //!< record the OPs of a frame once and replay them for the rest PFBs
+#endif
+
+#ifndef __ARM_2D_CFG_SUPPORT_PROFILER__
+#   define __ARM_2D_CFG_SUPPORT_PROFILER__              0       //!< record the timing of OPs and sub-tasks into a ring buffer
+#endif
+
+#ifndef __ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__
+#   define __ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__       1       //!< reject the OPs outside the root tile (e.g. the current PFB) before any region calculation
+#endif
+
+#ifndef __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+#   define __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__    0       //!< count the OPs checked and rejected by the early-reject stage
+#endif
+#if !__ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__
+#   undef __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+#   define __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__    0
+#endif
+
+#ifndef __ARM_2D_CFG_SUPPORT_TRANSFORM_MIPMAP__
+#   define __ARM_2D_CFG_SUPPORT_TRANSFORM_MIPMAP__      1       //!< transform operations use the half-resolution levels of arm_2d_tile_mipmap_t for small scaling factors
+#endif
+
+#ifndef __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__
+#   define __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__       0       //!< cache the transformed masks for the quantised angles and scaling factors
+#endif
+
 #undef __ARM_2D_HAS_FPU__
 #if defined(__ARM_FP)
 #define __ARM_2D_HAS_FPU__                              1       //!< target MCU has FPU
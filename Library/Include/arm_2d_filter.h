@@ -34,6 +34,7 @@
 #include "arm_2d_types.h"
 
 #include "__arm_2d_filter_iir_blur.h"
+#include "__arm_2d_filter_separable_blur.h"
 
 #ifdef   __cplusplus
 extern "C" {
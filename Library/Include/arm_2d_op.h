@@ -668,6 +668,15 @@ const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINT_RGB16;
 
 extern
 const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINT_RGB32;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINTS_C8BIT;
+  
+extern
+const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINTS_RGB16;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINTS_RGB32;
     
 extern
 const __arm_2d_op_info_t ARM_2D_OP_DRAW_PATTERN_C8BIT;
@@ -711,6 +720,9 @@ const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_RGB565;
 extern
 const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_CCCN888;
 
+extern
+const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_CCCA8888;
+
 extern
 const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_WITH_COLOUR_KEYING_OPACITY_GRAY8;
 
@@ -729,6 +741,9 @@ const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_WITH_OPACITY_RGB565;
 extern
 const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_WITH_OPACITY_CCCN888;
 
+extern
+const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_WITH_OPACITY_CCCA8888;
+
 extern
 const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_WITH_SRC_MSK_GRAY8;
     
@@ -764,6 +779,39 @@ const __arm_2d_op_info_t ARM_2D_OP_FILTER_IIR_BLUR_RGB565;
 
 extern
 const __arm_2d_op_info_t ARM_2D_OP_FILTER_IIR_BLUR_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILTER_SEPARABLE_BLUR_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILTER_SEPARABLE_BLUR_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILTER_SEPARABLE_BLUR_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILL_PATH_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILL_PATH_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILL_PATH_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_GRAY8;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_RGB565;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_CCCN888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_TILE_COPY_WITH_OPACITY_CCCA8888;
+
+extern
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_MASK_AND_OPACITY_CCCA8888;
 /*============================ PROTOTYPES ====================================*/
 
 
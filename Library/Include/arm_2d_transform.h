@@ -1502,6 +1502,15 @@ extern "C" {
                                                    (__CENTRE),                  \
                                             (float)(__ANGLE),                   \
                                             (float)(__SCALE))
+#define arm_2d_ccca8888_tile_transform_only_prepare(__SRC_TILE_ADDR,            \
+                                            __CENTRE,                           \
+                                            __ANGLE,                            \
+                                            __SCALE)                            \
+            arm_2dp_ccca8888_tile_transform_only_prepare( NULL,                 \
+                                                   (__SRC_TILE_ADDR),           \
+                                                   (__CENTRE),                  \
+                                            (float)(__ANGLE),                   \
+                                            (float)(__SCALE))
 
 #define arm_2d_gray8_tile_transform_with_opacity_prepare(                       \
                                             __SRC_TILE_ADDR,                    \
@@ -1593,6 +1602,20 @@ extern "C" {
                                             (float)(__SCALE),                   \
                                                    (__OPACITY))
 
+#define arm_2d_ccca8888_tile_transform_only_with_opacity_prepare(               \
+                                            __SRC_TILE_ADDR,                    \
+                                            __CENTRE,                           \
+                                            __ANGLE,                            \
+                                            __SCALE,                            \
+                                            __OPACITY)                          \
+          arm_2dp_ccca8888_tile_transform_only_with_opacity_prepare(            \
+                                                    NULL,                       \
+                                                   (__SRC_TILE_ADDR),           \
+                                                   (__CENTRE),                  \
+                                            (float)(__ANGLE),                   \
+                                            (float)(__SCALE),                   \
+                                                   (__OPACITY))
+
 
 #define arm_2d_gray8_tile_transform_with_src_mask_prepare(                      \
                                             __SRC_TILE_ADDR,                    \
@@ -1836,6 +1859,28 @@ extern "C" {
                             (NULL,##__VA_ARGS__));                              \
         })
 
+#define arm_2dp_ccca8888_tile_transform_only(__CB_ADDR,                         \
+                                            __SRC_TILE_ADDR,                    \
+                                            __DES_TILE_ADDR,                    \
+                                            __DES_REGION_ADDR,                  \
+                                            __CENTRE,                           \
+                                            __ANGLE,                            \
+                                            __SCALE,                            \
+                                            ...)                                \
+        ({assert(NULL != (__CB_ADDR)); if (bIsNewFrame) {                       \
+            arm_2dp_ccca8888_tile_transform_only_prepare(                       \
+                                        (__CB_ADDR),                            \
+                                        (__SRC_TILE_ADDR),                      \
+                                        (__CENTRE),                             \
+                                        (float)(__ANGLE),                       \
+                                        (float)(__SCALE));                      \
+        };                                                                      \
+        arm_2dp_tile_transform((arm_2d_op_trans_t *)(__CB_ADDR),                \
+                            (__DES_TILE_ADDR),                                  \
+                            (__DES_REGION_ADDR),                                \
+                            (NULL,##__VA_ARGS__));                              \
+        })
+
 
 #define arm_2d_gray8_tile_transform_only(   __SRC_TILE_ADDR,                    \
                                             __DES_TILE_ADDR,                    \
@@ -1897,6 +1942,26 @@ extern "C" {
                             (NULL,##__VA_ARGS__));                              \
         })
 
+#define arm_2d_ccca8888_tile_transform_only(__SRC_TILE_ADDR,                    \
+                                            __DES_TILE_ADDR,                    \
+                                            __DES_REGION_ADDR,                  \
+                                            __CENTRE,                           \
+                                            __ANGLE,                            \
+                                            __SCALE,                            \
+                                            ...)                                \
+        ({                                                                      \
+            arm_2dp_ccca8888_tile_transform_only_prepare(                       \
+                                        NULL,                                   \
+                                        (__SRC_TILE_ADDR),                      \
+                                        (__CENTRE),                             \
+                                        (float)(__ANGLE),                       \
+                                        (float)(__SCALE));                      \
+            arm_2dp_tile_transform(NULL,                                        \
+                            (__DES_TILE_ADDR),                                  \
+                            (__DES_REGION_ADDR),                                \
+                            (NULL,##__VA_ARGS__));                              \
+        })
+
 #define arm_2dp_gray8_tile_transform_with_opacity(                              \
                                         __CB_ADDR,                              \
                                         __SRC_TILE_ADDR,                        \
@@ -2048,6 +2113,30 @@ extern "C" {
                             (NULL,##__VA_ARGS__));                              \
         })
 
+#define arm_2dp_ccca8888_tile_transform_only_with_opacity(                      \
+                                        __CB_ADDR,                              \
+                                        __SRC_TILE_ADDR,                        \
+                                        __DES_TILE_ADDR,                        \
+                                        __DES_REGION_ADDR,                      \
+                                        __CENTRE,                               \
+                                        __ANGLE,                                \
+                                        __SCALE,                                \
+                                        __OPACITY, ...)                         \
+        ({assert(NULL != (__CB_ADDR)); if (bIsNewFrame) {                       \
+          arm_2dp_ccca8888_tile_transform_only_with_opacity_prepare(            \
+                                        (__CB_ADDR),                            \
+                                        (__SRC_TILE_ADDR),                      \
+                                        (__CENTRE),                             \
+                                        (float)(__ANGLE),                       \
+                                        (float)(__SCALE),                       \
+                                        (__OPACITY));                           \
+        };                                                                      \
+        arm_2dp_tile_transform((arm_2d_op_trans_t *)(__CB_ADDR),                \
+                            (__DES_TILE_ADDR),                                  \
+                            (__DES_REGION_ADDR),                                \
+                            (NULL,##__VA_ARGS__));                              \
+        })
+
 #define arm_2dp_gray8_fill_colour_with_mask_opacity_and_transform(              \
                                         __CB_ADDR,                              \
                                         __MASK_ADDR,                            \
@@ -2614,6 +2703,29 @@ extern "C" {
                             (NULL,##__VA_ARGS__));                              \
         })
 
+#define arm_2d_ccca8888_tile_transform_only_with_opacity(                       \
+                                        __SRC_TILE_ADDR,                        \
+                                        __DES_TILE_ADDR,                        \
+                                        __DES_REGION_ADDR,                      \
+                                        __CENTRE,                               \
+                                        __ANGLE,                                \
+                                        __SCALE,                                \
+                                        __OPACITY, ...)                         \
+        ({{                                                                     \
+          arm_2dp_ccca8888_tile_transform_only_with_opacity_prepare(            \
+                                        NULL,                                   \
+                                        (__SRC_TILE_ADDR),                      \
+                                        (__CENTRE),                             \
+                                        (float)(__ANGLE),                       \
+                                        (float)(__SCALE),                       \
+                                        (__OPACITY));                           \
+        };                                                                      \
+        arm_2dp_tile_transform(NULL,                                            \
+                            (__DES_TILE_ADDR),                                  \
+                            (__DES_REGION_ADDR),                                \
+                            (NULL,##__VA_ARGS__));                              \
+        })
+
 #define arm_2d_gray8_tile_transform_with_src_mask(                              \
                                         __SRC_TILE_ADDR,                        \
                                         __SRC_MASK_ADDR,                        \
@@ -3846,6 +3958,11 @@ extern "C" {
                             (__DES_REGION_ADDR),                                \
                             (NULL,##__VA_ARGS__));                              \
         })
+
+#if __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__
+#define arm_2d_rgb888_fill_colour_with_mask_opacity_and_transform_cached        \
+            arm_2d_cccn888_fill_colour_with_mask_opacity_and_transform_cached
+#endif
         
 /*============================ TYPES =========================================*/
 
@@ -3870,6 +3987,9 @@ ARM_PRIVATE(
         arm_2d_region_t     tRegion;
         arm_2d_tile_t       tTile;
     } Target;
+#if __ARM_2D_CFG_SUPPORT_TRANSFORM_MIPMAP__
+    arm_2d_tile_t           tMipmapLevel;
+#endif
 )
 
 } __arm_2d_transform_info_t;
@@ -3978,6 +4098,65 @@ typedef struct arm_2d_op_trans_msk_opa_t {
     
 } arm_2d_op_trans_msk_opa_t;
 
+#if __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__
+/*!
+ * \brief an entry of the transform cache
+ */
+typedef struct arm_2d_transform_cache_item_t {
+ARM_PRIVATE(
+    const arm_2d_tile_t     *ptRoot;        //!< the root tile of the mask
+    arm_2d_region_t         tRegion;        //!< the mask region in the root tile
+    arm_2d_location_t       tCentre;        //!< the pivot in the root tile
+    int32_t                 nAngle;         //!< the quantised angle
+    int32_t                 nScale;         //!< the quantised scaling factor
+
+    arm_2d_size_t           tSize;          //!< the size of the transformed mask
+    arm_2d_location_t       tPivot;         //!< the pivot in the transformed mask
+    uint32_t                wOffset;        //!< the offset in the arena
+    uint32_t                wSize;          //!< the number of bytes in the arena
+    uint32_t                wTimestamp;     //!< the tick of the last access
+    bool                    bValid;
+)
+} arm_2d_transform_cache_item_t;
+
+/*!
+ * \brief the configuration of a transform cache
+ */
+typedef struct arm_2d_transform_cache_cfg_t {
+    void                            *pBuffer;       //!< the arena for the transformed masks
+    uint32_t                        wBufferSize;    //!< the size of the arena in bytes
+    arm_2d_transform_cache_item_t   *ptItems;       //!< the entries
+    uint16_t                        hwItemCount;    //!< the number of entries
+    float                           fAngleStep;     //!< the angle quantisation step in radian, 0 means 1 degree
+    float                           fScaleStep;     //!< the scaling factor quantisation step, 0 means 1/64
+} arm_2d_transform_cache_cfg_t;
+
+/*!
+ * \brief the transform cache
+ * \note the transform cache owns its OPs. The cached masks are drawn by the
+ *       cache, so please do NOT share one cache among threads.
+ */
+typedef struct arm_2d_transform_cache_t {
+ARM_PRIVATE(
+    arm_2d_transform_cache_cfg_t        tCFG;
+    uint32_t                            wUsedSize;
+    uint32_t                            wTick;
+
+    arm_2d_tile_t                       tMask;
+    arm_2d_tile_t                       tTarget;
+
+    arm_2d_op_trans_t                   tTransformOP;
+    arm_2d_op_fill_cl_msk_opc_t         tFillOP;
+    arm_2d_op_fill_cl_msk_opa_trans_t   tFallbackOP;
+)
+    struct {
+        uint32_t                        wHit;       //!< served from the cache
+        uint32_t                        wMiss;      //!< rendered into the cache
+        uint32_t                        wBypass;    //!< drawn without the cache
+    } Statistics;
+} arm_2d_transform_cache_t;
+#endif
+
 /*============================ GLOBAL VARIABLES ==============================*/
 /*============================ PROTOTYPES ====================================*/
 
@@ -4096,6 +4275,25 @@ arm_2d_err_t arm_2dp_cccn888_tile_transform_only_prepare(
                                         float fAngle,
                                         float fScale);
 
+/*!
+ * \brief prepare for a transform in premultiplied ccca8888
+ * \note the interpolated pixels (alpha included) replace the target pixels
+ * \param[in] ptOP the control block, NULL means using the default control block
+ * \param[in] ptSource the source tile
+ * \param[in] tCentre the pivot in the source tile
+ * \param[in] fAngle the rotation angle
+ * \param[in] fScale the scaling factor
+ * \return arm_2d_err_t the result of the preparing process
+ */
+extern
+ARM_NONNULL(2)
+arm_2d_err_t arm_2dp_ccca8888_tile_transform_only_prepare(
+                                        arm_2d_op_trans_t *ptOP,
+                                        const arm_2d_tile_t *ptSource,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale);
+
 /*!
  * \brief prepare for a transform with colour keying and opacity in gray8
  * \param[in] ptOP the control block, NULL means using the default control block
@@ -4222,6 +4420,28 @@ arm_2d_err_t arm_2dp_cccn888_tile_transform_only_with_opacity_prepare(
                                         float fScale,
                                         uint_fast8_t chRatio);
 
+/*!
+ * \brief prepare for a transform with opacity in premultiplied ccca8888
+ * \note the transformed pixels are blended onto the target with source-over,
+ *       i.e. transparent pixels of the source leave the target untouched.
+ * \param[in] ptOP the control block, NULL means using the default control block
+ * \param[in] ptSource the source tile
+ * \param[in] tCentre the pivot in the source tile
+ * \param[in] fAngle the rotation angle
+ * \param[in] fScale the scaling factor
+ * \param[in] chRatio the opacity
+ * \return arm_2d_err_t the result of the preparing process
+ */
+extern
+ARM_NONNULL(2)
+arm_2d_err_t arm_2dp_ccca8888_tile_transform_only_with_opacity_prepare(
+                                        arm_2d_op_trans_opa_t *ptOP,
+                                        const arm_2d_tile_t *ptSource,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint_fast8_t chRatio);
+
 /*!
  * \brief prepare for a transform with a source mask in gray8
  * \param[in] ptOP the control block, NULL means using the default control block
@@ -4433,6 +4653,122 @@ arm_fsm_rt_t arm_2dp_tile_transform( arm_2d_op_trans_t *ptOP,
                                      const arm_2d_region_t *ptRegion,
                                      const arm_2d_location_t *ptTargetCentre);
 
+#if __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__
+/*!
+ * \brief initialize a transform cache
+ * \param[in] ptThis the transform cache
+ * \param[in] ptCFG the configuration
+ * \return arm_2d_err_t the result of the initialization
+ */
+extern
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_transform_cache_init(arm_2d_transform_cache_t *ptThis,
+                                         arm_2d_transform_cache_cfg_t *ptCFG);
+
+/*!
+ * \brief drop all cached masks, e.g. after the content of a mask is changed
+ * \param[in] ptThis the transform cache
+ */
+extern
+ARM_NONNULL(1)
+void arm_2d_transform_cache_invalidate(arm_2d_transform_cache_t *ptThis);
+
+/*!
+ * \brief fill a gray8 target with a colour, a transformed mask and an opacity.
+ *        The transformed mask is kept in the cache and reused when the same
+ *        mask is drawn with the same quantised angle and scaling factor.
+ * \param[in] ptCache the transform cache
+ * \param[in] ptMask the A8 mask
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the target region, NULL means the whole target tile
+ * \param[in] tCentre the pivot in the mask
+ * \param[in] fAngle the rotation angle
+ * \param[in] fScale the scaling factor
+ * \param[in] chFillColour the colour to fill
+ * \param[in] chOpacity the opacity
+ * \param[in] ptTargetCentre the pivot in the target region, NULL means the
+ *            centre of the target region
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(1,2,3)
+arm_fsm_rt_t arm_2d_gray8_fill_colour_with_mask_opacity_and_transform_cached(
+                                        arm_2d_transform_cache_t *ptCache,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint_fast8_t chFillColour,
+                                        uint_fast8_t chOpacity,
+                                        const arm_2d_location_t *ptTargetCentre);
+
+/*!
+ * \brief fill a rgb565 target with a colour, a transformed mask and an 
+ *        opacity. The transformed mask is kept in the cache and reused when 
+ *        the same mask is drawn with the same quantised angle and scaling 
+ *        factor.
+ * \param[in] ptCache the transform cache
+ * \param[in] ptMask the A8 mask
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the target region, NULL means the whole target tile
+ * \param[in] tCentre the pivot in the mask
+ * \param[in] fAngle the rotation angle
+ * \param[in] fScale the scaling factor
+ * \param[in] hwFillColour the colour to fill
+ * \param[in] chOpacity the opacity
+ * \param[in] ptTargetCentre the pivot in the target region, NULL means the
+ *            centre of the target region
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(1,2,3)
+arm_fsm_rt_t arm_2d_rgb565_fill_colour_with_mask_opacity_and_transform_cached(
+                                        arm_2d_transform_cache_t *ptCache,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint_fast16_t hwFillColour,
+                                        uint_fast8_t chOpacity,
+                                        const arm_2d_location_t *ptTargetCentre);
+
+/*!
+ * \brief fill a cccn888 target with a colour, a transformed mask and an 
+ *        opacity. The transformed mask is kept in the cache and reused when 
+ *        the same mask is drawn with the same quantised angle and scaling 
+ *        factor.
+ * \param[in] ptCache the transform cache
+ * \param[in] ptMask the A8 mask
+ * \param[in] ptTarget the target tile
+ * \param[in] ptRegion the target region, NULL means the whole target tile
+ * \param[in] tCentre the pivot in the mask
+ * \param[in] fAngle the rotation angle
+ * \param[in] fScale the scaling factor
+ * \param[in] wFillColour the colour to fill
+ * \param[in] chOpacity the opacity
+ * \param[in] ptTargetCentre the pivot in the target region, NULL means the
+ *            centre of the target region
+ * \return arm_fsm_rt_t the operation result
+ */
+extern
+ARM_NONNULL(1,2,3)
+arm_fsm_rt_t arm_2d_cccn888_fill_colour_with_mask_opacity_and_transform_cached(
+                                        arm_2d_transform_cache_t *ptCache,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint32_t wFillColour,
+                                        uint_fast8_t chOpacity,
+                                        const arm_2d_location_t *ptTargetCentre);
+#endif
+
 /*! @} */
 
 #if defined(__clang__)
@@ -580,6 +580,7 @@ typedef struct arm_2d_region_t {
 enum {
     ARM_2D_TILE_EXTENSION_NONE = 0,             //!< no extension in the tile.tInfo.Extension field
     ARM_2D_TILE_EXTENSION_PFB,                  //!< contains PFB extension information
+    ARM_2D_TILE_EXTENSION_MIPMAP,               //!< the tile is the level 0 of an arm_2d_tile_mipmap_t
 };
 
 /*!
@@ -603,6 +604,9 @@ struct arm_2d_tile_t {
                 uint8_t bIsNewFrame     : 1;
                 uint8_t bIsDryRun       : 1;
             }PFB;
+            struct {
+                uint8_t chLevelCount;                                           //!< the number of levels after level 0
+            }Mipmap;
         } Extension;
         
     }, tInfo);
@@ -760,6 +764,24 @@ struct arm_2d_vres_t {
                             intptr_t pBuffer );
 };
 
+/*!
+ * \brief a tile with pre-computed half-resolution levels (a mip chain).
+ *        Transform operations pick the level closest to the target size when
+ *        the scaling factor is not more than 0.5.
+ * \note tTile is the level 0. Please set tTile.tInfo.u3ExtensionID to 
+ *       ARM_2D_TILE_EXTENSION_MIPMAP and tTile.tInfo.Extension.Mipmap
+ *       .chLevelCount to the number of levels in ptLevels.
+ */
+typedef struct arm_2d_tile_mipmap_t arm_2d_tile_mipmap_t;
+struct arm_2d_tile_mipmap_t {
+
+    /*! base class: tTile, the level 0 */
+    implement_ex( arm_2d_tile_t, tTile);
+
+    /*! the level 1 to n, each level is half the size of the previous one */
+    const arm_2d_tile_t *const *ptLevels;
+};
+
 /*----------------------------------------------------------------------------*
  * Task                                                                       *
  *----------------------------------------------------------------------------*/
@@ -775,6 +797,7 @@ ARM_PRIVATE(
 
     void         *ptTask;                                                       //!< a pointer for an internal object
 )
+    uint8_t      chWorkerID;                                                    //!< the worker index, only used when __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
 } arm_2d_task_t;
 
 /*----------------------------------------------------------------------------*
@@ -828,6 +851,7 @@ typedef struct arm_2d_evt_t {
 #define ARM_2D_OP_INFO_PARAM_HAS_SOURCE_MASK        _BV(2)                      //!< opcode has source mask info
 #define ARM_2D_OP_INFO_PARAM_HAS_TARGET_MASK        _BV(3)                      //!< opcode has target mask info
 #define ARM_2D_OP_INFO_PARAM_HAS_ORIGIN             _BV(4)                      //!< opcode has original tile info
+#define ARM_2D_OP_INFO_PARAM_BACKEND_READS_SOURCE   _BV(5)                      //!< opcode reads the source tile in the backend directly
 
 /*! a bitmask for INFO_PARAM_HAS_xxxx bitfields */
 #define ARM_2D_OP_INFO_PARAM_TILES_MASK             (                           \
@@ -854,7 +878,8 @@ typedef union __arm_2d_op_info_t {
                 uint8_t bHasSrcMask             : 1;                            //!< whether this operation has Mask layer for source tile
                 uint8_t bHasDesMask             : 1;                            //!< whether this operation has Mask layer for target tile
                 uint8_t bHasOrigin              : 1;                            //!< whether the Source has an origin tile
-                uint8_t                         : 2;
+                uint8_t bBackendReadsSource     : 1;                            //!< whether the backend reads the source tile of an arm_2d_op_src_t directly (without bHasSource)
+                uint8_t                         : 1;
                 uint8_t bAllowEnforcedColour    : 1;                            //!< whether this operation allow enforced colours in tiles
             };
             uint8_t chValue;                                                    //!< feature value
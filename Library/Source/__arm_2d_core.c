@@ -1991,6 +1991,82 @@ arm_fsm_rt_t __arm_2d_op_frontend_region_process_with_src( arm_2d_op_core_t *ptO
  * Frontend                                                                   *
  *----------------------------------------------------------------------------*/
 
+#if __ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__
+/*
+  HOW IT WORKS:
+
+    The target region is translated into the coordinates of the root tile
+    (e.g. the current PFB) by adding up the locations of the tiles on the way.
+    Clipping against the parent tiles can only make the region smaller, hence
+    when the translated region doesn't overlap with the root tile, the OP has
+    nothing to draw. This is much cheaper than resolving the tile root and
+    intersecting the regions level by level in the frontends.
+ */
+static bool __arm_2d_op_is_outside_root_tile(arm_2d_op_core_t *ptOP)
+{
+    ARM_2D_IMPL(arm_2d_op_t, ptOP)
+
+    const arm_2d_tile_t *ptTile = this.Target.ptTile;
+    if (NULL == ptTile) {
+        return false;
+    }
+
+    arm_2d_region_t tRegion = {
+        .tSize = ptTile->tRegion.tSize,
+    };
+    if (NULL != this.Target.ptRegion) {
+        tRegion = *this.Target.ptRegion;
+    }
+
+    while (!arm_2d_is_root_tile(ptTile)) {
+        tRegion.tLocation.iX += ptTile->tRegion.tLocation.iX;
+        tRegion.tLocation.iY += ptTile->tRegion.tLocation.iY;
+
+        ptTile = ptTile->ptParent;
+        if (NULL == ptTile) {
+            /* leave the broken tile to the frontends */
+            return false;
+        }
+    }
+
+    /* root tile can has offset */
+    return !arm_2d_region_intersect(&tRegion, &ptTile->tRegion, NULL);
+}
+
+static bool __arm_2d_op_early_reject(arm_2d_op_core_t *ptOP)
+{
+    bool bReject = __arm_2d_op_is_outside_root_tile(ptOP);
+
+#if __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+    arm_irq_safe {
+        ARM_2D_CTRL.EarlyReject.wChecked++;
+        ARM_2D_CTRL.EarlyReject.wRejected += bReject;
+    }
+#endif
+
+    return bReject;
+}
+
+#if __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+void arm_2d_get_op_early_reject_statistics(
+                            arm_2d_op_early_reject_statistics_t *ptStatistics)
+{
+    assert(NULL != ptStatistics);
+
+    arm_irq_safe {
+        *ptStatistics = ARM_2D_CTRL.EarlyReject;
+    }
+}
+
+void arm_2d_reset_op_early_reject_statistics(void)
+{
+    arm_irq_safe {
+        memset(&ARM_2D_CTRL.EarlyReject, 0, sizeof(ARM_2D_CTRL.EarlyReject));
+    }
+}
+#endif
+#endif
+
 arm_fsm_rt_t __arm_2d_op_depose(arm_2d_op_core_t *ptThis, 
                                 arm_fsm_rt_t tResult)
 {
@@ -2025,6 +2101,10 @@ arm_fsm_rt_t __arm_2d_op_frontend_op_decoder(arm_2d_op_core_t *ptThis)
 {
     arm_fsm_rt_t tResult;
     
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    int64_t lStart = arm_2d_port_get_profiler_timestamp();
+#endif
+
     //! decode operation
     switch (this.ptOp->Info.Param.chValue & 
                 (   ARM_2D_OP_INFO_PARAM_HAS_SOURCE 
@@ -2037,12 +2117,24 @@ arm_fsm_rt_t __arm_2d_op_frontend_op_decoder(arm_2d_op_core_t *ptThis)
     case (   ARM_2D_OP_INFO_PARAM_HAS_SOURCE 
          |   ARM_2D_OP_INFO_PARAM_HAS_TARGET):
         __arm_2d_op_use_default_frame_buffer(ptThis);
+    #if __ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__
+        if (__arm_2d_op_early_reject(ptThis)) {
+            tResult = (arm_fsm_rt_t)ARM_2D_ERR_OUT_OF_REGION;
+            break;
+        }
+    #endif
         /* operaion process target tile based on source tile */
         tResult = __arm_2d_op_frontend_region_process_with_src(ptThis);
         break;
         
     case ARM_2D_OP_INFO_PARAM_HAS_TARGET:
         __arm_2d_op_use_default_frame_buffer(ptThis);
+    #if __ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__
+        if (__arm_2d_op_early_reject(ptThis)) {
+            tResult = (arm_fsm_rt_t)ARM_2D_ERR_OUT_OF_REGION;
+            break;
+        }
+    #endif
         /* operation which only processes target tile */
         tResult = __arm_2d_op_frontend_region_process(ptThis);
         break;
@@ -2058,6 +2150,14 @@ arm_fsm_rt_t __arm_2d_op_frontend_op_decoder(arm_2d_op_core_t *ptThis)
             tResult = arm_fsm_rt_cpl;
         } 
     }
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    __arm_2d_profiler_record(   ptThis, 
+                                ARM_2D_PROFILER_EVT_OP, 
+                                __arm_2d_profiler_get_thread_index(),
+                                lStart,
+                                __arm_2d_profiler_get_op_pixel_count(ptThis));
+#endif
     
     return tResult;
 }
@@ -2126,6 +2226,12 @@ arm_fsm_rt_t __arm_2d_op_invoke(arm_2d_op_core_t *ptOP)
     } while(0);
 #endif
 
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+    if (NULL != ARM_2D_CTRL.ptRecordingList) {
+        __arm_2d_display_list_record(ptThis);
+    }
+#endif
+
     return  __arm_2d_op_frontend(ptThis);
 }
 
@@ -0,0 +1,956 @@
+/*
+ * Copyright (C) 2010-2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_display_list.c
+ * Description:  Record the OPs of a frame and replay them on other PFBs
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wempty-translation-unit"
+#endif
+
+#ifdef __ARM_2D_COMPILATION_UNIT
+#undef __ARM_2D_COMPILATION_UNIT
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+#include <string.h>
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#elif defined(__IS_COMPILER_GCC__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdiscarded-qualifiers"
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+
+/*============================ MACROS ========================================*/
+
+/*! the size of one default OP, i.e. the largest OP that can be recorded */
+#define __ARM_2D_DISPLAY_LIST_OP_SIZE                                           \
+            (sizeof(ARM_2D_CTRL.DefaultOP) / __ARM_2D_CFG_DEFAULT_OP_COUNT__)
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+#define __arm_2d_display_list_is_default_op(__OP_PTR)                           \
+    (       ((uintptr_t)(__OP_PTR) >= (uintptr_t)&ARM_2D_CTRL.DefaultOP)        \
+        &&  ((uintptr_t)(__OP_PTR) < (  (uintptr_t)&ARM_2D_CTRL.DefaultOP       \
+                                     +  sizeof(ARM_2D_CTRL.DefaultOP))))
+
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief a record in the display list
+ * \note  The target tile is stored in one of the following forms:
+ *        - a child of the canvas (tTarget) when the target is drawn on the
+ *          canvas. The target is clipped by its parent tiles in advance and
+ *          the target region is moved accordingly, so the replay neither
+ *          walks the tile tree nor modifies the record, i.e. several threads
+ *          can replay the same list at the same time.
+ *        - a copy of the tile chain (ptTarget) ending at a root tile, i.e. the
+ *          target is not a part of the canvas. Such records are always
+ *          replayed.
+ */
+typedef struct __arm_2d_display_list_entry_t __arm_2d_display_list_entry_t;
+struct __arm_2d_display_list_entry_t {
+    __arm_2d_display_list_entry_t   *ptNext;            //!< the next record
+    const arm_2d_tile_t             *ptTarget;          //!< the copied target chain, NULL means using tTarget
+    arm_2d_tile_t                   tTarget;            //!< the flattened target tile (a child of the canvas)
+    arm_2d_region_t                 tRegion;            //!< the target region
+    arm_2d_region_t                 tBoundingBox;       //!< the area to draw in the canvas
+    uint8_t                         bAlwaysReplay : 1;  //!< the target is not a part of the canvas
+    uint8_t                                       : 7;
+
+    uint64_t dwOP[(__ARM_2D_DISPLAY_LIST_OP_SIZE + 7) / 8]; //!< a copy of the OP
+};
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+static void *__arm_2d_display_list_alloc(   arm_2d_display_list_t *ptThis,
+                                            uint32_t wSize)
+{
+    wSize = (wSize + 7) & ~((uint32_t)7);
+
+    if (wSize > (this.wSize - this.wUsed)) {
+        /* out of memory, the list cannot be replayed */
+        this.bValid = false;
+        return NULL;
+    }
+
+    void *pBuffer = &this.pchBuffer[this.wUsed];
+    this.wUsed += wSize;
+
+    return pBuffer;
+}
+
+/*!
+ * \brief check whether a tile of a chain is copied to the display list
+ * \note  The canvas and the root tiles are referenced directly. The derived
+ *        resources are copied, as they are often generated on the stack,
+ *        e.g. the glyphs of a font and the quadrants of a mask.
+ */
+static bool __arm_2d_display_list_is_copied_tile(
+                                            arm_2d_display_list_t *ptThis,
+                                            const arm_2d_tile_t *ptTile)
+{
+    return  (NULL != ptTile)
+        &&  (ptTile != this.ptCanvas)
+        &&  !arm_2d_is_root_tile(ptTile);
+}
+
+/*!
+ * \brief copy the non-root tiles of a tile chain to the display list
+ * \param[in] ptThis the target display list
+ * \param[in] ptTile the first tile of the chain
+ * \param[out] pbOnCanvas whether the chain ends at the canvas
+ * \return const arm_2d_tile_t * the copied chain, NULL means out of memory
+ */
+static
+const arm_2d_tile_t *__arm_2d_display_list_copy_tile_chain(
+                                            arm_2d_display_list_t *ptThis,
+                                            const arm_2d_tile_t *ptTile,
+                                            bool *pbOnCanvas)
+{
+    const arm_2d_tile_t *ptHead = ptTile;
+    arm_2d_tile_t *ptLast = NULL;
+
+    while(__arm_2d_display_list_is_copied_tile(ptThis, ptTile)) {
+
+        arm_2d_tile_t *ptCopy = __arm_2d_display_list_alloc(
+                                                        ptThis,
+                                                        sizeof(arm_2d_tile_t));
+        if (NULL == ptCopy) {
+            return NULL;
+        }
+        *ptCopy = *ptTile;
+
+        if (NULL == ptLast) {
+            ptHead = ptCopy;
+        } else {
+            ptLast->ptParent = ptCopy;
+        }
+        ptLast = ptCopy;
+        ptTile = ptTile->ptParent;
+    }
+
+    *pbOnCanvas = (ptTile == this.ptCanvas);
+
+    return ptHead;
+}
+
+/*!
+ * \brief check whether a tile chain has the same values as a copied one
+ * \param[in] ptThis the target display list
+ * \param[in] ptTile the first tile of the chain
+ * \param[in] ptCopy the first tile of the copied chain
+ * \return bool whether the two chains are the same
+ */
+static
+bool __arm_2d_display_list_is_same_chain(   arm_2d_display_list_t *ptThis,
+                                            const arm_2d_tile_t *ptTile,
+                                            const arm_2d_tile_t *ptCopy)
+{
+    while(__arm_2d_display_list_is_copied_tile(ptThis, ptTile)) {
+        if (    (NULL == ptCopy)
+            ||  (0 != memcmp(   &ptTile->tRegion,
+                                &ptCopy->tRegion,
+                                sizeof(arm_2d_region_t)))
+            ||  (0 != memcmp(   &ptTile->tInfo,
+                                &ptCopy->tInfo,
+                                sizeof(ptTile->tInfo)))) {
+            return false;
+        }
+        ptTile = ptTile->ptParent;
+        ptCopy = ptCopy->ptParent;
+    }
+
+    /* the last tile of a chain is referenced directly */
+    return ptTile == ptCopy;
+}
+
+/*!
+ * \brief copy a source (or mask) tile chain to the display list
+ * \retval true the tile is copied
+ * \retval false the list becomes invalid
+ */
+static
+bool __arm_2d_display_list_copy_asset( arm_2d_display_list_t *ptThis,
+                                       const arm_2d_tile_t **ppTile)
+{
+    bool bOnCanvas;
+
+    if (NULL == *ppTile) {
+        return true;
+    }
+
+    const arm_2d_tile_t *ptCopy = __arm_2d_display_list_copy_tile_chain(
+                                                                    ptThis,
+                                                                    *ppTile,
+                                                                    &bOnCanvas);
+    if (NULL == ptCopy) {
+        return false;
+    }
+
+    if (bOnCanvas) {
+        /* the OP reads the canvas which changes from one PFB to another */
+        this.bValid = false;
+        return false;
+    }
+
+    *ppTile = ptCopy;
+    return true;
+}
+
+/*!
+ * \brief get the tiles other than the target referenced by an OP
+ * \param[in] ptOP the OP or a copy of it
+ * \param[in] chParam the parameter flags of the OP
+ * \param[out] pptTiles the addresses of the tile pointers in the OP
+ * \return uint_fast8_t the number of the tiles
+ */
+static
+uint_fast8_t __arm_2d_display_list_get_assets(
+                                        arm_2d_op_core_t *ptOP,
+                                        uint_fast8_t chParam,
+                                        const arm_2d_tile_t **pptTiles[3])
+{
+    uint_fast8_t chCount = 0;
+
+    if (chParam & ARM_2D_OP_INFO_PARAM_HAS_SOURCE) {
+        arm_2d_op_src_t *ptSourceOP = (arm_2d_op_src_t *)ptOP;
+        pptTiles[chCount++] = &ptSourceOP->Source.ptTile;
+
+        if (chParam & (     ARM_2D_OP_INFO_PARAM_HAS_SOURCE_MASK
+                        |   ARM_2D_OP_INFO_PARAM_HAS_TARGET_MASK)) {
+            arm_2d_op_src_msk_t *ptMaskOP = (arm_2d_op_src_msk_t *)ptOP;
+            pptTiles[chCount++] = &ptMaskOP->Mask.ptSourceSide;
+            pptTiles[chCount++] = &ptMaskOP->Mask.ptTargetSide;
+        }
+    } else if (chParam & ARM_2D_OP_INFO_PARAM_HAS_TARGET_MASK) {
+        arm_2d_op_msk_t *ptMaskOP = (arm_2d_op_msk_t *)ptOP;
+        pptTiles[chCount++] = &ptMaskOP->Mask.ptTargetSide;
+    }
+
+    return chCount;
+}
+
+/*!
+ * \brief calculate the target form of a record
+ * \note  the target region (tRegion) of the record should be set in advance
+ * \retval ARM_2D_ERR_NONE the target is flattened into a child of the canvas
+ * \retval ARM_2D_ERR_NOT_AVAILABLE the target is not a part of the canvas
+ * \retval ARM_2D_ERR_OUT_OF_REGION the OP draws nothing on the canvas
+ */
+static
+arm_2d_err_t __arm_2d_display_list_locate_target(
+                                        arm_2d_display_list_t *ptThis,
+                                        __arm_2d_display_list_entry_t *ptEntry,
+                                        const arm_2d_tile_t *ptTarget)
+{
+    const arm_2d_tile_t *ptTile = ptTarget;
+    arm_2d_location_t tAbsolute = {0};
+
+    /* get the location of the target in the canvas */
+    while (ptTile != this.ptCanvas) {
+        if (    arm_2d_is_root_tile(ptTile)
+            ||  ptTile->tInfo.bDerivedResource
+            ||  (NULL == ptTile->ptParent)) {
+            /* the target is not a part of the canvas, e.g. a layer buffer */
+            ptEntry->bAlwaysReplay = true;
+            return ARM_2D_ERR_NOT_AVAILABLE;
+        }
+        tAbsolute.iX += ptTile->tRegion.tLocation.iX;
+        tAbsolute.iY += ptTile->tRegion.tLocation.iY;
+        ptTile = ptTile->ptParent;
+    }
+
+    /* calculate the visible part of the target in the canvas */
+    arm_2d_region_t tWindow = {
+        .tLocation = tAbsolute,
+        .tSize = ptTarget->tRegion.tSize,
+    };
+    arm_2d_location_t tLocation = tAbsolute;
+
+    ptTile = ptTarget;
+    while (ptTile != this.ptCanvas) {
+        tLocation.iX -= ptTile->tRegion.tLocation.iX;
+        tLocation.iY -= ptTile->tRegion.tLocation.iY;
+        ptTile = ptTile->ptParent;
+
+        arm_2d_region_t tParent = {
+            .tLocation = tLocation,
+            .tSize = ptTile->tRegion.tSize,
+        };
+
+        if (!arm_2d_region_intersect(&tWindow, &tParent, &tWindow)) {
+            return ARM_2D_ERR_OUT_OF_REGION;
+        }
+    }
+
+    /* calculate the bounding box */
+    arm_2d_region_t tBoundingBox = ptEntry->tRegion;
+    tBoundingBox.tLocation.iX += tAbsolute.iX;
+    tBoundingBox.tLocation.iY += tAbsolute.iY;
+
+    if (!arm_2d_region_intersect(   &tWindow,
+                                    &tBoundingBox,
+                                    &ptEntry->tBoundingBox)) {
+        return ARM_2D_ERR_OUT_OF_REGION;
+    }
+
+    /* flatten the target: a child of the canvas covering the visible part,
+     * the target region is moved to keep its location in the canvas
+     */
+    ptEntry->tTarget = *ptTarget;
+    ptEntry->tTarget.tRegion = tWindow;
+    ptEntry->tTarget.ptParent = (arm_2d_tile_t *)this.ptCanvas;
+
+    ptEntry->tTarget.tInfo.bIsRoot = false;
+    ptEntry->tTarget.tInfo.bDerivedResource = false;
+    ptEntry->tTarget.tInfo.bVirtualResource = false;
+    ptEntry->tTarget.tInfo.bVirtualScreen = false;
+    ptEntry->tTarget.tInfo.u3ExtensionID = ARM_2D_TILE_EXTENSION_NONE;
+    memset( &ptEntry->tTarget.tInfo.Extension,
+            0,
+            sizeof(ptEntry->tTarget.tInfo.Extension));
+
+    ptEntry->tRegion.tLocation.iX -= tWindow.tLocation.iX - tAbsolute.iX;
+    ptEntry->tRegion.tLocation.iY -= tWindow.tLocation.iY - tAbsolute.iY;
+
+    ptEntry->ptTarget = NULL;
+
+    return ARM_2D_ERR_NONE;
+}
+
+/*!
+ * \brief check whether an OP can be copied into a record
+ * \note  only the tiles (and the regions) of an OP are copied, hence only the
+ *        built-in OPs known to hold nothing but tiles and scalars can be
+ *        recorded. The following OPs are rejected:
+ *        - the OPs referencing other payloads by pointers, e.g. draw-points
+ *          (the locations and the opacities), fill-path (the path) and the
+ *          gradients (the colour stops), as the payloads might be changed or
+ *          gone before the replay.
+ *        - the filters, which keep scratch memories or read the pixels
+ *          beyond the recorded tiles.
+ *        - the transforms, the barrier and all user OPs.
+ * \param[in] ptInfo the OP descriptor
+ * \return bool whether the OP can be recorded
+ */
+static bool __arm_2d_display_list_is_recordable(const __arm_2d_op_info_t *ptInfo)
+{
+    switch (ptInfo->Info.chOpIndex) {
+        case __ARM_2D_OP_IDX_COPY:
+        case __ARM_2D_OP_IDX_COPY_ONLY:
+        case __ARM_2D_OP_IDX_COPY_WITH_X_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_Y_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_XY_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_ONLY:
+        case __ARM_2D_OP_IDX_FILL_WITH_X_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_Y_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_XY_MIRROR:
+
+        case __ARM_2D_OP_IDX_COPY_WITH_COLOUR_KEYING:
+        case __ARM_2D_OP_IDX_COPY_ONLY_WITH_COLOUR_KEYING:
+        case __ARM_2D_OP_IDX_COPY_WITH_COLOUR_KEYING_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_COLOUR_KEYING_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_COLOUR_KEYING_AND_XY_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_ONLY_WITH_COLOUR_KEYING:
+        case __ARM_2D_OP_IDX_FILL_WITH_COLOUR_KEYING_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_COLOUR_KEYING_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_COLOUR_KEYING_AND_XY_MIRROR:
+
+        case __ARM_2D_OP_IDX_COPY_WITH_OPACITY:
+        case __ARM_2D_OP_IDX_COPY_WITH_COLOUR_KEYING_AND_OPACITY:
+
+        case __ARM_2D_OP_IDX_COPY_WITH_MASKS:
+        case __ARM_2D_OP_IDX_COPY_WITH_MASKS_ONLY:
+        case __ARM_2D_OP_IDX_COPY_WITH_MASKS_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_MASKS_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_MASKS_AND_XY_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_MASKS_ONLY:
+        case __ARM_2D_OP_IDX_FILL_WITH_MASKS_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_MASKS_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_MASKS_AND_XY_MIRROR:
+
+        case __ARM_2D_OP_IDX_COPY_WITH_SOURCE_MASK:
+        case __ARM_2D_OP_IDX_COPY_WITH_SOURCE_MASK_ONLY:
+        case __ARM_2D_OP_IDX_COPY_WITH_SOURCE_MASK_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_SOURCE_MASK_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_SOURCE_MASK_AND_XY_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_SOURCE_MASK_ONLY:
+        case __ARM_2D_OP_IDX_FILL_WITH_SOURCE_MASK_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_SOURCE_MASK_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_SOURCE_MASK_AND_XY_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_SOURCE_MASK_AND_OPACITY_ONLY:
+
+        case __ARM_2D_OP_IDX_COPY_WITH_TARGET_MASK:
+        case __ARM_2D_OP_IDX_COPY_WITH_TARGET_MASK_ONLY:
+        case __ARM_2D_OP_IDX_COPY_WITH_TARGET_MASK_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_TARGET_MASK_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_COPY_WITH_TARGET_MASK_AND_XY_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_TARGET_MASK_ONLY:
+        case __ARM_2D_OP_IDX_FILL_WITH_TARGET_MASK_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_TARGET_MASK_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_WITH_TARGET_MASK_AND_XY_MIRROR:
+
+        case __ARM_2D_OP_IDX_FILL_COLOUR:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_OPACITY:
+
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_A2_MASK:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_A4_MASK:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_A8_MASK:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_AND_X_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_AND_Y_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_AND_XY_MIRROR:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_AND_REPEAT:
+
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_A2_MASK_AND_OPACITY:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_A4_MASK_AND_OPACITY:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_A8_MASK_AND_OPACITY:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_X_MIRROR_AND_OPACITY:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_Y_MIRROR_AND_OPACITY:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_XY_MIRROR_AND_OPACITY:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_OPACITY_AND_REPEAT:
+
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_HORIZONTAL_LINE_MASK:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_HORIZONTAL_LINE_MASK_AND_OPACITY:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_VERTICAL_LINE_MASK:
+        case __ARM_2D_OP_IDX_FILL_COLOUR_WITH_VERTICAL_LINE_MASK_AND_OPACITY:
+
+        case __ARM_2D_OP_IDX_DRAW_POINT:
+        case __ARM_2D_OP_IDX_DRAW_PATTERN:
+
+        case __ARM_2D_OP_IDX_COLOUR_FORMAT_CONVERSION:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/*!
+ * \brief compare an OP with the next record when verifying the list
+ * \note  the OP is compared by values, i.e. the tiles referenced by the OP
+ *        are compared with the copied ones instead of their addresses.
+ * \param[in] ptThis the target display list
+ * \param[in] ptNew a record of the OP, which is not added to the list yet
+ * \param[in] ptTarget the target tile of the OP
+ * \param[in] chParam the parameter flags of the OP
+ * \return bool whether the OP is the same as the record
+ */
+static
+bool __arm_2d_display_list_is_same_op(  arm_2d_display_list_t *ptThis,
+                                        __arm_2d_display_list_entry_t *ptNew,
+                                        const arm_2d_tile_t *ptTarget,
+                                        uint_fast8_t chParam)
+{
+    __arm_2d_display_list_entry_t *ptEntry = this.ptVerify;
+
+    if (NULL == ptEntry) {
+        /* the OP stream becomes longer */
+        return false;
+    }
+
+    if (    (ptEntry->bAlwaysReplay != ptNew->bAlwaysReplay)
+        ||  (0 != memcmp(   &ptEntry->tRegion,
+                            &ptNew->tRegion,
+                            sizeof(arm_2d_region_t)))) {
+        return false;
+    }
+
+    if (ptNew->bAlwaysReplay) {
+        if (!__arm_2d_display_list_is_same_chain(   ptThis,
+                                                    ptTarget,
+                                                    ptEntry->ptTarget)) {
+            return false;
+        }
+    } else if ( (0 != memcmp(   &ptEntry->tBoundingBox,
+                                &ptNew->tBoundingBox,
+                                sizeof(arm_2d_region_t)))
+            ||  (0 != memcmp(   &ptEntry->tTarget.tRegion,
+                                &ptNew->tTarget.tRegion,
+                                sizeof(arm_2d_region_t)))
+            ||  (0 != memcmp(   &ptEntry->tTarget.tInfo,
+                                &ptNew->tTarget.tInfo,
+                                sizeof(ptNew->tTarget.tInfo)))) {
+        return false;
+    }
+
+    arm_2d_op_core_t *ptLive = (arm_2d_op_core_t *)ptNew->dwOP;
+    arm_2d_op_core_t *ptRecorded = (arm_2d_op_core_t *)ptEntry->dwOP;
+
+    if (ptLive->ptOp != ptRecorded->ptOp) {
+        return false;
+    }
+
+    const arm_2d_tile_t **pptLiveTiles[3];
+    const arm_2d_tile_t **pptRecordedTiles[3];
+    const arm_2d_tile_t *ptLiveTiles[3];
+    uint_fast8_t chCount = __arm_2d_display_list_get_assets(ptLive,
+                                                            chParam,
+                                                            pptLiveTiles);
+    __arm_2d_display_list_get_assets(ptRecorded, chParam, pptRecordedTiles);
+
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        if (!__arm_2d_display_list_is_same_chain(   ptThis,
+                                                    *pptLiveTiles[n],
+                                                    *pptRecordedTiles[n])) {
+            return false;
+        }
+    }
+
+    /* compare the rest of the OP without the runtime states and the tiles
+     * NOTE: the default OP is shared by all kinds of OPs, hence the bytes not
+     *       used by this OP might be left by another one. They might cause a
+     *       mismatch (i.e. a recording), but never a wrong replay.
+     */
+    arm_2d_op_t *ptLiveOP = (arm_2d_op_t *)ptLive;
+    arm_2d_op_t tLiveTarget = *ptLiveOP;
+
+    ptLiveOP->Target = ((arm_2d_op_t *)ptRecorded)->Target;
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        ptLiveTiles[n] = *pptLiveTiles[n];
+        *pptLiveTiles[n] = *pptRecordedTiles[n];
+    }
+
+    bool bResult = (0 == memcmp(
+                        (uint8_t *)ptNew->dwOP + sizeof(arm_2d_op_core_t),
+                        (uint8_t *)ptEntry->dwOP + sizeof(arm_2d_op_core_t),
+                        __ARM_2D_DISPLAY_LIST_OP_SIZE - sizeof(arm_2d_op_core_t)));
+
+    ptLiveOP->Target = tLiveTarget.Target;
+    for (uint_fast8_t n = 0; n < chCount; n++) {
+        *pptLiveTiles[n] = ptLiveTiles[n];
+    }
+
+    return bResult;
+}
+
+/*!
+ * \brief stop verifying the list and drop the records not compared yet
+ * \note  the records are allocated one after another, hence the memory of
+ *        the dropped records starts from the first of them.
+ */
+static void __arm_2d_display_list_stop_verifying(arm_2d_display_list_t *ptThis)
+{
+    if (NULL != this.ptVerify) {
+        this.wUsed = (uint32_t)((uint8_t *)this.ptVerify - this.pchBuffer);
+        this.ptVerify = NULL;
+    }
+
+    if (NULL == this.ptTail) {
+        this.ptHead = NULL;
+    } else {
+        this.ptTail->ptNext = NULL;
+    }
+
+    this.bVerifying = false;
+}
+
+void __arm_2d_display_list_record(arm_2d_op_core_t *ptOP)
+{
+    arm_2d_display_list_t *ptThis = ARM_2D_CTRL.ptRecordingList;
+
+    if (NULL == ptThis || !this.bValid) {
+        return ;
+    }
+
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+    if (arm_2d_port_get_default_op_index() != ARM_2D_CTRL.chRecordingOPIndex) {
+        /* ignore the OPs issued by other threads */
+        return ;
+    }
+#endif
+
+    uint_fast8_t chParam = ptOP->ptOp->Info.Param.chValue;
+
+    /* NOTE: a source read by the backend directly (bBackendReadsSource) is
+     *       neither copied nor checked against the canvas
+     */
+    if (    !__arm_2d_display_list_is_default_op(ptOP)
+        ||  !(chParam & ARM_2D_OP_INFO_PARAM_HAS_TARGET)
+        ||  (chParam & ARM_2D_OP_INFO_PARAM_HAS_ORIGIN)
+        ||  (chParam & ARM_2D_OP_INFO_PARAM_BACKEND_READS_SOURCE)
+        ||  !__arm_2d_display_list_is_recordable(ptOP->ptOp)) {
+        /* the OP cannot be recorded */
+        this.bValid = false;
+        return ;
+    }
+
+    arm_2d_op_t *ptTargetOP = (arm_2d_op_t *)ptOP;
+    const arm_2d_tile_t *ptTarget = ptTargetOP->Target.ptTile;
+    if ((intptr_t)-1 == (intptr_t)ptTarget) {
+        ptTarget = ARM_2D_CTRL.ptDefaultFrameBuffer;
+    }
+    if (NULL == ptTarget) {
+        this.bValid = false;
+        return ;
+    }
+
+    /* when verifying, the record is only added if it differs from the list */
+    __arm_2d_display_list_entry_t tNew;
+    __arm_2d_display_list_entry_t *ptEntry = &tNew;
+    uint32_t wMark = this.wUsed;
+
+    if (!this.bVerifying) {
+        ptEntry = __arm_2d_display_list_alloc(
+                                        ptThis,
+                                        sizeof(__arm_2d_display_list_entry_t));
+        if (NULL == ptEntry) {
+            return ;
+        }
+    }
+    memset(ptEntry, 0, offsetof(__arm_2d_display_list_entry_t, dwOP));
+    memcpy(ptEntry->dwOP, ptOP, __ARM_2D_DISPLAY_LIST_OP_SIZE);
+
+    if (NULL == ptTargetOP->Target.ptRegion) {
+        ptEntry->tRegion.tSize = ptTarget->tRegion.tSize;
+    } else {
+        ptEntry->tRegion = *ptTargetOP->Target.ptRegion;
+    }
+
+    arm_2d_err_t tResult = __arm_2d_display_list_locate_target(ptThis,
+                                                               ptEntry,
+                                                               ptTarget);
+    if (ARM_2D_ERR_OUT_OF_REGION == tResult) {
+        /* drop the record, as the OP draws nothing */
+        this.wUsed = wMark;
+        return ;
+    }
+
+    if (this.bVerifying) {
+        if (__arm_2d_display_list_is_same_op(ptThis, &tNew, ptTarget, chParam)) {
+            /* keep the record */
+            this.ptTail = this.ptVerify;
+            this.ptVerify = this.ptVerify->ptNext;
+            this.hwCount++;
+            return ;
+        }
+
+        /* the OP stream changes from here, record the rest OPs again */
+        __arm_2d_display_list_stop_verifying(ptThis);
+
+        ptEntry = __arm_2d_display_list_alloc(
+                                        ptThis,
+                                        sizeof(__arm_2d_display_list_entry_t));
+        if (NULL == ptEntry) {
+            return ;
+        }
+        *ptEntry = tNew;
+    }
+
+    if (ARM_2D_ERR_NOT_AVAILABLE == tResult) {
+        bool bOnCanvas;
+        ptEntry->ptTarget = __arm_2d_display_list_copy_tile_chain(ptThis,
+                                                                  ptTarget,
+                                                                  &bOnCanvas);
+        if (NULL == ptEntry->ptTarget) {
+            return ;
+        }
+    }
+
+    /* copy the source and masks */
+    do {
+        const arm_2d_tile_t **pptTiles[3];
+        uint_fast8_t chCount = __arm_2d_display_list_get_assets(
+                                            (arm_2d_op_core_t *)ptEntry->dwOP,
+                                            chParam,
+                                            pptTiles);
+
+        for (uint_fast8_t n = 0; n < chCount; n++) {
+            if (!__arm_2d_display_list_copy_asset(ptThis, pptTiles[n])) {
+                return ;
+            }
+        }
+    } while(0);
+
+    /* add the record to the list */
+    if (NULL == this.ptTail) {
+        this.ptHead = ptEntry;
+    } else {
+        this.ptTail->ptNext = ptEntry;
+    }
+    this.ptTail = ptEntry;
+    this.hwCount++;
+}
+
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_display_list_init(  arm_2d_display_list_t *ptThis,
+                                        void *pBuffer,
+                                        uint32_t wSize)
+{
+    assert(NULL != ptThis);
+    assert(NULL != pBuffer);
+
+    memset(ptThis, 0, sizeof(arm_2d_display_list_t));
+
+    /* align the buffer to 8 bytes */
+    uintptr_t nAligned = ((uintptr_t)pBuffer + 7) & ~((uintptr_t)7);
+    uint32_t wPadding = (uint32_t)(nAligned - (uintptr_t)pBuffer);
+
+    if (wSize <= wPadding + sizeof(__arm_2d_display_list_entry_t)) {
+        return ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    this.pchBuffer = (uint8_t *)nAligned;
+    this.wSize = wSize - wPadding;
+
+    return ARM_2D_ERR_NONE;
+}
+
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_display_list_begin_recording(
+                                            arm_2d_display_list_t *ptThis,
+                                            const arm_2d_tile_t *ptCanvas)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptCanvas);
+
+    bool bBusy = false;
+
+    arm_irq_safe {
+        if (NULL != ARM_2D_CTRL.ptRecordingList) {
+            bBusy = true;
+        } else {
+            ARM_2D_CTRL.ptRecordingList = ptThis;
+        }
+    }
+
+    if (bBusy) {
+        return ARM_2D_ERR_BUSY;
+    }
+
+    /* compare the OPs with a valid list before recording them again */
+    this.bVerifying = this.bValid && (NULL != this.ptHead);
+    if (this.bVerifying) {
+        this.ptVerify = this.ptHead;
+    } else {
+        this.wUsed = 0;
+        this.ptHead = NULL;
+        this.ptVerify = NULL;
+    }
+
+    this.ptTail = NULL;
+    this.hwCount = 0;
+    this.ptCanvas = ptCanvas;
+    this.bValid = true;
+    this.bRecording = true;
+    this.tStatistics.wRecordings++;
+
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+    ARM_2D_CTRL.chRecordingOPIndex = arm_2d_port_get_default_op_index();
+#endif
+
+    return ARM_2D_ERR_NONE;
+}
+
+ARM_NONNULL(1)
+bool arm_2d_display_list_end_recording(arm_2d_display_list_t *ptThis)
+{
+    assert(NULL != ptThis);
+
+    arm_irq_safe {
+        if (ARM_2D_CTRL.ptRecordingList == ptThis) {
+            ARM_2D_CTRL.ptRecordingList = NULL;
+        }
+    }
+
+    if (!this.bRecording) {
+        return this.bValid;
+    }
+    this.bRecording = false;
+
+    if (this.bVerifying) {
+        if (NULL == this.ptVerify) {
+            /* the OP stream is unchanged, all the records are kept */
+            this.bVerifying = false;
+            this.tStatistics.wReused++;
+        } else {
+            /* the OP stream becomes shorter */
+            __arm_2d_display_list_stop_verifying(ptThis);
+        }
+    }
+
+    if (!this.bValid) {
+        this.tStatistics.wInvalid++;
+    }
+
+    return this.bValid;
+}
+
+bool arm_2d_display_list_is_recording(void)
+{
+    arm_2d_display_list_t *ptThis = ARM_2D_CTRL.ptRecordingList;
+
+    /* an invalid list records nothing, the drawing can skip the invisible
+     * parts as usual
+     */
+    return (NULL != ptThis) && this.bValid;
+}
+
+static arm_2d_op_core_t *__arm_2d_display_list_get_default_op(void)
+{
+    ARM_2D_IMPL(arm_2d_op_core_t, NULL);
+
+    return ptThis;
+}
+
+ARM_NONNULL(1,2)
+bool arm_2d_display_list_replay(arm_2d_display_list_t *ptThis,
+                                const arm_2d_tile_t *ptCanvas)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptCanvas);
+
+    if (!this.bValid || this.bRecording) {
+        return false;
+    }
+
+    /* get the visible area of the canvas */
+    arm_2d_region_t tVisibleArea;
+    arm_2d_location_t tOffset;
+    if (NULL == arm_2d_tile_get_root(ptCanvas, &tVisibleArea, &tOffset)) {
+        /* nothing to draw */
+        return true;
+    }
+    tVisibleArea.tLocation = tOffset;
+
+    /* the default OP of the calling thread */
+    arm_2d_op_core_t *ptOP = __arm_2d_display_list_get_default_op();
+    uint32_t wReplayed = 0;
+    uint32_t wCulled = 0;
+
+    /* NOTE: the target and the region must stay valid until the OP completes */
+    arm_2d_tile_t tTarget;
+    arm_2d_region_t tRegion;
+
+    __arm_2d_display_list_entry_t *ptEntry = this.ptHead;
+    for (; NULL != ptEntry; ptEntry = ptEntry->ptNext) {
+
+        if (!ptEntry->bAlwaysReplay) {
+            arm_2d_region_t tDrawRegion;
+            if (!arm_2d_region_intersect(   &tVisibleArea,
+                                            &ptEntry->tBoundingBox,
+                                            &tDrawRegion)) {
+                wCulled++;
+                continue;
+            }
+        }
+
+        /* wait for the previous OP */
+        arm_2d_op_wait_async(ptOP);
+
+        /* load the OP, but keep the runtime states of the default OP */
+        arm_2d_op_core_t tCore = *ptOP;
+        memcpy(ptOP, ptEntry->dwOP, __ARM_2D_DISPLAY_LIST_OP_SIZE);
+        const __arm_2d_op_info_t *ptInfo = ptOP->ptOp;
+        *ptOP = tCore;
+        ptOP->ptOp = ptInfo;
+
+        arm_2d_op_t *ptTargetOP = (arm_2d_op_t *)ptOP;
+        tRegion = ptEntry->tRegion;
+        ptTargetOP->Target.ptRegion = &tRegion;
+
+        if (NULL == ptEntry->ptTarget) {
+            tTarget = ptEntry->tTarget;
+            tTarget.ptParent = (arm_2d_tile_t *)ptCanvas;
+            ptTargetOP->Target.ptTile = &tTarget;
+        } else {
+            ptTargetOP->Target.ptTile = ptEntry->ptTarget;
+        }
+
+        if (__arm_2d_op_acquire(ptOP)) {
+            __arm_2d_op_invoke(ptOP);
+        }
+        wReplayed++;
+    }
+
+    arm_2d_op_wait_async(ptOP);
+
+    arm_irq_safe {
+        this.tStatistics.wReplays++;
+        this.tStatistics.wReplayedOPs += wReplayed;
+        this.tStatistics.wCulledOPs += wCulled;
+    }
+
+    return true;
+}
+
+ARM_NONNULL(1,2)
+void arm_2d_display_list_get_statistics(
+                            arm_2d_display_list_t *ptThis,
+                            arm_2d_display_list_statistics_t *ptStatistics)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptStatistics);
+
+    arm_irq_safe {
+        *ptStatistics = this.tStatistics;
+        ptStatistics->hwCount = this.hwCount;
+        ptStatistics->wUsed = this.wUsed;
+    }
+}
+
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_warning 174,177,188,68,513,144
+#elif defined(__IS_COMPILER_GCC__)
+#   pragma GCC diagnostic pop
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
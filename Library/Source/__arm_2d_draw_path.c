@@ -0,0 +1,1235 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_draw_path.c
+ * Description:  APIs for the anti-aliased path (polygon, line and arc) filling
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+
+/*============================ INCLUDES ======================================*/
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wempty-translation-unit"
+#endif
+
+#ifdef __ARM_2D_COMPILATION_UNIT
+#undef __ARM_2D_COMPILATION_UNIT
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-float-conversion"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wswitch-enum"
+#   pragma clang diagnostic ignored "-Wswitch"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#   pragma clang diagnostic ignored "-Wbad-function-cast"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#elif defined(__IS_COMPILER_GCC__)
+#   pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+
+/*============================ MACROS ========================================*/
+#undef OP_CORE
+#define OP_CORE this.use_as__arm_2d_op_t.use_as__arm_2d_op_core_t
+
+#undef OPCODE
+#define OPCODE this.use_as__arm_2d_op_t
+
+/* the largest distance (in pixels) between an arc and the edges approximating it */
+#define __ARM_2D_PATH_ARC_TOLERANCE         (0.2f)
+
+/* the largest angle covered by one edge of an arc, i.e. 45 degrees */
+#define __ARM_2D_PATH_ARC_MAX_STEP          (0.7853982f)
+
+#define __ARM_2D_PATH_ARC_MAX_SEGMENTS      360
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*! \brief blend a band of coverage to the target */
+typedef void __arm_2d_fill_path_blend_t(arm_2d_op_fill_path_t *ptThis,
+                                        void *pTarget,
+                                        int16_t iTargetStride,
+                                        uint8_t *pchAlpha,
+                                        int16_t iAlphaStride,
+                                        arm_2d_size_t *ptSize);
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*----------------------------------------------------------------------------*
+ * Path construction                                                          *
+ *----------------------------------------------------------------------------*/
+
+static
+void __arm_2d_path_update_bounding_box(arm_2d_path_t *ptThis, float fX, float fY)
+{
+    if (!this.bHasBoundingBox) {
+        this.bHasBoundingBox = true;
+        this.tMin.fX = this.tMax.fX = fX;
+        this.tMin.fY = this.tMax.fY = fY;
+        return ;
+    }
+
+    this.tMin.fX = MIN(this.tMin.fX, fX);
+    this.tMin.fY = MIN(this.tMin.fY, fY);
+    this.tMax.fX = MAX(this.tMax.fX, fX);
+    this.tMax.fY = MAX(this.tMax.fY, fY);
+}
+
+static
+arm_2d_err_t __arm_2d_path_add_edge(arm_2d_path_t *ptThis,
+                                    arm_2d_point_float_t tStart,
+                                    arm_2d_point_float_t tEnd)
+{
+    /* horizontal edges don't contribute to the coverage */
+    if (tStart.fY == tEnd.fY) {
+        return ARM_2D_ERR_NONE;
+    }
+
+    if (this.hwCount >= this.hwCapacity) {
+        this.bOverflow = true;
+        return ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    this.ptEdges[this.hwCount].tStart = tStart;
+    this.ptEdges[this.hwCount].tEnd = tEnd;
+    this.hwCount++;
+
+    return ARM_2D_ERR_NONE;
+}
+
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_init(  arm_2d_path_t *ptPath,
+                                arm_2d_path_edge_t *ptEdges,
+                                uint16_t hwCapacity,
+                                arm_2d_path_fill_rule_t tRule)
+{
+    assert(NULL != ptPath);
+    assert(NULL != ptEdges);
+
+    if (tRule > ARM_2D_PATH_FILL_EVEN_ODD) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    arm_2d_path_t *ptThis = ptPath;
+    memset(ptThis, 0, sizeof(arm_2d_path_t));
+
+    this.ptEdges = ptEdges;
+    this.hwCapacity = hwCapacity;
+    this.chFillRule = tRule;
+
+    arm_2d_path_reset(ptPath);
+
+    return ARM_2D_ERR_NONE;
+}
+
+ARM_NONNULL(1)
+void arm_2d_path_reset(arm_2d_path_t *ptPath)
+{
+    assert(NULL != ptPath);
+    arm_2d_path_t *ptThis = ptPath;
+
+    this.hwCount = 0;
+    this.bContourOpen = false;
+    this.bOverflow = false;
+    this.bHasBoundingBox = false;
+}
+
+ARM_NONNULL(1)
+arm_2d_err_t arm_2d_path_close(arm_2d_path_t *ptPath)
+{
+    assert(NULL != ptPath);
+    arm_2d_path_t *ptThis = ptPath;
+
+    if (!this.bContourOpen) {
+        return ARM_2D_ERR_NONE;
+    }
+    this.bContourOpen = false;
+
+    arm_2d_err_t tErr = __arm_2d_path_add_edge( ptThis,
+                                                this.tCurrent,
+                                                this.tContourStart);
+    this.tCurrent = this.tContourStart;
+
+    return tErr;
+}
+
+ARM_NONNULL(1)
+arm_2d_err_t arm_2d_path_move_to(arm_2d_path_t *ptPath, float fX, float fY)
+{
+    assert(NULL != ptPath);
+    arm_2d_path_t *ptThis = ptPath;
+
+    arm_2d_err_t tErr = arm_2d_path_close(ptPath);
+
+    this.tContourStart.fX = fX;
+    this.tContourStart.fY = fY;
+    this.tCurrent = this.tContourStart;
+    this.bContourOpen = true;
+
+    __arm_2d_path_update_bounding_box(ptThis, fX, fY);
+
+    return tErr;
+}
+
+ARM_NONNULL(1)
+arm_2d_err_t arm_2d_path_line_to(arm_2d_path_t *ptPath, float fX, float fY)
+{
+    assert(NULL != ptPath);
+    arm_2d_path_t *ptThis = ptPath;
+
+    if (!this.bContourOpen) {
+        return arm_2d_path_move_to(ptPath, fX, fY);
+    }
+
+    arm_2d_point_float_t tEnd = {.fX = fX, .fY = fY};
+    arm_2d_err_t tErr = __arm_2d_path_add_edge(ptThis, this.tCurrent, tEnd);
+    this.tCurrent = tEnd;
+
+    __arm_2d_path_update_bounding_box(ptThis, fX, fY);
+
+    return tErr;
+}
+
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_add_polygon(   arm_2d_path_t *ptPath,
+                                        const arm_2d_point_float_t *ptPoints,
+                                        uint16_t hwCount)
+{
+    assert(NULL != ptPath);
+    assert(NULL != ptPoints);
+
+    if (hwCount < 3) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    arm_2d_err_t tErr = arm_2d_path_move_to(ptPath,
+                                            ptPoints[0].fX,
+                                            ptPoints[0].fY);
+
+    for (uint_fast16_t n = 1; n < hwCount; n++) {
+        arm_2d_err_t tResult = arm_2d_path_line_to(ptPath,
+                                                   ptPoints[n].fX,
+                                                   ptPoints[n].fY);
+        if (ARM_2D_ERR_NONE != tResult) {
+            tErr = tResult;
+        }
+    }
+
+    arm_2d_err_t tResult = arm_2d_path_close(ptPath);
+    return (ARM_2D_ERR_NONE != tResult) ? tResult : tErr;
+}
+
+ARM_NONNULL(1,2,3)
+arm_2d_err_t arm_2d_path_add_line(  arm_2d_path_t *ptPath,
+                                    const arm_2d_point_float_t *ptStart,
+                                    const arm_2d_point_float_t *ptEnd,
+                                    float fThickness)
+{
+    assert(NULL != ptPath);
+    assert(NULL != ptStart);
+    assert(NULL != ptEnd);
+
+    if (fThickness <= 0.0f) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    float fDX = ptEnd->fX - ptStart->fX;
+    float fDY = ptEnd->fY - ptStart->fY;
+    float fLength;
+    arm_sqrt_f32(fDX * fDX + fDY * fDY, &fLength);
+
+    if (fLength == 0.0f) {
+        return ARM_2D_ERR_NONE;
+    }
+
+    /* half of the thickness along the normal of the line */
+    float fScale = fThickness * 0.5f / fLength;
+    float fNX = -fDY * fScale;
+    float fNY = fDX * fScale;
+
+    arm_2d_point_float_t tPoints[4] = {
+        {.fX = ptStart->fX + fNX,   .fY = ptStart->fY + fNY},
+        {.fX = ptEnd->fX + fNX,     .fY = ptEnd->fY + fNY},
+        {.fX = ptEnd->fX - fNX,     .fY = ptEnd->fY - fNY},
+        {.fX = ptStart->fX - fNX,   .fY = ptStart->fY - fNY},
+    };
+
+    return arm_2d_path_add_polygon(ptPath, tPoints, dimof(tPoints));
+}
+
+static
+uint_fast16_t __arm_2d_path_get_arc_segments(float fRadius, float fSweep)
+{
+    /* the sagitta of a chord is about r * step^2 / 8 */
+    float fStep;
+    arm_sqrt_f32(8.0f * __ARM_2D_PATH_ARC_TOLERANCE / fRadius, &fStep);
+    fStep = MIN(fStep, __ARM_2D_PATH_ARC_MAX_STEP);
+
+    int32_t nSegments = (int32_t)(fSweep / fStep) + 1;
+
+    return MIN(nSegments, __ARM_2D_PATH_ARC_MAX_SEGMENTS);
+}
+
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_add_arc(   arm_2d_path_t *ptPath,
+                                    const arm_2d_point_float_t *ptCentre,
+                                    float fRadius,
+                                    float fThickness,
+                                    float fStartAngle,
+                                    float fEndAngle)
+{
+    assert(NULL != ptPath);
+    assert(NULL != ptCentre);
+
+    if ((fRadius <= 0.0f) || (fThickness <= 0.0f)) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    float fSweep = fEndAngle - fStartAngle;
+    if (fSweep == 0.0f) {
+        return ARM_2D_ERR_NONE;
+    }
+    fSweep = MAX(MIN(fSweep, ARM_2D_ANGLE(360.0f)), -ARM_2D_ANGLE(360.0f));
+
+    float fOuter = fRadius + fThickness * 0.5f;
+    float fInner = fRadius - fThickness * 0.5f;
+
+    uint_fast16_t hwSegments = __arm_2d_path_get_arc_segments(
+                                                fOuter,
+                                                (fSweep < 0.0f) ? -fSweep : fSweep);
+    float fStep = fSweep / (float)hwSegments;
+    float fStepCos = arm_cos_f32(fStep);
+    float fStepSin = arm_sin_f32(fStep);
+
+    arm_2d_err_t tErr = ARM_2D_ERR_NONE;
+    arm_2d_err_t tResult;
+
+    /* the outer edge, from the start angle to the end angle */
+    float fCos = arm_cos_f32(fStartAngle);
+    float fSin = arm_sin_f32(fStartAngle);
+
+    tErr = arm_2d_path_move_to( ptPath,
+                                ptCentre->fX + fOuter * fCos,
+                                ptCentre->fY + fOuter * fSin);
+
+    for (uint_fast16_t n = 1; n <= hwSegments; n++) {
+        float fTemp = fCos * fStepCos - fSin * fStepSin;
+        fSin = fSin * fStepCos + fCos * fStepSin;
+        fCos = fTemp;
+
+        tResult = arm_2d_path_line_to(  ptPath,
+                                        ptCentre->fX + fOuter * fCos,
+                                        ptCentre->fY + fOuter * fSin);
+        if (ARM_2D_ERR_NONE != tResult) {
+            tErr = tResult;
+        }
+    }
+
+    if (fInner <= 0.0f) {
+        /* a pie slice */
+        tResult = arm_2d_path_line_to(ptPath, ptCentre->fX, ptCentre->fY);
+        if (ARM_2D_ERR_NONE != tResult) {
+            tErr = tResult;
+        }
+    } else {
+        /* the inner edge, from the end angle back to the start angle */
+        for (uint_fast16_t n = 0; n <= hwSegments; n++) {
+            tResult = arm_2d_path_line_to(  ptPath,
+                                            ptCentre->fX + fInner * fCos,
+                                            ptCentre->fY + fInner * fSin);
+            if (ARM_2D_ERR_NONE != tResult) {
+                tErr = tResult;
+            }
+
+            float fTemp = fCos * fStepCos + fSin * fStepSin;
+            fSin = fSin * fStepCos - fCos * fStepSin;
+            fCos = fTemp;
+        }
+    }
+
+    tResult = arm_2d_path_close(ptPath);
+    return (ARM_2D_ERR_NONE != tResult) ? tResult : tErr;
+}
+
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_path_add_circle(arm_2d_path_t *ptPath,
+                                    const arm_2d_point_float_t *ptCentre,
+                                    float fRadius)
+{
+    assert(NULL != ptPath);
+    assert(NULL != ptCentre);
+
+    if (fRadius <= 0.0f) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    uint_fast16_t hwSegments = __arm_2d_path_get_arc_segments(
+                                                    fRadius,
+                                                    ARM_2D_ANGLE(360.0f));
+    float fStep = ARM_2D_ANGLE(360.0f) / (float)hwSegments;
+    float fStepCos = arm_cos_f32(fStep);
+    float fStepSin = arm_sin_f32(fStep);
+    float fCos = 1.0f;
+    float fSin = 0.0f;
+
+    arm_2d_err_t tErr = arm_2d_path_move_to(ptPath,
+                                            ptCentre->fX + fRadius,
+                                            ptCentre->fY);
+
+    for (uint_fast16_t n = 1; n < hwSegments; n++) {
+        float fTemp = fCos * fStepCos - fSin * fStepSin;
+        fSin = fSin * fStepCos + fCos * fStepSin;
+        fCos = fTemp;
+
+        arm_2d_err_t tResult = arm_2d_path_line_to(
+                                            ptPath,
+                                            ptCentre->fX + fRadius * fCos,
+                                            ptCentre->fY + fRadius * fSin);
+        if (ARM_2D_ERR_NONE != tResult) {
+            tErr = tResult;
+        }
+    }
+
+    arm_2d_err_t tResult = arm_2d_path_close(ptPath);
+    return (ARM_2D_ERR_NONE != tResult) ? tResult : tErr;
+}
+
+/*----------------------------------------------------------------------------*
+ * Rasteriser                                                                 *
+ *----------------------------------------------------------------------------*/
+
+uint32_t arm_2d_fill_path_get_scratch_size(int16_t iWidth)
+{
+    if (iWidth <= 0) {
+        return 0;
+    }
+
+    /* the signed area accumulators (two guard columns) and the A8 mask */
+    return  (uint32_t)(iWidth + 2) * ARM_2D_DRAW_PATH_BAND_HEIGHT * sizeof(float)
+        +   (uint32_t)iWidth * ARM_2D_DRAW_PATH_BAND_HEIGHT;
+}
+
+/*!
+ * \brief accumulate the signed area covered by a line inside the band
+ * \note the line must be inside the band and x must be in range [0, iWidth],
+ *       the accumulators of a pixel receive the area on its right side, hence
+ *       the prefix sum of a row is the coverage.
+ */
+static
+void __arm_2d_path_accumulate_line( float *__RESTRICT pfAcc,
+                                    int_fast16_t iAccStride,
+                                    int_fast16_t iWidth,
+                                    float fX0,
+                                    float fY0,
+                                    float fX1,
+                                    float fY1)
+{
+    float fDir = 1.0f;
+
+    if (fY0 == fY1) {
+        return ;
+    } else if (fY0 > fY1) {
+        float fTemp;
+        fTemp = fX0; fX0 = fX1; fX1 = fTemp;
+        fTemp = fY0; fY0 = fY1; fY1 = fTemp;
+        fDir = -1.0f;
+    }
+
+    float fDXDY = (fX1 - fX0) / (fY1 - fY0);
+    float fX = fX0;
+    int_fast16_t iY = (int_fast16_t)fY0;
+    int_fast16_t iYEnd = (int_fast16_t)fY1;
+    if ((float)iYEnd < fY1) {
+        iYEnd++;
+    }
+
+    for (; iY < iYEnd; iY++) {
+        float *pfRow = pfAcc + iY * iAccStride;
+
+        float fDY = MIN((float)(iY + 1), fY1) - MAX((float)iY, fY0);
+        float fXNext = fX + fDXDY * fDY;
+        float fD = fDY * fDir;
+
+        float fLeft = MAX(MIN(fX, fXNext), 0.0f);
+        float fRight = MIN(MAX(fX, fXNext), (float)iWidth);
+
+        int_fast16_t iLeft = (int_fast16_t)fLeft;
+        int_fast16_t iRight = (int_fast16_t)fRight;
+        if ((float)iRight < fRight) {
+            iRight++;
+        }
+
+        if (iRight <= iLeft + 1) {
+            /* inside one pixel: split by the average x */
+            float fMid = (fLeft + fRight) * 0.5f - (float)iLeft;
+            pfRow[iLeft] += fD - fD * fMid;
+            pfRow[iLeft + 1] += fD * fMid;
+        } else {
+            /* across pixels: the covered area grows as a trapezoid */
+            float fInvDX = 1.0f / (fRight - fLeft);
+            float fLeftFrac = fLeft - (float)iLeft;
+            float fRightFrac = fRight - (float)iRight + 1.0f;
+
+            float fA0 = 0.5f * fInvDX * (1.0f - fLeftFrac) * (1.0f - fLeftFrac);
+            float fAm = 0.5f * fInvDX * fRightFrac * fRightFrac;
+
+            pfRow[iLeft] += fD * fA0;
+
+            if (iRight == iLeft + 2) {
+                pfRow[iLeft + 1] += fD * (1.0f - fA0 - fAm);
+            } else {
+                float fA1 = fInvDX * (1.5f - fLeftFrac);
+                pfRow[iLeft + 1] += fD * (fA1 - fA0);
+
+                for (int_fast16_t iX = iLeft + 2; iX < iRight - 1; iX++) {
+                    pfRow[iX] += fD * fInvDX;
+                }
+
+                float fA2 = fA1 + (float)(iRight - iLeft - 3) * fInvDX;
+                pfRow[iRight - 1] += fD * (1.0f - fA2 - fAm);
+            }
+            pfRow[iRight] += fD * fAm;
+        }
+
+        fX = fXNext;
+    }
+}
+
+/*!
+ * \brief clip an edge with the band and accumulate it
+ * \note the parts on the left of the band are kept as vertical lines at x = 0,
+ *       as they still cover the whole row, and the parts on the right are
+ *       kept at x = iWidth which is outside the visible columns.
+ * \return bool whether the edge touches the band
+ */
+static
+bool __arm_2d_path_accumulate_edge( float *__RESTRICT pfAcc,
+                                    int_fast16_t iAccStride,
+                                    int_fast16_t iWidth,
+                                    int_fast16_t iHeight,
+                                    float fX0,
+                                    float fY0,
+                                    float fX1,
+                                    float fY1,
+                                    int16_t *piLeft,
+                                    int16_t *piRight)
+{
+    float fHeight = (float)iHeight;
+    float fWidth = (float)iWidth;
+
+    if (    (fY0 == fY1)
+        ||  (MAX(fY0, fY1) <= 0.0f)
+        ||  (MIN(fY0, fY1) >= fHeight)) {
+        return false;
+    }
+
+    /* clip vertically */
+    float fDXDY = (fX1 - fX0) / (fY1 - fY0);
+    if (fY0 < 0.0f) {
+        fX0 -= fY0 * fDXDY;
+        fY0 = 0.0f;
+    } else if (fY0 > fHeight) {
+        fX0 += (fHeight - fY0) * fDXDY;
+        fY0 = fHeight;
+    }
+    if (fY1 < 0.0f) {
+        fX1 -= fY1 * fDXDY;
+        fY1 = 0.0f;
+    } else if (fY1 > fHeight) {
+        fX1 += (fHeight - fY1) * fDXDY;
+        fY1 = fHeight;
+    }
+
+    /* update the columns touched by the band */
+    do {
+        float fLeft = MAX(MIN(fX0, fX1), 0.0f);
+        float fRight = MIN(MAX(fX0, fX1), fWidth);
+
+        *piLeft = MIN(*piLeft, (int16_t)MIN(fLeft, fWidth));
+        *piRight = MAX(*piRight, (int16_t)MAX(fRight, 0.0f) + 1);
+    } while(0);
+
+    /* split at x = 0 and x = iWidth, then clamp each part */
+    float fSplitY[4];
+    uint_fast8_t chSplits = 0;
+
+    fSplitY[chSplits++] = fY0;
+    if (fX0 != fX1) {
+        float fDYDX = (fY1 - fY0) / (fX1 - fX0);
+        float fYAtLeft = fY0 + (0.0f - fX0) * fDYDX;
+        float fYAtRight = fY0 + (fWidth - fX0) * fDYDX;
+
+        /* keep the crossings in the order from the start to the end */
+        bool bLeftFirst = ((fX1 > fX0) == true);
+        float fFirst = bLeftFirst ? fYAtLeft : fYAtRight;
+        float fSecond = bLeftFirst ? fYAtRight : fYAtLeft;
+
+        if ((MIN(fX0, fX1) < (bLeftFirst ? 0.0f : fWidth))
+        &&  (MAX(fX0, fX1) > (bLeftFirst ? 0.0f : fWidth))) {
+            fSplitY[chSplits++] = fFirst;
+        }
+        if ((MIN(fX0, fX1) < (bLeftFirst ? fWidth : 0.0f))
+        &&  (MAX(fX0, fX1) > (bLeftFirst ? fWidth : 0.0f))) {
+            fSplitY[chSplits++] = fSecond;
+        }
+    }
+    fSplitY[chSplits] = fY1;
+
+    for (uint_fast8_t n = 0; n < chSplits; n++) {
+        float fStartY = fSplitY[n];
+        float fEndY = fSplitY[n + 1];
+        float fStartX = fX0 + (fStartY - fY0) * fDXDY;
+        float fEndX = fX0 + (fEndY - fY0) * fDXDY;
+
+        __arm_2d_path_accumulate_line(  pfAcc,
+                                        iAccStride,
+                                        iWidth,
+                                        MIN(MAX(fStartX, 0.0f), fWidth),
+                                        fStartY,
+                                        MIN(MAX(fEndX, 0.0f), fWidth),
+                                        fEndY);
+    }
+
+    return true;
+}
+
+/*!
+ * \brief rasterise a path inside the working buffer and blend it to the target
+ */
+static
+arm_fsm_rt_t __arm_2d_fill_path(arm_2d_op_fill_path_t *ptThis,
+                                __arm_2d_sub_task_t *ptTask,
+                                uint_fast8_t chPixelSizeInByte,
+                                __arm_2d_fill_path_blend_t *fnBlend)
+{
+    const arm_2d_path_t *ptPath = this.ptPath;
+    arm_2d_region_t *ptValidRegion
+        = &ptTask->Param.tTileProcess.tValidRegionInVirtualScreen;
+
+    int16_t iWidth = ptValidRegion->tSize.iWidth;
+    int16_t iHeight = ptValidRegion->tSize.iHeight;
+    if (iWidth <= 0 || iHeight <= 0) {
+        return arm_fsm_rt_cpl;
+    }
+
+    /* get the scratch memory */
+    uint32_t wSize = arm_2d_fill_path_get_scratch_size(iWidth);
+    arm_2d_scratch_mem_t tScratchMemory = {0};
+    uint8_t *pchScratch = (uint8_t *)this.tScratchMemory.pBuffer;
+
+    if (NULL != pchScratch) {
+        if (this.tScratchMemory.u24SizeInByte < wSize) {
+            return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+        }
+    } else {
+        if (NULL == arm_2d_scratch_memory_new(  &tScratchMemory,
+                                                sizeof(uint32_t),
+                                                (wSize + 3) / sizeof(uint32_t),
+                                                sizeof(uint32_t),
+                                                ARM_2D_MEM_TYPE_FAST)) {
+            return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+        }
+        pchScratch = (uint8_t *)tScratchMemory.pBuffer;
+        if (NULL == pchScratch) {
+            return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+        }
+    }
+
+    int16_t iAccStride = iWidth + 2;
+    float *pfAcc = (float *)pchScratch;
+    uint8_t *pchMask = pchScratch
+                     + (uint32_t)iAccStride
+                     * ARM_2D_DRAW_PATH_BAND_HEIGHT
+                     * sizeof(float);
+
+    /* move the path to the working buffer */
+    arm_2d_location_t tOrigin = arm_2d_get_absolute_location(   OPCODE.Target.ptTile,
+                                                                this.tOrigin,
+                                                                true);
+    float fOffsetX = (float)(tOrigin.iX - ptValidRegion->tLocation.iX);
+    float fOffsetY = (float)(tOrigin.iY - ptValidRegion->tLocation.iY);
+
+    uint8_t *pchTarget = ptTask->Param.tTileProcess.pBuffer;
+    int16_t iTargetStride = ptTask->Param.tTileProcess.iStride;
+    bool bEvenOdd = (ARM_2D_PATH_FILL_EVEN_ODD == ptPath->chFillRule);
+
+    for (int_fast16_t iY = 0; iY < iHeight; iY += ARM_2D_DRAW_PATH_BAND_HEIGHT) {
+        int16_t iBandHeight = MIN(ARM_2D_DRAW_PATH_BAND_HEIGHT, iHeight - iY);
+        float fBandOffsetY = fOffsetY - (float)iY;
+
+        /* skip the band when it is outside the bounding box */
+        if (    (ptPath->tMax.fY + fBandOffsetY <= 0.0f)
+            ||  (ptPath->tMin.fY + fBandOffsetY >= (float)iBandHeight)) {
+            continue;
+        }
+
+        memset(pfAcc, 0, (uint32_t)iAccStride * iBandHeight * sizeof(float));
+
+        int16_t iLeft = iWidth;
+        int16_t iRight = 0;
+        bool bTouched = false;
+
+        const arm_2d_path_edge_t *ptEdge = ptPath->ptEdges;
+        for (uint_fast16_t n = ptPath->hwCount; n > 0; n--, ptEdge++) {
+            bTouched |= __arm_2d_path_accumulate_edge(
+                                            pfAcc,
+                                            iAccStride,
+                                            iWidth,
+                                            iBandHeight,
+                                            ptEdge->tStart.fX + fOffsetX,
+                                            ptEdge->tStart.fY + fBandOffsetY,
+                                            ptEdge->tEnd.fX + fOffsetX,
+                                            ptEdge->tEnd.fY + fBandOffsetY,
+                                            &iLeft,
+                                            &iRight);
+        }
+
+        /* the open contour is closed implicitly */
+        if (ptPath->bContourOpen) {
+            bTouched |= __arm_2d_path_accumulate_edge(
+                                            pfAcc,
+                                            iAccStride,
+                                            iWidth,
+                                            iBandHeight,
+                                            ptPath->tCurrent.fX + fOffsetX,
+                                            ptPath->tCurrent.fY + fBandOffsetY,
+                                            ptPath->tContourStart.fX + fOffsetX,
+                                            ptPath->tContourStart.fY + fBandOffsetY,
+                                            &iLeft,
+                                            &iRight);
+        }
+
+        iRight = MIN(iRight, iWidth);
+        if (!bTouched || iLeft >= iRight) {
+            continue;
+        }
+
+        /* the prefix sum of the accumulators is the coverage */
+        for (int_fast16_t iRow = 0; iRow < iBandHeight; iRow++) {
+            float *pfRow = pfAcc + iRow * iAccStride;
+            uint8_t *pchAlpha = pchMask + iRow * iWidth;
+            float fCoverage = 0.0f;
+
+            for (int_fast16_t iX = iLeft; iX < iRight; iX++) {
+                fCoverage += pfRow[iX];
+
+                float fAlpha = (fCoverage < 0.0f) ? -fCoverage : fCoverage;
+                if (bEvenOdd) {
+                    fAlpha = ARM_2D_FMODF(fAlpha, 2.0f);
+                    if (fAlpha > 1.0f) {
+                        fAlpha = 2.0f - fAlpha;
+                    }
+                } else {
+                    fAlpha = MIN(fAlpha, 1.0f);
+                }
+
+                pchAlpha[iX] = (uint8_t)(fAlpha * 255.0f + 0.5f);
+            }
+        }
+
+        arm_2d_size_t tBandSize = {
+            .iWidth = iRight - iLeft,
+            .iHeight = iBandHeight,
+        };
+
+        (*fnBlend)( ptThis,
+                    pchTarget + ((int32_t)iY * iTargetStride + iLeft) * chPixelSizeInByte,
+                    iTargetStride,
+                    pchMask + iLeft,
+                    iWidth,
+                    &tBandSize);
+    }
+
+    if (NULL != (void *)tScratchMemory.pBuffer) {
+        arm_2d_scratch_memory_free(&tScratchMemory);
+    }
+
+    return arm_fsm_rt_cpl;
+}
+
+static
+arm_fsm_rt_t __arm_2d_fill_path_prepare(arm_2d_op_fill_path_t *ptThis,
+                                        bool bDefaultOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_path_t *ptPath,
+                                        uint8_t chOpacity)
+{
+    arm_2d_region_t tTargetRegion;
+
+    if (NULL == ptRegion) {
+        tTargetRegion = (arm_2d_region_t) {
+            .tSize = ptTarget->tRegion.tSize,
+        };
+    } else {
+        tTargetRegion = *ptRegion;
+    }
+
+    /* the bounding box in pixels */
+    int16_t iLeft = (int16_t)ptPath->tMin.fX;
+    int16_t iTop = (int16_t)ptPath->tMin.fY;
+    int16_t iRight = (int16_t)ptPath->tMax.fX;
+    int16_t iBottom = (int16_t)ptPath->tMax.fY;
+
+    iLeft -= ((float)iLeft > ptPath->tMin.fX);
+    iTop -= ((float)iTop > ptPath->tMin.fY);
+    iRight += ((float)iRight < ptPath->tMax.fX);
+    iBottom += ((float)iBottom < ptPath->tMax.fY);
+
+    arm_2d_region_t tBoundingBox = {
+        .tLocation = {
+            .iX = tTargetRegion.tLocation.iX + iLeft,
+            .iY = tTargetRegion.tLocation.iY + iTop,
+        },
+        .tSize = {
+            .iWidth = iRight - iLeft,
+            .iHeight = iBottom - iTop,
+        },
+    };
+
+    if (!arm_2d_region_intersect(&tTargetRegion, &tBoundingBox, &this.tRegion)) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_OUT_OF_REGION;
+    }
+
+    this.tOrigin = tTargetRegion.tLocation;
+    this.ptPath = ptPath;
+    this.chOpacity = chOpacity;
+
+    OPCODE.Target.ptTile = ptTarget;
+    OPCODE.Target.ptRegion = &this.tRegion;
+
+    if (bDefaultOP) {
+        /* the default OP is shared with other OPs, never trust its content */
+        memset(&this.tScratchMemory, 0, sizeof(arm_2d_scratch_mem_t));
+    }
+
+    return arm_fsm_rt_cpl;
+}
+
+static
+arm_2d_err_t __arm_2d_fill_path_check(const arm_2d_path_t *ptPath)
+{
+    if (ptPath->bOverflow) {
+        return ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    if (    (0 == ptPath->hwCount)
+        ||  (ptPath->tMin.fX < (float)INT16_MIN)
+        ||  (ptPath->tMin.fY < (float)INT16_MIN)
+        ||  (ptPath->tMax.fX > (float)INT16_MAX)
+        ||  (ptPath->tMax.fY > (float)INT16_MAX)) {
+        return ARM_2D_ERR_OUT_OF_REGION;
+    }
+
+    return ARM_2D_ERR_NONE;
+}
+
+/*----------------------------------------------------------------------------*
+ * GRAY8                                                                      *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_gray8_fill_path(   arm_2d_op_fill_path_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_path_t *ptPath,
+                                        uint8_t chColour,
+                                        uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPath);
+
+    ARM_2D_IMPL(arm_2d_op_fill_path_t, ptOP);
+
+    arm_2d_err_t tErr = __arm_2d_fill_path_check(ptPath);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (0 == chOpacity) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_FILL_PATH_GRAY8;
+
+    arm_fsm_rt_t tResult = __arm_2d_fill_path_prepare(  ptThis,
+                                                        (NULL == ptOP),
+                                                        ptTarget,
+                                                        ptRegion,
+                                                        ptPath,
+                                                        chOpacity);
+    if (tResult < 0) {
+        return __arm_2d_op_depose((arm_2d_op_core_t *)ptThis, tResult);
+    }
+
+    this.chColour = chColour;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+static
+void __arm_2d_gray8_fill_path_blend(arm_2d_op_fill_path_t *ptThis,
+                                    void *pTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *ptSize)
+{
+    if (255 == this.chOpacity) {
+        __arm_2d_impl_gray8_colour_filling_mask(pTarget,
+                                                iTargetStride,
+                                                pchAlpha,
+                                                iAlphaStride,
+                                                ptSize,
+                                                this.chColour);
+    } else {
+        __arm_2d_impl_gray8_colour_filling_mask_opacity(pTarget,
+                                                        iTargetStride,
+                                                        pchAlpha,
+                                                        iAlphaStride,
+                                                        ptSize,
+                                                        this.chColour,
+                                                        this.chOpacity);
+    }
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_gray8_sw_fill_path( __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_fill_path_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_8BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    return __arm_2d_fill_path(  ptThis,
+                                ptTask,
+                                sizeof(uint8_t),
+                                &__arm_2d_gray8_fill_path_blend);
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILL_PATH_GRAY8,
+                __arm_2d_gray8_sw_fill_path);               /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILL_PATH_GRAY8 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_GRAY8,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILL_PATH,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILL_PATH_GRAY8),
+        },
+    },
+};
+
+/*----------------------------------------------------------------------------*
+ * RGB565                                                                     *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_rgb565_fill_path(  arm_2d_op_fill_path_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_path_t *ptPath,
+                                        uint16_t hwColour,
+                                        uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPath);
+
+    ARM_2D_IMPL(arm_2d_op_fill_path_t, ptOP);
+
+    arm_2d_err_t tErr = __arm_2d_fill_path_check(ptPath);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (0 == chOpacity) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_FILL_PATH_RGB565;
+
+    arm_fsm_rt_t tResult = __arm_2d_fill_path_prepare(  ptThis,
+                                                        (NULL == ptOP),
+                                                        ptTarget,
+                                                        ptRegion,
+                                                        ptPath,
+                                                        chOpacity);
+    if (tResult < 0) {
+        return __arm_2d_op_depose((arm_2d_op_core_t *)ptThis, tResult);
+    }
+
+    this.hwColour = hwColour;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+static
+void __arm_2d_rgb565_fill_path_blend(   arm_2d_op_fill_path_t *ptThis,
+                                        void *pTarget,
+                                        int16_t iTargetStride,
+                                        uint8_t *pchAlpha,
+                                        int16_t iAlphaStride,
+                                        arm_2d_size_t *ptSize)
+{
+    if (255 == this.chOpacity) {
+        __arm_2d_impl_rgb565_colour_filling_mask(   pTarget,
+                                                    iTargetStride,
+                                                    pchAlpha,
+                                                    iAlphaStride,
+                                                    ptSize,
+                                                    this.hwColour);
+    } else {
+        __arm_2d_impl_rgb565_colour_filling_mask_opacity(   pTarget,
+                                                            iTargetStride,
+                                                            pchAlpha,
+                                                            iAlphaStride,
+                                                            ptSize,
+                                                            this.hwColour,
+                                                            this.chOpacity);
+    }
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_rgb565_sw_fill_path( __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_fill_path_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_16BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    return __arm_2d_fill_path(  ptThis,
+                                ptTask,
+                                sizeof(uint16_t),
+                                &__arm_2d_rgb565_fill_path_blend);
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILL_PATH_RGB565,
+                __arm_2d_rgb565_sw_fill_path);              /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILL_PATH_RGB565 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_RGB565,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILL_PATH,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILL_PATH_RGB565),
+        },
+    },
+};
+
+/*----------------------------------------------------------------------------*
+ * CCCN888                                                                    *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_cccn888_fill_path( arm_2d_op_fill_path_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_path_t *ptPath,
+                                        uint32_t wColour,
+                                        uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPath);
+
+    ARM_2D_IMPL(arm_2d_op_fill_path_t, ptOP);
+
+    arm_2d_err_t tErr = __arm_2d_fill_path_check(ptPath);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (0 == chOpacity) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_FILL_PATH_CCCN888;
+
+    arm_fsm_rt_t tResult = __arm_2d_fill_path_prepare(  ptThis,
+                                                        (NULL == ptOP),
+                                                        ptTarget,
+                                                        ptRegion,
+                                                        ptPath,
+                                                        chOpacity);
+    if (tResult < 0) {
+        return __arm_2d_op_depose((arm_2d_op_core_t *)ptThis, tResult);
+    }
+
+    this.wColour = wColour;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+static
+void __arm_2d_cccn888_fill_path_blend(  arm_2d_op_fill_path_t *ptThis,
+                                        void *pTarget,
+                                        int16_t iTargetStride,
+                                        uint8_t *pchAlpha,
+                                        int16_t iAlphaStride,
+                                        arm_2d_size_t *ptSize)
+{
+    if (255 == this.chOpacity) {
+        __arm_2d_impl_cccn888_colour_filling_mask(  pTarget,
+                                                    iTargetStride,
+                                                    pchAlpha,
+                                                    iAlphaStride,
+                                                    ptSize,
+                                                    this.wColour);
+    } else {
+        __arm_2d_impl_cccn888_colour_filling_mask_opacity(  pTarget,
+                                                            iTargetStride,
+                                                            pchAlpha,
+                                                            iAlphaStride,
+                                                            ptSize,
+                                                            this.wColour,
+                                                            this.chOpacity);
+    }
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_cccn888_sw_fill_path( __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_fill_path_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_32BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    return __arm_2d_fill_path(  ptThis,
+                                ptTask,
+                                sizeof(uint32_t),
+                                &__arm_2d_cccn888_fill_path_blend);
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILL_PATH_CCCN888,
+                __arm_2d_cccn888_sw_fill_path);             /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILL_PATH_CCCN888 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_CCCN888,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILL_PATH,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILL_PATH_CCCN888),
+        },
+    },
+};
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* __ARM_2D_COMPILATION_UNIT */
@@ -0,0 +1,1787 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_fill_colour_with_gradient.c
+ * Description:  APIs for colour-filling-with-gradient (linear, radial, conic)
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+
+/*============================ INCLUDES ======================================*/
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wempty-translation-unit"
+#endif
+
+#ifdef __ARM_2D_COMPILATION_UNIT
+#undef __ARM_2D_COMPILATION_UNIT
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-float-conversion"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wswitch-enum"
+#   pragma clang diagnostic ignored "-Wswitch"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wbad-function-cast"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#elif defined(__IS_COMPILER_GCC__)
+#   pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+
+/*============================ MACROS ========================================*/
+
+#undef OP_CORE
+#define OP_CORE this.use_as__arm_2d_op_t.use_as__arm_2d_op_core_t
+
+#undef OPCODE
+#define OPCODE this.use_as__arm_2d_op_t
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*!
+ * \brief the fixed-point parameters of a gradient at the top-left pixel of
+ *        an area
+ * \note the coordinates are doubled, so the centres of pixels are integers
+ */
+typedef struct __arm_2d_gradient_param_t {
+    union {
+        struct {
+            int32_t nT;                 /* Q16 position of the first pixel */
+            int32_t nDTDX;              /* Q16 increment along the X axis */
+            int32_t nDTDY;              /* Q16 increment along the Y axis */
+        } Linear;
+        struct {
+            int32_t nDX;                /* 2 * (x - cx) of the first pixel */
+            int32_t nDY;                /* 2 * (y - cy) of the first pixel */
+            uint32_t wLimit;            /* 4 * r^2 */
+            uint32_t wScale;            /* 2^(32 + shift) / wLimit */
+            uint8_t chShift;
+        } Radial;
+        struct {
+            int32_t nDX;                /* 2 * (x - cx) of the first pixel */
+            int32_t nDY;                /* 2 * (y - cy) of the first pixel */
+            uint16_t hwStartAngle;
+        } Conic;
+    };
+} __arm_2d_gradient_param_t;
+
+typedef void __arm_2d_gradient_generate_t(  arm_2d_op_fill_cl_gradient_t *ptThis,
+                                            void *pTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *ptSize,
+                                            const void *pLUT,
+                                            const __arm_2d_gradient_param_t *ptParam);
+
+typedef void __arm_2d_gradient_blend_t( arm_2d_op_fill_cl_gradient_t *ptThis,
+                                        void *pSource,
+                                        void *pTarget,
+                                        uint8_t *pchMask,
+                                        arm_2d_size_t *ptSize);
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+/*! \brief atan(i / 256) in 1/65536 turn, i.e. 0 ~ 1/8 turn */
+static const uint16_t c_hwGradientAtanLUT[257] = {
+        0,    41,    81,   122,   163,   204,   244,   285,
+      326,   367,   407,   448,   489,   529,   570,   610,
+      651,   692,   732,   773,   813,   854,   894,   935,
+      975,  1015,  1056,  1096,  1136,  1177,  1217,  1257,
+     1297,  1337,  1377,  1417,  1457,  1497,  1537,  1577,
+     1617,  1656,  1696,  1736,  1775,  1815,  1854,  1894,
+     1933,  1973,  2012,  2051,  2090,  2129,  2168,  2207,
+     2246,  2285,  2324,  2363,  2401,  2440,  2478,  2517,
+     2555,  2594,  2632,  2670,  2708,  2746,  2784,  2822,
+     2860,  2897,  2935,  2973,  3010,  3047,  3085,  3122,
+     3159,  3196,  3233,  3270,  3307,  3344,  3380,  3417,
+     3453,  3490,  3526,  3562,  3599,  3635,  3670,  3706,
+     3742,  3778,  3813,  3849,  3884,  3920,  3955,  3990,
+     4025,  4060,  4095,  4129,  4164,  4199,  4233,  4267,
+     4302,  4336,  4370,  4404,  4438,  4471,  4505,  4539,
+     4572,  4605,  4639,  4672,  4705,  4738,  4771,  4803,
+     4836,  4869,  4901,  4933,  4966,  4998,  5030,  5062,
+     5094,  5125,  5157,  5188,  5220,  5251,  5282,  5313,
+     5344,  5375,  5406,  5437,  5467,  5498,  5528,  5559,
+     5589,  5619,  5649,  5679,  5708,  5738,  5768,  5797,
+     5826,  5856,  5885,  5914,  5943,  5972,  6000,  6029,
+     6058,  6086,  6114,  6142,  6171,  6199,  6227,  6254,
+     6282,  6310,  6337,  6365,  6392,  6419,  6446,  6473,
+     6500,  6527,  6554,  6580,  6607,  6633,  6660,  6686,
+     6712,  6738,  6764,  6790,  6815,  6841,  6867,  6892,
+     6917,  6943,  6968,  6993,  7018,  7043,  7068,  7092,
+     7117,  7141,  7166,  7190,  7214,  7238,  7262,  7286,
+     7310,  7334,  7358,  7381,  7405,  7428,  7451,  7475,
+     7498,  7521,  7544,  7566,  7589,  7612,  7635,  7657,
+     7679,  7702,  7724,  7746,  7768,  7790,  7812,  7834,
+     7856,  7877,  7899,  7920,  7942,  7963,  7984,  8005,
+     8026,  8047,  8068,  8089,  8110,  8131,  8151,  8172,
+     8192,
+};
+
+/*============================ IMPLEMENTATION ================================*/
+
+/*----------------------------------------------------------------------------*
+ * Fixed-point Helpers                                                        *
+ *----------------------------------------------------------------------------*/
+
+static
+int64_t __arm_2d_gradient_div_round(int64_t lNumerator, int64_t lDenominator)
+{
+    assert(lDenominator > 0);
+
+    if (lNumerator >= 0) {
+        return (lNumerator + (lDenominator >> 1)) / lDenominator;
+    }
+    return (lNumerator - (lDenominator >> 1)) / lDenominator;
+}
+
+/*!
+ * \brief the integer square root of a number smaller than 65536
+ */
+__STATIC_INLINE
+uint_fast16_t __arm_2d_gradient_isqrt(uint32_t wValue)
+{
+    uint_fast16_t hwResult = 0;
+
+    for (uint_fast16_t hwBit = 128; hwBit > 0; hwBit >>= 1) {
+        uint_fast16_t hwCandidate = hwResult | hwBit;
+        if (hwCandidate * hwCandidate <= wValue) {
+            hwResult = hwCandidate;
+        }
+    }
+
+    return hwResult;
+}
+
+/*!
+ * \brief calculate the radial position (0 ~ 255) of a pixel
+ * \param[in] wSquare the squared distance (doubled coordinates), it must be
+ *            smaller than wLimit
+ * \param[in,out] phwIndex the position of the previous pixel, it is used as
+ *                the initial guess because neighbours barely differ. A value
+ *                larger than 255 means there is no previous pixel.
+ */
+__STATIC_INLINE
+uint_fast8_t __arm_2d_gradient_radial_index(uint32_t wSquare,
+                                            uint32_t wScale,
+                                            uint_fast8_t chShift,
+                                            uint_fast16_t *phwIndex)
+{
+    uint32_t wQ16 = ((wSquare >> chShift) * wScale) >> 16;
+    uint_fast16_t hwIndex = *phwIndex;
+
+    if (hwIndex > 255) {
+        hwIndex = __arm_2d_gradient_isqrt(wQ16);
+    }
+
+    while ((hwIndex < 255) && ((hwIndex + 1) * (hwIndex + 1) <= wQ16)) {
+        hwIndex++;
+    }
+    while (hwIndex * hwIndex > wQ16) {
+        hwIndex--;
+    }
+
+    *phwIndex = hwIndex;
+    return hwIndex;
+}
+
+/*!
+ * \brief calculate the angle of a vector in 1/65536 turn, clockwise on the
+ *        screen starting from the positive X axis
+ */
+__STATIC_INLINE
+uint16_t __arm_2d_gradient_conic_angle(int32_t nDX, int32_t nDY)
+{
+    uint32_t wX = (nDX < 0) ? -nDX : nDX;
+    uint32_t wY = (nDY < 0) ? -nDY : nDY;
+    uint32_t wAngle;
+
+    /* octant reduction */
+    if (wX >= wY) {
+        wAngle = c_hwGradientAtanLUT[(wY << 8) / wX];
+    } else {
+        wAngle = 16384 - c_hwGradientAtanLUT[(wX << 8) / wY];
+    }
+
+    /* quadrant fix-up */
+    if (nDX < 0) {
+        wAngle = 32768 - wAngle;
+    }
+    if (nDY < 0) {
+        wAngle = 65536 - wAngle;
+    }
+
+    return (uint16_t)wAngle;
+}
+
+/*!
+ * \brief find the colour stops around a given position
+ * \param[out] phwRatio the weight of the second stop (0 ~ 255)
+ * \return the first stop, the second stop is the next one when the ratio is
+ *         not zero
+ */
+static
+const arm_2d_gradient_stop_t *__arm_2d_gradient_locate(
+                                        const arm_2d_gradient_stop_t *ptStops,
+                                        uint_fast8_t chStopCount,
+                                        uint_fast8_t chPosition,
+                                        uint16_t *phwRatio)
+{
+    *phwRatio = 0;
+
+    if (chPosition <= ptStops[0].chPosition) {
+        return &ptStops[0];
+    }
+
+    for (uint_fast8_t n = 0; n + 1 < chStopCount; n++) {
+        uint_fast8_t chStart = ptStops[n].chPosition;
+        uint_fast8_t chEnd = ptStops[n + 1].chPosition;
+
+        if (chPosition >= chStart && chPosition < chEnd) {
+            *phwRatio = ((chPosition - chStart) << 8) / (chEnd - chStart);
+            return &ptStops[n];
+        }
+    }
+
+    return &ptStops[chStopCount - 1];
+}
+
+/*!
+ * \brief calculate the fixed-point parameters for an area whose top-left
+ *        pixel is (iX, iY) relative to the target region
+ */
+static
+void __arm_2d_gradient_get_param(   arm_2d_op_fill_cl_gradient_t *ptThis,
+                                    int16_t iX,
+                                    int16_t iY,
+                                    __arm_2d_gradient_param_t *ptParam)
+{
+    switch (this.chType) {
+        case ARM_2D_GRADIENT_LINEAR: {
+            int64_t lDX = this.Linear.tEnd.iX - this.Linear.tStart.iX;
+            int64_t lDY = this.Linear.tEnd.iY - this.Linear.tStart.iY;
+            int64_t lLength2 = lDX * lDX + lDY * lDY;
+
+            int32_t nDTDX = (int32_t)__arm_2d_gradient_div_round(lDX * 65536, lLength2);
+            int32_t nDTDY = (int32_t)__arm_2d_gradient_div_round(lDY * 65536, lLength2);
+
+            /* the position of the first pixel in the target region */
+            int64_t lT = ( (1 - 2 * (int64_t)this.Linear.tStart.iX) * lDX
+                         + (1 - 2 * (int64_t)this.Linear.tStart.iY) * lDY)
+                       * 32768;
+            lT = __arm_2d_gradient_div_round(lT, lLength2);
+
+            /* step with the rounded increments, so every PFB sees the same
+             * positions no matter where it starts
+             */
+            lT += (int64_t)iX * nDTDX + (int64_t)iY * nDTDY;
+
+            /* far beyond both ends, the colours are clamped anyway */
+            lT = MIN(MAX(lT, -(1ll << 30)), (1ll << 30));
+
+            ptParam->Linear.nT = (int32_t)lT;
+            ptParam->Linear.nDTDX = nDTDX;
+            ptParam->Linear.nDTDY = nDTDY;
+            break;
+        }
+
+        case ARM_2D_GRADIENT_RADIAL: {
+            uint32_t wLimit = 4ul
+                            * (uint32_t)this.Radial.iRadius
+                            * (uint32_t)this.Radial.iRadius;
+
+            /* keep 16 significant bits in the scale */
+            uint_fast8_t chShift = 0;
+            while ((wLimit >> chShift) >= 0x10000ul) {
+                chShift++;
+            }
+
+            ptParam->Radial.nDX = 2 * (int32_t)iX + 1 - 2 * this.Radial.tCentre.iX;
+            ptParam->Radial.nDY = 2 * (int32_t)iY + 1 - 2 * this.Radial.tCentre.iY;
+            ptParam->Radial.wLimit = wLimit;
+            ptParam->Radial.wScale = (uint32_t)((1ull << (32 + chShift)) / wLimit);
+            ptParam->Radial.chShift = chShift;
+            break;
+        }
+
+        case ARM_2D_GRADIENT_CONIC:
+            ptParam->Conic.nDX = 2 * (int32_t)iX + 1 - 2 * this.Conic.tCentre.iX;
+            ptParam->Conic.nDY = 2 * (int32_t)iY + 1 - 2 * this.Conic.tCentre.iY;
+            ptParam->Conic.hwStartAngle = this.Conic.hwStartAngle;
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+}
+
+/*!
+ * \brief generate the gradient inside the working buffer and blend it to the
+ *        target when a mask or an opacity is used
+ */
+static
+arm_fsm_rt_t __arm_2d_fill_colour_with_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptThis,
+                                    __arm_2d_sub_task_t *ptTask,
+                                    uint_fast8_t chPixelSizeInByte,
+                                    const void *pLUT,
+                                    __arm_2d_gradient_generate_t *fnGenerate,
+                                    __arm_2d_gradient_blend_t *fnBlend)
+{
+    arm_2d_region_t *ptValidRegion
+        = &ptTask->Param.tTileProcess.tValidRegionInVirtualScreen;
+
+    int16_t iWidth = ptValidRegion->tSize.iWidth;
+    int16_t iHeight = ptValidRegion->tSize.iHeight;
+    if (iWidth <= 0 || iHeight <= 0) {
+        return arm_fsm_rt_cpl;
+    }
+
+    /* the location of the working buffer relative to the target region */
+    arm_2d_location_t tOrigin = arm_2d_get_absolute_location(   OPCODE.Target.ptTile,
+                                                                this.tRegion.tLocation,
+                                                                true);
+    int16_t iX = ptValidRegion->tLocation.iX - tOrigin.iX;
+    int16_t iY = ptValidRegion->tLocation.iY - tOrigin.iY;
+
+    uint8_t *pchTarget = ptTask->Param.tTileProcess.pBuffer;
+    int16_t iTargetStride = ptTask->Param.tTileProcess.iStride;
+    __arm_2d_gradient_param_t tParam;
+
+    if ((NULL == this.ptMask) && (255 == this.chOpacity)) {
+        /* write the gradient to the target directly */
+        __arm_2d_gradient_get_param(ptThis, iX, iY, &tParam);
+        (*fnGenerate)(  ptThis,
+                        pchTarget,
+                        iTargetStride,
+                        &ptValidRegion->tSize,
+                        pLUT,
+                        &tParam);
+
+        return arm_fsm_rt_cpl;
+    }
+
+    uint8_t *pchMask = NULL;
+    int16_t iMaskStride = 0;
+    if (NULL != this.ptMask) {
+        arm_2d_region_t tMaskRegion;
+        const arm_2d_tile_t *ptMaskRoot = arm_2d_tile_get_root( this.ptMask,
+                                                                &tMaskRegion,
+                                                                NULL);
+        assert(NULL != ptMaskRoot);
+
+        iMaskStride = ptMaskRoot->tRegion.tSize.iWidth;
+        pchMask = ptMaskRoot->pchBuffer
+                + (int32_t)(  tMaskRegion.tLocation.iY
+                            - ptMaskRoot->tRegion.tLocation.iY
+                            + iY) * iMaskStride
+                + (tMaskRegion.tLocation.iX - ptMaskRoot->tRegion.tLocation.iX + iX);
+    }
+
+    /* a row of the gradient */
+    arm_2d_scratch_mem_t tScratchMemory = {0};
+    if (NULL == arm_2d_scratch_memory_new(  &tScratchMemory,
+                                            chPixelSizeInByte,
+                                            iWidth,
+                                            chPixelSizeInByte,
+                                            ARM_2D_MEM_TYPE_FAST)) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+    void *pRow = (void *)tScratchMemory.pBuffer;
+    if (NULL == pRow) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    arm_2d_size_t tRowSize = {
+        .iWidth = iWidth,
+        .iHeight = 1,
+    };
+
+    for (int_fast16_t n = 0; n < iHeight; n++) {
+        __arm_2d_gradient_get_param(ptThis, iX, iY + n, &tParam);
+        (*fnGenerate)(ptThis, pRow, iWidth, &tRowSize, pLUT, &tParam);
+
+        (*fnBlend)(ptThis, pRow, pchTarget, pchMask, &tRowSize);
+
+        pchTarget += (int32_t)iTargetStride * chPixelSizeInByte;
+        if (NULL != pchMask) {
+            pchMask += iMaskStride;
+        }
+    }
+
+    arm_2d_scratch_memory_free(&tScratchMemory);
+
+    return arm_fsm_rt_cpl;
+}
+
+/*----------------------------------------------------------------------------*
+ * Frontend Helpers                                                           *
+ *----------------------------------------------------------------------------*/
+
+static
+arm_2d_err_t __arm_2d_fill_colour_with_gradient_check(
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_gradient_stop_t *ptStops,
+                                        uint8_t chStopCount)
+{
+    if (0 == chStopCount) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    for (uint_fast8_t n = 1; n < chStopCount; n++) {
+        if (ptStops[n].chPosition < ptStops[n - 1].chPosition) {
+            return ARM_2D_ERR_INVALID_PARAM;
+        }
+    }
+
+    if (NULL != ptMask) {
+        if (!__arm_2d_valid_mask(ptMask, __ARM_2D_MASK_ALLOW_A8)) {
+            return ARM_2D_ERR_INVALID_PARAM;
+        }
+
+        const arm_2d_tile_t *ptMaskRoot = arm_2d_tile_get_root(ptMask, NULL, NULL);
+        if (ptMaskRoot->tInfo.bVirtualResource) {
+            /* the mask is read directly from its buffer */
+            return ARM_2D_ERR_NOT_SUPPORT;
+        }
+    }
+
+    return ARM_2D_ERR_NONE;
+}
+
+/*!
+ * \brief initialise the common part of the control block
+ * \param[out] ptShift the location of the clipped target region relative to
+ *             the user specified one
+ */
+static
+arm_fsm_rt_t __arm_2d_fill_colour_with_gradient_prepare(
+                                        arm_2d_op_fill_cl_gradient_t *ptThis,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_gradient_stop_t *ptStops,
+                                        uint8_t chStopCount,
+                                        uint8_t chOpacity,
+                                        arm_2d_gradient_type_t tType,
+                                        arm_2d_location_t *ptShift)
+{
+    arm_2d_region_t tTargetRegion;
+
+    if (NULL == ptRegion) {
+        tTargetRegion = (arm_2d_region_t) {
+            .tSize = ptTarget->tRegion.tSize,
+        };
+    } else {
+        tTargetRegion = *ptRegion;
+    }
+
+    this.tRegion = tTargetRegion;
+
+    if (NULL != ptMask) {
+        /* only the visible part of the mask is used */
+        arm_2d_region_t tMaskRegion;
+        arm_2d_location_t tMaskOffset;
+        if (NULL == arm_2d_tile_get_root(ptMask, &tMaskRegion, &tMaskOffset)) {
+            return (arm_fsm_rt_t)ARM_2D_ERR_OUT_OF_REGION;
+        }
+
+        tMaskRegion.tLocation.iX = tTargetRegion.tLocation.iX + tMaskOffset.iX;
+        tMaskRegion.tLocation.iY = tTargetRegion.tLocation.iY + tMaskOffset.iY;
+
+        if (!arm_2d_region_intersect(&tTargetRegion, &tMaskRegion, &this.tRegion)) {
+            return (arm_fsm_rt_t)ARM_2D_ERR_OUT_OF_REGION;
+        }
+    }
+
+    ptShift->iX = this.tRegion.tLocation.iX - tTargetRegion.tLocation.iX;
+    ptShift->iY = this.tRegion.tLocation.iY - tTargetRegion.tLocation.iY;
+
+    this.ptMask = ptMask;
+    this.ptStops = ptStops;
+    this.chStopCount = chStopCount;
+    this.chType = (uint8_t)tType;
+    this.chOpacity = chOpacity;
+
+    OPCODE.Target.ptTile = ptTarget;
+    OPCODE.Target.ptRegion = &this.tRegion;
+
+    return arm_fsm_rt_cpl;
+}
+
+static
+arm_fsm_rt_t __arm_2dp_fill_colour_with_linear_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptThis,
+                                    const __arm_2d_op_info_t *ptOPInfo,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tStart,
+                                    arm_2d_location_t tEnd,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    if ((tStart.iX == tEnd.iX) && (tStart.iY == tEnd.iY)) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    arm_2d_err_t tErr = __arm_2d_fill_colour_with_gradient_check(   ptMask,
+                                                                    ptStops,
+                                                                    chStopCount);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (0 == chOpacity) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = ptOPInfo;
+
+    arm_2d_location_t tShift;
+    arm_fsm_rt_t tResult = __arm_2d_fill_colour_with_gradient_prepare(
+                                                    ptThis,
+                                                    ptTarget,
+                                                    ptRegion,
+                                                    ptMask,
+                                                    ptStops,
+                                                    chStopCount,
+                                                    chOpacity,
+                                                    ARM_2D_GRADIENT_LINEAR,
+                                                    &tShift);
+    if (tResult < 0) {
+        return __arm_2d_op_depose((arm_2d_op_core_t *)ptThis, tResult);
+    }
+
+    this.Linear.tStart.iX = tStart.iX - tShift.iX;
+    this.Linear.tStart.iY = tStart.iY - tShift.iY;
+    this.Linear.tEnd.iX = tEnd.iX - tShift.iX;
+    this.Linear.tEnd.iY = tEnd.iY - tShift.iY;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+static
+arm_fsm_rt_t __arm_2dp_fill_colour_with_radial_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptThis,
+                                    const __arm_2d_op_info_t *ptOPInfo,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    int16_t iRadius,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    if (iRadius <= 0) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    arm_2d_err_t tErr = __arm_2d_fill_colour_with_gradient_check(   ptMask,
+                                                                    ptStops,
+                                                                    chStopCount);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (0 == chOpacity) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = ptOPInfo;
+
+    arm_2d_location_t tShift;
+    arm_fsm_rt_t tResult = __arm_2d_fill_colour_with_gradient_prepare(
+                                                    ptThis,
+                                                    ptTarget,
+                                                    ptRegion,
+                                                    ptMask,
+                                                    ptStops,
+                                                    chStopCount,
+                                                    chOpacity,
+                                                    ARM_2D_GRADIENT_RADIAL,
+                                                    &tShift);
+    if (tResult < 0) {
+        return __arm_2d_op_depose((arm_2d_op_core_t *)ptThis, tResult);
+    }
+
+    this.Radial.tCentre.iX = tCentre.iX - tShift.iX;
+    this.Radial.tCentre.iY = tCentre.iY - tShift.iY;
+    this.Radial.iRadius = iRadius;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+static
+arm_fsm_rt_t __arm_2dp_fill_colour_with_conic_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptThis,
+                                    const __arm_2d_op_info_t *ptOPInfo,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    float fStartAngle,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    arm_2d_err_t tErr = __arm_2d_fill_colour_with_gradient_check(   ptMask,
+                                                                    ptStops,
+                                                                    chStopCount);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (0 == chOpacity) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = ptOPInfo;
+
+    arm_2d_location_t tShift;
+    arm_fsm_rt_t tResult = __arm_2d_fill_colour_with_gradient_prepare(
+                                                    ptThis,
+                                                    ptTarget,
+                                                    ptRegion,
+                                                    ptMask,
+                                                    ptStops,
+                                                    chStopCount,
+                                                    chOpacity,
+                                                    ARM_2D_GRADIENT_CONIC,
+                                                    &tShift);
+    if (tResult < 0) {
+        return __arm_2d_op_depose((arm_2d_op_core_t *)ptThis, tResult);
+    }
+
+    /* convert the angle to 1/65536 turn */
+    float fTurn = ARM_2D_FMODF(fStartAngle, ARM_2D_ANGLE(360.0f))
+                / ARM_2D_ANGLE(360.0f);
+    if (fTurn < 0.0f) {
+        fTurn += 1.0f;
+    }
+
+    this.Conic.tCentre.iX = tCentre.iX - tShift.iX;
+    this.Conic.tCentre.iY = tCentre.iY - tShift.iY;
+    this.Conic.hwStartAngle = (uint16_t)(int32_t)(fTurn * 65536.0f + 0.5f);
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+/*----------------------------------------------------------------------------*
+ * GRAY8                                                                      *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_gray8_fill_colour_with_linear_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tStart,
+                                    arm_2d_location_t tEnd,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_linear_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_GRAY8,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tStart,
+                                        tEnd,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_gray8_fill_colour_with_radial_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    int16_t iRadius,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_radial_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_GRAY8,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tCentre,
+                                        iRadius,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_gray8_fill_colour_with_conic_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    float fStartAngle,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_conic_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_GRAY8,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tCentre,
+                                        fStartAngle,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+/* default low level implementation */
+
+__WEAK
+void __arm_2d_impl_gray8_linear_gradient(   uint8_t *__RESTRICT pchTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint8_t *__RESTRICT pchLUT,
+                                            int32_t nT,
+                                            int32_t nDTDX,
+                                            int32_t nDTDY)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        int32_t nRowT = nT;
+
+        for (int_fast16_t x = 0; x < iWidth; x++) {
+            int32_t nClamped = MIN(MAX(nRowT, 0), 0xFFFF);
+            pchTarget[x] = pchLUT[nClamped >> 8];
+            nRowT += nDTDX;
+        }
+
+        nT += nDTDY;
+        pchTarget += iTargetStride;
+    }
+}
+
+__WEAK
+void __arm_2d_impl_gray8_radial_gradient(   uint8_t *__RESTRICT pchTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint8_t *__RESTRICT pchLUT,
+                                            int32_t nDX,
+                                            int32_t nDY,
+                                            uint32_t wLimit,
+                                            uint32_t wScale,
+                                            uint8_t chShift)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+        uint32_t wDY = (nDY < 0) ? -nDY : nDY;
+        uint32_t wDY2 = (uint32_t)MIN(wDY, 0xFFFF) * (uint32_t)MIN(wDY, 0xFFFF);
+
+        if (wDY2 >= wLimit) {
+            memset(pchTarget, pchLUT[255], iWidth);
+            pchTarget += iTargetStride;
+            continue;
+        }
+
+        uint32_t wRemain = wLimit - wDY2;
+        uint_fast16_t hwIndex = 256;
+        int32_t nRowDX = nDX;
+
+        for (int_fast16_t x = 0; x < iWidth; x++, nRowDX += 2) {
+            /* clamping the distance keeps the square in 32bit */
+            uint32_t wDX = (nRowDX < 0) ? -nRowDX : nRowDX;
+            wDX = MIN(wDX, 0xFFFF);
+            uint32_t wDX2 = wDX * wDX;
+
+            if (wDX2 >= wRemain) {
+                pchTarget[x] = pchLUT[255];
+                hwIndex = 255;
+            } else {
+                pchTarget[x] = pchLUT[__arm_2d_gradient_radial_index(
+                                                            wDX2 + wDY2,
+                                                            wScale,
+                                                            chShift,
+                                                            &hwIndex)];
+            }
+        }
+
+        pchTarget += iTargetStride;
+    }
+}
+
+__WEAK
+void __arm_2d_impl_gray8_conic_gradient(uint8_t *__RESTRICT pchTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *__RESTRICT ptSize,
+                                        const uint8_t *__RESTRICT pchLUT,
+                                        int32_t nDX,
+                                        int32_t nDY,
+                                        uint16_t hwStartAngle)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+        int32_t nRowDX = nDX;
+
+        for (int_fast16_t x = 0; x < iWidth; x++, nRowDX += 2) {
+            uint16_t hwAngle = __arm_2d_gradient_conic_angle(nRowDX, nDY)
+                             - hwStartAngle;
+            pchTarget[x] = pchLUT[hwAngle >> 8];
+        }
+
+        pchTarget += iTargetStride;
+    }
+}
+
+static
+void __arm_2d_gray8_gradient_generate(  arm_2d_op_fill_cl_gradient_t *ptThis,
+                                        void *pTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *ptSize,
+                                        const void *pLUT,
+                                        const __arm_2d_gradient_param_t *ptParam)
+{
+    switch (this.chType) {
+        case ARM_2D_GRADIENT_LINEAR:
+            __arm_2d_impl_gray8_linear_gradient(pTarget,
+                                                iTargetStride,
+                                                ptSize,
+                                                pLUT,
+                                                ptParam->Linear.nT,
+                                                ptParam->Linear.nDTDX,
+                                                ptParam->Linear.nDTDY);
+            break;
+        case ARM_2D_GRADIENT_RADIAL:
+            __arm_2d_impl_gray8_radial_gradient(pTarget,
+                                                iTargetStride,
+                                                ptSize,
+                                                pLUT,
+                                                ptParam->Radial.nDX,
+                                                ptParam->Radial.nDY,
+                                                ptParam->Radial.wLimit,
+                                                ptParam->Radial.wScale,
+                                                ptParam->Radial.chShift);
+            break;
+        case ARM_2D_GRADIENT_CONIC:
+            __arm_2d_impl_gray8_conic_gradient( pTarget,
+                                                iTargetStride,
+                                                ptSize,
+                                                pLUT,
+                                                ptParam->Conic.nDX,
+                                                ptParam->Conic.nDY,
+                                                ptParam->Conic.hwStartAngle);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+static
+void __arm_2d_gray8_gradient_blend( arm_2d_op_fill_cl_gradient_t *ptThis,
+                                    void *pSource,
+                                    void *pTarget,
+                                    uint8_t *pchMask,
+                                    arm_2d_size_t *ptSize)
+{
+    /* the mask size and the copy size are both __RESTRICT */
+    arm_2d_size_t tMaskSize = *ptSize;
+
+    if (NULL == pchMask) {
+        __arm_2d_impl_gray8_tile_copy_opacity(  pSource,
+                                                ptSize->iWidth,
+                                                pTarget,
+                                                ptSize->iWidth,
+                                                ptSize,
+                                                this.chOpacity);
+    } else if (255 == this.chOpacity) {
+        __arm_2d_impl_gray8_src_msk_copy(   pSource,
+                                            ptSize->iWidth,
+                                            pchMask,
+                                            ptSize->iWidth,
+                                            &tMaskSize,
+                                            pTarget,
+                                            ptSize->iWidth,
+                                            ptSize);
+    } else {
+        __arm_2d_impl_gray8_tile_copy_with_src_mask_and_opacity(
+                                            pSource,
+                                            ptSize->iWidth,
+                                            pchMask,
+                                            ptSize->iWidth,
+                                            &tMaskSize,
+                                            pTarget,
+                                            ptSize->iWidth,
+                                            ptSize,
+                                            this.chOpacity);
+    }
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_gray8_sw_fill_colour_with_gradient(__arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_8BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    /* interpolate the colour stops */
+    uint8_t chLUT[256];
+    for (int_fast16_t n = 0; n < 256; n++) {
+        uint16_t hwRatio;
+        const arm_2d_gradient_stop_t *ptStop = __arm_2d_gradient_locate(
+                                                                this.ptStops,
+                                                                this.chStopCount,
+                                                                n,
+                                                                &hwRatio);
+        if (0 == hwRatio) {
+            chLUT[n] = ptStop[0].chColour;
+        } else {
+            chLUT[n] = (  (uint_fast16_t)ptStop[0].chColour * (256 - hwRatio)
+                        + (uint_fast16_t)ptStop[1].chColour * hwRatio) >> 8;
+        }
+    }
+
+    return __arm_2d_fill_colour_with_gradient(  ptThis,
+                                                ptTask,
+                                                sizeof(uint8_t),
+                                                chLUT,
+                                                &__arm_2d_gray8_gradient_generate,
+                                                &__arm_2d_gray8_gradient_blend);
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILL_COLOUR_WITH_GRADIENT_GRAY8,
+                __arm_2d_gray8_sw_fill_colour_with_gradient);   /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_GRAY8 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_GRAY8,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILL_COLOUR_WITH_GRADIENT,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILL_COLOUR_WITH_GRADIENT_GRAY8),
+        },
+    },
+};
+
+/*----------------------------------------------------------------------------*
+ * RGB565                                                                     *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_rgb565_fill_colour_with_linear_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tStart,
+                                    arm_2d_location_t tEnd,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_linear_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_RGB565,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tStart,
+                                        tEnd,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_rgb565_fill_colour_with_radial_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    int16_t iRadius,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_radial_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_RGB565,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tCentre,
+                                        iRadius,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_rgb565_fill_colour_with_conic_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    float fStartAngle,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_conic_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_RGB565,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tCentre,
+                                        fStartAngle,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+/* default low level implementation */
+
+__WEAK
+void __arm_2d_impl_rgb565_linear_gradient(  uint16_t *__RESTRICT phwTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint16_t *__RESTRICT phwLUT,
+                                            int32_t nT,
+                                            int32_t nDTDX,
+                                            int32_t nDTDY)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        int32_t nRowT = nT;
+
+        for (int_fast16_t x = 0; x < iWidth; x++) {
+            int32_t nClamped = MIN(MAX(nRowT, 0), 0xFFFF);
+            phwTarget[x] = phwLUT[nClamped >> 8];
+            nRowT += nDTDX;
+        }
+
+        nT += nDTDY;
+        phwTarget += iTargetStride;
+    }
+}
+
+__WEAK
+void __arm_2d_impl_rgb565_radial_gradient(  uint16_t *__RESTRICT phwTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint16_t *__RESTRICT phwLUT,
+                                            int32_t nDX,
+                                            int32_t nDY,
+                                            uint32_t wLimit,
+                                            uint32_t wScale,
+                                            uint8_t chShift)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+        uint32_t wDY = (nDY < 0) ? -nDY : nDY;
+        uint32_t wDY2 = (uint32_t)MIN(wDY, 0xFFFF) * (uint32_t)MIN(wDY, 0xFFFF);
+
+        if (wDY2 >= wLimit) {
+            for (int_fast16_t x = 0; x < iWidth; x++) {
+                phwTarget[x] = phwLUT[255];
+            }
+            phwTarget += iTargetStride;
+            continue;
+        }
+
+        uint32_t wRemain = wLimit - wDY2;
+        uint_fast16_t hwIndex = 256;
+        int32_t nRowDX = nDX;
+
+        for (int_fast16_t x = 0; x < iWidth; x++, nRowDX += 2) {
+            uint32_t wDX = (nRowDX < 0) ? -nRowDX : nRowDX;
+            wDX = MIN(wDX, 0xFFFF);
+            uint32_t wDX2 = wDX * wDX;
+
+            if (wDX2 >= wRemain) {
+                phwTarget[x] = phwLUT[255];
+                hwIndex = 255;
+            } else {
+                phwTarget[x] = phwLUT[__arm_2d_gradient_radial_index(
+                                                            wDX2 + wDY2,
+                                                            wScale,
+                                                            chShift,
+                                                            &hwIndex)];
+            }
+        }
+
+        phwTarget += iTargetStride;
+    }
+}
+
+__WEAK
+void __arm_2d_impl_rgb565_conic_gradient(   uint16_t *__RESTRICT phwTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint16_t *__RESTRICT phwLUT,
+                                            int32_t nDX,
+                                            int32_t nDY,
+                                            uint16_t hwStartAngle)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+        int32_t nRowDX = nDX;
+
+        for (int_fast16_t x = 0; x < iWidth; x++, nRowDX += 2) {
+            uint16_t hwAngle = __arm_2d_gradient_conic_angle(nRowDX, nDY)
+                             - hwStartAngle;
+            phwTarget[x] = phwLUT[hwAngle >> 8];
+        }
+
+        phwTarget += iTargetStride;
+    }
+}
+
+static
+void __arm_2d_rgb565_gradient_generate( arm_2d_op_fill_cl_gradient_t *ptThis,
+                                        void *pTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *ptSize,
+                                        const void *pLUT,
+                                        const __arm_2d_gradient_param_t *ptParam)
+{
+    switch (this.chType) {
+        case ARM_2D_GRADIENT_LINEAR:
+            __arm_2d_impl_rgb565_linear_gradient(   pTarget,
+                                                    iTargetStride,
+                                                    ptSize,
+                                                    pLUT,
+                                                    ptParam->Linear.nT,
+                                                    ptParam->Linear.nDTDX,
+                                                    ptParam->Linear.nDTDY);
+            break;
+        case ARM_2D_GRADIENT_RADIAL:
+            __arm_2d_impl_rgb565_radial_gradient(   pTarget,
+                                                    iTargetStride,
+                                                    ptSize,
+                                                    pLUT,
+                                                    ptParam->Radial.nDX,
+                                                    ptParam->Radial.nDY,
+                                                    ptParam->Radial.wLimit,
+                                                    ptParam->Radial.wScale,
+                                                    ptParam->Radial.chShift);
+            break;
+        case ARM_2D_GRADIENT_CONIC:
+            __arm_2d_impl_rgb565_conic_gradient(pTarget,
+                                                iTargetStride,
+                                                ptSize,
+                                                pLUT,
+                                                ptParam->Conic.nDX,
+                                                ptParam->Conic.nDY,
+                                                ptParam->Conic.hwStartAngle);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+static
+void __arm_2d_rgb565_gradient_blend(arm_2d_op_fill_cl_gradient_t *ptThis,
+                                    void *pSource,
+                                    void *pTarget,
+                                    uint8_t *pchMask,
+                                    arm_2d_size_t *ptSize)
+{
+    /* the mask size and the copy size are both __RESTRICT */
+    arm_2d_size_t tMaskSize = *ptSize;
+
+    if (NULL == pchMask) {
+        __arm_2d_impl_rgb565_tile_copy_opacity( pSource,
+                                                ptSize->iWidth,
+                                                pTarget,
+                                                ptSize->iWidth,
+                                                ptSize,
+                                                this.chOpacity);
+    } else if (255 == this.chOpacity) {
+        __arm_2d_impl_rgb565_src_msk_copy(  pSource,
+                                            ptSize->iWidth,
+                                            pchMask,
+                                            ptSize->iWidth,
+                                            &tMaskSize,
+                                            pTarget,
+                                            ptSize->iWidth,
+                                            ptSize);
+    } else {
+        __arm_2d_impl_rgb565_tile_copy_with_src_mask_and_opacity(
+                                            pSource,
+                                            ptSize->iWidth,
+                                            pchMask,
+                                            ptSize->iWidth,
+                                            &tMaskSize,
+                                            pTarget,
+                                            ptSize->iWidth,
+                                            ptSize,
+                                            this.chOpacity);
+    }
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_rgb565_sw_fill_colour_with_gradient(__arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_16BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    /* interpolate the colour stops */
+    uint16_t hwLUT[256];
+    for (int_fast16_t n = 0; n < 256; n++) {
+        uint16_t hwRatio;
+        const arm_2d_gradient_stop_t *ptStop = __arm_2d_gradient_locate(
+                                                                this.ptStops,
+                                                                this.chStopCount,
+                                                                n,
+                                                                &hwRatio);
+        if (0 == hwRatio) {
+            hwLUT[n] = ptStop[0].hwColour;
+        } else {
+            __arm_2d_color_fast_rgb_t tStart, tEnd;
+            __arm_2d_rgb565_unpack(ptStop[0].hwColour, &tStart);
+            __arm_2d_rgb565_unpack(ptStop[1].hwColour, &tEnd);
+
+            for (int_fast8_t i = 0; i < 3; i++) {
+                tStart.BGRA[i] = (  tStart.BGRA[i] * (256 - hwRatio)
+                                  + tEnd.BGRA[i] * hwRatio) >> 8;
+            }
+
+            hwLUT[n] = __arm_2d_rgb565_pack(&tStart);
+        }
+    }
+
+    return __arm_2d_fill_colour_with_gradient(  ptThis,
+                                                ptTask,
+                                                sizeof(uint16_t),
+                                                hwLUT,
+                                                &__arm_2d_rgb565_gradient_generate,
+                                                &__arm_2d_rgb565_gradient_blend);
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILL_COLOUR_WITH_GRADIENT_RGB565,
+                __arm_2d_rgb565_sw_fill_colour_with_gradient);  /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_RGB565 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_RGB565,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILL_COLOUR_WITH_GRADIENT,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILL_COLOUR_WITH_GRADIENT_RGB565),
+        },
+    },
+};
+
+/*----------------------------------------------------------------------------*
+ * CCCN888                                                                    *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_cccn888_fill_colour_with_linear_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tStart,
+                                    arm_2d_location_t tEnd,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_linear_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_CCCN888,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tStart,
+                                        tEnd,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_cccn888_fill_colour_with_radial_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    int16_t iRadius,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_radial_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_CCCN888,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tCentre,
+                                        iRadius,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+ARM_NONNULL(2,7)
+arm_fsm_rt_t arm_2dp_cccn888_fill_colour_with_conic_gradient(
+                                    arm_2d_op_fill_cl_gradient_t *ptOP,
+                                    const arm_2d_tile_t *ptTarget,
+                                    const arm_2d_region_t *ptRegion,
+                                    const arm_2d_tile_t *ptMask,
+                                    arm_2d_location_t tCentre,
+                                    float fStartAngle,
+                                    const arm_2d_gradient_stop_t *ptStops,
+                                    uint8_t chStopCount,
+                                    uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptStops);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptOP);
+
+    return __arm_2dp_fill_colour_with_conic_gradient(
+                                        ptThis,
+                                        &ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_CCCN888,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptMask,
+                                        tCentre,
+                                        fStartAngle,
+                                        ptStops,
+                                        chStopCount,
+                                        chOpacity);
+}
+
+/* default low level implementation */
+
+__WEAK
+void __arm_2d_impl_cccn888_linear_gradient( uint32_t *__RESTRICT pwTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint32_t *__RESTRICT pwLUT,
+                                            int32_t nT,
+                                            int32_t nDTDX,
+                                            int32_t nDTDY)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        int32_t nRowT = nT;
+
+        for (int_fast16_t x = 0; x < iWidth; x++) {
+            int32_t nClamped = MIN(MAX(nRowT, 0), 0xFFFF);
+            pwTarget[x] = pwLUT[nClamped >> 8];
+            nRowT += nDTDX;
+        }
+
+        nT += nDTDY;
+        pwTarget += iTargetStride;
+    }
+}
+
+__WEAK
+void __arm_2d_impl_cccn888_radial_gradient( uint32_t *__RESTRICT pwTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint32_t *__RESTRICT pwLUT,
+                                            int32_t nDX,
+                                            int32_t nDY,
+                                            uint32_t wLimit,
+                                            uint32_t wScale,
+                                            uint8_t chShift)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+        uint32_t wDY = (nDY < 0) ? -nDY : nDY;
+        uint32_t wDY2 = (uint32_t)MIN(wDY, 0xFFFF) * (uint32_t)MIN(wDY, 0xFFFF);
+
+        if (wDY2 >= wLimit) {
+            for (int_fast16_t x = 0; x < iWidth; x++) {
+                pwTarget[x] = pwLUT[255];
+            }
+            pwTarget += iTargetStride;
+            continue;
+        }
+
+        uint32_t wRemain = wLimit - wDY2;
+        uint_fast16_t hwIndex = 256;
+        int32_t nRowDX = nDX;
+
+        for (int_fast16_t x = 0; x < iWidth; x++, nRowDX += 2) {
+            uint32_t wDX = (nRowDX < 0) ? -nRowDX : nRowDX;
+            wDX = MIN(wDX, 0xFFFF);
+            uint32_t wDX2 = wDX * wDX;
+
+            if (wDX2 >= wRemain) {
+                pwTarget[x] = pwLUT[255];
+                hwIndex = 255;
+            } else {
+                pwTarget[x] = pwLUT[__arm_2d_gradient_radial_index(
+                                                            wDX2 + wDY2,
+                                                            wScale,
+                                                            chShift,
+                                                            &hwIndex)];
+            }
+        }
+
+        pwTarget += iTargetStride;
+    }
+}
+
+__WEAK
+void __arm_2d_impl_cccn888_conic_gradient(  uint32_t *__RESTRICT pwTarget,
+                                            int16_t iTargetStride,
+                                            arm_2d_size_t *__RESTRICT ptSize,
+                                            const uint32_t *__RESTRICT pwLUT,
+                                            int32_t nDX,
+                                            int32_t nDY,
+                                            uint16_t hwStartAngle)
+{
+    int_fast16_t iWidth = ptSize->iWidth;
+    int_fast16_t iHeight = ptSize->iHeight;
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+        int32_t nRowDX = nDX;
+
+        for (int_fast16_t x = 0; x < iWidth; x++, nRowDX += 2) {
+            uint16_t hwAngle = __arm_2d_gradient_conic_angle(nRowDX, nDY)
+                             - hwStartAngle;
+            pwTarget[x] = pwLUT[hwAngle >> 8];
+        }
+
+        pwTarget += iTargetStride;
+    }
+}
+
+static
+void __arm_2d_cccn888_gradient_generate(arm_2d_op_fill_cl_gradient_t *ptThis,
+                                        void *pTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *ptSize,
+                                        const void *pLUT,
+                                        const __arm_2d_gradient_param_t *ptParam)
+{
+    switch (this.chType) {
+        case ARM_2D_GRADIENT_LINEAR:
+            __arm_2d_impl_cccn888_linear_gradient(  pTarget,
+                                                    iTargetStride,
+                                                    ptSize,
+                                                    pLUT,
+                                                    ptParam->Linear.nT,
+                                                    ptParam->Linear.nDTDX,
+                                                    ptParam->Linear.nDTDY);
+            break;
+        case ARM_2D_GRADIENT_RADIAL:
+            __arm_2d_impl_cccn888_radial_gradient(  pTarget,
+                                                    iTargetStride,
+                                                    ptSize,
+                                                    pLUT,
+                                                    ptParam->Radial.nDX,
+                                                    ptParam->Radial.nDY,
+                                                    ptParam->Radial.wLimit,
+                                                    ptParam->Radial.wScale,
+                                                    ptParam->Radial.chShift);
+            break;
+        case ARM_2D_GRADIENT_CONIC:
+            __arm_2d_impl_cccn888_conic_gradient(   pTarget,
+                                                    iTargetStride,
+                                                    ptSize,
+                                                    pLUT,
+                                                    ptParam->Conic.nDX,
+                                                    ptParam->Conic.nDY,
+                                                    ptParam->Conic.hwStartAngle);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+static
+void __arm_2d_cccn888_gradient_blend(   arm_2d_op_fill_cl_gradient_t *ptThis,
+                                        void *pSource,
+                                        void *pTarget,
+                                        uint8_t *pchMask,
+                                        arm_2d_size_t *ptSize)
+{
+    /* the mask size and the copy size are both __RESTRICT */
+    arm_2d_size_t tMaskSize = *ptSize;
+
+    if (NULL == pchMask) {
+        __arm_2d_impl_cccn888_tile_copy_opacity(pSource,
+                                                ptSize->iWidth,
+                                                pTarget,
+                                                ptSize->iWidth,
+                                                ptSize,
+                                                this.chOpacity);
+    } else if (255 == this.chOpacity) {
+        __arm_2d_impl_cccn888_src_msk_copy( pSource,
+                                            ptSize->iWidth,
+                                            pchMask,
+                                            ptSize->iWidth,
+                                            &tMaskSize,
+                                            pTarget,
+                                            ptSize->iWidth,
+                                            ptSize);
+    } else {
+        __arm_2d_impl_cccn888_tile_copy_with_src_mask_and_opacity(
+                                            pSource,
+                                            ptSize->iWidth,
+                                            pchMask,
+                                            ptSize->iWidth,
+                                            &tMaskSize,
+                                            pTarget,
+                                            ptSize->iWidth,
+                                            ptSize,
+                                            this.chOpacity);
+    }
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_cccn888_sw_fill_colour_with_gradient(__arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_fill_cl_gradient_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_32BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    /* interpolate the colour stops */
+    uint32_t wLUT[256];
+    for (int_fast16_t n = 0; n < 256; n++) {
+        uint16_t hwRatio;
+        const arm_2d_gradient_stop_t *ptStop = __arm_2d_gradient_locate(
+                                                                this.ptStops,
+                                                                this.chStopCount,
+                                                                n,
+                                                                &hwRatio);
+        if (0 == hwRatio) {
+            wLUT[n] = ptStop[0].wColour;
+        } else {
+            const uint8_t *pchStart = (const uint8_t *)&ptStop[0].wColour;
+            const uint8_t *pchEnd = (const uint8_t *)&ptStop[1].wColour;
+            uint8_t *pchColour = (uint8_t *)&wLUT[n];
+
+            for (int_fast8_t i = 0; i < 4; i++) {
+                pchColour[i] = (  (uint_fast16_t)pchStart[i] * (256 - hwRatio)
+                                + (uint_fast16_t)pchEnd[i] * hwRatio) >> 8;
+            }
+        }
+    }
+
+    return __arm_2d_fill_colour_with_gradient(  ptThis,
+                                                ptTask,
+                                                sizeof(uint32_t),
+                                                wLUT,
+                                                &__arm_2d_cccn888_gradient_generate,
+                                                &__arm_2d_cccn888_gradient_blend);
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILL_COLOUR_WITH_GRADIENT_CCCN888,
+                __arm_2d_cccn888_sw_fill_colour_with_gradient); /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_GRADIENT_CCCN888 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_CCCN888,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILL_COLOUR_WITH_GRADIENT,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILL_COLOUR_WITH_GRADIENT_CCCN888),
+        },
+    },
+};
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
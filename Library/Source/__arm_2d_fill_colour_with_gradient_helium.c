@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ /* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_fill_colour_with_gradient_helium.c
+ * Description:  APIs for colour-filling-with-gradient (linear and radial)
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+/*============================ INCLUDES ======================================*/
+
+#ifdef __ARM_2D_COMPILATION_UNIT
+#undef __ARM_2D_COMPILATION_UNIT
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-float-conversion"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wswitch-enum"
+#   pragma clang diagnostic ignored "-Wswitch"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*
+ * NOTE: the conic gradient needs a division for every pixel, which Helium
+ *       doesn't provide for vectors, hence it uses the default implementation.
+ */
+
+__OVERRIDE_WEAK void __MVE_WRAPPER( __arm_2d_impl_gray8_linear_gradient)(
+                                        uint8_t *__RESTRICT pchTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *__RESTRICT ptSize,
+                                        const uint8_t *__RESTRICT pchLUT,
+                                        int32_t nT,
+                                        int32_t nDTDX,
+                                        int32_t nDTDY)
+{
+    int_fast16_t iHeight = ptSize->iHeight;
+    int_fast16_t iWidth  = ptSize->iWidth;
+
+    /* the offsets of the 4 lanes */
+    int32x4_t vLaneT = vmulq_n_s32(vreinterpretq_s32_u32(vidupq_n_u32(0, 1)), nDTDX);
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+
+        uint8_t *pchTargetLine = pchTarget;
+        int32_t blkCnt = iWidth;
+        int32x4_t vT = vaddq_n_s32(vLaneT, nT);
+
+        do {
+            mve_pred16_t tailPred = vctp32q(blkCnt);
+
+            int32x4_t vClamped = vminq_s32( vmaxq_s32(vT, vdupq_n_s32(0)),
+                                            vdupq_n_s32(0xFFFF));
+            uint32x4_t vIndex = vshrq_n_u32(vreinterpretq_u32_s32(vClamped), 8);
+
+            vstrbq_p_u32(  pchTargetLine,
+                            vldrbq_gather_offset_z_u32(pchLUT, vIndex, tailPred),
+                            tailPred);
+
+            vT = vaddq_n_s32(vT, nDTDX * 4);
+            pchTargetLine += 4;
+            blkCnt -= 4;
+        }
+        while (blkCnt > 0);
+
+        nT += nDTDY;
+        pchTarget += iTargetStride;
+    }
+}
+
+__OVERRIDE_WEAK void __MVE_WRAPPER( __arm_2d_impl_gray8_radial_gradient)(
+                                        uint8_t *__RESTRICT pchTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *__RESTRICT ptSize,
+                                        const uint8_t *__RESTRICT pchLUT,
+                                        int32_t nDX,
+                                        int32_t nDY,
+                                        uint32_t wLimit,
+                                        uint32_t wScale,
+                                        uint8_t chShift)
+{
+    int_fast16_t iHeight = ptSize->iHeight;
+    int_fast16_t iWidth  = ptSize->iWidth;
+
+    int32x4_t vLaneDX = vaddq_n_s32(vreinterpretq_s32_u32(vidupq_n_u32(0, 2)), nDX);
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+
+        uint8_t *pchTargetLine = pchTarget;
+        int32_t blkCnt = iWidth;
+
+        /* clamping the distances keeps the squares in 32bit */
+        uint32_t wDY = (nDY < 0) ? -nDY : nDY;
+        wDY = MIN(wDY, 0xFFFF);
+        uint32_t wDY2 = wDY * wDY;
+        uint32_t wRemain = (wDY2 < wLimit) ? (wLimit - wDY2) : 0;
+
+        int32x4_t vDX = vLaneDX;
+
+        do {
+            mve_pred16_t tailPred = vctp32q(blkCnt);
+
+            uint32x4_t vAbsDX = vminq_u32(  vreinterpretq_u32_s32(vabsq_s32(vDX)),
+                                            vdupq_n_u32(0xFFFF));
+            uint32x4_t vDX2 = vmulq_u32(vAbsDX, vAbsDX);
+            mve_pred16_t tOutside = vcmpcsq_n_u32(vDX2, wRemain);
+
+            uint32x4_t vQ16 = vshlq_r_u32(vaddq_n_u32(vDX2, wDY2), -(int32_t)chShift);
+            vQ16 = vshrq_n_u32(vmulq_n_u32(vQ16, wScale), 16);
+
+            /* bitwise integer square root */
+            uint32x4_t vIndex = vdupq_n_u32(0);
+            for (uint_fast16_t hwBit = 128; hwBit > 0; hwBit >>= 1) {
+                uint32x4_t vCandidate = vaddq_n_u32(vIndex, hwBit);
+                vIndex = vpselq_u32(vCandidate,
+                                    vIndex,
+                                    vcmpcsq_u32(vQ16, vmulq_u32(vCandidate, vCandidate)));
+            }
+            vIndex = vpselq_u32(vdupq_n_u32(255), vIndex, tOutside);
+
+            vstrbq_p_u32(  pchTargetLine,
+                            vldrbq_gather_offset_z_u32(pchLUT, vIndex, tailPred),
+                            tailPred);
+
+            vDX = vaddq_n_s32(vDX, 8);
+            pchTargetLine += 4;
+            blkCnt -= 4;
+        }
+        while (blkCnt > 0);
+
+        pchTarget += iTargetStride;
+    }
+}
+
+__OVERRIDE_WEAK void __MVE_WRAPPER( __arm_2d_impl_rgb565_linear_gradient)(
+                                        uint16_t *__RESTRICT phwTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *__RESTRICT ptSize,
+                                        const uint16_t *__RESTRICT phwLUT,
+                                        int32_t nT,
+                                        int32_t nDTDX,
+                                        int32_t nDTDY)
+{
+    int_fast16_t iHeight = ptSize->iHeight;
+    int_fast16_t iWidth  = ptSize->iWidth;
+
+    /* the offsets of the 4 lanes */
+    int32x4_t vLaneT = vmulq_n_s32(vreinterpretq_s32_u32(vidupq_n_u32(0, 1)), nDTDX);
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+
+        uint16_t *phwTargetLine = phwTarget;
+        int32_t blkCnt = iWidth;
+        int32x4_t vT = vaddq_n_s32(vLaneT, nT);
+
+        do {
+            mve_pred16_t tailPred = vctp32q(blkCnt);
+
+            int32x4_t vClamped = vminq_s32( vmaxq_s32(vT, vdupq_n_s32(0)),
+                                            vdupq_n_s32(0xFFFF));
+            uint32x4_t vIndex = vshrq_n_u32(vreinterpretq_u32_s32(vClamped), 8);
+
+            vstrhq_p_u32(  phwTargetLine,
+                            vldrhq_gather_shifted_offset_z_u32(phwLUT, vIndex, tailPred),
+                            tailPred);
+
+            vT = vaddq_n_s32(vT, nDTDX * 4);
+            phwTargetLine += 4;
+            blkCnt -= 4;
+        }
+        while (blkCnt > 0);
+
+        nT += nDTDY;
+        phwTarget += iTargetStride;
+    }
+}
+
+__OVERRIDE_WEAK void __MVE_WRAPPER( __arm_2d_impl_rgb565_radial_gradient)(
+                                        uint16_t *__RESTRICT phwTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *__RESTRICT ptSize,
+                                        const uint16_t *__RESTRICT phwLUT,
+                                        int32_t nDX,
+                                        int32_t nDY,
+                                        uint32_t wLimit,
+                                        uint32_t wScale,
+                                        uint8_t chShift)
+{
+    int_fast16_t iHeight = ptSize->iHeight;
+    int_fast16_t iWidth  = ptSize->iWidth;
+
+    int32x4_t vLaneDX = vaddq_n_s32(vreinterpretq_s32_u32(vidupq_n_u32(0, 2)), nDX);
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+
+        uint16_t *phwTargetLine = phwTarget;
+        int32_t blkCnt = iWidth;
+
+        /* clamping the distances keeps the squares in 32bit */
+        uint32_t wDY = (nDY < 0) ? -nDY : nDY;
+        wDY = MIN(wDY, 0xFFFF);
+        uint32_t wDY2 = wDY * wDY;
+        uint32_t wRemain = (wDY2 < wLimit) ? (wLimit - wDY2) : 0;
+
+        int32x4_t vDX = vLaneDX;
+
+        do {
+            mve_pred16_t tailPred = vctp32q(blkCnt);
+
+            uint32x4_t vAbsDX = vminq_u32(  vreinterpretq_u32_s32(vabsq_s32(vDX)),
+                                            vdupq_n_u32(0xFFFF));
+            uint32x4_t vDX2 = vmulq_u32(vAbsDX, vAbsDX);
+            mve_pred16_t tOutside = vcmpcsq_n_u32(vDX2, wRemain);
+
+            uint32x4_t vQ16 = vshlq_r_u32(vaddq_n_u32(vDX2, wDY2), -(int32_t)chShift);
+            vQ16 = vshrq_n_u32(vmulq_n_u32(vQ16, wScale), 16);
+
+            /* bitwise integer square root */
+            uint32x4_t vIndex = vdupq_n_u32(0);
+            for (uint_fast16_t hwBit = 128; hwBit > 0; hwBit >>= 1) {
+                uint32x4_t vCandidate = vaddq_n_u32(vIndex, hwBit);
+                vIndex = vpselq_u32(vCandidate,
+                                    vIndex,
+                                    vcmpcsq_u32(vQ16, vmulq_u32(vCandidate, vCandidate)));
+            }
+            vIndex = vpselq_u32(vdupq_n_u32(255), vIndex, tOutside);
+
+            vstrhq_p_u32(  phwTargetLine,
+                            vldrhq_gather_shifted_offset_z_u32(phwLUT, vIndex, tailPred),
+                            tailPred);
+
+            vDX = vaddq_n_s32(vDX, 8);
+            phwTargetLine += 4;
+            blkCnt -= 4;
+        }
+        while (blkCnt > 0);
+
+        phwTarget += iTargetStride;
+    }
+}
+
+__OVERRIDE_WEAK void __MVE_WRAPPER( __arm_2d_impl_cccn888_linear_gradient)(
+                                        uint32_t *__RESTRICT pwTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *__RESTRICT ptSize,
+                                        const uint32_t *__RESTRICT pwLUT,
+                                        int32_t nT,
+                                        int32_t nDTDX,
+                                        int32_t nDTDY)
+{
+    int_fast16_t iHeight = ptSize->iHeight;
+    int_fast16_t iWidth  = ptSize->iWidth;
+
+    /* the offsets of the 4 lanes */
+    int32x4_t vLaneT = vmulq_n_s32(vreinterpretq_s32_u32(vidupq_n_u32(0, 1)), nDTDX);
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+
+        uint32_t *pwTargetLine = pwTarget;
+        int32_t blkCnt = iWidth;
+        int32x4_t vT = vaddq_n_s32(vLaneT, nT);
+
+        do {
+            mve_pred16_t tailPred = vctp32q(blkCnt);
+
+            int32x4_t vClamped = vminq_s32( vmaxq_s32(vT, vdupq_n_s32(0)),
+                                            vdupq_n_s32(0xFFFF));
+            uint32x4_t vIndex = vshrq_n_u32(vreinterpretq_u32_s32(vClamped), 8);
+
+            vstrwq_p_u32(  pwTargetLine,
+                            vldrwq_gather_shifted_offset_z_u32(pwLUT, vIndex, tailPred),
+                            tailPred);
+
+            vT = vaddq_n_s32(vT, nDTDX * 4);
+            pwTargetLine += 4;
+            blkCnt -= 4;
+        }
+        while (blkCnt > 0);
+
+        nT += nDTDY;
+        pwTarget += iTargetStride;
+    }
+}
+
+__OVERRIDE_WEAK void __MVE_WRAPPER( __arm_2d_impl_cccn888_radial_gradient)(
+                                        uint32_t *__RESTRICT pwTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_size_t *__RESTRICT ptSize,
+                                        const uint32_t *__RESTRICT pwLUT,
+                                        int32_t nDX,
+                                        int32_t nDY,
+                                        uint32_t wLimit,
+                                        uint32_t wScale,
+                                        uint8_t chShift)
+{
+    int_fast16_t iHeight = ptSize->iHeight;
+    int_fast16_t iWidth  = ptSize->iWidth;
+
+    int32x4_t vLaneDX = vaddq_n_s32(vreinterpretq_s32_u32(vidupq_n_u32(0, 2)), nDX);
+
+    for (int_fast16_t y = 0; y < iHeight; y++, nDY += 2) {
+
+        uint32_t *pwTargetLine = pwTarget;
+        int32_t blkCnt = iWidth;
+
+        /* clamping the distances keeps the squares in 32bit */
+        uint32_t wDY = (nDY < 0) ? -nDY : nDY;
+        wDY = MIN(wDY, 0xFFFF);
+        uint32_t wDY2 = wDY * wDY;
+        uint32_t wRemain = (wDY2 < wLimit) ? (wLimit - wDY2) : 0;
+
+        int32x4_t vDX = vLaneDX;
+
+        do {
+            mve_pred16_t tailPred = vctp32q(blkCnt);
+
+            uint32x4_t vAbsDX = vminq_u32(  vreinterpretq_u32_s32(vabsq_s32(vDX)),
+                                            vdupq_n_u32(0xFFFF));
+            uint32x4_t vDX2 = vmulq_u32(vAbsDX, vAbsDX);
+            mve_pred16_t tOutside = vcmpcsq_n_u32(vDX2, wRemain);
+
+            uint32x4_t vQ16 = vshlq_r_u32(vaddq_n_u32(vDX2, wDY2), -(int32_t)chShift);
+            vQ16 = vshrq_n_u32(vmulq_n_u32(vQ16, wScale), 16);
+
+            /* bitwise integer square root */
+            uint32x4_t vIndex = vdupq_n_u32(0);
+            for (uint_fast16_t hwBit = 128; hwBit > 0; hwBit >>= 1) {
+                uint32x4_t vCandidate = vaddq_n_u32(vIndex, hwBit);
+                vIndex = vpselq_u32(vCandidate,
+                                    vIndex,
+                                    vcmpcsq_u32(vQ16, vmulq_u32(vCandidate, vCandidate)));
+            }
+            vIndex = vpselq_u32(vdupq_n_u32(255), vIndex, tOutside);
+
+            vstrwq_p_u32(  pwTargetLine,
+                            vldrwq_gather_shifted_offset_z_u32(pwLUT, vIndex, tailPred),
+                            tailPred);
+
+            vDX = vaddq_n_s32(vDX, 8);
+            pwTargetLine += 4;
+            blkCnt -= 4;
+        }
+        while (blkCnt > 0);
+
+        pwTarget += iTargetStride;
+    }
+}
+
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
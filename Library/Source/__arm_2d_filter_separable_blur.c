@@ -0,0 +1,1212 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_filter_separable_blur.c
+ * Description:  APIs for the separable Box/Gaussian Blur
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+
+/*============================ INCLUDES ======================================*/
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wempty-translation-unit"
+#endif
+
+#ifdef __ARM_2D_COMPILATION_UNIT
+#undef __ARM_2D_COMPILATION_UNIT
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-float-conversion"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wswitch-enum"
+#   pragma clang diagnostic ignored "-Wswitch"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#elif defined(__IS_COMPILER_GCC__)
+#   pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif
+
+/*============================ MACROS ========================================*/
+#undef OP_CORE
+#define OP_CORE this.use_as__arm_2d_op_src_t.use_as__arm_2d_op_core_t
+
+#undef OPCODE
+#define OPCODE this.use_as__arm_2d_op_src_t
+
+/* every thread that can run the backend at the same time, i.e. the async 
+ * workers and the drawing threads, might need a scratch memory
+ */
+#define __ARM_2D_SEPARABLE_BLUR_SCRATCH_POOL_SIZE                               \
+            (__ARM_2D_CFG_DEFAULT_OP_COUNT__ + __ARM_2D_CFG_ASYNC_WORKER_COUNT__ - 1)
+
+#if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+#   define __arm_2d_separable_blur_safe                                         \
+            arm_using(  uint32_t ARM_2D_SAFE_NAME(temp) =                       \
+                            arm_2d_port_enter_worker_critical_section(),        \
+                        arm_2d_port_leave_worker_critical_section(              \
+                            ARM_2D_SAFE_NAME(temp)))
+#else
+#   define __arm_2d_separable_blur_safe     arm_irq_safe
+#endif
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+
+/*! \brief a slot of the scratch memory pool */
+typedef struct __arm_2d_separable_blur_scratch_t {
+    arm_2d_scratch_mem_t tMemory;
+    bool bBusy;                     /* the slot is used by a running sub-task */
+} __arm_2d_separable_blur_scratch_t;
+
+typedef struct __arm_2d_separable_blur_kernel_t {
+    uint16_t hwWeight[ARM_2D_FILTER_SEPARABLE_BLUR_MAX_RADIUS * 2 + 1];
+    uint32_t wScale;                /* the normalisation is (acc * wScale + wRound) >> chShift */
+    uint32_t wRound;
+    uint8_t  chShift;
+    uint8_t  chRadius;
+    uint8_t  bBox;
+} __arm_2d_separable_blur_kernel_t;
+
+/*! \brief read a source row into the line buffer, extending the edges */
+typedef void __arm_2d_separable_blur_fetch_t(   const void *pSourceRow,
+                                                int_fast16_t iX,
+                                                int_fast16_t iCount,
+                                                int_fast16_t iSourceWidth,
+                                                uint8_t *__RESTRICT pchLine);
+
+/*! \brief write a blurred row to the target */
+typedef void __arm_2d_separable_blur_store_t(   const uint8_t *__RESTRICT pchLine,
+                                                void *pTargetRow,
+                                                int_fast16_t iWidth);
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+/*! \brief the scratch memory pool, a slot is taken by a sub-task till it ends */
+static __arm_2d_separable_blur_scratch_t
+    s_tSeparableBlurScratchPool[__ARM_2D_SEPARABLE_BLUR_SCRATCH_POOL_SIZE];
+
+/*============================ IMPLEMENTATION ================================*/
+
+static
+uint_fast8_t __arm_2d_separable_blur_channels(uint_fast8_t chColourSZ)
+{
+    /* gray8 uses one channel, others are blurred as B, G and R */
+    return (ARM_2D_COLOUR_SZ_8BIT == chColourSZ) ? 1 : 3;
+}
+
+uint32_t arm_2d_filter_separable_blur_get_scratch_size(
+                                                int16_t iWidth,
+                                                uint8_t chRadius,
+                                                uint8_t chColourSZ)
+{
+    uint32_t wRowSize = (uint32_t)iWidth
+                      * __arm_2d_separable_blur_channels(chColourSZ);
+    uint32_t wTaps = (uint32_t)chRadius * 2 + 1;
+
+    /*
+     * column sums (16bit)  : wRowSize * 2
+     * line buffer          : (iWidth + 2 * chRadius) * channels
+     * row ring             : wTaps * wRowSize
+     */
+    uint32_t wSize = wRowSize * sizeof(uint16_t)
+                   + wRowSize + (wTaps - 1)
+                              * __arm_2d_separable_blur_channels(chColourSZ)
+                   + wRowSize * wTaps;
+
+    return (wSize + 3) & ~(uint32_t)3;
+}
+
+void arm_2d_filter_separable_blur_free_scratch_pool(void)
+{
+    arm_foreach(__arm_2d_separable_blur_scratch_t, 
+                s_tSeparableBlurScratchPool, 
+                ptSlot) {
+        assert(!ptSlot->bBusy);
+        if (NULL != (void *)ptSlot->tMemory.pBuffer) {
+            arm_2d_scratch_memory_free(&ptSlot->tMemory);
+        }
+    }
+}
+
+static
+void __arm_2d_separable_blur_kernel_init(
+                                __arm_2d_separable_blur_kernel_t *ptKernel,
+                                uint8_t chKernel,
+                                uint8_t chRadius)
+{
+    uint_fast8_t chTaps = chRadius * 2 + 1;
+
+    memset(ptKernel, 0, sizeof(__arm_2d_separable_blur_kernel_t));
+    ptKernel->chRadius = chRadius;
+
+    if (ARM_2D_FILTER_BLUR_KERNEL_GAUSSIAN == chKernel) {
+        /* the binomial coefficients C(2r, k), which add up to 2^(2r) */
+        ptKernel->hwWeight[0] = 1;
+        for (uint_fast8_t n = 1; n < chTaps; n++) {
+            for (uint_fast8_t k = n; k > 0; k--) {
+                ptKernel->hwWeight[k] += ptKernel->hwWeight[k - 1];
+            }
+        }
+
+        ptKernel->wScale = 1;
+        ptKernel->chShift = chRadius * 2;
+        ptKernel->wRound = (0 == chRadius) ? 0 : (1ul << (chRadius * 2 - 1));
+    } else {
+        for (uint_fast8_t n = 0; n < chTaps; n++) {
+            ptKernel->hwWeight[n] = 1;
+        }
+
+        /* divide by the number of taps with a Q16 reciprocal */
+        ptKernel->bBox = true;
+        ptKernel->wScale = (65536ul + (chTaps >> 1)) / chTaps;
+        ptKernel->chShift = 16;
+        ptKernel->wRound = 1ul << 15;
+    }
+}
+
+__STATIC_INLINE
+uint8_t __arm_2d_separable_blur_normalise(
+                                const __arm_2d_separable_blur_kernel_t *ptKernel,
+                                uint32_t wAcc)
+{
+    return (uint8_t)((wAcc * ptKernel->wScale + ptKernel->wRound)
+                        >> ptKernel->chShift);
+}
+
+/*!
+ * \brief the horizontal pass: filter the line buffer into a row of the ring
+ */
+static
+void __arm_2d_separable_blur_row(   const uint8_t *__RESTRICT pchLine,
+                                    uint8_t *__RESTRICT pchRow,
+                                    int_fast16_t iWidth,
+                                    uint_fast8_t chChannels,
+                                    const __arm_2d_separable_blur_kernel_t *ptKernel)
+{
+    int_fast16_t iTaps = ptKernel->chRadius * 2 + 1;
+
+    if (ptKernel->bBox) {
+        /* sliding sum, the cost doesn't depend on the radius */
+        for (uint_fast8_t c = 0; c < chChannels; c++) {
+            const uint8_t *pchIn = pchLine + c;
+            uint8_t *pchOut = pchRow + c;
+            uint32_t wSum = 0;
+
+            for (int_fast16_t i = 0; i < iTaps; i++) {
+                wSum += pchIn[i * chChannels];
+            }
+            *pchOut = __arm_2d_separable_blur_normalise(ptKernel, wSum);
+
+            for (int_fast16_t iX = 1; iX < iWidth; iX++) {
+                wSum += pchIn[(iX + iTaps - 1) * chChannels];
+                wSum -= pchIn[(iX - 1) * chChannels];
+
+                pchOut += chChannels;
+                *pchOut = __arm_2d_separable_blur_normalise(ptKernel, wSum);
+            }
+        }
+    } else {
+        int_fast16_t iCount = iWidth * chChannels;
+
+        for (int_fast16_t n = 0; n < iCount; n++) {
+            const uint8_t *pchIn = pchLine + n;
+            uint32_t wAcc = 0;
+
+            for (int_fast16_t i = 0; i < iTaps; i++) {
+                wAcc += (uint32_t)ptKernel->hwWeight[i] * pchIn[i * chChannels];
+            }
+
+            pchRow[n] = __arm_2d_separable_blur_normalise(ptKernel, wAcc);
+        }
+    }
+}
+
+/*!
+ * \brief the generic separable blur
+ * \details The source rows are filtered horizontally into a ring of 2r+1 rows
+ *          and the ring is filtered vertically into the target. Pixels outside
+ *          the source are the copies of the nearest edge pixels.
+ *
+ *          Source Domain (the visible part of the source tile)
+ *          +--------------------------------------------------+
+ *          |                                                  |
+ *          |      Guard Band (r pixels)                       |
+ *          |     +-------------------------------+            |
+ *          |     |    Valid Region (the PFB)     |            |
+ *          |     |   +-----------------------+   |            |
+ *          |     |   |                       |   |            |
+ *          |     |   +-----------------------+   |            |
+ *          |     +-------------------------------+            |
+ *          +--------------------------------------------------+
+ *
+ *          NOTE: The valid region is expressed in the coordinates of the
+ *                source domain and it is always inside the domain.
+ */
+static
+void __arm_2d_separable_blur(   const uint8_t *pchSourceBase,
+                                int32_t nSourceStrideInByte,
+                                const arm_2d_size_t *ptSourceSize,
+                                uint8_t *pchTarget,
+                                int32_t nTargetStrideInByte,
+                                const arm_2d_region_t *ptValidRegionInSource,
+                                uint_fast8_t chChannels,
+                                uint8_t chKernel,
+                                uint8_t chRadius,
+                                uint8_t *pchScratch,
+                                __arm_2d_separable_blur_fetch_t *fnFetch,
+                                __arm_2d_separable_blur_store_t *fnStore)
+{
+    __arm_2d_separable_blur_kernel_t tKernel;
+    __arm_2d_separable_blur_kernel_init(&tKernel, chKernel, chRadius);
+
+    int_fast16_t iWidth = ptValidRegionInSource->tSize.iWidth;
+    int_fast16_t iHeight = ptValidRegionInSource->tSize.iHeight;
+    int_fast16_t iX0 = ptValidRegionInSource->tLocation.iX;
+    int_fast16_t iY0 = ptValidRegionInSource->tLocation.iY;
+    int_fast16_t iTaps = chRadius * 2 + 1;
+    int_fast16_t iRowSize = iWidth * chChannels;
+
+    /* layout of the scratch memory, see arm_2d_filter_separable_blur_get_scratch_size() */
+    uint16_t *phwSum = (uint16_t *)pchScratch;
+    uint8_t *pchLine = (uint8_t *)(phwSum + iRowSize);
+    uint8_t *pchRing = pchLine + (iWidth + iTaps - 1) * chChannels;
+
+    int_fast16_t iLastSourceRow = -1;
+    uint8_t *pchLastRow = NULL;
+
+    /* fill a ring slot with the filtered source row iY (unclamped) */
+    #define __ARM_2D_SEPARABLE_BLUR_PRODUCE(__SLOT, __Y)                        \
+        do {                                                                    \
+            int_fast16_t iSourceRow = MIN(MAX((__Y), 0),                        \
+                                          ptSourceSize->iHeight - 1);           \
+            uint8_t *pchSlot = pchRing + (__SLOT) * iRowSize;                   \
+            if (iSourceRow == iLastSourceRow) {                                 \
+                /* the extended edges repeat the same row */                    \
+                memcpy(pchSlot, pchLastRow, iRowSize);                          \
+            } else {                                                            \
+                (*fnFetch)( pchSourceBase                                       \
+                                + iSourceRow * nSourceStrideInByte,             \
+                            iX0 - chRadius,                                     \
+                            iWidth + iTaps - 1,                                 \
+                            ptSourceSize->iWidth,                               \
+                            pchLine);                                           \
+                __arm_2d_separable_blur_row(pchLine, pchSlot, iWidth,           \
+                                            chChannels, &tKernel);              \
+            }                                                                   \
+            iLastSourceRow = iSourceRow;                                        \
+            pchLastRow = pchSlot;                                               \
+        } while(0)
+
+    /* prime the ring with the rows of the guard band */
+    for (int_fast16_t j = 0; j < iTaps; j++) {
+        __ARM_2D_SEPARABLE_BLUR_PRODUCE(j, iY0 - chRadius + j);
+    }
+
+    if (tKernel.bBox) {
+        memset(phwSum, 0, iRowSize * sizeof(uint16_t));
+        for (int_fast16_t j = 0; j < iTaps; j++) {
+            const uint8_t *pchRow = pchRing + j * iRowSize;
+            for (int_fast16_t n = 0; n < iRowSize; n++) {
+                phwSum[n] += pchRow[n];
+            }
+        }
+    }
+
+    int_fast16_t iHead = 0;                 /* the slot of the top row in the window */
+
+    for (int_fast16_t iY = 0; iY < iHeight; iY++) {
+
+        if (iY > 0) {
+            /* slide the window: replace the top row with the next bottom row */
+            uint8_t *pchSlot = pchRing + iHead * iRowSize;
+
+            if (tKernel.bBox) {
+                for (int_fast16_t n = 0; n < iRowSize; n++) {
+                    phwSum[n] -= pchSlot[n];
+                }
+            }
+
+            __ARM_2D_SEPARABLE_BLUR_PRODUCE(iHead, iY0 + iY + chRadius);
+
+            if (tKernel.bBox) {
+                for (int_fast16_t n = 0; n < iRowSize; n++) {
+                    phwSum[n] += pchSlot[n];
+                }
+            }
+
+            iHead++;
+            if (iHead >= iTaps) {
+                iHead = 0;
+            }
+        }
+
+        /* the vertical pass, the line buffer is reused as the output row */
+        if (tKernel.bBox) {
+            for (int_fast16_t n = 0; n < iRowSize; n++) {
+                pchLine[n] = __arm_2d_separable_blur_normalise(&tKernel, phwSum[n]);
+            }
+        } else {
+            for (int_fast16_t n = 0; n < iRowSize; n++) {
+                uint32_t wAcc = 0;
+                int_fast16_t iSlot = iHead;
+                for (int_fast16_t j = 0; j < iTaps; j++) {
+                    wAcc += (uint32_t)tKernel.hwWeight[j]
+                          * pchRing[iSlot * iRowSize + n];
+                    if (++iSlot >= iTaps) {
+                        iSlot = 0;
+                    }
+                }
+                pchLine[n] = __arm_2d_separable_blur_normalise(&tKernel, wAcc);
+            }
+        }
+
+        (*fnStore)(pchLine, pchTarget, iWidth);
+        pchTarget += nTargetStrideInByte;
+    }
+
+    #undef __ARM_2D_SEPARABLE_BLUR_PRODUCE
+}
+
+/*
+ * Helpers shared by the frontend APIs and the backend entries
+ */
+
+static
+arm_2d_err_t __arm_2d_filter_separable_blur_check(
+                                        const arm_2d_tile_t *ptSource,
+                                        arm_2d_filter_blur_kernel_t tKernel,
+                                        uint8_t chRadius)
+{
+    if (    (chRadius > ARM_2D_FILTER_SEPARABLE_BLUR_MAX_RADIUS)
+        ||  (tKernel > ARM_2D_FILTER_BLUR_KERNEL_GAUSSIAN)) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    arm_2d_region_t tValidRegion;
+    const arm_2d_tile_t *ptRoot = arm_2d_tile_get_root(ptSource,
+                                                       &tValidRegion,
+                                                       NULL);
+    if (NULL == ptRoot) {
+        return ARM_2D_ERR_OUT_OF_REGION;
+    }
+
+    /* the guard band is read directly from the source buffer */
+    if (ptRoot->tInfo.bVirtualResource) {
+        return ARM_2D_ERR_NOT_SUPPORT;
+    }
+
+    return ARM_2D_ERR_NONE;
+}
+
+static
+void __arm_2d_filter_separable_blur_prepare(
+                            arm_2d_filter_separable_blur_descriptor_t *ptThis,
+                            bool bDefaultOP,
+                            const arm_2d_tile_t *ptSource,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion,
+                            arm_2d_filter_blur_kernel_t tKernel,
+                            uint8_t chRadius)
+{
+    if (NULL == ptRegion) {
+        this.tRegion = (arm_2d_region_t) {
+            .tSize = ptTarget->tRegion.tSize,
+        };
+    } else {
+        this.tRegion = *ptRegion;
+    }
+
+    /* like the tile copy, the output is limited by the source size */
+    this.tRegion.tSize.iWidth = MIN(this.tRegion.tSize.iWidth,
+                                    ptSource->tRegion.tSize.iWidth);
+    this.tRegion.tSize.iHeight = MIN(this.tRegion.tSize.iHeight,
+                                     ptSource->tRegion.tSize.iHeight);
+
+    OPCODE.Target.ptTile = ptTarget;
+    OPCODE.Target.ptRegion = &this.tRegion;
+    OPCODE.Source.ptTile = ptSource;
+    OPCODE.wMode = 0;
+
+    this.chKernel = tKernel;
+    this.chRadius = chRadius;
+
+    if (bDefaultOP) {
+        /* the default OP is shared with other OPs, never trust its content */
+        memset(&this.tScratchMemory, 0, sizeof(arm_2d_scratch_mem_t));
+    }
+}
+
+/*!
+ * \brief return the pool slot taken by a sub-task
+ * \param[in] ptSlot the slot, NULL is ignored
+ */
+static
+void __arm_2d_filter_separable_blur_put_scratch(
+                                    __arm_2d_separable_blur_scratch_t *ptSlot)
+{
+    if (NULL == ptSlot) {
+        return ;
+    }
+
+    __arm_2d_separable_blur_safe {
+        ptSlot->bBusy = false;
+    }
+}
+
+/*!
+ * \brief get the scratch memory for a sub-task
+ * \param[in] ptThis the OP
+ * \param[in] wSize the required size in bytes
+ * \param[out] pptSlot the pool slot taken by the sub-task, NULL means the 
+ *             scratch memory provided by users is used
+ * \return uint8_t* the scratch memory, NULL means insufficient resource
+ */
+static
+uint8_t *__arm_2d_filter_separable_blur_get_scratch(
+                            arm_2d_filter_separable_blur_descriptor_t *ptThis,
+                            uint32_t wSize,
+                            __arm_2d_separable_blur_scratch_t **pptSlot)
+{
+    *pptSlot = NULL;
+
+    if (NULL != (void *)this.tScratchMemory.pBuffer) {
+        if (this.tScratchMemory.u24SizeInByte < wSize) {
+            return NULL;
+        }
+        return (uint8_t *)this.tScratchMemory.pBuffer;
+    }
+
+    /* sub-tasks of different OPs might run in parallel on the async workers,
+     * so each of them takes a dedicated slot. A slot that is large enough is
+     * preferred, so the pool only grows when it has to.
+     */
+    __arm_2d_separable_blur_scratch_t *ptSlot = NULL;
+    __arm_2d_separable_blur_safe {
+        arm_foreach(__arm_2d_separable_blur_scratch_t, 
+                    s_tSeparableBlurScratchPool, 
+                    ptItem) {
+            if (ptItem->bBusy) {
+                continue;
+            }
+            if (ptItem->tMemory.u24SizeInByte >= wSize) {
+                ptSlot = ptItem;
+                break;
+            }
+            if (NULL == ptSlot) {
+                ptSlot = ptItem;
+            }
+        }
+
+        if (NULL != ptSlot) {
+            ptSlot->bBusy = true;
+        }
+    }
+
+    if (NULL == ptSlot) {
+        return NULL;
+    }
+
+    arm_2d_scratch_mem_t *ptPool = &ptSlot->tMemory;
+    if (ptPool->u24SizeInByte < wSize) {
+        if (NULL != (void *)ptPool->pBuffer) {
+            arm_2d_scratch_memory_free(ptPool);
+        }
+
+        if (    (NULL == arm_2d_scratch_memory_new( ptPool,
+                                                    sizeof(uint32_t),
+                                                    wSize / sizeof(uint32_t),
+                                                    sizeof(uint32_t),
+                                                    ARM_2D_MEM_TYPE_FAST))
+            ||  (NULL == (void *)ptPool->pBuffer)) {
+            memset(ptPool, 0, sizeof(arm_2d_scratch_mem_t));
+            __arm_2d_filter_separable_blur_put_scratch(ptSlot);
+            return NULL;
+        }
+    }
+
+    *pptSlot = ptSlot;
+    return (uint8_t *)ptPool->pBuffer;
+}
+
+/*!
+ * \brief map the current working buffer to the source tile
+ * \param[in] ptThis the OP
+ * \param[in] ptTask the sub-task
+ * \param[in] chPixelSizeInByte the pixel size
+ * \param[out] ppchSourceBase the first pixel of the source domain
+ * \param[out] pnSourceStrideInByte the stride of the source
+ * \param[out] ptSourceSize the size of the source domain
+ * \param[out] ptValidRegionInSource the working buffer in the source domain
+ * \return arm_2d_err_t the result
+ */
+static
+arm_2d_err_t __arm_2d_filter_separable_blur_map_source(
+                            arm_2d_filter_separable_blur_descriptor_t *ptThis,
+                            __arm_2d_sub_task_t *ptTask,
+                            uint_fast8_t chPixelSizeInByte,
+                            const uint8_t **ppchSourceBase,
+                            int32_t *pnSourceStrideInByte,
+                            arm_2d_size_t *ptSourceSize,
+                            arm_2d_region_t *ptValidRegionInSource)
+{
+    arm_2d_region_t tSourceValidRegion;
+    arm_2d_location_t tSourceOffset = {0};
+    const arm_2d_tile_t *ptRoot = arm_2d_tile_get_root(OPCODE.Source.ptTile,
+                                                       &tSourceValidRegion,
+                                                       &tSourceOffset);
+    if (NULL == ptRoot) {
+        return ARM_2D_ERR_OUT_OF_REGION;
+    }
+
+    /* root tile can have offset location */
+    int32_t nOffset = (int32_t)ptRoot->tRegion.tSize.iWidth
+                    * (tSourceValidRegion.tLocation.iY
+                        - ptRoot->tRegion.tLocation.iY)
+                    + (tSourceValidRegion.tLocation.iX
+                        - ptRoot->tRegion.tLocation.iX);
+
+    *ppchSourceBase = ptRoot->pchBuffer + nOffset * chPixelSizeInByte;
+    *pnSourceStrideInByte = (int32_t)ptRoot->tRegion.tSize.iWidth
+                          * chPixelSizeInByte;
+    *ptSourceSize = tSourceValidRegion.tSize;
+
+    /* the location (0, 0) of the target region maps to (0, 0) of the source tile */
+    arm_2d_location_t tTargetLocation
+        = arm_2d_get_absolute_location( OPCODE.Target.ptTile,
+                                        this.tRegion.tLocation,
+                                        true);
+
+    *ptValidRegionInSource
+        = ptTask->Param.tTileProcess.tValidRegionInVirtualScreen;
+    ptValidRegionInSource->tLocation.iX -= tTargetLocation.iX + tSourceOffset.iX;
+    ptValidRegionInSource->tLocation.iY -= tTargetLocation.iY + tSourceOffset.iY;
+
+    /* NOTE: when the source tile is clipped by its parent, the valid region
+     *       might be partially outside the source domain, and the edges of
+     *       the domain are extended to cover it.
+     */
+
+    return ARM_2D_ERR_NONE;
+}
+
+/*----------------------------------------------------------------------------*
+ * GRAY8                                                                      *
+ *----------------------------------------------------------------------------*/
+
+static
+void __arm_2d_gray8_separable_blur_fetch(   const void *pSourceRow,
+                                            int_fast16_t iX,
+                                            int_fast16_t iCount,
+                                            int_fast16_t iSourceWidth,
+                                            uint8_t *__RESTRICT pchLine)
+{
+    const uint8_t *pchSource = (const uint8_t *)pSourceRow;
+
+    while(iCount--) {
+        *pchLine++ = pchSource[MIN(MAX(iX, 0), iSourceWidth - 1)];
+        iX++;
+    }
+}
+
+static
+void __arm_2d_gray8_separable_blur_store(   const uint8_t *__RESTRICT pchLine,
+                                            void *pTargetRow,
+                                            int_fast16_t iWidth)
+{
+    memcpy(pTargetRow, pchLine, iWidth);
+}
+
+/*
+ * the Frontend API
+ */
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_gray8_filter_separable_blur(
+                            arm_2d_filter_separable_blur_descriptor_t *ptOP,
+                            const arm_2d_tile_t *ptSource,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion,
+                            arm_2d_filter_blur_kernel_t tKernel,
+                            uint8_t chRadius)
+{
+    assert(NULL != ptSource);
+    assert(NULL != ptTarget);
+
+    ARM_2D_IMPL(arm_2d_filter_separable_blur_descriptor_t, ptOP);
+
+    arm_2d_err_t tErr = __arm_2d_filter_separable_blur_check(ptSource,
+                                                             tKernel,
+                                                             chRadius);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_FILTER_SEPARABLE_BLUR_GRAY8;
+
+    __arm_2d_filter_separable_blur_prepare( ptThis,
+                                            (NULL == ptOP),
+                                            ptSource,
+                                            ptTarget,
+                                            ptRegion,
+                                            tKernel,
+                                            chRadius);
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+/* default low level implementation */
+__WEAK
+void __arm_2d_impl_gray8_filter_separable_blur(
+                            const uint8_t *__RESTRICT pchSourceBase,
+                            int16_t iSourceStride,
+                            arm_2d_size_t *__RESTRICT ptSourceSize,
+                            uint8_t *__RESTRICT pchTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionInSource,
+                            uint8_t chKernel,
+                            uint8_t chRadius,
+                            uint8_t *__RESTRICT pchScratch)
+{
+    __arm_2d_separable_blur(pchSourceBase,
+                            iSourceStride,
+                            ptSourceSize,
+                            pchTarget,
+                            iTargetStride,
+                            ptValidRegionInSource,
+                            1,
+                            chKernel,
+                            chRadius,
+                            pchScratch,
+                            &__arm_2d_gray8_separable_blur_fetch,
+                            &__arm_2d_gray8_separable_blur_store);
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_gray8_sw_filter_separable_blur( __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_filter_separable_blur_descriptor_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_8BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    const uint8_t *pchSourceBase;
+    int32_t nSourceStride;
+    arm_2d_size_t tSourceSize;
+    arm_2d_region_t tValidRegionInSource;
+
+    arm_2d_err_t tErr = __arm_2d_filter_separable_blur_map_source(
+                                                    ptThis,
+                                                    ptTask,
+                                                    sizeof(uint8_t),
+                                                    &pchSourceBase,
+                                                    &nSourceStride,
+                                                    &tSourceSize,
+                                                    &tValidRegionInSource);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    __arm_2d_separable_blur_scratch_t *ptSlot;
+    uint8_t *pchScratch = __arm_2d_filter_separable_blur_get_scratch(
+                ptThis,
+                arm_2d_filter_separable_blur_get_scratch_size(
+                                    tValidRegionInSource.tSize.iWidth,
+                                    this.chRadius,
+                                    ARM_2D_COLOUR_SZ_8BIT),
+                &ptSlot);
+    if (NULL == pchScratch) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    __arm_2d_impl_gray8_filter_separable_blur(
+                        pchSourceBase,
+                        nSourceStride,
+                        &tSourceSize,
+                        ptTask->Param.tTileProcess.pBuffer,
+                        ptTask->Param.tTileProcess.iStride,
+                        &tValidRegionInSource,
+                        this.chKernel,
+                        this.chRadius,
+                        pchScratch);
+
+    __arm_2d_filter_separable_blur_put_scratch(ptSlot);
+
+    return arm_fsm_rt_cpl;
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILTER_SEPARABLE_BLUR_GRAY8,
+                __arm_2d_gray8_sw_filter_separable_blur);   /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILTER_SEPARABLE_BLUR_GRAY8 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_GRAY8,
+        },
+        .Param = {
+            .bHasSource             = false,
+            .bHasTarget             = true,
+            .bBackendReadsSource    = true, /* the source is read by the backend directly */
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILTER_SEPARABLE_BLUR,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILTER_SEPARABLE_BLUR_GRAY8),
+        },
+    },
+};
+
+/*----------------------------------------------------------------------------*
+ * RGB565                                                                     *
+ *----------------------------------------------------------------------------*/
+
+static
+void __arm_2d_rgb565_separable_blur_fetch(  const void *pSourceRow,
+                                            int_fast16_t iX,
+                                            int_fast16_t iCount,
+                                            int_fast16_t iSourceWidth,
+                                            uint8_t *__RESTRICT pchLine)
+{
+    const uint16_t *phwSource = (const uint16_t *)pSourceRow;
+    __arm_2d_color_fast_rgb_t tPixel;
+
+    while(iCount--) {
+        __arm_2d_rgb565_unpack( phwSource[MIN(MAX(iX, 0), iSourceWidth - 1)],
+                                &tPixel);
+        *pchLine++ = tPixel.B;
+        *pchLine++ = tPixel.G;
+        *pchLine++ = tPixel.R;
+        iX++;
+    }
+}
+
+static
+void __arm_2d_rgb565_separable_blur_store(  const uint8_t *__RESTRICT pchLine,
+                                            void *pTargetRow,
+                                            int_fast16_t iWidth)
+{
+    uint16_t *phwTarget = (uint16_t *)pTargetRow;
+    __arm_2d_color_fast_rgb_t tPixel;
+
+    while(iWidth--) {
+        tPixel.B = *pchLine++;
+        tPixel.G = *pchLine++;
+        tPixel.R = *pchLine++;
+        *phwTarget++ = __arm_2d_rgb565_pack(&tPixel);
+    }
+}
+
+/*
+ * the Frontend API
+ */
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_rgb565_filter_separable_blur(
+                            arm_2d_filter_separable_blur_descriptor_t *ptOP,
+                            const arm_2d_tile_t *ptSource,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion,
+                            arm_2d_filter_blur_kernel_t tKernel,
+                            uint8_t chRadius)
+{
+    assert(NULL != ptSource);
+    assert(NULL != ptTarget);
+
+    ARM_2D_IMPL(arm_2d_filter_separable_blur_descriptor_t, ptOP);
+
+    arm_2d_err_t tErr = __arm_2d_filter_separable_blur_check(ptSource,
+                                                             tKernel,
+                                                             chRadius);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_FILTER_SEPARABLE_BLUR_RGB565;
+
+    __arm_2d_filter_separable_blur_prepare( ptThis,
+                                            (NULL == ptOP),
+                                            ptSource,
+                                            ptTarget,
+                                            ptRegion,
+                                            tKernel,
+                                            chRadius);
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+/* default low level implementation */
+__WEAK
+void __arm_2d_impl_rgb565_filter_separable_blur(
+                            const uint16_t *__RESTRICT phwSourceBase,
+                            int16_t iSourceStride,
+                            arm_2d_size_t *__RESTRICT ptSourceSize,
+                            uint16_t *__RESTRICT phwTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionInSource,
+                            uint8_t chKernel,
+                            uint8_t chRadius,
+                            uint8_t *__RESTRICT pchScratch)
+{
+    __arm_2d_separable_blur((const uint8_t *)phwSourceBase,
+                            iSourceStride * sizeof(uint16_t),
+                            ptSourceSize,
+                            (uint8_t *)phwTarget,
+                            iTargetStride * sizeof(uint16_t),
+                            ptValidRegionInSource,
+                            3,
+                            chKernel,
+                            chRadius,
+                            pchScratch,
+                            &__arm_2d_rgb565_separable_blur_fetch,
+                            &__arm_2d_rgb565_separable_blur_store);
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_rgb565_sw_filter_separable_blur( __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_filter_separable_blur_descriptor_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_16BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    const uint8_t *pchSourceBase;
+    int32_t nSourceStride;
+    arm_2d_size_t tSourceSize;
+    arm_2d_region_t tValidRegionInSource;
+
+    arm_2d_err_t tErr = __arm_2d_filter_separable_blur_map_source(
+                                                    ptThis,
+                                                    ptTask,
+                                                    sizeof(uint16_t),
+                                                    &pchSourceBase,
+                                                    &nSourceStride,
+                                                    &tSourceSize,
+                                                    &tValidRegionInSource);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    __arm_2d_separable_blur_scratch_t *ptSlot;
+    uint8_t *pchScratch = __arm_2d_filter_separable_blur_get_scratch(
+                ptThis,
+                arm_2d_filter_separable_blur_get_scratch_size(
+                                    tValidRegionInSource.tSize.iWidth,
+                                    this.chRadius,
+                                    ARM_2D_COLOUR_SZ_16BIT),
+                &ptSlot);
+    if (NULL == pchScratch) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    __arm_2d_impl_rgb565_filter_separable_blur(
+                        (const uint16_t *)pchSourceBase,
+                        nSourceStride / sizeof(uint16_t),
+                        &tSourceSize,
+                        ptTask->Param.tTileProcess.pBuffer,
+                        ptTask->Param.tTileProcess.iStride,
+                        &tValidRegionInSource,
+                        this.chKernel,
+                        this.chRadius,
+                        pchScratch);
+
+    __arm_2d_filter_separable_blur_put_scratch(ptSlot);
+
+    return arm_fsm_rt_cpl;
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILTER_SEPARABLE_BLUR_RGB565,
+                __arm_2d_rgb565_sw_filter_separable_blur);  /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILTER_SEPARABLE_BLUR_RGB565 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_RGB565,
+        },
+        .Param = {
+            .bHasSource             = false,
+            .bHasTarget             = true,
+            .bBackendReadsSource    = true, /* the source is read by the backend directly */
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILTER_SEPARABLE_BLUR,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILTER_SEPARABLE_BLUR_RGB565),
+        },
+    },
+};
+
+/*----------------------------------------------------------------------------*
+ * CCCN888                                                                    *
+ *----------------------------------------------------------------------------*/
+
+static
+void __arm_2d_cccn888_separable_blur_fetch( const void *pSourceRow,
+                                            int_fast16_t iX,
+                                            int_fast16_t iCount,
+                                            int_fast16_t iSourceWidth,
+                                            uint8_t *__RESTRICT pchLine)
+{
+    const uint32_t *pwSource = (const uint32_t *)pSourceRow;
+
+    while(iCount--) {
+        const uint8_t *pchPixel
+            = (const uint8_t *)&pwSource[MIN(MAX(iX, 0), iSourceWidth - 1)];
+        *pchLine++ = pchPixel[0];
+        *pchLine++ = pchPixel[1];
+        *pchLine++ = pchPixel[2];
+        iX++;
+    }
+}
+
+static
+void __arm_2d_cccn888_separable_blur_store( const uint8_t *__RESTRICT pchLine,
+                                            void *pTargetRow,
+                                            int_fast16_t iWidth)
+{
+    uint8_t *pchTarget = (uint8_t *)pTargetRow;
+
+    while(iWidth--) {
+        /* keep the n channel untouched */
+        pchTarget[0] = *pchLine++;
+        pchTarget[1] = *pchLine++;
+        pchTarget[2] = *pchLine++;
+        pchTarget += sizeof(uint32_t);
+    }
+}
+
+/*
+ * the Frontend API
+ */
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_cccn888_filter_separable_blur(
+                            arm_2d_filter_separable_blur_descriptor_t *ptOP,
+                            const arm_2d_tile_t *ptSource,
+                            const arm_2d_tile_t *ptTarget,
+                            const arm_2d_region_t *ptRegion,
+                            arm_2d_filter_blur_kernel_t tKernel,
+                            uint8_t chRadius)
+{
+    assert(NULL != ptSource);
+    assert(NULL != ptTarget);
+
+    ARM_2D_IMPL(arm_2d_filter_separable_blur_descriptor_t, ptOP);
+
+    arm_2d_err_t tErr = __arm_2d_filter_separable_blur_check(ptSource,
+                                                             tKernel,
+                                                             chRadius);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_FILTER_SEPARABLE_BLUR_CCCN888;
+
+    __arm_2d_filter_separable_blur_prepare( ptThis,
+                                            (NULL == ptOP),
+                                            ptSource,
+                                            ptTarget,
+                                            ptRegion,
+                                            tKernel,
+                                            chRadius);
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+/* default low level implementation */
+__WEAK
+void __arm_2d_impl_cccn888_filter_separable_blur(
+                            const uint32_t *__RESTRICT pwSourceBase,
+                            int16_t iSourceStride,
+                            arm_2d_size_t *__RESTRICT ptSourceSize,
+                            uint32_t *__RESTRICT pwTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionInSource,
+                            uint8_t chKernel,
+                            uint8_t chRadius,
+                            uint8_t *__RESTRICT pchScratch)
+{
+    __arm_2d_separable_blur((const uint8_t *)pwSourceBase,
+                            iSourceStride * sizeof(uint32_t),
+                            ptSourceSize,
+                            (uint8_t *)pwTarget,
+                            iTargetStride * sizeof(uint32_t),
+                            ptValidRegionInSource,
+                            3,
+                            chKernel,
+                            chRadius,
+                            pchScratch,
+                            &__arm_2d_cccn888_separable_blur_fetch,
+                            &__arm_2d_cccn888_separable_blur_store);
+}
+
+/*
+ * The backend entry
+ */
+arm_fsm_rt_t __arm_2d_cccn888_sw_filter_separable_blur( __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_filter_separable_blur_descriptor_t, ptTask->ptOP);
+
+    assert(ARM_2D_COLOUR_SZ_32BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    const uint8_t *pchSourceBase;
+    int32_t nSourceStride;
+    arm_2d_size_t tSourceSize;
+    arm_2d_region_t tValidRegionInSource;
+
+    arm_2d_err_t tErr = __arm_2d_filter_separable_blur_map_source(
+                                                    ptThis,
+                                                    ptTask,
+                                                    sizeof(uint32_t),
+                                                    &pchSourceBase,
+                                                    &nSourceStride,
+                                                    &tSourceSize,
+                                                    &tValidRegionInSource);
+    if (ARM_2D_ERR_NONE != tErr) {
+        return (arm_fsm_rt_t)tErr;
+    }
+
+    __arm_2d_separable_blur_scratch_t *ptSlot;
+    uint8_t *pchScratch = __arm_2d_filter_separable_blur_get_scratch(
+                ptThis,
+                arm_2d_filter_separable_blur_get_scratch_size(
+                                    tValidRegionInSource.tSize.iWidth,
+                                    this.chRadius,
+                                    ARM_2D_COLOUR_SZ_32BIT),
+                &ptSlot);
+    if (NULL == pchScratch) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+    }
+
+    __arm_2d_impl_cccn888_filter_separable_blur(
+                        (const uint32_t *)pchSourceBase,
+                        nSourceStride / sizeof(uint32_t),
+                        &tSourceSize,
+                        ptTask->Param.tTileProcess.pBuffer,
+                        ptTask->Param.tTileProcess.iStride,
+                        &tValidRegionInSource,
+                        this.chKernel,
+                        this.chRadius,
+                        pchScratch);
+
+    __arm_2d_filter_separable_blur_put_scratch(ptSlot);
+
+    return arm_fsm_rt_cpl;
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILTER_SEPARABLE_BLUR_CCCN888,
+                __arm_2d_cccn888_sw_filter_separable_blur); /* Default SW Implementation */
+
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_FILTER_SEPARABLE_BLUR_CCCN888 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_CCCN888,
+        },
+        .Param = {
+            .bHasSource             = false,
+            .bHasTarget             = true,
+            .bBackendReadsSource    = true, /* the source is read by the backend directly */
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILTER_SEPARABLE_BLUR,
+
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_FILTER_SEPARABLE_BLUR_CCCN888),
+        },
+    },
+};
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* __ARM_2D_COMPILATION_UNIT */
@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_premultiplied_ccca8888.c
+ * Description:  APIs for blending into premultiplied CCCA8888 targets
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+/*============================ INCLUDES ======================================*/
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wempty-translation-unit"
+#endif
+
+#ifdef __ARM_2D_COMPILATION_UNIT
+#undef __ARM_2D_COMPILATION_UNIT
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
+#   pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wimplicit-int-float-conversion"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wunused-parameter"
+#   pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wtautological-pointer-compare"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wsign-compare"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#endif
+
+/*============================ MACROS ========================================*/
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*
+ * NOTE: All pixels handled in this file are premultiplied, i.e. the colour
+ *       channels have already been scaled by the alpha channel. Blending is
+ *       therefore a plain source-over:
+ *
+ *           Des = Src * Opacity + Des * (1 - SrcAlpha * Opacity)
+ *
+ *       applied to all four channels, so the target keeps a meaningful alpha
+ *       channel and can be composed again as a layer later.
+ */
+
+/*----------------------------------------------------------------------------*
+ * Accelerable Low Level APIs                                                 *
+ *----------------------------------------------------------------------------*/
+
+__WEAK
+void __arm_2d_impl_ccca8888_tile_copy_opacity(
+                                    uint32_t *__RESTRICT pwSourceBase,
+                                    int16_t iSourceStride,
+                                    uint32_t *__RESTRICT pwTargetBase,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint_fast16_t hwRatio)
+{
+    int_fast16_t iWidth = ptCopySize->iWidth;
+    int_fast16_t iHeight = ptCopySize->iHeight;
+
+    hwRatio += (hwRatio == 255);
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint32_t *pwSource = pwSourceBase;
+        uint32_t *pwTarget = pwTargetBase;
+
+        for (int_fast16_t x = 0; x < iWidth; x++) {
+            __ARM_2D_PIXEL_BLENDING_OPA_CCCA8888(pwSource++, pwTarget++, hwRatio);
+        }
+
+        pwSourceBase += iSourceStride;
+        pwTargetBase += iTargetStride;
+    }
+}
+
+__WEAK
+void __arm_2d_impl_ccca8888_colour_filling_mask_opacity(
+                                    uint32_t *__RESTRICT pwTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint32_t wColour,
+                                    uint_fast16_t hwOpacity)
+{
+    int_fast16_t iWidth = ptCopySize->iWidth;
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    arm_2d_color_ccca8888_t tColour = {.tValue = wColour};
+
+    /* fold the alpha of the colour into the opacity */
+    uint_fast16_t hwColourAlpha = tColour.u8A + (tColour.u8A == 255);
+    hwOpacity += (hwOpacity == 255);
+    hwOpacity = (hwOpacity * hwColourAlpha) >> 8;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint8_t *pchDes = (uint8_t *)pwTarget;
+        const uint8_t *pchMask = pchAlpha;
+
+        for (int_fast16_t x = 0; x < iWidth; x++) {
+            uint_fast16_t hwAlpha = ((uint_fast16_t)(*pchMask++) * hwOpacity) >> 8;
+
+            if (0 != hwAlpha) {
+                uint_fast16_t hwTrans = 256 - hwAlpha;
+                uint_fast16_t hwScale = hwAlpha + (hwAlpha == 255);
+
+                for (int_fast8_t n = 0; n < 3; n++) {
+                    pchDes[n] = ( ((uint_fast16_t)tColour.u8C[n] * hwScale) >> 8)
+                              + ( ((uint_fast16_t)pchDes[n] * hwTrans) >> 8);
+                }
+                pchDes[3] = hwAlpha + (((uint_fast16_t)pchDes[3] * hwTrans) >> 8);
+            }
+
+            pchDes += sizeof(uint32_t);
+        }
+
+        pwTarget += iTargetStride;
+        pchAlpha += iAlphaStride;
+    }
+}
+
+/*----------------------------------------------------------------------------*
+ * Blend a premultiplied tile with a specified opacity                        *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_ccca8888_tile_copy_with_opacity(
+                                            arm_2d_op_alpha_t *ptOP,
+                                            const arm_2d_tile_t *ptSource,
+                                            const arm_2d_tile_t *ptTarget,
+                                            const arm_2d_region_t *ptRegion,
+                                            uint_fast8_t chRatio)
+{
+    assert(NULL != ptSource);
+    assert(NULL != ptTarget);
+
+    ARM_2D_IMPL(arm_2d_op_alpha_t, ptOP);
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_TILE_COPY_WITH_OPACITY_CCCA8888;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = ptRegion;
+    this.Source.ptTile = ptSource;
+    this.wMode = 0;
+    this.chRatio = chRatio;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+arm_fsm_rt_t __arm_2d_ccca8888_sw_tile_copy_with_opacity(
+                                                __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_alpha_t, ptTask->ptOP)
+    assert(ARM_2D_COLOUR_SZ_32BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    __arm_2d_impl_ccca8888_tile_copy_opacity(
+                                    ptTask->Param.tCopy.tSource.pBuffer,
+                                    ptTask->Param.tCopy.tSource.iStride,
+                                    ptTask->Param.tCopy.tTarget.pBuffer,
+                                    ptTask->Param.tCopy.tTarget.iStride,
+                                    &(ptTask->Param.tCopy.tCopySize),
+                                    this.chRatio);
+
+    return arm_fsm_rt_cpl;
+}
+
+/*----------------------------------------------------------------------------*
+ * Fill a premultiplied target with a colour, a mask and an opacity           *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,4)
+arm_fsm_rt_t arm_2dp_ccca8888_fill_colour_with_mask_and_opacity(
+                                        arm_2d_op_fill_cl_msk_opc_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_tile_t *ptAlpha,
+                                        arm_2d_color_ccca8888_t tColour,
+                                        uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptAlpha);
+
+    ARM_2D_IMPL(arm_2d_op_fill_cl_msk_opc_t, ptOP);
+
+    //! valid alpha mask tile
+    if (!__arm_2d_valid_mask(ptAlpha, __ARM_2D_MASK_ALLOW_A8)) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_FILL_COLOUR_WITH_MASK_AND_OPACITY_CCCA8888;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = ptRegion;
+    this.Mask.ptTile = ptAlpha;
+    this.wMode = 0;
+    this.wColour = tColour.tValue;
+    this.chRatio = chOpacity;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+arm_fsm_rt_t __arm_2d_ccca8888_sw_colour_filling_with_mask_and_opacity(
+                                                __arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_fill_cl_msk_opc_t, ptTask->ptOP)
+    assert(ARM_2D_COLOUR_SZ_32BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    __arm_2d_impl_ccca8888_colour_filling_mask_opacity(
+                            ptTask->Param.tCopy.tTarget.pBuffer,
+                            ptTask->Param.tCopy.tTarget.iStride,
+                            ptTask->Param.tCopy.tSource.pBuffer,                //!< alpha tile
+                            ptTask->Param.tCopy.tSource.iStride,                //!< alpha tile
+                            &(ptTask->Param.tCopy.tCopySize),
+                            this.wColour,
+                            this.chRatio);
+
+    return arm_fsm_rt_cpl;
+}
+
+/*
+ * OPCODE Low Level Implementation Entries
+ */
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_COPY_WITH_OPACITY_CCCA8888,
+                __arm_2d_ccca8888_sw_tile_copy_with_opacity);   /* Default SW Implementation */
+
+__WEAK
+def_low_lv_io(  __ARM_2D_IO_FILL_COLOUR_MASK_AND_OPACITY_CCCA8888,
+                __arm_2d_ccca8888_sw_colour_filling_with_mask_and_opacity);
+
+/*
+ * OPCODE
+ */
+
+const __arm_2d_op_info_t ARM_2D_OP_TILE_COPY_WITH_OPACITY_CCCA8888 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_CCCA8888,
+        },
+        .Param = {
+            .bHasSource     = true,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_COPY_WITH_OPACITY,
+
+        .LowLevelIO = {
+            .ptCopyLike = ref_low_lv_io(__ARM_2D_IO_COPY_WITH_OPACITY_CCCA8888),
+            .ptFillLike = NULL,
+        },
+    },
+};
+
+const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_WITH_MASK_AND_OPACITY_CCCA8888 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_CCCA8888,
+        },
+        .Param = {
+            .bHasSource     = true,
+            .bHasTarget     = true,
+            .bAllowEnforcedColour   = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_FILL_COLOUR_WITH_MASK_AND_OPACITY,
+
+        .LowLevelIO = {
+            .ptCopyLike = ref_low_lv_io(__ARM_2D_IO_FILL_COLOUR_MASK_AND_OPACITY_CCCA8888),
+            .ptFillLike = NULL,
+        },
+    },
+};
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
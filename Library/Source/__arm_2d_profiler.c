@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2010-2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        __arm_2d_profiler.c
+ * Description:  Record the timing of OPs and sub-tasks into a ring buffer
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wempty-translation-unit"
+#endif
+
+#ifdef __ARM_2D_COMPILATION_UNIT
+#undef __ARM_2D_COMPILATION_UNIT
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_suppress 174,177,188,68,513,144
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+
+/*============================ MACROS ========================================*/
+
+#if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+#   define __arm_2d_profiler_safe                                               \
+            arm_using(  uint32_t ARM_2D_SAFE_NAME(temp) =                       \
+                            arm_2d_port_enter_worker_critical_section(),        \
+                        arm_2d_port_leave_worker_critical_section(              \
+                            ARM_2D_SAFE_NAME(temp)))
+#else
+#   define __arm_2d_profiler_safe       arm_irq_safe
+#endif
+
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+#   define __arm_2d_profiler_thread_index()                                     \
+            (arm_2d_port_get_default_op_index())
+#else
+#   define __arm_2d_profiler_thread_index()     0
+#endif
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+__WEAK
+int64_t arm_2d_port_get_profiler_timestamp(void)
+{
+    return 0;
+}
+
+void arm_2d_profiler_init(  arm_2d_profiler_record_t *ptRecords,
+                            uint_fast16_t hwCount)
+{
+    if (NULL == ptRecords) {
+        hwCount = 0;
+    }
+
+    __arm_2d_profiler_safe {
+        ARM_2D_CTRL.Profiler.ptRecords = (0 == hwCount) ? NULL : ptRecords;
+        ARM_2D_CTRL.Profiler.hwSize = hwCount;
+        ARM_2D_CTRL.Profiler.hwHead = 0;
+        ARM_2D_CTRL.Profiler.hwCount = 0;
+        ARM_2D_CTRL.Profiler.wLost = 0;
+    }
+}
+
+void arm_2d_profiler_set_pfb_index(uint_fast8_t chIndex)
+{
+    ARM_2D_CTRL.Profiler.chPFBIndex[__arm_2d_profiler_thread_index()] 
+        = (uint8_t)chIndex;
+}
+
+uint_fast16_t arm_2d_profiler_fetch_records(arm_2d_profiler_record_t *ptBuffer,
+                                            uint_fast16_t hwCount)
+{
+    assert(NULL != ptBuffer);
+    uint_fast16_t hwFetched = 0;
+
+    __arm_2d_profiler_safe {
+        while ((hwFetched < hwCount) && (ARM_2D_CTRL.Profiler.hwCount > 0)) {
+            ptBuffer[hwFetched++] 
+                = ARM_2D_CTRL.Profiler.ptRecords[ARM_2D_CTRL.Profiler.hwHead];
+
+            ARM_2D_CTRL.Profiler.hwHead++;
+            if (ARM_2D_CTRL.Profiler.hwHead >= ARM_2D_CTRL.Profiler.hwSize) {
+                ARM_2D_CTRL.Profiler.hwHead = 0;
+            }
+            ARM_2D_CTRL.Profiler.hwCount--;
+        }
+    }
+
+    return hwFetched;
+}
+
+uint32_t arm_2d_profiler_get_lost_count(void)
+{
+    return ARM_2D_CTRL.Profiler.wLost;
+}
+
+uint32_t __arm_2d_profiler_get_op_pixel_count(arm_2d_op_core_t *ptOP)
+{
+    ARM_2D_IMPL(arm_2d_op_t, ptOP);
+
+    if (!(OP_CORE.ptOp->Info.Param.bHasTarget)) {
+        return 0;
+    }
+
+    const arm_2d_tile_t *ptTarget = this.Target.ptTile;
+    if (    (NULL == ptTarget)
+        ||  ((intptr_t)-1 == (intptr_t)ptTarget)) {
+        return 0;
+    }
+
+    /* get the visible area of the target tile */
+    arm_2d_region_t tRegion;
+    arm_2d_location_t tOffset;
+    if (NULL == arm_2d_tile_get_root(ptTarget, &tRegion, &tOffset)) {
+        return 0;
+    }
+    tRegion.tLocation = tOffset;
+
+    if (NULL != this.Target.ptRegion) {
+        if (!arm_2d_region_intersect(&tRegion, this.Target.ptRegion, &tRegion)) {
+            return 0;
+        }
+    }
+
+    return (uint32_t)tRegion.tSize.iWidth * (uint32_t)tRegion.tSize.iHeight;
+}
+
+uint32_t __arm_2d_profiler_get_sub_task_pixel_count(__arm_2d_sub_task_t *ptTask)
+{
+    const __arm_2d_tile_param_t *ptTarget = &ptTask->Param.tTileProcess;
+
+    if (ptTask->ptOP->ptOp->Info.Param.bHasSource) {
+        /* all copy-like and fill-like interfaces keep the target tile after 
+         * the source tile 
+         */
+        ptTarget = &ptTask->Param.tCopy.tTarget;
+    }
+
+    return  (uint32_t)ptTarget->tValidRegion.tSize.iWidth 
+        *   (uint32_t)ptTarget->tValidRegion.tSize.iHeight;
+}
+
+uint_fast8_t __arm_2d_profiler_get_thread_index(void)
+{
+    return __arm_2d_profiler_thread_index();
+}
+
+void __arm_2d_profiler_record(  arm_2d_op_core_t *ptOP,
+                                uint_fast8_t chType,
+                                uint_fast8_t chThreadIndex,
+                                int64_t lStart,
+                                uint32_t wPixelCount)
+{
+    arm_2d_profiler_record_t tRecord = {
+        .lTimestamp = lStart,
+        .wElapsed = (uint32_t)(arm_2d_port_get_profiler_timestamp() - lStart),
+        .wPixelCount = wPixelCount,
+        .chOPIndex = ptOP->ptOp->Info.chOpIndex,
+        .chColourFormat = ptOP->ptOp->Info.Colour.chScheme,
+        .chPFBIndex = ARM_2D_CTRL.Profiler.chPFBIndex[
+                                            __arm_2d_profiler_thread_index()],
+        .chType = (uint8_t)chType,
+        .chThreadIndex = (uint8_t)chThreadIndex,
+    };
+
+    __arm_2d_profiler_safe {
+        if (NULL == ARM_2D_CTRL.Profiler.ptRecords) {
+            continue;
+        }
+
+        uint_fast16_t hwIndex = ARM_2D_CTRL.Profiler.hwHead 
+                              + ARM_2D_CTRL.Profiler.hwCount;
+        if (hwIndex >= ARM_2D_CTRL.Profiler.hwSize) {
+            hwIndex -= ARM_2D_CTRL.Profiler.hwSize;
+        }
+
+        ARM_2D_CTRL.Profiler.ptRecords[hwIndex] = tRecord;
+
+        if (ARM_2D_CTRL.Profiler.hwCount < ARM_2D_CTRL.Profiler.hwSize) {
+            ARM_2D_CTRL.Profiler.hwCount++;
+        } else {
+            /* overwrite the oldest record */
+            ARM_2D_CTRL.Profiler.wLost++;
+            ARM_2D_CTRL.Profiler.hwHead++;
+            if (ARM_2D_CTRL.Profiler.hwHead >= ARM_2D_CTRL.Profiler.hwSize) {
+                ARM_2D_CTRL.Profiler.hwHead = 0;
+            }
+        }
+    }
+}
+
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__IS_COMPILER_ARM_COMPILER_5__)
+#   pragma diag_warning 174,177,188,68,513,144
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
@@ -45,6 +45,12 @@
 #define __ARM_2D_COMPILATION_UNIT
 #include "../Source/__arm_2d_tile.c"
 
+#define __ARM_2D_COMPILATION_UNIT
+#include "../Source/__arm_2d_display_list.c"
+
+#define __ARM_2D_COMPILATION_UNIT
+#include "../Source/__arm_2d_profiler.c"
+
 #if defined(__clang__)
 #   pragma clang diagnostic ignored "-Wunknown-warning-option"
 #   pragma clang diagnostic ignored "-Wformat-nonliteral"
@@ -67,6 +73,10 @@ extern "C" {
 #   define __arm_2d_helium_init()
 #endif
 
+#if !defined(__ARM_2D_HAS_PORTABLE_SIMD__) || !__ARM_2D_HAS_PORTABLE_SIMD__
+#   define __arm_2d_simd_init()
+#endif
+
 #if !defined(__ARM_2D_HAS_TIGHTLY_COUPLED_ACC__) || !__ARM_2D_HAS_TIGHTLY_COUPLED_ACC__
 #   define __arm_2d_sync_acc_init()
 #endif
@@ -118,6 +128,14 @@ extern
 void __arm_2d_helium_init(void);
 #endif
 
+#if defined(__ARM_2D_HAS_PORTABLE_SIMD__) && __ARM_2D_HAS_PORTABLE_SIMD__
+/*! 
+ * \brief initialise the portable SIMD acceleration
+ */
+extern
+void __arm_2d_simd_init(void);
+#endif
+
 #if defined(__ARM_2D_HAS_ACI__) && __ARM_2D_HAS_ACI__
 /*! 
  * \brief initialise the ACI service
@@ -169,6 +187,7 @@ void arm_2d_init(void)
     } while(0);
 
     __arm_2d_helium_init();                                             
+    __arm_2d_simd_init();
     __arm_2d_aci_init();   
     __arm_2d_sync_acc_init();                                             
     __arm_2d_async_acc_init();                                                
@@ -200,6 +219,38 @@ void __arm_2d_free_scratch_memory( arm_2d_mem_type_t tType,
     free(pBuff);
 }
 
+#if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+__WEAK
+uint32_t arm_2d_port_enter_worker_critical_section(void)
+{
+#if __IS_SUPPORTED_ARM_ARCH__
+    uint32_t wPRIMASK = __get_PRIMASK();
+    __disable_irq();
+    return wPRIMASK;
+#else
+    return 0;
+#endif
+}
+
+__WEAK
+void arm_2d_port_leave_worker_critical_section(uint32_t wState)
+{
+#if __IS_SUPPORTED_ARM_ARCH__
+    __set_PRIMASK(wState);
+#else
+    ARM_2D_UNUSED(wState);
+#endif
+}
+#endif
+
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+__WEAK
+uint_fast8_t arm_2d_port_get_default_op_index(void)
+{
+    return 0;
+}
+#endif
+
 
 typedef union arm_2d_log_chn_t {
     struct {
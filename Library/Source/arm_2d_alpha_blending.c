@@ -3657,6 +3657,12 @@ const __arm_2d_op_info_t ARM_2D_OP_TILE_FILL_WITH_DES_MASK_AND_XY_MIRROR_CCCN888
 #define __ARM_2D_COMPILATION_UNIT
 #include "__arm_2d_tile_copy_with_source_mask_and_opacity.c"
 
+#define __ARM_2D_COMPILATION_UNIT
+#include "__arm_2d_premultiplied_ccca8888.c"
+
+#define __ARM_2D_COMPILATION_UNIT
+#include "__arm_2d_fill_colour_with_gradient.c"
+
 #ifdef   __cplusplus
 }
 #endif
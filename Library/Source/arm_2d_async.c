@@ -35,6 +35,10 @@
 #include "arm_2d.h"
 #include "__arm_2d_impl.h"
 
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#   include <stdatomic.h>
+#endif
+
 #ifdef   __cplusplus
 extern "C" {
 #endif
@@ -76,27 +80,359 @@ extern "C" {
 #endif
 
 /*============================ MACROS ========================================*/
+
+/*! \note the capacity of arm_2d_op_status_t.u4SubTaskCount, an OP can have at 
+ *!       most 4 sub-tasks booked, plus the reference held by the frontend 
+ *!       when there are more than one worker.
+ */
+#define __ARM_2D_OP_SUB_TASK_COUNT_MAX      15
+
+#if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+/*! \note when there are more than one worker (or more than one thread issuing
+ *!       OPs), the sub-task pool, the queues and the OP status are shared, 
+ *!       hence the critical section must work across cores/threads.
+ */
+#   define __arm_2d_async_safe                                                  \
+            arm_using(  uint32_t ARM_2D_SAFE_NAME(temp) =                       \
+                            arm_2d_port_enter_worker_critical_section(),        \
+                        arm_2d_port_leave_worker_critical_section(              \
+                            ARM_2D_SAFE_NAME(temp)))
+#else
+#   define __arm_2d_async_safe          arm_irq_safe
+#endif
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+/* the capacity of the lock-free pool and FIFO: a power of 2 which is no less 
+ * than the sub-task pool size 
+ */
+#   if __ARM_2D_CFG_DEFAULT_SUB_TASK_POOL_SIZE__ <= 8
+#       define __ARM_2D_LOCK_FREE_CAPACITY              8
+#   elif __ARM_2D_CFG_DEFAULT_SUB_TASK_POOL_SIZE__ <= 16
+#       define __ARM_2D_LOCK_FREE_CAPACITY              16
+#   elif __ARM_2D_CFG_DEFAULT_SUB_TASK_POOL_SIZE__ <= 32
+#       define __ARM_2D_LOCK_FREE_CAPACITY              32
+#   elif __ARM_2D_CFG_DEFAULT_SUB_TASK_POOL_SIZE__ <= 64
+#       define __ARM_2D_LOCK_FREE_CAPACITY              64
+#   elif __ARM_2D_CFG_DEFAULT_SUB_TASK_POOL_SIZE__ <= 128
+#       define __ARM_2D_LOCK_FREE_CAPACITY              128
+#   elif __ARM_2D_CFG_DEFAULT_SUB_TASK_POOL_SIZE__ <= 256
+#       define __ARM_2D_LOCK_FREE_CAPACITY              256
+#   else
+#       error The lock-free sub-task pool supports at most 256 sub-tasks.
+#   endif
+#endif
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
+
+#if !__ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+#   define __arm_2d_contention_inc(__NAME)
+#elif __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#   define __arm_2d_contention_inc(__NAME)                                      \
+            atomic_fetch_add_explicit(  &s_tContention.__NAME,                  \
+                                        1,                                      \
+                                        memory_order_relaxed)
+#else
+/* \note it should be used inside the critical section */
+#   define __arm_2d_contention_inc(__NAME)                                      \
+            do {s_tContention.__NAME++;} while(0)
+#endif
+
+#if !__ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+#   define __arm_2d_pool_statistics_on_alloc(__IN_USE)
+#   define __arm_2d_pool_statistics_on_enqueue(__DEPTH)
+#endif
+
 /*============================ TYPES =========================================*/
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+typedef struct {
+    atomic_uint_least32_t   wSequence;
+    __arm_2d_sub_task_t     *ptTask;
+} __arm_2d_lock_free_cell_t;
+#endif
+
 /*============================ GLOBAL VARIABLES ==============================*/
 /*============================ PROTOTYPES ====================================*/
 /*============================ LOCAL VARIABLES ===============================*/
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+/*! \note the sub-task pool is a Treiber stack: the head keeps the index (plus 
+ *!       one) of the top node in the lower 16 bits and an ABA tag in the upper
+ *!       16 bits. The FIFO is a bounded MPMC ring. As there are never more 
+ *!       sub-tasks than the capacity, the FIFO never overflows.
+ */
+static struct {
+    __arm_2d_sub_task_t         *ptPool;
+    uint16_t                    hwPoolSize;
+
+    atomic_uint_least32_t       wFreeListHead;
+    atomic_uint_least16_t       hwFreeNext[__ARM_2D_LOCK_FREE_CAPACITY];
+    atomic_uint_least16_t       hwFreeCount;
+    atomic_uint_least16_t       hwBookCount;
+
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ == 1
+    struct {
+        __arm_2d_lock_free_cell_t   tCells[__ARM_2D_LOCK_FREE_CAPACITY];
+        atomic_uint_least32_t       wEnqueue;
+        atomic_uint_least32_t       wDequeue;
+    } FIFO;
+#endif
+} s_tLockFree;
+#endif
+
+#if __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+#   if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+static struct {
+    atomic_uint_least32_t   wPoolAccess;
+    atomic_uint_least32_t   wPoolRetry;
+    atomic_uint_least32_t   wFIFOAccess;
+    atomic_uint_least32_t   wFIFORetry;
+    atomic_uint_least32_t   wLockBusy;
+} s_tContention;
+#   else
+static arm_2d_async_contention_t s_tContention;
+#   endif
+#endif
+
+#if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+#   if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+static struct {
+    atomic_uint_least16_t   hwHighWaterMark;
+    atomic_uint_least16_t   hwFIFOMaxDepth;
+    atomic_uint_least32_t   wBookingFailure;
+    atomic_uint_least32_t   wFIFODepthSum;
+    atomic_uint_least32_t   wFIFOSampleCount;
+} s_tPoolStatistics;
+#   else
+static struct {
+    uint16_t                hwPoolSize;
+    uint16_t                hwHighWaterMark;
+    uint16_t                hwFIFOMaxDepth;
+    uint16_t                                : 16;
+    uint32_t                wBookingFailure;
+    uint32_t                wFIFODepthSum;
+    uint32_t                wFIFOSampleCount;
+} s_tPoolStatistics;
+#   endif
+#endif
+
+#if __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+/*! \note the arena is only accessed inside the critical section */
+static struct {
+    uint8_t                 *pchArena;
+    size_t                  tSize;
+    uint16_t                hwGrowCount;
+} s_tPoolArena;
+#endif
 /*============================ IMPLEMENTATION ================================*/
 
 /*----------------------------------------------------------------------------*
  * Subtask Pool                                                               *
  *----------------------------------------------------------------------------*/
 
+#if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+#   if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+static void __arm_2d_pool_statistics_update_max(atomic_uint_least16_t *phwMax,
+                                                uint_fast16_t hwValue)
+{
+    uint_least16_t hwMax = atomic_load_explicit(phwMax, memory_order_relaxed);
+
+    while (hwValue > hwMax) {
+        if (atomic_compare_exchange_weak_explicit(  phwMax, 
+                                                    &hwMax, 
+                                                    hwValue,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed)) {
+            break;
+        }
+    }
+}
+
+static void __arm_2d_pool_statistics_on_alloc(uint_fast16_t hwInUse)
+{
+    __arm_2d_pool_statistics_update_max(&s_tPoolStatistics.hwHighWaterMark, 
+                                        hwInUse);
+}
+
+static void __arm_2d_pool_statistics_on_enqueue(uint_fast16_t hwDepth)
+{
+    __arm_2d_pool_statistics_update_max(&s_tPoolStatistics.hwFIFOMaxDepth, 
+                                        hwDepth);
+    atomic_fetch_add_explicit(  &s_tPoolStatistics.wFIFODepthSum, 
+                                hwDepth, 
+                                memory_order_relaxed);
+    atomic_fetch_add_explicit(  &s_tPoolStatistics.wFIFOSampleCount, 
+                                1, 
+                                memory_order_relaxed);
+}
+#   else
+/*! \note this function should be called inside the critical section */
+static void __arm_2d_pool_statistics_on_alloc(uint_fast16_t hwInUse)
+{
+    s_tPoolStatistics.hwHighWaterMark 
+        = MAX(s_tPoolStatistics.hwHighWaterMark, hwInUse);
+}
+
+/*! \note this function should be called inside the critical section */
+static void __arm_2d_pool_statistics_on_enqueue(uint_fast16_t hwDepth)
+{
+    s_tPoolStatistics.hwFIFOMaxDepth 
+        = MAX(s_tPoolStatistics.hwFIFOMaxDepth, hwDepth);
+    s_tPoolStatistics.wFIFODepthSum += hwDepth;
+    s_tPoolStatistics.wFIFOSampleCount++;
+}
+#   endif
+#endif
+
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+/*! \brief remove a sub-task from the in-flight list
+ *! \note this function should be called inside the critical section
+ */
+static void __arm_2d_sub_task_leave_in_flight_list(__arm_2d_sub_task_t *ptTask)
+{
+    if (!ptTask->bInFlight) {
+        return ;
+    }
+    ptTask->bInFlight = false;
+
+    if (NULL == ptTask->ptNewerInFlight) {
+        ARM_2D_CTRL.InFlight.ptNewest = ptTask->ptOlderInFlight;
+    } else {
+        ptTask->ptNewerInFlight->ptOlderInFlight = ptTask->ptOlderInFlight;
+    }
+
+    if (NULL == ptTask->ptOlderInFlight) {
+        ARM_2D_CTRL.InFlight.ptOldest = ptTask->ptNewerInFlight;
+    } else {
+        ptTask->ptOlderInFlight->ptNewerInFlight = ptTask->ptNewerInFlight;
+    }
+}
+#endif
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+
+/*! \brief book sub-tasks when there are enough unbooked free ones
+ *! \note  checking the free count and booking are done in one CAS, hence
+ *!        no critical section is required
+ */
+static bool __arm_2d_sub_task_try_booking(uint_fast16_t hwCount)
+{
+    uint_least16_t hwBookCount = atomic_load(&s_tLockFree.hwBookCount);
+
+    do {
+        uint_fast16_t hwFreeCount = atomic_load(&s_tLockFree.hwFreeCount);
+        if (hwFreeCount < (uint_fast16_t)hwBookCount + hwCount) {
+            return false;
+        }
+    } while(!atomic_compare_exchange_weak(  &s_tLockFree.hwBookCount,
+                                            &hwBookCount,
+                                            hwBookCount + hwCount));
+
+    return true;
+}
+
+static void __arm_2d_sub_task_cancel_booking(void)
+{
+    atomic_store(&s_tLockFree.hwBookCount, 0);
+}
+
+static
+__arm_2d_sub_task_t *__arm_2d_sub_task_new(void)
+{
+    uint32_t wHead = atomic_load_explicit(  &s_tLockFree.wFreeListHead, 
+                                            memory_order_acquire);
+    uint_fast16_t hwIndex;
+
+    do {
+        hwIndex = wHead & 0xFFFF;
+        if (0 == hwIndex) {
+            return NULL;
+        }
+
+        uint32_t wNewHead 
+            = ((wHead + 0x10000) & 0xFFFF0000)
+            | atomic_load_explicit( &s_tLockFree.hwFreeNext[hwIndex - 1],
+                                    memory_order_relaxed);
+
+        if (atomic_compare_exchange_weak_explicit(  
+                                            &s_tLockFree.wFreeListHead,
+                                            &wHead,
+                                            wNewHead,
+                                            memory_order_acq_rel,
+                                            memory_order_acquire)) {
+            break;
+        }
+        __arm_2d_contention_inc(wPoolRetry);
+    } while(true);
+
+    __arm_2d_contention_inc(wPoolAccess);
+    atomic_fetch_sub(&s_tLockFree.hwFreeCount, 1);
+    __arm_2d_pool_statistics_on_alloc(  s_tLockFree.hwPoolSize 
+                                     -  atomic_load(&s_tLockFree.hwFreeCount));
+
+    /* consume one booked sub-task if there is any */
+    uint_least16_t hwBookCount = atomic_load(&s_tLockFree.hwBookCount);
+    while (hwBookCount > 0) {
+        if (atomic_compare_exchange_weak(   &s_tLockFree.hwBookCount,
+                                            &hwBookCount,
+                                            hwBookCount - 1)) {
+            break;
+        }
+    }
+
+    __arm_2d_sub_task_t *ptTask = &s_tLockFree.ptPool[hwIndex - 1];
+    memset(ptTask, 0 ,sizeof(__arm_2d_sub_task_t));
+    
+    return ptTask;
+}
+
+static 
+void __arm_2d_sub_task_free(__arm_2d_sub_task_t *ptTask)
+{
+    if (NULL == ptTask) {
+        return ;
+    }
+
+    assert(ptTask >= s_tLockFree.ptPool);
+    assert(ptTask < s_tLockFree.ptPool + s_tLockFree.hwPoolSize);
+
+    uint_fast16_t hwIndex = (uint_fast16_t)(ptTask - s_tLockFree.ptPool) + 1;
+    uint32_t wHead = atomic_load_explicit(  &s_tLockFree.wFreeListHead,
+                                            memory_order_relaxed);
+    do {
+        atomic_store_explicit(  &s_tLockFree.hwFreeNext[hwIndex - 1],
+                                wHead & 0xFFFF,
+                                memory_order_relaxed);
+
+        uint32_t wNewHead = ((wHead + 0x10000) & 0xFFFF0000) | hwIndex;
+
+        if (atomic_compare_exchange_weak_explicit(  
+                                            &s_tLockFree.wFreeListHead,
+                                            &wHead,
+                                            wNewHead,
+                                            memory_order_release,
+                                            memory_order_relaxed)) {
+            break;
+        }
+        __arm_2d_contention_inc(wPoolRetry);
+    } while(true);
+
+    __arm_2d_contention_inc(wPoolAccess);
+    atomic_fetch_add(&s_tLockFree.hwFreeCount, 1);
+}
+
+#else
+
 static void __arm_2d_sub_task_booking(uint_fast16_t hwCount)
 {
-    arm_irq_safe {
+    __arm_2d_async_safe {
         ARM_2D_CTRL.hwBookCount += hwCount;
     }
 }
 
 static void __arm_2d_sub_task_cancel_booking(void)
 {
-    arm_irq_safe {
+    __arm_2d_async_safe {
         ARM_2D_CTRL.hwBookCount = 0;
     }
 }
@@ -105,7 +441,7 @@ static uint_fast16_t __arm_2d_sub_task_available_count(void)
 {
     uint_fast16_t hwResult = 0;
     
-    arm_irq_safe {
+    __arm_2d_async_safe {
         hwResult = ARM_2D_CTRL.hwFreeCount;
         hwResult = (hwResult > ARM_2D_CTRL.hwBookCount)
                     ?   hwResult - ARM_2D_CTRL.hwBookCount
@@ -120,7 +456,7 @@ __arm_2d_sub_task_t *__arm_2d_sub_task_new(void)
 {
     __arm_2d_sub_task_t *ptTask = NULL;
     
-    arm_irq_safe {    
+    __arm_2d_async_safe {    
         if (NULL != ARM_2D_CTRL.ptFreeList) {
             ARM_LIST_STACK_POP(ARM_2D_CTRL.ptFreeList, ptTask);
             if (ARM_2D_CTRL.hwBookCount) {
@@ -128,6 +464,9 @@ __arm_2d_sub_task_t *__arm_2d_sub_task_new(void)
             }
             
             ARM_2D_CTRL.hwFreeCount--;
+            __arm_2d_contention_inc(wPoolAccess);
+            __arm_2d_pool_statistics_on_alloc(  s_tPoolStatistics.hwPoolSize
+                                             -  ARM_2D_CTRL.hwFreeCount);
         }
     }
     
@@ -143,15 +482,421 @@ void __arm_2d_sub_task_free(__arm_2d_sub_task_t *ptTask)
         return ;
     }
     
-    arm_irq_safe {
+    __arm_2d_async_safe {
         ARM_LIST_STACK_PUSH(ARM_2D_CTRL.ptFreeList, ptTask);
         ARM_2D_CTRL.hwFreeCount++;
+        __arm_2d_contention_inc(wPoolAccess);
     }
 }
 
+#if __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+/*! \brief add sub-tasks taken from the arena to the pool
+ *! \param hwCount the number of sub-tasks required
+ *! \return uint_fast16_t the number of sub-tasks added
+ *! \note this function should be called inside the critical section
+ */
+static uint_fast16_t __arm_2d_sub_task_pool_grow(uint_fast16_t hwCount)
+{
+    uint_fast16_t hwAdded = 0;
+
+    while(      (hwAdded < hwCount) 
+            &&  (s_tPoolArena.tSize >= sizeof(__arm_2d_sub_task_t))) {
+        __arm_2d_sub_task_t *ptTask = (__arm_2d_sub_task_t *)s_tPoolArena.pchArena;
+
+        s_tPoolArena.pchArena += sizeof(__arm_2d_sub_task_t);
+        s_tPoolArena.tSize -= sizeof(__arm_2d_sub_task_t);
+
+        ARM_LIST_STACK_PUSH(ARM_2D_CTRL.ptFreeList, ptTask);
+        ARM_2D_CTRL.hwFreeCount++;
+        hwAdded++;
+    }
+
+    s_tPoolArena.hwGrowCount += hwAdded;
+#if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+    s_tPoolStatistics.hwPoolSize += hwAdded;
+#endif
+
+    return hwAdded;
+}
+#endif
+#endif
+
 /*----------------------------------------------------------------------------*
  * Subtask FIFO                                                               *
  *----------------------------------------------------------------------------*/
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+__WEAK 
+void arm_2d_notif_sub_task_fifo_task_arrive(void)
+{
+}
+
+/*! \brief record the tiles a sub-task writes and reads, so workers can tell 
+ *!        whether two sub-tasks are safe to run in parallel
+ */
+static 
+void __arm_2d_sub_task_set_footprint(   __arm_2d_sub_task_t *ptTask,
+                                        __arm_2d_tile_param_t *ptTarget,
+                                        __arm_2d_tile_param_t *ptRead0,
+                                        __arm_2d_tile_param_t *ptRead1,
+                                        __arm_2d_tile_param_t *ptRead2,
+                                        __arm_2d_tile_param_t *ptRead3)
+{
+    ptTask->ptTargetParam = ptTarget;
+    ptTask->ptReadParam[0] = ptRead0;
+    ptTask->ptReadParam[1] = ptRead1;
+    ptTask->ptReadParam[2] = ptRead2;
+    ptTask->ptReadParam[3] = ptRead3;
+}
+
+/*! \brief describe the source tile read by the backend of an OP directly,
+ *!        i.e. an arm_2d_op_src_t with bBackendReadsSource, as a footprint
+ *! \return __arm_2d_tile_param_t* the footprint, NULL means none
+ */
+static 
+__arm_2d_tile_param_t *__arm_2d_sub_task_get_backend_source(
+                                                    __arm_2d_sub_task_t *ptTask)
+{
+    const __arm_2d_op_info_t *ptInfo = ptTask->ptOP->ptOp;
+
+    if (!ptInfo->Info.Param.bBackendReadsSource) {
+        return NULL;
+    }
+
+    const arm_2d_tile_t *ptSource 
+        = ((arm_2d_op_src_t *)ptTask->ptOP)->Source.ptTile;
+    arm_2d_region_t tValidRegion;
+    const arm_2d_tile_t *ptRoot = arm_2d_tile_get_root( ptSource, 
+                                                        &tValidRegion, 
+                                                        NULL);
+    if ((NULL == ptRoot) || (NULL == ptRoot->pchBuffer)) {
+        return NULL;
+    }
+
+    __arm_2d_tile_param_t *ptParam = &ptTask->tBackendSource;
+    uint_fast8_t chBits = _BV(ptInfo->Info.Colour.u3ColourSZ);
+
+    /* root tile can have offset location */
+    int32_t nOffset = (int32_t)ptRoot->tRegion.tSize.iWidth 
+                    * (tValidRegion.tLocation.iY - ptRoot->tRegion.tLocation.iY)
+                    + (tValidRegion.tLocation.iX - ptRoot->tRegion.tLocation.iX);
+
+    *ptParam = (__arm_2d_tile_param_t) {
+        .pBuffer = ptRoot->pchBuffer + (nOffset * (int32_t)chBits >> 3),
+        .iStride = ptRoot->tRegion.tSize.iWidth,
+        .tColour = ptInfo->Info.Colour,
+        .tValidRegion = tValidRegion,
+    };
+
+    return ptParam;
+}
+
+/*! \brief get the pixel size of a tile parameter
+ *! \param chBytes bytes per pixel, 0 means unknown
+ *! \note  when the pixel size is unknown, it is derived from the colour info,
+ *!        and the largest pixel size is used when it is also unknown.
+ */
+static 
+uint_fast8_t __arm_2d_tile_param_get_pixel_size(
+                                        const __arm_2d_tile_param_t *ptParam,
+                                        uint_fast8_t chBytes)
+{
+    if (0 != chBytes) {
+        return chBytes;
+    }
+
+    uint_fast8_t chColourSZ = ptParam->tColour.u3ColourSZ;
+    if (chColourSZ >= ARM_2D_COLOUR_SZ_8BIT) {
+        return _BV(chColourSZ) >> 3;
+    }
+
+    /* a zero colour scheme might be unknown, assume the largest pixel */
+    return (0 == ptParam->tColour.chScheme) ? 4 : 1;
+}
+
+/*! \brief check whether two tile parameters touch the same memory
+ *! \param chBytes bytes per pixel, 0 means unknown (use a conservative guess)
+ *! \note  when both parameters describe targets with the same pixel size and 
+ *!        stride, they are compared as rectangles, otherwise the comparison is
+ *!        done with conservative address ranges.
+ */
+static 
+bool __arm_2d_tile_param_overlap(   const __arm_2d_tile_param_t *ptA,
+                                    uint_fast8_t chBytesA,
+                                    const __arm_2d_tile_param_t *ptB,
+                                    uint_fast8_t chBytesB)
+{
+    if (    (NULL == ptA) || (NULL == ptB)
+        ||  ptA->bInvalid || ptB->bInvalid
+        ||  (NULL == ptA->pBuffer) || (NULL == ptB->pBuffer)) {
+        return false;
+    }
+
+    bool bPrecise = (chBytesA == chBytesB) && (0 != chBytesA);
+    chBytesA = __arm_2d_tile_param_get_pixel_size(ptA, chBytesA);
+    chBytesB = __arm_2d_tile_param_get_pixel_size(ptB, chBytesB);
+
+    intptr_t nRowA = (intptr_t)ptA->iStride * (intptr_t)chBytesA;
+    intptr_t nRowB = (intptr_t)ptB->iStride * (intptr_t)chBytesB;
+
+    uintptr_t nStartA = (uintptr_t)ptA->pBuffer;
+    uintptr_t nStartB = (uintptr_t)ptB->pBuffer;
+    uintptr_t nEndA = nStartA 
+                    + (uintptr_t)(  (ptA->tValidRegion.tSize.iHeight - 1) * nRowA
+                                 +  ptA->tValidRegion.tSize.iWidth * chBytesA);
+    uintptr_t nEndB = nStartB 
+                    + (uintptr_t)(  (ptB->tValidRegion.tSize.iHeight - 1) * nRowB
+                                 +  ptB->tValidRegion.tSize.iWidth * chBytesB);
+
+    if ((nEndA <= nStartB) || (nEndB <= nStartA)) {
+        return false;
+    }
+
+    if (!bPrecise || (nRowA != nRowB) || (nRowA <= 0)) {
+        return true;
+    }
+
+    /* both tiles live in the same buffer, compare them as rectangles */
+    intptr_t nDelta = (intptr_t)(nStartB - nStartA);
+    intptr_t nY = nDelta / nRowA;
+    intptr_t nRemain = nDelta - nY * nRowA;
+    if (nRemain < 0) {
+        nY--;
+        nRemain += nRowA;
+    }
+    if (0 != (nRemain % (intptr_t)chBytesA)) {
+        return true;
+    }
+
+    arm_2d_region_t tRegionA = {
+        .tSize = ptA->tValidRegion.tSize,
+    };
+    arm_2d_region_t tRegionB = {
+        .tLocation = {
+            .iX = (int16_t)(nRemain / (intptr_t)chBytesA),
+            .iY = (int16_t)nY,
+        },
+        .tSize = ptB->tValidRegion.tSize,
+    };
+
+    if (arm_2d_region_intersect(&tRegionA, &tRegionB, NULL)) {
+        return true;
+    }
+
+    /* the address delta cannot tell whether B starts on the right of A in the 
+     * row nY, or on the left of A in the row nY + 1 
+     */
+    tRegionB.tLocation.iX -= ptA->iStride;
+    tRegionB.tLocation.iY += 1;
+
+    return arm_2d_region_intersect(&tRegionA, &tRegionB, NULL);
+}
+
+static 
+uint_fast8_t __arm_2d_sub_task_get_target_pixel_size(__arm_2d_sub_task_t *ptTask)
+{
+    uint_fast8_t chBits = _BV(ptTask->ptOP->ptOp->Info.Colour.u3ColourSZ);
+    
+    /* sub-byte pixels are always compared conservatively */
+    return (chBits >= 8) ? (chBits >> 3) : 0;
+}
+
+/*! \brief check whether the sub-task ptLater has to wait for ptEarlier */
+static 
+bool __arm_2d_sub_task_depends_on( __arm_2d_sub_task_t *ptLater,
+                                    __arm_2d_sub_task_t *ptEarlier)
+{
+    uint_fast8_t chLaterBytes = __arm_2d_sub_task_get_target_pixel_size(ptLater);
+    uint_fast8_t chEarlierBytes = __arm_2d_sub_task_get_target_pixel_size(ptEarlier);
+
+    /* write after write */
+    if (__arm_2d_tile_param_overlap(ptLater->ptTargetParam, chLaterBytes,
+                                    ptEarlier->ptTargetParam, chEarlierBytes)) {
+        return true;
+    }
+
+    /* read after write and write after read */
+    for (uint_fast8_t n = 0; n < dimof(ptLater->ptReadParam); n++) {
+        if (__arm_2d_tile_param_overlap(ptLater->ptReadParam[n], 0,
+                                        ptEarlier->ptTargetParam, 0)) {
+            return true;
+        }
+        if (__arm_2d_tile_param_overlap(ptLater->ptTargetParam, 0,
+                                        ptEarlier->ptReadParam[n], 0)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*! \brief find the earlier in-flight sub-tasks the new sub-task depends on
+ *! \note  the dependencies are resolved once when the sub-task is issued, 
+ *!        hence taking a sub-task only checks the recorded ones. When there
+ *!        are more dependencies than WaitFor[] can hold, the sub-task waits 
+ *!        for all earlier sub-tasks instead.
+ *! \note  this function should be called inside the critical section
+ */
+static 
+void __arm_2d_sub_task_resolve_dependencies(__arm_2d_sub_task_t *ptTask)
+{
+    __arm_2d_sub_task_t *ptEarlier = ARM_2D_CTRL.InFlight.ptNewest;
+
+    ptTask->chWaitCount = 0;
+    ptTask->bWaitForAll = false;
+
+    while(NULL != ptEarlier) {
+        if (__arm_2d_sub_task_depends_on(ptTask, ptEarlier)) {
+            if (ptTask->chWaitCount >= dimof(ptTask->WaitFor)) {
+                ptTask->bWaitForAll = true;
+                break;
+            }
+
+            ptTask->WaitFor[ptTask->chWaitCount].ptTask = ptEarlier;
+            ptTask->WaitFor[ptTask->chWaitCount].wSequence = ptEarlier->wSequence;
+            ptTask->chWaitCount++;
+
+            if (ptEarlier->bWaitForAll) {
+                /* ptEarlier only completes after all sub-tasks before it */
+                break;
+            }
+        }
+        ptEarlier = ptEarlier->ptOlderInFlight;
+    }
+}
+
+/*! \note this function should be called inside the critical section */
+static 
+bool __arm_2d_sub_task_is_runnable(__arm_2d_sub_task_t *ptTask)
+{
+    if (ptTask->bWaitForAll) {
+        /* all earlier sub-tasks are completed */
+        return (ARM_2D_CTRL.InFlight.ptOldest == ptTask);
+    }
+
+    while(ptTask->chWaitCount > 0) {
+        uint_fast8_t chIndex = ptTask->chWaitCount - 1;
+        __arm_2d_sub_task_t *ptEarlier = ptTask->WaitFor[chIndex].ptTask;
+
+        /* a completed sub-task is either freed or reused with a new sequence */
+        if (    ptEarlier->bInFlight 
+            &&  (ptEarlier->wSequence == ptTask->WaitFor[chIndex].wSequence)) {
+            return false;
+        }
+
+        /* drop the resolved dependency */
+        ptTask->chWaitCount--;
+    }
+
+    return true;
+}
+
+/*! \brief take a runnable sub-task from a given worker queue
+ *! \param bSteal false: take the first runnable one (owner side), 
+ *!               true: take the last runnable one (thief side)
+ *! \note this function should be called inside the critical section
+ */
+static 
+__arm_2d_sub_task_t *__arm_2d_sub_task_take(uint_fast8_t chQueue, bool bSteal)
+{
+    __arm_2d_sub_task_t *ptPrevious = NULL;
+    __arm_2d_sub_task_t *ptNode = ARM_2D_CTRL.TaskFIFO[chQueue].ptHead;
+    __arm_2d_sub_task_t *ptFound = NULL;
+    __arm_2d_sub_task_t *ptFoundPrevious = NULL;
+
+    while(NULL != ptNode) {
+        if (__arm_2d_sub_task_is_runnable(ptNode)) {
+            ptFound = ptNode;
+            ptFoundPrevious = ptPrevious;
+            if (!bSteal) {
+                break;
+            }
+        }
+        ptPrevious = ptNode;
+        ptNode = ptNode->ptNext;
+    }
+
+    if (NULL != ptFound) {
+        if (NULL == ptFoundPrevious) {
+            ARM_2D_CTRL.TaskFIFO[chQueue].ptHead = ptFound->ptNext;
+        } else {
+            ptFoundPrevious->ptNext = ptFound->ptNext;
+        }
+        if (ARM_2D_CTRL.TaskFIFO[chQueue].ptTail == ptFound) {
+            ARM_2D_CTRL.TaskFIFO[chQueue].ptTail = ptFoundPrevious;
+        }
+        ptFound->ptNext = NULL;
+    }
+
+    return ptFound;
+}
+
+static 
+void __arm_2d_sub_task_add(__arm_2d_sub_task_t *ptTask)
+{
+    assert(NULL != ptTask);
+    
+    __arm_2d_async_safe {
+        uint_fast8_t chWorker = ARM_2D_CTRL.chNextWorker;
+        ARM_2D_CTRL.chNextWorker = (chWorker + 1) % __ARM_2D_CFG_ASYNC_WORKER_COUNT__;
+
+        __arm_2d_sub_task_resolve_dependencies(ptTask);
+
+        ptTask->wSequence = ARM_2D_CTRL.wSequence++;
+        ptTask->bInFlight = true;
+        ptTask->ptOlderInFlight = ARM_2D_CTRL.InFlight.ptNewest;
+        ptTask->ptNewerInFlight = NULL;
+        if (NULL == ARM_2D_CTRL.InFlight.ptNewest) {
+            ARM_2D_CTRL.InFlight.ptOldest = ptTask;
+        } else {
+            ARM_2D_CTRL.InFlight.ptNewest->ptNewerInFlight = ptTask;
+        }
+        ARM_2D_CTRL.InFlight.ptNewest = ptTask;
+
+        ARM_LIST_QUEUE_ENQUEUE( ARM_2D_CTRL.TaskFIFO[chWorker].ptHead, 
+                                ARM_2D_CTRL.TaskFIFO[chWorker].ptTail,
+                                ptTask);
+        ARM_2D_CTRL.hwTaskCount++;
+        assert(ptTask->ptOP->Status.u4SubTaskCount < __ARM_2D_OP_SUB_TASK_COUNT_MAX);
+        ptTask->ptOP->Status.u4SubTaskCount++;
+        __arm_2d_contention_inc(wFIFOAccess);
+        __arm_2d_pool_statistics_on_enqueue(ARM_2D_CTRL.hwTaskCount);
+    }
+
+    arm_2d_notif_sub_task_fifo_task_arrive();
+}
+
+static 
+__arm_2d_sub_task_t * __arm_2d_sub_task_fetch(uint_fast8_t chWorkerID)
+{
+    __arm_2d_sub_task_t *ptTask = NULL;
+
+    chWorkerID %= __ARM_2D_CFG_ASYNC_WORKER_COUNT__;
+    
+    __arm_2d_async_safe {
+        if (0 == ARM_2D_CTRL.hwTaskCount) {
+            continue;
+        }
+        
+        /* try the local queue first and steal from others if it is empty */
+        uint_fast8_t chQueue = chWorkerID;
+        do {
+            ptTask = __arm_2d_sub_task_take(chQueue, chQueue != chWorkerID);
+            if (NULL != ptTask) {
+                ARM_2D_CTRL.hwTaskCount--;
+                __arm_2d_contention_inc(wFIFOAccess);
+                break;
+            }
+            chQueue = (chQueue + 1) % __ARM_2D_CFG_ASYNC_WORKER_COUNT__;
+        } while(chQueue != chWorkerID);
+    }
+    
+    return ptTask;
+}
+
+#else
+
+#define __arm_2d_sub_task_set_footprint(...)
+
 #if 0
 __WEAK 
 void arm_2d_notif_sub_task_fifo_task_arrive(void)
@@ -159,18 +904,115 @@ void arm_2d_notif_sub_task_fifo_task_arrive(void)
 }
 #endif
 
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+static 
+void __arm_2d_sub_task_add(__arm_2d_sub_task_t *ptTask)
+{
+    assert(NULL != ptTask);
+
+    /* the OP status is shared with the completion side (e.g. an ISR) */
+    __arm_2d_async_safe {
+        assert(ptTask->ptOP->Status.u4SubTaskCount < __ARM_2D_OP_SUB_TASK_COUNT_MAX);
+        ptTask->ptOP->Status.u4SubTaskCount++;
+    }
+
+    uint32_t wPosition = atomic_load_explicit(  &s_tLockFree.FIFO.wEnqueue,
+                                                memory_order_relaxed);
+    __arm_2d_lock_free_cell_t *ptCell;
+    do {
+        ptCell = &s_tLockFree.FIFO.tCells[  wPosition 
+                                        &   (__ARM_2D_LOCK_FREE_CAPACITY - 1)];
+        uint32_t wSequence = atomic_load_explicit(  &ptCell->wSequence, 
+                                                    memory_order_acquire);
+        int32_t nDiff = (int32_t)(wSequence - wPosition);
+
+        /* the FIFO is never full as it is larger than the sub-task pool */
+        assert(nDiff >= 0);
+
+        if (0 == nDiff) {
+            if (atomic_compare_exchange_weak_explicit(  
+                                            &s_tLockFree.FIFO.wEnqueue,
+                                            &wPosition,
+                                            wPosition + 1,
+                                            memory_order_relaxed,
+                                            memory_order_relaxed)) {
+                break;
+            }
+        } else {
+            wPosition = atomic_load_explicit(   &s_tLockFree.FIFO.wEnqueue,
+                                                memory_order_relaxed);
+        }
+        __arm_2d_contention_inc(wFIFORetry);
+    } while(true);
+
+    ptCell->ptTask = ptTask;
+    atomic_store_explicit(&ptCell->wSequence, wPosition + 1, memory_order_release);
+
+    __arm_2d_contention_inc(wFIFOAccess);
+    __arm_2d_pool_statistics_on_enqueue(
+            (uint16_t)( wPosition + 1 
+                      - atomic_load_explicit(   &s_tLockFree.FIFO.wDequeue,
+                                                memory_order_relaxed)));
+}
+
+static 
+__arm_2d_sub_task_t * __arm_2d_sub_task_fetch(void)
+{
+    uint32_t wPosition = atomic_load_explicit(  &s_tLockFree.FIFO.wDequeue,
+                                                memory_order_relaxed);
+    __arm_2d_lock_free_cell_t *ptCell;
+    do {
+        ptCell = &s_tLockFree.FIFO.tCells[  wPosition 
+                                        &   (__ARM_2D_LOCK_FREE_CAPACITY - 1)];
+        uint32_t wSequence = atomic_load_explicit(  &ptCell->wSequence, 
+                                                    memory_order_acquire);
+        int32_t nDiff = (int32_t)(wSequence - (wPosition + 1));
+
+        if (nDiff < 0) {
+            /* the FIFO is empty */
+            return NULL;
+        } else if (0 == nDiff) {
+            if (atomic_compare_exchange_weak_explicit(  
+                                            &s_tLockFree.FIFO.wDequeue,
+                                            &wPosition,
+                                            wPosition + 1,
+                                            memory_order_relaxed,
+                                            memory_order_relaxed)) {
+                break;
+            }
+        } else {
+            wPosition = atomic_load_explicit(   &s_tLockFree.FIFO.wDequeue,
+                                                memory_order_relaxed);
+        }
+        __arm_2d_contention_inc(wFIFORetry);
+    } while(true);
+
+    __arm_2d_sub_task_t *ptTask = ptCell->ptTask;
+    atomic_store_explicit(  &ptCell->wSequence, 
+                            wPosition + __ARM_2D_LOCK_FREE_CAPACITY, 
+                            memory_order_release);
+
+    __arm_2d_contention_inc(wFIFOAccess);
+
+    return ptTask;
+}
+#else
 static 
 void __arm_2d_sub_task_add(__arm_2d_sub_task_t *ptTask)
 {
     assert(NULL != ptTask);
     //bool bIsEmpty = false;
-    arm_irq_safe {
+    __arm_2d_async_safe {
         //bIsEmpty = (0 == ARM_2D_CTRL.hwTaskCount);
         
         ARM_LIST_QUEUE_ENQUEUE( ARM_2D_CTRL.TaskFIFO.ptHead, 
                                 ARM_2D_CTRL.TaskFIFO.ptTail,
                                 ptTask);
         ARM_2D_CTRL.hwTaskCount++;
+        assert(ptTask->ptOP->Status.u4SubTaskCount < __ARM_2D_OP_SUB_TASK_COUNT_MAX);
+        ptTask->ptOP->Status.u4SubTaskCount++;
+        __arm_2d_contention_inc(wFIFOAccess);
+        __arm_2d_pool_statistics_on_enqueue(ARM_2D_CTRL.hwTaskCount);
     }
 #if 0
     if (bIsEmpty) {
@@ -184,18 +1026,20 @@ __arm_2d_sub_task_t * __arm_2d_sub_task_fetch(void)
 {
     __arm_2d_sub_task_t *ptTask = NULL;
     
-    arm_irq_safe {
+    __arm_2d_async_safe {
         if (NULL != ARM_2D_CTRL.TaskFIFO.ptHead) {
             ARM_LIST_QUEUE_DEQUEUE( ARM_2D_CTRL.TaskFIFO.ptHead, 
                                     ARM_2D_CTRL.TaskFIFO.ptTail,
                                     ptTask);
             ARM_2D_CTRL.hwTaskCount--;
+            __arm_2d_contention_inc(wFIFOAccess);
         }
     }
     
     return ptTask;
 }
-
+#endif
+#endif
 
 /*----------------------------------------------------------------------------*
  * Subtask Processing                                                         *
@@ -338,7 +1182,7 @@ static void __arm_2d_notify_op_cpl(arm_2d_op_core_t *ptOP, arm_fsm_rt_t tResult)
         ptOP->Preference.u2ACCMethods = 0;
         
         /*! arm_thread_safe */
-        arm_irq_safe {
+        __arm_2d_async_safe {
             //! only clear busy flag after bOpCpl is set properly.
             ptOP->Status.bIsBusy = false;
             
@@ -367,8 +1211,10 @@ void __arm_2d_notify_sub_task_cpl(  __arm_2d_sub_task_t *ptTask,
     assert(NULL != ptOP);
     assert(ptOP->Status.u4SubTaskCount > 0);
 
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ == 1
     /* free sub task */
     __arm_2d_sub_task_free(ptTask);
+#endif
 
     /* depose resources hold by the sub task */
     __arm_2d_sub_task_depose(ptOP);
@@ -376,10 +1222,39 @@ void __arm_2d_notify_sub_task_cpl(  __arm_2d_sub_task_t *ptTask,
     //if (bFromHW) {
         arm_2d_notif_aync_sub_task_cpl(ptOP->pUserParam);
     //}
-    
+
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+    bool bLastSubTask = false;
+
+    /* the in-flight list is a doubly linked list shared by all workers, 
+     * leaving it shares the critical section with the sub-task counter, so
+     * freeing the sub-task afterwards takes no lock in the lock-free mode
+     */
+    __arm_2d_async_safe {
+        __arm_2d_sub_task_leave_in_flight_list(ptTask);
+
+        if (tResult < 0) {
+            ptOP->tResult = tResult;
+            ptOP->Status.bIOError = true;
+        }
+        ptOP->Status.u4SubTaskCount--;
+        bLastSubTask = (0 == ptOP->Status.u4SubTaskCount);
+    }
+
+    /* free sub task */
+    __arm_2d_sub_task_free(ptTask);
+
+    /* only the one who releases the last sub-task completes the OP */
+    if (bLastSubTask) {
+        __arm_2d_notify_op_cpl(ptOP, tResult);
+    }
+
+    /* sub-tasks waiting for this one might be runnable now */
+    arm_2d_notif_sub_task_fifo_task_arrive();
+#else
     ptOP->Status.u4SubTaskCount--;
     __arm_2d_notify_op_cpl(ptOP, tResult);
-    
+#endif
 }
 
 /*! \note You can override this to add support for new types of interface
@@ -421,6 +1296,9 @@ arm_fsm_rt_t __arm_2d_sub_task_dispatch(__arm_2d_sub_task_t *ptTask)
 static 
 arm_fsm_rt_t __arm_2d_backend_task(arm_2d_task_t *ptThis)
 {
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    int64_t lStart;
+#endif
     
     enum {
         START = 0,
@@ -437,7 +1315,11 @@ arm_fsm_rt_t __arm_2d_backend_task(arm_2d_task_t *ptThis)
         case FETCH:
         
             //! fetch a sub task from FIFO
+        #if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+            this.ptTask = __arm_2d_sub_task_fetch(this.chWorkerID);
+        #else
             this.ptTask = __arm_2d_sub_task_fetch();
+        #endif
             if (NULL == this.ptTask) {
                 __ARM_2D_BACKEND_TASK_RESET_FSM();
                 return arm_fsm_rt_cpl;
@@ -446,11 +1328,29 @@ arm_fsm_rt_t __arm_2d_backend_task(arm_2d_task_t *ptThis)
             //break;
             
         case DISPATCH:
+        #if __ARM_2D_CFG_SUPPORT_PROFILER__
+            lStart = arm_2d_port_get_profiler_timestamp();
+        #endif
 
             //! dispatch sub tasks
             this.tResult = 
                 __arm_2d_sub_task_dispatch((__arm_2d_sub_task_t *)this.ptTask);
 
+        #if __ARM_2D_CFG_SUPPORT_PROFILER__
+            /* record the sub-task here, as only the worker knows its index */
+            __arm_2d_profiler_record(
+                    ((__arm_2d_sub_task_t *)this.ptTask)->ptOP,
+                    ARM_2D_PROFILER_EVT_SUB_TASK,
+            #if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+                    this.chWorkerID,
+            #else
+                    0,
+            #endif
+                    lStart,
+                    __arm_2d_profiler_get_sub_task_pixel_count(
+                                        (__arm_2d_sub_task_t *)this.ptTask));
+        #endif
+
             if (    (arm_fsm_rt_on_going == this.tResult)                       //!< sub task wants to yield
                 ||  (arm_fsm_rt_wait_for_obj == this.tResult)) {                //!< sub task wants to sync-up with applications
                 return this.tResult;
@@ -500,10 +1400,27 @@ arm_fsm_rt_t __arm_2d_frontend_task(arm_2d_task_t *ptThis)
     arm_2d_op_core_t *ptOP = NULL;
     arm_fsm_rt_t tResult;
     
-    arm_irq_safe {
+    __arm_2d_async_safe {
+    #if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+        /* only one worker can decode OPs at a time */
+        if (ARM_2D_CTRL.bFrontendBusy) {
+            continue;
+        }
+    #endif
         ARM_LIST_QUEUE_PEEK(ARM_2D_CTRL.OPFIFO.ptHead, 
                             ARM_2D_CTRL.OPFIFO.ptTail,
                             ptOP);
+    #if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+        if (NULL != ptOP) {
+            ARM_2D_CTRL.bFrontendBusy = true;
+
+            /* hold the OP, so other workers cannot complete it before all of 
+             * its sub-tasks are issued
+             */
+            assert(ptOP->Status.u4SubTaskCount < __ARM_2D_OP_SUB_TASK_COUNT_MAX);
+            ptOP->Status.u4SubTaskCount++;
+        }
+    #endif
     }
     
     if (NULL == ptOP) {
@@ -511,10 +1428,40 @@ arm_fsm_rt_t __arm_2d_frontend_task(arm_2d_task_t *ptThis)
     }
 
     tResult = __arm_2d_op_frontend_op_decoder(ptOP);
+
+#if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+    bool bNoSubTaskLeft = false;
+    __arm_2d_async_safe {
+        if (    (arm_fsm_rt_cpl == tResult) 
+            ||  (arm_fsm_rt_async == tResult)
+            ||  (tResult < 0)) {
+            ARM_LIST_QUEUE_DEQUEUE( ARM_2D_CTRL.OPFIFO.ptHead, 
+                                    ARM_2D_CTRL.OPFIFO.ptTail,
+                                    ptOP);
+        }
+        
+        if (tResult < 0) {
+            ptOP->tResult = tResult;
+            ptOP->Status.bIOError = true;
+        }
+
+        ptOP->Status.u4SubTaskCount--;
+        bNoSubTaskLeft = (0 == ptOP->Status.u4SubTaskCount);
+        ARM_2D_CTRL.bFrontendBusy = false;
+    }
     
+    if (bNoSubTaskLeft) {
+        if ((arm_fsm_rt_cpl == tResult) || (tResult < 0)) {
+            __arm_2d_notify_op_cpl(ptOP, tResult);
+        } else if (arm_fsm_rt_async == tResult) {
+            /* all sub-tasks have already been completed by other workers */
+            __arm_2d_notify_op_cpl(ptOP, arm_fsm_rt_cpl);
+        }
+    }
+#else
     if ((arm_fsm_rt_cpl == tResult) || (tResult < 0)) {
 
-        arm_irq_safe {
+        __arm_2d_async_safe {
             ARM_LIST_QUEUE_DEQUEUE( ARM_2D_CTRL.OPFIFO.ptHead, 
                                     ARM_2D_CTRL.OPFIFO.ptTail,
                                     ptOP);
@@ -522,12 +1469,13 @@ arm_fsm_rt_t __arm_2d_frontend_task(arm_2d_task_t *ptThis)
         ptOP->Status.u4SubTaskCount = 0;
         __arm_2d_notify_op_cpl(ptOP, tResult);
     } else if (arm_fsm_rt_async == tResult) {
-        arm_irq_safe {
+        __arm_2d_async_safe {
             ARM_LIST_QUEUE_DEQUEUE( ARM_2D_CTRL.OPFIFO.ptHead, 
                                     ARM_2D_CTRL.OPFIFO.ptTail,
                                     ptOP);
         }
     }
+#endif
     
     /* release resources here */
     __arm_2d_sub_task_cancel_booking();
@@ -618,7 +1566,7 @@ arm_fsm_rt_t __arm_2d_op_frontend(arm_2d_op_core_t *ptThis)
 {
     bool bEmptyQueue = false;
     arm_fsm_rt_t tResult;
-    arm_irq_safe {
+    __arm_2d_async_safe {
         if (NULL == ARM_2D_CTRL.OPFIFO.ptHead) {
             bEmptyQueue = true;
         }
@@ -643,14 +1591,40 @@ bool __arm_2d_op_ensure_resource(   arm_2d_op_core_t *ptOP,
 {
     bool bResult = false;
     
+    /* the sub-tasks are counted by the 4-bit Status.u4SubTaskCount */
+    assert( ptOP->Status.u4SubTaskCount + hwRequired 
+        <=  __ARM_2D_OP_SUB_TASK_COUNT_MAX);
     ARM_2D_UNUSED(ptOP);
-    
-    arm_irq_safe {
-        bResult = (__arm_2d_sub_task_available_count() >= hwRequired);
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+    bResult = __arm_2d_sub_task_try_booking(hwRequired);
+#   if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+    if (!bResult) {
+        atomic_fetch_add_explicit(  &s_tPoolStatistics.wBookingFailure, 
+                                    1, 
+                                    memory_order_relaxed);
+    }
+#   endif
+#else
+    __arm_2d_async_safe {
+        uint_fast16_t hwAvailable = __arm_2d_sub_task_available_count();
+
+    #if __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+        if (hwAvailable < hwRequired) {
+            hwAvailable += __arm_2d_sub_task_pool_grow(hwRequired - hwAvailable);
+        }
+    #endif
+
+        bResult = (hwAvailable >= hwRequired);
         if (bResult) {
             __arm_2d_sub_task_booking(hwRequired);
+        } else {
+        #if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+            s_tPoolStatistics.wBookingFailure++;
+        #endif
         }
     }
+#endif
 
     return bResult;
 }
@@ -671,8 +1645,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_tile_process(
                     .Param.tTileProcess = *ptParam,
                 };
     
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tTileProcess,
+                                    __arm_2d_sub_task_get_backend_source(ptTask),
+                                    NULL,
+                                    NULL,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
     
     return arm_fsm_rt_async;
@@ -697,8 +1676,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_tile_mask_process(
                     },
                 };
     
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tTileMaskProcess.tTarget,
+                                    &ptTask->Param.tTileMaskProcess.tDesMask,
+                                    NULL,
+                                    NULL,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
     
     return arm_fsm_rt_async;
@@ -722,8 +1706,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_fill(
                     },
                 };
     
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tFill.tTarget,
+                                    &ptTask->Param.tFill.tSource,
+                                    NULL,
+                                    NULL,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
 
     return arm_fsm_rt_async;
@@ -763,8 +1752,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_fill_with_mask(
         ptTask->Param.tFillMask.tDesMask = *ptTargetMask;
     }
     
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tFillMask.tTarget,
+                                    &ptTask->Param.tFillMask.tSource,
+                                    &ptTask->Param.tFillMask.tSrcMask,
+                                    &ptTask->Param.tFillMask.tDesMask,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
 
     return arm_fsm_rt_async;
@@ -791,8 +1785,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_copy(
                         .tCopySize          = *ptCopySize,
                     },
                 };
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tCopy.tTarget,
+                                    &ptTask->Param.tCopy.tSource,
+                                    NULL,
+                                    NULL,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
 
     return arm_fsm_rt_async;
@@ -835,8 +1834,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_copy_with_mask(
         ptTask->Param.tCopyMask.tDesMask = *ptTargetMask;
     }
     
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tCopyMask.tTarget,
+                                    &ptTask->Param.tCopyMask.tSource,
+                                    &ptTask->Param.tCopyMask.tSrcMask,
+                                    &ptTask->Param.tCopyMask.tDesMask,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
 
     return arm_fsm_rt_async;
@@ -865,8 +1869,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_fill_origin(
                     },
                 };
     
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tFillOrig.tTarget,
+                                    &ptTask->Param.tFillOrig.tSource,
+                                    &ptTask->Param.tFillOrig.tOrigin,
+                                    NULL,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
 
     return arm_fsm_rt_async;
@@ -895,8 +1904,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_copy_origin(
                         .tOrigin                = *ptOrigin,
                     },
                 };
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tCopyOrig.tTarget,
+                                    &ptTask->Param.tCopyOrig.tSource,
+                                    &ptTask->Param.tCopyOrig.tOrigin,
+                                    NULL,
+                                    NULL);
+
     __arm_2d_sub_task_add(ptTask);
 
     return arm_fsm_rt_async;
@@ -944,8 +1958,13 @@ arm_fsm_rt_t __arm_2d_issue_sub_task_copy_origin_masks(
         ptTask->Param.tCopyOrigMask.tDesMask = *ptTargetMask;
     }
     
-    OP_CORE.Status.u4SubTaskCount++;
-    
+    __arm_2d_sub_task_set_footprint(ptTask,
+                                    &ptTask->Param.tCopyOrigMask.tTarget,
+                                    &ptTask->Param.tCopyOrigMask.tSource,
+                                    &ptTask->Param.tCopyOrigMask.tOrigin,
+                                    &ptTask->Param.tCopyOrigMask.tOrigMask,
+                                    &ptTask->Param.tCopyOrigMask.tDesMask);
+
     __arm_2d_sub_task_add(ptTask);
 
     return arm_fsm_rt_async;
@@ -967,15 +1986,209 @@ arm_2d_err_t __arm_2d_async_init(   __arm_2d_sub_task_t *ptSubTasks,
         return ARM_2D_ERR_INSUFFICIENT_RESOURCE;
     }
     
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+    assert(hwCount <= __ARM_2D_LOCK_FREE_CAPACITY);
+    hwCount = MIN(hwCount, __ARM_2D_LOCK_FREE_CAPACITY);
+
+    s_tLockFree.ptPool = ptSubTasks;
+    s_tLockFree.hwPoolSize = hwCount;
+
+#   if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ == 1
+    for (uint_fast16_t n = 0; n < __ARM_2D_LOCK_FREE_CAPACITY; n++) {
+        atomic_init(&s_tLockFree.FIFO.tCells[n].wSequence, n);
+    }
+#   endif
+#elif __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+    s_tPoolStatistics.hwPoolSize = hwCount;
+#endif
+
     //! initialise sub task pool
     do {
         __arm_2d_sub_task_free(ptSubTasks++);
     } while(--hwCount);
+
+    /* seeding the pool is not an access worth counting */
+#if __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+    arm_2d_async_reset_contention_counters();
+#endif
+#if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+    arm_2d_async_reset_pool_statistics();
+#endif
     
     return ARM_2D_ERR_NONE;
 }
 
 
+#if __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+/*! 
+ * \brief get a snapshot of the contention counters
+ * \param[out] ptCounters the buffer for the counters
+ */
+void arm_2d_async_get_contention_counters(arm_2d_async_contention_t *ptCounters)
+{
+    assert(NULL != ptCounters);
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+    ptCounters->wPoolAccess = atomic_load(&s_tContention.wPoolAccess);
+    ptCounters->wPoolRetry = atomic_load(&s_tContention.wPoolRetry);
+    ptCounters->wFIFOAccess = atomic_load(&s_tContention.wFIFOAccess);
+    ptCounters->wFIFORetry = atomic_load(&s_tContention.wFIFORetry);
+    ptCounters->wLockBusy = atomic_load(&s_tContention.wLockBusy);
+#else
+    __arm_2d_async_safe {
+        *ptCounters = s_tContention;
+    }
+#endif
+}
+
+/*! 
+ * \brief reset the contention counters
+ */
+void arm_2d_async_reset_contention_counters(void)
+{
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+    atomic_store(&s_tContention.wPoolAccess, 0);
+    atomic_store(&s_tContention.wPoolRetry, 0);
+    atomic_store(&s_tContention.wFIFOAccess, 0);
+    atomic_store(&s_tContention.wFIFORetry, 0);
+    atomic_store(&s_tContention.wLockBusy, 0);
+#else
+    __arm_2d_async_safe {
+        memset(&s_tContention, 0, sizeof(s_tContention));
+    }
+#endif
+}
+
+#   if __ARM_2D_HAS_WORKER_CRITICAL_SECTION__
+void arm_2d_notif_worker_lock_contention(void)
+{
+    __arm_2d_contention_inc(wLockBusy);
+}
+#   endif
+#endif
+
+#if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+/*! 
+ * \brief get a snapshot of the sub-task pool and FIFO statistics
+ * \param[out] ptStatistics the buffer for the statistics
+ */
+void arm_2d_async_get_pool_statistics(
+                                arm_2d_async_pool_statistics_t *ptStatistics)
+{
+    assert(NULL != ptStatistics);
+
+    memset(ptStatistics, 0, sizeof(arm_2d_async_pool_statistics_t));
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+    ptStatistics->hwPoolSize = s_tLockFree.hwPoolSize;
+    ptStatistics->hwInUse = s_tLockFree.hwPoolSize 
+                          - atomic_load(&s_tLockFree.hwFreeCount);
+    ptStatistics->hwHighWaterMark 
+        = atomic_load(&s_tPoolStatistics.hwHighWaterMark);
+    ptStatistics->hwFIFOMaxDepth = atomic_load(&s_tPoolStatistics.hwFIFOMaxDepth);
+    ptStatistics->wBookingFailure = atomic_load(&s_tPoolStatistics.wBookingFailure);
+    ptStatistics->wFIFODepthSum = atomic_load(&s_tPoolStatistics.wFIFODepthSum);
+    ptStatistics->wFIFOSampleCount 
+        = atomic_load(&s_tPoolStatistics.wFIFOSampleCount);
+
+#   if __ARM_2D_CFG_ASYNC_WORKER_COUNT__ == 1
+    ptStatistics->hwFIFODepth 
+        = (uint16_t)(   atomic_load(&s_tLockFree.FIFO.wEnqueue)
+                    -   atomic_load(&s_tLockFree.FIFO.wDequeue));
+#   else
+    __arm_2d_async_safe {
+        ptStatistics->hwFIFODepth = ARM_2D_CTRL.hwTaskCount;
+    }
+#   endif
+#else
+    __arm_2d_async_safe {
+        ptStatistics->hwPoolSize = s_tPoolStatistics.hwPoolSize;
+        ptStatistics->hwInUse = s_tPoolStatistics.hwPoolSize 
+                              - ARM_2D_CTRL.hwFreeCount;
+        ptStatistics->hwHighWaterMark = s_tPoolStatistics.hwHighWaterMark;
+        ptStatistics->hwFIFODepth = ARM_2D_CTRL.hwTaskCount;
+        ptStatistics->hwFIFOMaxDepth = s_tPoolStatistics.hwFIFOMaxDepth;
+        ptStatistics->wBookingFailure = s_tPoolStatistics.wBookingFailure;
+        ptStatistics->wFIFODepthSum = s_tPoolStatistics.wFIFODepthSum;
+        ptStatistics->wFIFOSampleCount = s_tPoolStatistics.wFIFOSampleCount;
+    #if __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+        ptStatistics->hwGrowCount = s_tPoolArena.hwGrowCount;
+    #endif
+    }
+#endif
+}
+
+/*! 
+ * \brief reset the sub-task pool and FIFO statistics
+ */
+void arm_2d_async_reset_pool_statistics(void)
+{
+    arm_2d_async_pool_statistics_t tCurrent;
+    arm_2d_async_get_pool_statistics(&tCurrent);
+
+#if __ARM_2D_CFG_ASYNC_LOCK_FREE__
+    atomic_store(&s_tPoolStatistics.hwHighWaterMark, tCurrent.hwInUse);
+    atomic_store(&s_tPoolStatistics.hwFIFOMaxDepth, tCurrent.hwFIFODepth);
+    atomic_store(&s_tPoolStatistics.wBookingFailure, 0);
+    atomic_store(&s_tPoolStatistics.wFIFODepthSum, 0);
+    atomic_store(&s_tPoolStatistics.wFIFOSampleCount, 0);
+#else
+    __arm_2d_async_safe {
+        s_tPoolStatistics.hwHighWaterMark = tCurrent.hwInUse;
+        s_tPoolStatistics.hwFIFOMaxDepth = tCurrent.hwFIFODepth;
+        s_tPoolStatistics.wBookingFailure = 0;
+        s_tPoolStatistics.wFIFODepthSum = 0;
+        s_tPoolStatistics.wFIFOSampleCount = 0;
+    }
+#endif
+}
+#endif
+
+#if __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+/*! 
+ * \brief set the arena used to grow the sub-task pool on demand
+ * \param[in] pArena the memory of the arena
+ * \param[in] tSize the size of the arena in bytes
+ * \return arm_2d_err_t error code
+ */
+arm_2d_err_t arm_2d_async_set_pool_arena(void *pArena, size_t tSize)
+{
+    uint8_t *pchArena = NULL;
+
+    if (NULL != pArena) {
+        /* align the sub-tasks to 8 bytes */
+        uintptr_t nAddress = ((uintptr_t)pArena + 7) & ~(uintptr_t)7;
+        size_t tPadding = nAddress - (uintptr_t)pArena;
+
+        if (tSize < tPadding + sizeof(__arm_2d_sub_task_t)) {
+            return ARM_2D_ERR_INSUFFICIENT_RESOURCE;
+        }
+
+        pchArena = (uint8_t *)nAddress;
+        tSize -= tPadding;
+    } else {
+        /* remove the arena */
+        tSize = 0;
+    }
+
+    __arm_2d_async_safe {
+        s_tPoolArena.pchArena = pchArena;
+        s_tPoolArena.tSize = tSize;
+    }
+
+    return ARM_2D_ERR_NONE;
+}
+
+/*! 
+ * \brief get the size of a sub-task
+ * \return size_t the size in bytes
+ */
+size_t arm_2d_async_get_sub_task_size(void)
+{
+    return sizeof(__arm_2d_sub_task_t);
+}
+#endif
+
 __WEAK
 bool arm_2d_port_wait_for_async(uintptr_t pUserParam, uintptr_t pSemahpore)
 {
@@ -1025,7 +2238,7 @@ bool __arm_2d_op_acquire(arm_2d_op_core_t *ptOP)
 
     bool bResult = false;
     do {
-        arm_irq_safe {
+        __arm_2d_async_safe {
             bResult = ptStatus->bIsBusy;
             if (!bResult) {
                 this.tResult = arm_fsm_rt_async;
@@ -272,6 +272,372 @@ arm_fsm_rt_t __arm_2d_sw_draw_point(__arm_2d_sub_task_t *ptTask)
 }
 
 
+/*----------------------------------------------------------------------------*
+ * Draw a batch of points with specified colour                               *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_gray8_draw_points(arm_2d_op_drw_pts_t *ptOP,
+                                       const arm_2d_tile_t *ptTarget,
+                                       const arm_2d_location_t *ptPoints,
+                                       uint_fast16_t hwCount,
+                                       uint_fast8_t chColour,
+                                       const uint8_t *pchOpacity,
+                                       uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPoints);
+
+    ARM_2D_IMPL(arm_2d_op_drw_pts_t, ptOP);
+
+    if (0 == chOpacity || 0 == hwCount) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_DRAW_POINTS_C8BIT;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = NULL;            /* clip the batch once */
+    this.chColour = chColour;
+    this.Points.ptLocations = ptPoints;
+    this.Points.pchOpacity = pchOpacity;
+    this.Points.hwCount = hwCount;
+    this.chOpacity = chOpacity;
+    this.bAntiAlias = false;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_gray8_draw_points_aa(arm_2d_op_drw_pts_t *ptOP,
+                                          const arm_2d_tile_t *ptTarget,
+                                          const arm_2d_point_fx_t *ptPoints,
+                                          uint_fast16_t hwCount,
+                                          uint_fast8_t chColour,
+                                          const uint8_t *pchOpacity,
+                                          uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPoints);
+
+    ARM_2D_IMPL(arm_2d_op_drw_pts_t, ptOP);
+
+    if (0 == chOpacity || 0 == hwCount) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_DRAW_POINTS_C8BIT;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = NULL;            /* clip the batch once */
+    this.chColour = chColour;
+    this.Points.ptQ16 = ptPoints;
+    this.Points.pchOpacity = pchOpacity;
+    this.Points.hwCount = hwCount;
+    this.chOpacity = chOpacity;
+    this.bAntiAlias = true;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_rgb565_draw_points(arm_2d_op_drw_pts_t *ptOP,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_location_t *ptPoints,
+                                        uint_fast16_t hwCount,
+                                        uint_fast16_t hwColour,
+                                        const uint8_t *pchOpacity,
+                                        uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPoints);
+
+    ARM_2D_IMPL(arm_2d_op_drw_pts_t, ptOP);
+
+    if (0 == chOpacity || 0 == hwCount) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_DRAW_POINTS_RGB16;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = NULL;            /* clip the batch once */
+    this.hwColour = hwColour;
+    this.Points.ptLocations = ptPoints;
+    this.Points.pchOpacity = pchOpacity;
+    this.Points.hwCount = hwCount;
+    this.chOpacity = chOpacity;
+    this.bAntiAlias = false;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_rgb565_draw_points_aa(arm_2d_op_drw_pts_t *ptOP,
+                                           const arm_2d_tile_t *ptTarget,
+                                           const arm_2d_point_fx_t *ptPoints,
+                                           uint_fast16_t hwCount,
+                                           uint_fast16_t hwColour,
+                                           const uint8_t *pchOpacity,
+                                           uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPoints);
+
+    ARM_2D_IMPL(arm_2d_op_drw_pts_t, ptOP);
+
+    if (0 == chOpacity || 0 == hwCount) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_DRAW_POINTS_RGB16;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = NULL;            /* clip the batch once */
+    this.hwColour = hwColour;
+    this.Points.ptQ16 = ptPoints;
+    this.Points.pchOpacity = pchOpacity;
+    this.Points.hwCount = hwCount;
+    this.chOpacity = chOpacity;
+    this.bAntiAlias = true;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_cccn888_draw_points(arm_2d_op_drw_pts_t *ptOP,
+                                         const arm_2d_tile_t *ptTarget,
+                                         const arm_2d_location_t *ptPoints,
+                                         uint_fast16_t hwCount,
+                                         uint32_t wColour,
+                                         const uint8_t *pchOpacity,
+                                         uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPoints);
+
+    ARM_2D_IMPL(arm_2d_op_drw_pts_t, ptOP);
+
+    if (0 == chOpacity || 0 == hwCount) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_DRAW_POINTS_RGB32;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = NULL;            /* clip the batch once */
+    this.wColour = wColour;
+    this.Points.ptLocations = ptPoints;
+    this.Points.pchOpacity = pchOpacity;
+    this.Points.hwCount = hwCount;
+    this.chOpacity = chOpacity;
+    this.bAntiAlias = false;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+ARM_NONNULL(2,3)
+arm_fsm_rt_t arm_2dp_cccn888_draw_points_aa(arm_2d_op_drw_pts_t *ptOP,
+                                            const arm_2d_tile_t *ptTarget,
+                                            const arm_2d_point_fx_t *ptPoints,
+                                            uint_fast16_t hwCount,
+                                            uint32_t wColour,
+                                            const uint8_t *pchOpacity,
+                                            uint8_t chOpacity)
+{
+    assert(NULL != ptTarget);
+    assert(NULL != ptPoints);
+
+    ARM_2D_IMPL(arm_2d_op_drw_pts_t, ptOP);
+
+    if (0 == chOpacity || 0 == hwCount) {
+        return arm_fsm_rt_cpl;
+    }
+
+    if (!__arm_2d_op_acquire((arm_2d_op_core_t *)ptThis)) {
+        return arm_fsm_rt_on_going;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_DRAW_POINTS_RGB32;
+
+    this.Target.ptTile = ptTarget;
+    this.Target.ptRegion = NULL;            /* clip the batch once */
+    this.wColour = wColour;
+    this.Points.ptQ16 = ptPoints;
+    this.Points.pchOpacity = pchOpacity;
+    this.Points.hwCount = hwCount;
+    this.chOpacity = chOpacity;
+    this.bAntiAlias = true;
+
+    return __arm_2d_op_invoke((arm_2d_op_core_t *)ptThis);
+}
+
+#define __ARM_2D_DRAW_POINTS_PLOT(__INT_TYPE, __BLENDING, __COLOUR_ADDR,        \
+                                  __X, __Y, __OPACITY)                          \
+    do {                                                                        \
+        uint_fast8_t chPlotOpacity = (__OPACITY);                               \
+        if (    (uint32_t)(__X) >= (uint32_t)iWidth                             \
+            ||  (uint32_t)(__Y) >= (uint32_t)iHeight                            \
+            ||  0 == chPlotOpacity) {                                           \
+            break;                                                              \
+        }                                                                       \
+        __INT_TYPE *pTargetPixel = pTarget + (__Y) * iStride + (__X);           \
+        if (255 == chPlotOpacity) {                                             \
+            *pTargetPixel = *(__COLOUR_ADDR);                                   \
+        } else {                                                                \
+            __BLENDING((__COLOUR_ADDR), pTargetPixel, chPlotOpacity);           \
+        }                                                                       \
+    } while(0)
+
+#define __ARM_2D_FUNC_DRAW_POINTS(__NAME, __INT_TYPE, __FIELD, __BLENDING)      \
+static                                                                          \
+void __NAME(arm_2d_op_drw_pts_t *ptThis,                                        \
+            __INT_TYPE *pTarget,                                                \
+            int_fast16_t iStride,                                               \
+            const arm_2d_region_t *ptValidRegion)                               \
+{                                                                               \
+    int_fast16_t iX0 = ptValidRegion->tLocation.iX;                             \
+    int_fast16_t iY0 = ptValidRegion->tLocation.iY;                             \
+    int_fast16_t iWidth = ptValidRegion->tSize.iWidth;                          \
+    int_fast16_t iHeight = ptValidRegion->tSize.iHeight;                        \
+    const uint8_t *pchOpacity = this.Points.pchOpacity;                         \
+    uint_fast8_t chOpacity = this.chOpacity;                                    \
+    int_fast32_t n = this.Points.hwCount;                                       \
+                                                                                \
+    if (!this.bAntiAlias) {                                                     \
+        const arm_2d_location_t *ptPoint = this.Points.ptLocations;             \
+        do {                                                                    \
+            uint_fast8_t chPointOpacity = chOpacity;                            \
+            if (NULL != pchOpacity) {                                           \
+                chPointOpacity = *pchOpacity++;                                 \
+                /* x * (opacity + 1) >> 8 keeps 255 as the identity */          \
+                chPointOpacity = (chPointOpacity * (chOpacity + 1)) >> 8;       \
+            }                                                                   \
+            int_fast16_t iX = ptPoint->iX - iX0;                                \
+            int_fast16_t iY = ptPoint->iY - iY0;                                \
+            ptPoint++;                                                          \
+                                                                                \
+            __ARM_2D_DRAW_POINTS_PLOT(  __INT_TYPE, __BLENDING, &this.__FIELD,  \
+                                        iX, iY, chPointOpacity);                \
+        } while(--n);                                                           \
+    } else {                                                                    \
+        const arm_2d_point_fx_t *ptPoint = this.Points.ptQ16;                   \
+        do {                                                                    \
+            uint_fast16_t hwPointOpacity = chOpacity;                           \
+            if (NULL != pchOpacity) {                                           \
+                hwPointOpacity = *pchOpacity++;                                 \
+                /* x * (opacity + 1) >> 8 keeps 255 as the identity */          \
+                hwPointOpacity = (hwPointOpacity * (chOpacity + 1)) >> 8;       \
+            }                                                                   \
+            /* map 255 to 256 so a point on the pixel grid stays opaque */      \
+            hwPointOpacity += (hwPointOpacity == 255);                          \
+                                                                                \
+            int_fast16_t iX = (int_fast16_t)(ptPoint->X >> 16) - iX0;           \
+            int_fast16_t iY = (int_fast16_t)(ptPoint->Y >> 16) - iY0;           \
+            uint_fast16_t hwFX = (ptPoint->X >> 8) & 0xFF;                      \
+            uint_fast16_t hwFY = (ptPoint->Y >> 8) & 0xFF;                      \
+            ptPoint++;                                                          \
+                                                                                \
+            /* skip points whose 2x2 footprint is outside the window */         \
+            if (    iX < -1 || iX >= iWidth                                     \
+                ||  iY < -1 || iY >= iHeight) {                                 \
+                continue;                                                       \
+            }                                                                   \
+                                                                                \
+            uint32_t wTop = (256 - hwFY) * hwPointOpacity;                      \
+            uint32_t wBottom = hwFY * hwPointOpacity;                           \
+            uint_fast8_t chA00 = MIN(255, ((256 - hwFX) * wTop) >> 16);         \
+            uint_fast8_t chA10 = MIN(255, (hwFX * wTop) >> 16);                 \
+            uint_fast8_t chA01 = MIN(255, ((256 - hwFX) * wBottom) >> 16);      \
+            uint_fast8_t chA11 = MIN(255, (hwFX * wBottom) >> 16);              \
+                                                                                \
+            __ARM_2D_DRAW_POINTS_PLOT(  __INT_TYPE, __BLENDING, &this.__FIELD,  \
+                                        iX, iY, chA00);                         \
+            __ARM_2D_DRAW_POINTS_PLOT(  __INT_TYPE, __BLENDING, &this.__FIELD,  \
+                                        iX + 1, iY, chA10);                     \
+            __ARM_2D_DRAW_POINTS_PLOT(  __INT_TYPE, __BLENDING, &this.__FIELD,  \
+                                        iX, iY + 1, chA01);                     \
+            __ARM_2D_DRAW_POINTS_PLOT(  __INT_TYPE, __BLENDING, &this.__FIELD,  \
+                                        iX + 1, iY + 1, chA11);                 \
+        } while(--n);                                                           \
+    }                                                                           \
+}
+
+__ARM_2D_FUNC_DRAW_POINTS(  __arm_2d_c8bit_sw_draw_points, 
+                            uint8_t, 
+                            chColour,
+                            __ARM_2D_PIXEL_BLENDING_OPA_GRAY8)
+
+__ARM_2D_FUNC_DRAW_POINTS(  __arm_2d_rgb16_sw_draw_points, 
+                            uint16_t, 
+                            hwColour,
+                            __ARM_2D_PIXEL_BLENDING_OPA_RGB565)
+
+__ARM_2D_FUNC_DRAW_POINTS(  __arm_2d_rgb32_sw_draw_points, 
+                            uint32_t, 
+                            wColour,
+                            __ARM_2D_PIXEL_BLENDING_OPA_CCCN888)
+
+arm_fsm_rt_t __arm_2d_sw_draw_points(__arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_drw_pts_t, ptTask->ptOP)
+
+    /* the visible window of the target tile, in the target tile coordinates */
+    arm_2d_region_t tValidRegion;
+    arm_2d_location_t tOffset;
+    if (NULL == arm_2d_tile_get_root(this.Target.ptTile, &tValidRegion, &tOffset)) {
+        return arm_fsm_rt_cpl;
+    }
+    tValidRegion.tLocation = tOffset;
+    tValidRegion.tSize = ptTask->Param.tTileProcess.tValidRegion.tSize;
+
+    switch (OP_CORE.ptOp->Info.Colour.u3ColourSZ) {
+        case ARM_2D_COLOUR_SZ_8BIT:
+            __arm_2d_c8bit_sw_draw_points(  ptThis,
+                                            ptTask->Param.tTileProcess.pBuffer,
+                                            ptTask->Param.tTileProcess.iStride,
+                                            &tValidRegion);
+            break;
+        case ARM_2D_COLOUR_SZ_16BIT:
+            __arm_2d_rgb16_sw_draw_points(  ptThis,
+                                            ptTask->Param.tTileProcess.pBuffer,
+                                            ptTask->Param.tTileProcess.iStride,
+                                            &tValidRegion);
+            break;
+        case ARM_2D_COLOUR_SZ_32BIT:
+            __arm_2d_rgb32_sw_draw_points(  ptThis,
+                                            ptTask->Param.tTileProcess.pBuffer,
+                                            ptTask->Param.tTileProcess.iStride,
+                                            &tValidRegion);
+            break;
+        default:
+            return (arm_fsm_rt_t)ARM_2D_ERR_NOT_SUPPORT;
+    }
+
+    return arm_fsm_rt_cpl;
+}
+
+
 /*----------------------------------------------------------------------------*
  * Fill tile with a specified colour                                          *
  *----------------------------------------------------------------------------*/
@@ -731,6 +1097,9 @@ arm_fsm_rt_t __arm_2d_rgb32_sw_draw_pattern( __arm_2d_sub_task_t *ptTask)
 __WEAK
 def_low_lv_io(__ARM_2D_IO_DRAW_POINT, __arm_2d_sw_draw_point);
 
+__WEAK
+def_low_lv_io(__ARM_2D_IO_DRAW_POINTS, __arm_2d_sw_draw_points);
+
 __WEAK
 def_low_lv_io(__ARM_2D_IO_DRAW_PATTERN_C8BIT, __arm_2d_c8bit_sw_draw_pattern);
 __WEAK
@@ -797,6 +1166,57 @@ const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINT_RGB32 = {
     },
 };
     
+const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINTS_C8BIT = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_8BIT,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_DRAW_POINTS,
+        
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_DRAW_POINTS),
+        },
+    },
+};
+    
+const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINTS_RGB16 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_RGB16,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_DRAW_POINTS,
+        
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_DRAW_POINTS),
+        },
+    },
+};
+    
+const __arm_2d_op_info_t ARM_2D_OP_DRAW_POINTS_RGB32 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_RGB32,
+        },
+        .Param = {
+            .bHasSource     = false,
+            .bHasTarget     = true,
+        },
+        .chOpIndex      = __ARM_2D_OP_IDX_DRAW_POINTS,
+        
+        .LowLevelIO = {
+            .ptTileProcessLike = ref_low_lv_io(__ARM_2D_IO_DRAW_POINTS),
+        },
+    },
+};
+    
 const __arm_2d_op_info_t ARM_2D_OP_DRAW_PATTERN_C8BIT = {
     .Info = {
         .Colour = {
@@ -905,6 +1325,10 @@ const __arm_2d_op_info_t ARM_2D_OP_FILL_COLOUR_RGB32 = {
     },
 };
 
+/*============================ INCLUDES ======================================*/
+#define __ARM_2D_COMPILATION_UNIT
+#include "__arm_2d_draw_path.c"
+
 #ifdef   __cplusplus
 }
 #endif
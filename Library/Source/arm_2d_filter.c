@@ -39,6 +39,9 @@
 #define __ARM_2D_COMPILATION_UNIT
 #include "__arm_2d_filter_iir_blur.c"
 
+#define __ARM_2D_COMPILATION_UNIT
+#include "__arm_2d_filter_separable_blur.c"
+
 #if defined(__clang__)
 #   pragma clang diagnostic ignored "-Wunknown-warning-option"
 #   pragma clang diagnostic ignored "-Wformat-nonliteral"
@@ -204,6 +204,9 @@ uint16x8_t __arm_2d_blend_n_cccn888(uint16x8_t        vTrg, uint16x8_t vChColour
 #define __ARM_2D_COMPILATION_UNIT
 #include "__arm_2d_fill_colour_with_mask_and_mirroring_helium.c"
 
+#define __ARM_2D_COMPILATION_UNIT
+#include "__arm_2d_fill_colour_with_gradient_helium.c"
+
 
 /*----------------------------------------------------------------------------*
  * Helper
@@ -0,0 +1,1335 @@
+/*
+ * Copyright (C) 2010-2024 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      Arm-2D Library
+ * Title:        arm-2d_simd.c
+ * Description:  Acceleration extensions using the compiler vector extensions
+ *
+ * $Date:        17. October 2024
+ * $Revision:    V.0.1.0
+ *
+ * Target Processor:  Processors without Helium but with a SIMD unit, e.g.
+ *                    Cortex-A (Neon) and the host PC (SSE2) for simulation
+ *
+ * -------------------------------------------------------------------- */
+
+#define __ARM_2D_IMPL__
+
+#include "arm_2d.h"
+#include "__arm_2d_impl.h"
+
+#if defined(__ARM_2D_HAS_PORTABLE_SIMD__) && __ARM_2D_HAS_PORTABLE_SIMD__
+
+#if defined(__clang__)
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wvector-conversion"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#endif
+
+#ifdef   __cplusplus
+extern "C" {
+#endif
+
+/*============================ MACROS ========================================*/
+
+#if defined(__SIMD_DEBUG__) && __SIMD_DEBUG__
+#   define ____SIMD_WRAPPER(__FUNC)      __FUNC##_simd
+#else
+#   define ____SIMD_WRAPPER(__FUNC)      __FUNC
+#endif
+
+#ifndef __SIMD_WRAPPER
+#   define __SIMD_WRAPPER(__FUNC)       ____SIMD_WRAPPER(__FUNC)
+#endif
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+
+#if defined(__clang__)
+#   define __arm_2d_simd_shuffle_u32x4(__A, __B, __0, __1, __2, __3)            \
+            __builtin_shufflevector((__A), (__B), __0, __1, __2, __3)
+#else
+#   define __arm_2d_simd_shuffle_u32x4(__A, __B, __0, __1, __2, __3)            \
+            __builtin_shuffle((__A), (__B), (__arm_2d_u32x4_t){__0, __1, __2, __3})
+#endif
+
+/*============================ TYPES =========================================*/
+
+typedef uint8_t  __arm_2d_u8x4_t    __attribute__((vector_size(4)));
+typedef uint8_t  __arm_2d_u8x8_t    __attribute__((vector_size(8)));
+typedef uint8_t  __arm_2d_u8x16_t   __attribute__((vector_size(16)));
+typedef uint16_t __arm_2d_u16x8_t   __attribute__((vector_size(16)));
+typedef uint16_t __arm_2d_u16x16_t  __attribute__((vector_size(32)));
+typedef uint32_t __arm_2d_u32x4_t   __attribute__((vector_size(16)));
+typedef uint32_t __arm_2d_u32x8_t   __attribute__((vector_size(32)));
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+/*============================ IMPLEMENTATION ================================*/
+
+/*!
+ * \brief initialise the portable SIMD acceleration
+ */
+void __arm_2d_simd_init(void)
+{
+    /* even if this is empty, do not remove it */
+}
+
+/*----------------------------------------------------------------------------*
+ * Utilities                                                                  *
+ *----------------------------------------------------------------------------*/
+
+/*
+ * NOTE: the pixels are loaded and stored with memcpy, as the buffers are only
+ *       aligned to the pixel size. The compiler turns them into unaligned
+ *       vector loads and stores.
+ */
+__STATIC_FORCEINLINE
+__arm_2d_u8x8_t __arm_2d_simd_load_u8x8(const uint8_t *pchSource)
+{
+    __arm_2d_u8x8_t vValue;
+    __builtin_memcpy(&vValue, pchSource, sizeof(vValue));
+    return vValue;
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u8x4_t __arm_2d_simd_load_u8x4(const uint8_t *pchSource)
+{
+    __arm_2d_u8x4_t vValue;
+    __builtin_memcpy(&vValue, pchSource, sizeof(vValue));
+    return vValue;
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u16x8_t __arm_2d_simd_load_u16x8(const uint16_t *phwSource)
+{
+    __arm_2d_u16x8_t vValue;
+    __builtin_memcpy(&vValue, phwSource, sizeof(vValue));
+    return vValue;
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u32x4_t __arm_2d_simd_load_u32x4(const uint32_t *pwSource)
+{
+    __arm_2d_u32x4_t vValue;
+    __builtin_memcpy(&vValue, pwSource, sizeof(vValue));
+    return vValue;
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u16x8_t __arm_2d_simd_load_alpha_u16x8(const uint8_t *pchSource)
+{
+    return __builtin_convertvector(__arm_2d_simd_load_u8x8(pchSource),
+                                   __arm_2d_u16x8_t);
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u32x4_t __arm_2d_simd_load_alpha_u32x4(const uint8_t *pchSource)
+{
+    return __builtin_convertvector(__arm_2d_simd_load_u8x4(pchSource),
+                                   __arm_2d_u32x4_t);
+}
+
+/*!
+ * \brief get the transparency (i.e. 256 - alpha) from an alpha mask
+ * \note it follows __ARM_2D_PIXEL_BLENDING_xxxx in the colour-filling-with-mask
+ *       family, hence the result is bit-exact.
+ */
+__STATIC_FORCEINLINE
+__arm_2d_u16x8_t __arm_2d_simd_mask_to_trans(__arm_2d_u16x8_t vAlpha)
+{
+    __arm_2d_u16x8_t vTrans = 256 - vAlpha;
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+    vTrans += (__arm_2d_u16x8_t)(vTrans == 1);      /* 1 -> 0 */
+#endif
+    return vTrans;
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u16x8_t __arm_2d_simd_mask_opa_to_trans(__arm_2d_u16x8_t vAlpha,
+                                                 uint16_t hwOpacity)
+{
+    __arm_2d_u16x8_t vTrans = 256 - ((vAlpha * hwOpacity) >> 8);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+    vTrans &= ~(__arm_2d_u16x8_t)(vTrans == 2);     /* 2 -> 0 */
+#endif
+    return vTrans;
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u32x4_t __arm_2d_simd_mask_to_trans_u32x4(__arm_2d_u32x4_t vAlpha)
+{
+    __arm_2d_u32x4_t vTrans = 256 - vAlpha;
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+    vTrans += (__arm_2d_u32x4_t)(vTrans == 1);      /* 1 -> 0 */
+#endif
+    return vTrans;
+}
+
+__STATIC_FORCEINLINE
+__arm_2d_u32x4_t __arm_2d_simd_mask_opa_to_trans_u32x4(__arm_2d_u32x4_t vAlpha,
+                                                       uint32_t wOpacity)
+{
+    __arm_2d_u32x4_t vTrans = 256 - ((vAlpha * wOpacity) >> 8);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+    vTrans &= ~(__arm_2d_u32x4_t)(vTrans == 2);     /* 2 -> 0 */
+#endif
+    return vTrans;
+}
+
+/*!
+ * \brief blend 8 rgb565 pixels, the same as __ARM_2D_PIXEL_BLENDING_RGB565
+ * \param[in] vSource the source pixels
+ * \param[in] vTarget the target pixels
+ * \param[in] vTrans the transparency of the source pixels (256 - opacity)
+ */
+__STATIC_FORCEINLINE
+__arm_2d_u16x8_t __arm_2d_simd_rgb565_blend(__arm_2d_u16x8_t vSource,
+                                            __arm_2d_u16x8_t vTarget,
+                                            __arm_2d_u16x8_t vTrans)
+{
+    __arm_2d_u16x8_t vOpa = 256 - vTrans;
+
+    __arm_2d_u16x8_t vR = ((vSource >> 11) << 3) * vOpa
+                        + ((vTarget >> 11) << 3) * vTrans;
+    __arm_2d_u16x8_t vG = (((vSource >> 5) & 0x3F) << 2) * vOpa
+                        + (((vTarget >> 5) & 0x3F) << 2) * vTrans;
+    __arm_2d_u16x8_t vB = ((vSource & 0x1F) << 3) * vOpa
+                        + ((vTarget & 0x1F) << 3) * vTrans;
+
+    return  ((((vR >> 8) >> 3) & 0x1F) << 11)
+        |   ((((vG >> 8) >> 2) & 0x3F) << 5)
+        |    (((vB >> 8) >> 3) & 0x1F);
+}
+
+/*!
+ * \brief blend 4 cccn888 pixels, the same as __ARM_2D_PIXEL_BLENDING_CCCN888
+ * \note the alpha channel of the target pixels is kept.
+ */
+__STATIC_FORCEINLINE
+__arm_2d_u32x4_t __arm_2d_simd_cccn888_blend(__arm_2d_u32x4_t vSource,
+                                             __arm_2d_u32x4_t vTarget,
+                                             __arm_2d_u32x4_t vTrans)
+{
+    __arm_2d_u32x4_t vOpa = 256 - vTrans;
+
+    __arm_2d_u32x4_t vB = ((vSource & 0xFF) * vOpa
+                        + (vTarget & 0xFF) * vTrans) >> 8;
+    __arm_2d_u32x4_t vG = (((vSource >> 8) & 0xFF) * vOpa
+                        + ((vTarget >> 8) & 0xFF) * vTrans) >> 8;
+    __arm_2d_u32x4_t vR = (((vSource >> 16) & 0xFF) * vOpa
+                        + ((vTarget >> 16) & 0xFF) * vTrans) >> 8;
+
+    return  (vTarget & 0xFF000000)
+        |   ((vR & 0xFF) << 16)
+        |   ((vG & 0xFF) << 8)
+        |    (vB & 0xFF);
+}
+
+/*!
+ * \brief blend 8 gray8 pixels, the same as __ARM_2D_PIXEL_BLENDING_GRAY8
+ */
+__STATIC_FORCEINLINE
+__arm_2d_u8x8_t __arm_2d_simd_gray8_blend(  __arm_2d_u16x8_t vSource,
+                                            __arm_2d_u16x8_t vTarget,
+                                            __arm_2d_u16x8_t vTrans)
+{
+    __arm_2d_u16x8_t vOpa = 256 - vTrans;
+
+    return __builtin_convertvector((vSource * vOpa + vTarget * vTrans) >> 8,
+                                   __arm_2d_u8x8_t);
+}
+
+/*!
+ * \brief transpose a 4x4 matrix of 32bit elements
+ */
+__STATIC_FORCEINLINE
+void __arm_2d_simd_transpose_u32x4( __arm_2d_u32x4_t *__RESTRICT pvOut,
+                                    const __arm_2d_u32x4_t *__RESTRICT pvIn)
+{
+    __arm_2d_u32x4_t vT0 = __arm_2d_simd_shuffle_u32x4(pvIn[0], pvIn[1], 0, 4, 1, 5);
+    __arm_2d_u32x4_t vT1 = __arm_2d_simd_shuffle_u32x4(pvIn[2], pvIn[3], 0, 4, 1, 5);
+    __arm_2d_u32x4_t vT2 = __arm_2d_simd_shuffle_u32x4(pvIn[0], pvIn[1], 2, 6, 3, 7);
+    __arm_2d_u32x4_t vT3 = __arm_2d_simd_shuffle_u32x4(pvIn[2], pvIn[3], 2, 6, 3, 7);
+
+    pvOut[0] = __arm_2d_simd_shuffle_u32x4(vT0, vT1, 0, 1, 4, 5);
+    pvOut[1] = __arm_2d_simd_shuffle_u32x4(vT0, vT1, 2, 3, 6, 7);
+    pvOut[2] = __arm_2d_simd_shuffle_u32x4(vT2, vT3, 0, 1, 4, 5);
+    pvOut[3] = __arm_2d_simd_shuffle_u32x4(vT2, vT3, 2, 3, 6, 7);
+}
+
+/*----------------------------------------------------------------------------*
+ * Alpha Blending                                                             *
+ *----------------------------------------------------------------------------*/
+
+void __SIMD_WRAPPER(__arm_2d_impl_gray8_tile_copy_opacity)(
+                                    uint8_t *__RESTRICT pchSourceBase,
+                                    int16_t iSourceStride,
+                                    uint8_t *__RESTRICT pchTargetBase,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint_fast16_t hwRatio)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+
+    hwRatio += (hwRatio == 255);
+    uint16_t hwRatioCompl = 256 - hwRatio;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint8_t *__RESTRICT pchSource = pchSourceBase;
+        uint8_t *__RESTRICT pchTarget = pchTargetBase;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= iWidth; x += 8) {
+            __arm_2d_u8x8_t vResult = __arm_2d_simd_gray8_blend(
+                                    __arm_2d_simd_load_alpha_u16x8(pchSource),
+                                    __arm_2d_simd_load_alpha_u16x8(pchTarget),
+                                    (__arm_2d_u16x8_t){} + hwRatioCompl);
+            __builtin_memcpy(pchTarget, &vResult, sizeof(vResult));
+
+            pchSource += 8;
+            pchTarget += 8;
+        }
+
+        for (; x < iWidth; x++) {
+            __ARM_2D_PIXEL_BLENDING_GRAY8(pchSource++, pchTarget++, hwRatioCompl);
+        }
+
+        pchSourceBase += iSourceStride;
+        pchTargetBase += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_rgb565_tile_copy_opacity)(
+                                    uint16_t *__RESTRICT phwSourceBase,
+                                    int16_t iSourceStride,
+                                    uint16_t *__RESTRICT phwTargetBase,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint_fast16_t hwRatio)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+
+    /* NOTE: unlike other colour formats, no compensation for 255 is applied */
+    uint16_t hwRatioCompl = 256 - hwRatio;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint16_t *__RESTRICT phwSource = phwSourceBase;
+        uint16_t *__RESTRICT phwTarget = phwTargetBase;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= iWidth; x += 8) {
+            __arm_2d_u16x8_t vResult = __arm_2d_simd_rgb565_blend(
+                                    __arm_2d_simd_load_u16x8(phwSource),
+                                    __arm_2d_simd_load_u16x8(phwTarget),
+                                    (__arm_2d_u16x8_t){} + hwRatioCompl);
+            __builtin_memcpy(phwTarget, &vResult, sizeof(vResult));
+
+            phwSource += 8;
+            phwTarget += 8;
+        }
+
+        for (; x < iWidth; x++) {
+            __ARM_2D_PIXEL_BLENDING_RGB565(phwSource++, phwTarget++, hwRatioCompl);
+        }
+
+        phwSourceBase += iSourceStride;
+        phwTargetBase += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_cccn888_tile_copy_opacity)(
+                                    uint32_t *__RESTRICT pwSourceBase,
+                                    int16_t iSourceStride,
+                                    uint32_t *__RESTRICT pwTargetBase,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint_fast16_t hwRatio)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+
+    hwRatio += (hwRatio == 255);
+    uint16_t hwRatioCompl = 256 - hwRatio;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint32_t *__RESTRICT pwSource = pwSourceBase;
+        uint32_t *__RESTRICT pwTarget = pwTargetBase;
+        int_fast16_t x = 0;
+
+        for (; x + 4 <= iWidth; x += 4) {
+            __arm_2d_u32x4_t vResult = __arm_2d_simd_cccn888_blend(
+                                    __arm_2d_simd_load_u32x4(pwSource),
+                                    __arm_2d_simd_load_u32x4(pwTarget),
+                                    (__arm_2d_u32x4_t){} + hwRatioCompl);
+            __builtin_memcpy(pwTarget, &vResult, sizeof(vResult));
+
+            pwSource += 4;
+            pwTarget += 4;
+        }
+
+        for (; x < iWidth; x++) {
+            __ARM_2D_PIXEL_BLENDING_CCCN888(pwSource++, pwTarget++, hwRatioCompl);
+        }
+
+        pwSourceBase += iSourceStride;
+        pwTargetBase += iTargetStride;
+    }
+}
+
+/*----------------------------------------------------------------------------*
+ * Colour Filling with Mask                                                   *
+ *----------------------------------------------------------------------------*/
+
+void __SIMD_WRAPPER(__arm_2d_impl_gray8_colour_filling_mask)(
+                                    uint8_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint8_t Colour)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+    __arm_2d_u16x8_t vColour = (__arm_2d_u16x8_t){} + Colour;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint8_t *__RESTRICT pchTarget = pTarget;
+        uint8_t *__RESTRICT pchMask = pchAlpha;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= iWidth; x += 8) {
+            __arm_2d_u8x8_t vResult = __arm_2d_simd_gray8_blend(
+                vColour,
+                __arm_2d_simd_load_alpha_u16x8(pchTarget),
+                __arm_2d_simd_mask_to_trans(
+                    __arm_2d_simd_load_alpha_u16x8(pchMask)));
+            __builtin_memcpy(pchTarget, &vResult, sizeof(vResult));
+
+            pchTarget += 8;
+            pchMask += 8;
+        }
+
+        for (; x < iWidth; x++) {
+            uint16_t hwAlpha = 256 - (*pchMask++);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+            hwAlpha -= (hwAlpha == 1);
+#endif
+            __ARM_2D_PIXEL_BLENDING_GRAY8(&Colour, pchTarget++, hwAlpha);
+        }
+
+        pchAlpha += iAlphaStride;
+        pTarget += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_gray8_colour_filling_mask_opacity)(
+                                    uint8_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint8_t Colour,
+                                    uint_fast16_t hwOpacity)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+    __arm_2d_u16x8_t vColour = (__arm_2d_u16x8_t){} + Colour;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint8_t *__RESTRICT pchTarget = pTarget;
+        uint8_t *__RESTRICT pchMask = pchAlpha;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= iWidth; x += 8) {
+            __arm_2d_u8x8_t vResult = __arm_2d_simd_gray8_blend(
+                vColour,
+                __arm_2d_simd_load_alpha_u16x8(pchTarget),
+                __arm_2d_simd_mask_opa_to_trans(
+                    __arm_2d_simd_load_alpha_u16x8(pchMask), hwOpacity));
+            __builtin_memcpy(pchTarget, &vResult, sizeof(vResult));
+
+            pchTarget += 8;
+            pchMask += 8;
+        }
+
+        for (; x < iWidth; x++) {
+            uint16_t hwAlpha = 256 - ((*pchMask++) * hwOpacity >> 8);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+            hwAlpha -= (hwAlpha == 2) * 2;
+#endif
+            __ARM_2D_PIXEL_BLENDING_GRAY8(&Colour, pchTarget++, hwAlpha);
+        }
+
+        pchAlpha += iAlphaStride;
+        pTarget += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_rgb565_colour_filling_mask)(
+                                    uint16_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint16_t Colour)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+    __arm_2d_u16x8_t vColour = (__arm_2d_u16x8_t){} + Colour;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint16_t *__RESTRICT phwTarget = pTarget;
+        uint8_t *__RESTRICT pchMask = pchAlpha;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= iWidth; x += 8) {
+            __arm_2d_u16x8_t vResult = __arm_2d_simd_rgb565_blend(
+                vColour,
+                __arm_2d_simd_load_u16x8(phwTarget),
+                __arm_2d_simd_mask_to_trans(
+                    __arm_2d_simd_load_alpha_u16x8(pchMask)));
+            __builtin_memcpy(phwTarget, &vResult, sizeof(vResult));
+
+            phwTarget += 8;
+            pchMask += 8;
+        }
+
+        for (; x < iWidth; x++) {
+            uint16_t hwAlpha = 256 - (*pchMask++);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+            hwAlpha -= (hwAlpha == 1);
+#endif
+            __ARM_2D_PIXEL_BLENDING_RGB565(&Colour, phwTarget++, hwAlpha);
+        }
+
+        pchAlpha += iAlphaStride;
+        pTarget += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_rgb565_colour_filling_mask_opacity)(
+                                    uint16_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint16_t Colour,
+                                    uint_fast16_t hwOpacity)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+    __arm_2d_u16x8_t vColour = (__arm_2d_u16x8_t){} + Colour;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint16_t *__RESTRICT phwTarget = pTarget;
+        uint8_t *__RESTRICT pchMask = pchAlpha;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= iWidth; x += 8) {
+            __arm_2d_u16x8_t vResult = __arm_2d_simd_rgb565_blend(
+                vColour,
+                __arm_2d_simd_load_u16x8(phwTarget),
+                __arm_2d_simd_mask_opa_to_trans(
+                    __arm_2d_simd_load_alpha_u16x8(pchMask), hwOpacity));
+            __builtin_memcpy(phwTarget, &vResult, sizeof(vResult));
+
+            phwTarget += 8;
+            pchMask += 8;
+        }
+
+        for (; x < iWidth; x++) {
+            uint16_t hwAlpha = 256 - ((*pchMask++) * hwOpacity >> 8);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+            hwAlpha -= (hwAlpha == 2) * 2;
+#endif
+            __ARM_2D_PIXEL_BLENDING_RGB565(&Colour, phwTarget++, hwAlpha);
+        }
+
+        pchAlpha += iAlphaStride;
+        pTarget += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_cccn888_colour_filling_mask)(
+                                    uint32_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint32_t Colour)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+    __arm_2d_u32x4_t vColour = (__arm_2d_u32x4_t){} + Colour;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint32_t *__RESTRICT pwTarget = pTarget;
+        uint8_t *__RESTRICT pchMask = pchAlpha;
+        int_fast16_t x = 0;
+
+        for (; x + 4 <= iWidth; x += 4) {
+            __arm_2d_u32x4_t vResult = __arm_2d_simd_cccn888_blend(
+                vColour,
+                __arm_2d_simd_load_u32x4(pwTarget),
+                __arm_2d_simd_mask_to_trans_u32x4(
+                    __arm_2d_simd_load_alpha_u32x4(pchMask)));
+            __builtin_memcpy(pwTarget, &vResult, sizeof(vResult));
+
+            pwTarget += 4;
+            pchMask += 4;
+        }
+
+        for (; x < iWidth; x++) {
+            uint16_t hwAlpha = 256 - (*pchMask++);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+            hwAlpha -= (hwAlpha == 1);
+#endif
+            __ARM_2D_PIXEL_BLENDING_CCCN888(&Colour, pwTarget++, hwAlpha);
+        }
+
+        pchAlpha += iAlphaStride;
+        pTarget += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_cccn888_colour_filling_mask_opacity)(
+                                    uint32_t *__RESTRICT pTarget,
+                                    int16_t iTargetStride,
+                                    uint8_t *__RESTRICT pchAlpha,
+                                    int16_t iAlphaStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize,
+                                    uint32_t Colour,
+                                    uint_fast16_t hwOpacity)
+{
+    int_fast16_t iHeight = ptCopySize->iHeight;
+    int_fast16_t iWidth  = ptCopySize->iWidth;
+    __arm_2d_u32x4_t vColour = (__arm_2d_u32x4_t){} + Colour;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        uint32_t *__RESTRICT pwTarget = pTarget;
+        uint8_t *__RESTRICT pchMask = pchAlpha;
+        int_fast16_t x = 0;
+
+        for (; x + 4 <= iWidth; x += 4) {
+            __arm_2d_u32x4_t vResult = __arm_2d_simd_cccn888_blend(
+                vColour,
+                __arm_2d_simd_load_u32x4(pwTarget),
+                __arm_2d_simd_mask_opa_to_trans_u32x4(
+                    __arm_2d_simd_load_alpha_u32x4(pchMask), hwOpacity));
+            __builtin_memcpy(pwTarget, &vResult, sizeof(vResult));
+
+            pwTarget += 4;
+            pchMask += 4;
+        }
+
+        for (; x < iWidth; x++) {
+            uint16_t hwAlpha = 256 - ((*pchMask++) * hwOpacity >> 8);
+#if !defined(__ARM_2D_CFG_UNSAFE_IGNORE_ALPHA_255_COMPENSATION__)
+            hwAlpha -= (hwAlpha == 2) * 2;
+#endif
+            __ARM_2D_PIXEL_BLENDING_CCCN888(&Colour, pwTarget++, hwAlpha);
+        }
+
+        pchAlpha += iAlphaStride;
+        pTarget += iTargetStride;
+    }
+}
+
+/*----------------------------------------------------------------------------*
+ * Colour Format Conversion                                                   *
+ *----------------------------------------------------------------------------*/
+
+void __SIMD_WRAPPER(__arm_2d_impl_rgb565_to_cccn888)(
+                                    uint16_t *__RESTRICT phwSourceBase,
+                                    int16_t iSourceStride,
+                                    uint32_t *__RESTRICT pwTargetBase,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize)
+{
+    for (int_fast16_t y = 0; y < ptCopySize->iHeight; y++) {
+
+        const uint16_t *__RESTRICT phwSource = phwSourceBase;
+        uint32_t       *__RESTRICT pwTarget = pwTargetBase;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= ptCopySize->iWidth; x += 8) {
+            __arm_2d_u32x8_t vPixel = __builtin_convertvector(
+                                        __arm_2d_simd_load_u16x8(phwSource),
+                                        __arm_2d_u32x8_t);
+
+            __arm_2d_u32x8_t vResult
+                = 0xFF000000
+                | (((vPixel >> 11) << 3) << 16)
+                | ((((vPixel >> 5) & 0x3F) << 2) << 8)
+                |  ((vPixel & 0x1F) << 3);
+            __builtin_memcpy(pwTarget, &vResult, sizeof(vResult));
+
+            phwSource += 8;
+            pwTarget += 8;
+        }
+
+        for (; x < ptCopySize->iWidth; x++) {
+            __arm_2d_color_fast_rgb_t      hwSrcPixel;
+            arm_2d_color_bgra8888_t wTargetPixel;
+
+            __arm_2d_rgb565_unpack(*phwSource++, &hwSrcPixel);
+            wTargetPixel.u8R = hwSrcPixel.R;
+            wTargetPixel.u8G = hwSrcPixel.G;
+            wTargetPixel.u8B = hwSrcPixel.B;
+            wTargetPixel.u8A = 0xFF;
+            *pwTarget++ = wTargetPixel.tValue;
+        }
+
+        phwSourceBase += iSourceStride;
+        pwTargetBase += iTargetStride;
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_cccn888_to_rgb565)(
+                                    uint32_t *__RESTRICT pwSourceBase,
+                                    int16_t iSourceStride,
+                                    uint16_t *__RESTRICT phwTargetBase,
+                                    int16_t iTargetStride,
+                                    arm_2d_size_t *__RESTRICT ptCopySize)
+{
+    for (int_fast16_t y = 0; y < ptCopySize->iHeight; y++) {
+
+        const uint32_t *__RESTRICT pwSource = pwSourceBase;
+        uint16_t *__RESTRICT phwTarget = phwTargetBase;
+        int_fast16_t x = 0;
+
+        for (; x + 8 <= ptCopySize->iWidth; x += 8) {
+            __arm_2d_u32x8_t vPixel;
+            __builtin_memcpy(&vPixel, pwSource, sizeof(vPixel));
+
+            __arm_2d_u16x8_t vResult = __builtin_convertvector(
+                    (((vPixel >> (16 + 3)) & 0x1F) << 11)
+                |   (((vPixel >> (8 + 2)) & 0x3F) << 5)
+                |    ((vPixel >> 3) & 0x1F),
+                __arm_2d_u16x8_t);
+            __builtin_memcpy(phwTarget, &vResult, sizeof(vResult));
+
+            pwSource += 8;
+            phwTarget += 8;
+        }
+
+        for (; x < ptCopySize->iWidth; x++) {
+            arm_2d_color_bgra8888_t wSrcPixel;
+            __arm_2d_color_fast_rgb_t      hwTargetPixel;
+
+            wSrcPixel.tValue = *pwSource++;
+            hwTargetPixel.R = wSrcPixel.u8R;
+            hwTargetPixel.G = wSrcPixel.u8G;
+            hwTargetPixel.B = wSrcPixel.u8B;
+
+            *phwTarget++ = __arm_2d_rgb565_pack(&hwTargetPixel);
+        }
+
+        pwSourceBase += iSourceStride;
+        phwTargetBase += iTargetStride;
+    }
+}
+
+/*----------------------------------------------------------------------------*
+ * IIR Blur                                                                   *
+ *----------------------------------------------------------------------------*/
+
+/*
+ * NOTE: The scalar version updates the accumulator with
+ *
+ *          acc += (pixel - acc) * ratio >> 8;
+ *
+ *       which equals to (acc * (256 - ratio) + pixel * ratio) >> 8 for any
+ *       integer acc, and it never overflows 16bit. In the row passes, the
+ *       lanes are adjacent rows, and in the column passes, the lanes are
+ *       adjacent columns, so the accumulators of the lanes are independent.
+ *
+ *       The reverse paths are not vectorised, and the scalar version is used
+ *       when __ARM_2D_CFG_USE_IIR_BLUR_REVERSE_PATH__ is enabled.
+ */
+#if !defined(__ARM_2D_CFG_USE_IIR_BLUR_REVERSE_PATH__)                          \
+ || !__ARM_2D_CFG_USE_IIR_BLUR_REVERSE_PATH__
+
+void __SIMD_WRAPPER(__arm_2d_impl_gray8_filter_iir_blur)(
+                            uint8_t *__RESTRICT pchTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionOnVirtualScreen,
+                            arm_2d_region_t *ptTargetRegionOnVirtualScreen,
+                            uint8_t chBlurDegree,
+                            arm_2d_scratch_mem_t *ptScratchMemory)
+{
+    int_fast16_t iWidth = ptValidRegionOnVirtualScreen->tSize.iWidth;
+    int_fast16_t iHeight = ptValidRegionOnVirtualScreen->tSize.iHeight;
+
+    int_fast16_t iY, iX;
+    uint16_t hwRatio = 256 - chBlurDegree;
+    __arm_2d_iir_blur_acc_gray8_t *ptStatusH = NULL;
+    __arm_2d_iir_blur_acc_gray8_t *ptStatusV = NULL;
+
+    if (NULL != (void *)(ptScratchMemory->pBuffer)) {
+        ptStatusH = (__arm_2d_iir_blur_acc_gray8_t *)ptScratchMemory->pBuffer;
+        ptStatusV = ptStatusH + ptTargetRegionOnVirtualScreen->tSize.iWidth;
+    }
+
+    /* calculate the offset between the target region and the valid region */
+    arm_2d_location_t tOffset = {
+        .iX = ptValidRegionOnVirtualScreen->tLocation.iX - ptTargetRegionOnVirtualScreen->tLocation.iX,
+        .iY = ptValidRegionOnVirtualScreen->tLocation.iY - ptTargetRegionOnVirtualScreen->tLocation.iY,
+    };
+
+    /* rows direct path */
+    if (NULL != ptStatusV) {
+        ptStatusV += tOffset.iY;
+    }
+    bool bRecoverV = (NULL != ptStatusV) && (tOffset.iX > 0);
+
+    for (iY = 0; iY + 8 <= iHeight; iY += 8) {
+        uint8_t *pchRow = &pchTarget[iY * iTargetStride];
+        __arm_2d_u16x8_t vAcc;
+
+        for (int_fast8_t n = 0; n < 8; n++) {
+            vAcc[n] = bRecoverV ? ptStatusV[iY + n].hwC
+                                : pchRow[n * iTargetStride];
+        }
+
+        for (iX = 0; iX < iWidth; iX++) {
+            __arm_2d_u16x8_t vPixel;
+            for (int_fast8_t n = 0; n < 8; n++) {
+                vPixel[n] = pchRow[n * iTargetStride + iX];
+            }
+
+            vAcc = (vAcc * chBlurDegree + vPixel * hwRatio) >> 8;
+
+            for (int_fast8_t n = 0; n < 8; n++) {
+                pchRow[n * iTargetStride + iX] = (uint8_t)vAcc[n];
+            }
+        }
+
+        if (NULL != ptStatusV) {
+            for (int_fast8_t n = 0; n < 8; n++) {
+                ptStatusV[iY + n].hwC = vAcc[n];
+            }
+        }
+    }
+
+    for (; iY < iHeight; iY++) {
+        uint8_t *pchChannel = &pchTarget[iY * iTargetStride];
+        __arm_2d_iir_blur_acc_gray8_t tAcc;
+
+        if (bRecoverV) {
+            tAcc = ptStatusV[iY];
+        } else {
+            tAcc.hwC = *pchChannel;
+        }
+
+        for (iX = 0; iX < iWidth; iX++) {
+            tAcc.hwC += ((*pchChannel) - tAcc.hwC) * hwRatio >> 8;  *pchChannel++ = tAcc.hwC;
+        }
+
+        if (NULL != ptStatusV) {
+            ptStatusV[iY] = tAcc;
+        }
+    }
+
+    /* columns direct path */
+    if (NULL != ptStatusH) {
+        ptStatusH += tOffset.iX;
+    }
+    bool bRecoverH = (NULL != ptStatusH) && (tOffset.iY > 0);
+
+    for (iX = 0; iX + 8 <= iWidth; iX += 8) {
+        uint8_t *pchChannel = &pchTarget[iX];
+        __arm_2d_u16x8_t vAcc;
+
+        if (bRecoverH) {
+            for (int_fast8_t n = 0; n < 8; n++) {
+                vAcc[n] = ptStatusH[iX + n].hwC;
+            }
+        } else {
+            vAcc = __arm_2d_simd_load_alpha_u16x8(pchChannel);
+        }
+
+        for (iY = 0; iY < iHeight; iY++) {
+            vAcc = (vAcc * chBlurDegree 
+                 + __arm_2d_simd_load_alpha_u16x8(pchChannel) * hwRatio) >> 8;
+
+            __arm_2d_u8x8_t vResult = __builtin_convertvector(vAcc, __arm_2d_u8x8_t);
+            __builtin_memcpy(pchChannel, &vResult, sizeof(vResult));
+
+            pchChannel += iTargetStride;
+        }
+
+        if (NULL != ptStatusH) {
+            for (int_fast8_t n = 0; n < 8; n++) {
+                ptStatusH[iX + n].hwC = vAcc[n];
+            }
+        }
+    }
+
+    for (; iX < iWidth; iX++) {
+        uint8_t *pchChannel = &pchTarget[iX];
+        __arm_2d_iir_blur_acc_gray8_t tAcc;
+
+        if (bRecoverH) {
+            tAcc = ptStatusH[iX];
+        } else {
+            tAcc.hwC = *pchChannel;
+        }
+
+        for (iY = 0; iY < iHeight; iY++) {
+            tAcc.hwC += ((*pchChannel) - tAcc.hwC) * hwRatio >> 8;  *pchChannel = tAcc.hwC;
+            pchChannel += iTargetStride;
+        }
+
+        if (NULL != ptStatusH) {
+            ptStatusH[iX] = tAcc;
+        }
+    }
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_rgb565_filter_iir_blur)(
+                            uint16_t *__RESTRICT phwTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionOnVirtualScreen,
+                            arm_2d_region_t *ptTargetRegionOnVirtualScreen,
+                            uint8_t chBlurDegree,
+                            arm_2d_scratch_mem_t *ptScratchMemory)
+{
+    int_fast16_t iWidth = ptValidRegionOnVirtualScreen->tSize.iWidth;
+    int_fast16_t iHeight = ptValidRegionOnVirtualScreen->tSize.iHeight;
+
+    int_fast16_t iY, iX;
+    uint16_t hwRatio = 256 - chBlurDegree;
+    __arm_2d_iir_blur_acc_rgb565_t *ptStatusH = NULL;
+    __arm_2d_iir_blur_acc_rgb565_t *ptStatusV = NULL;
+
+    if (NULL != (void *)(ptScratchMemory->pBuffer)) {
+        ptStatusH = (__arm_2d_iir_blur_acc_rgb565_t *)ptScratchMemory->pBuffer;
+        ptStatusV = ptStatusH + ptTargetRegionOnVirtualScreen->tSize.iWidth;
+    }
+
+    /* calculate the offset between the target region and the valid region */
+    arm_2d_location_t tOffset = {
+        .iX = ptValidRegionOnVirtualScreen->tLocation.iX - ptTargetRegionOnVirtualScreen->tLocation.iX,
+        .iY = ptValidRegionOnVirtualScreen->tLocation.iY - ptTargetRegionOnVirtualScreen->tLocation.iY,
+    };
+
+    /* rows direct path */
+    if (NULL != ptStatusV) {
+        ptStatusV += tOffset.iY;
+    }
+    bool bRecoverV = (NULL != ptStatusV) && (tOffset.iX > 0);
+
+    for (iY = 0; iY + 8 <= iHeight; iY += 8) {
+        uint16_t *phwRow = &phwTarget[iY * iTargetStride];
+        __arm_2d_u16x8_t vAccB, vAccG, vAccR;
+
+        if (bRecoverV) {
+            for (int_fast8_t n = 0; n < 8; n++) {
+                vAccB[n] = ptStatusV[iY + n].hwB;
+                vAccG[n] = ptStatusV[iY + n].hwG;
+                vAccR[n] = ptStatusV[iY + n].hwR;
+            }
+        } else {
+            __arm_2d_u16x8_t vPixel;
+            for (int_fast8_t n = 0; n < 8; n++) {
+                vPixel[n] = phwRow[n * iTargetStride];
+            }
+            vAccB = (vPixel & 0x1F) << 3;
+            vAccG = ((vPixel >> 5) & 0x3F) << 2;
+            vAccR = (vPixel >> 11) << 3;
+        }
+
+        for (iX = 0; iX < iWidth; iX++) {
+            __arm_2d_u16x8_t vPixel;
+            for (int_fast8_t n = 0; n < 8; n++) {
+                vPixel[n] = phwRow[n * iTargetStride + iX];
+            }
+
+            vAccB = (vAccB * chBlurDegree + ((vPixel & 0x1F) << 3) * hwRatio) >> 8;
+            vAccG = (vAccG * chBlurDegree + (((vPixel >> 5) & 0x3F) << 2) * hwRatio) >> 8;
+            vAccR = (vAccR * chBlurDegree + ((vPixel >> 11) << 3) * hwRatio) >> 8;
+
+            vPixel = ((vAccR >> 3) << 11) | ((vAccG >> 2) << 5) | (vAccB >> 3);
+
+            for (int_fast8_t n = 0; n < 8; n++) {
+                phwRow[n * iTargetStride + iX] = vPixel[n];
+            }
+        }
+
+        if (NULL != ptStatusV) {
+            for (int_fast8_t n = 0; n < 8; n++) {
+                ptStatusV[iY + n].hwB = vAccB[n];
+                ptStatusV[iY + n].hwG = vAccG[n];
+                ptStatusV[iY + n].hwR = vAccR[n];
+            }
+        }
+    }
+
+    for (; iY < iHeight; iY++) {
+        uint16_t *phwTargetPixel = &phwTarget[iY * iTargetStride];
+        __arm_2d_iir_blur_acc_rgb565_t tAcc;
+        __arm_2d_color_fast_rgb_t tPixel;
+
+        if (bRecoverV) {
+            tAcc = ptStatusV[iY];
+        } else {
+            __arm_2d_rgb565_unpack(*phwTargetPixel, &tPixel);
+            tAcc.hwB = tPixel.B;
+            tAcc.hwG = tPixel.G;
+            tAcc.hwR = tPixel.R;
+        }
+
+        for (iX = 0; iX < iWidth; iX++) {
+            __arm_2d_rgb565_unpack(*phwTargetPixel, &tPixel);
+
+            tAcc.hwB += (tPixel.B - tAcc.hwB) * hwRatio >> 8;  tPixel.B = tAcc.hwB; 
+            tAcc.hwG += (tPixel.G - tAcc.hwG) * hwRatio >> 8;  tPixel.G = tAcc.hwG;
+            tAcc.hwR += (tPixel.R - tAcc.hwR) * hwRatio >> 8;  tPixel.R = tAcc.hwR;
+
+            *phwTargetPixel++ = __arm_2d_rgb565_pack(&tPixel);
+        }
+
+        if (NULL != ptStatusV) {
+            ptStatusV[iY] = tAcc;
+        }
+    }
+
+    /* columns direct path */
+    if (NULL != ptStatusH) {
+        ptStatusH += tOffset.iX;
+    }
+    bool bRecoverH = (NULL != ptStatusH) && (tOffset.iY > 0);
+
+    for (iX = 0; iX + 8 <= iWidth; iX += 8) {
+        uint16_t *phwTargetPixel = &phwTarget[iX];
+        __arm_2d_u16x8_t vAccB, vAccG, vAccR;
+
+        if (bRecoverH) {
+            for (int_fast8_t n = 0; n < 8; n++) {
+                vAccB[n] = ptStatusH[iX + n].hwB;
+                vAccG[n] = ptStatusH[iX + n].hwG;
+                vAccR[n] = ptStatusH[iX + n].hwR;
+            }
+        } else {
+            __arm_2d_u16x8_t vPixel = __arm_2d_simd_load_u16x8(phwTargetPixel);
+            vAccB = (vPixel & 0x1F) << 3;
+            vAccG = ((vPixel >> 5) & 0x3F) << 2;
+            vAccR = (vPixel >> 11) << 3;
+        }
+
+        for (iY = 0; iY < iHeight; iY++) {
+            __arm_2d_u16x8_t vPixel = __arm_2d_simd_load_u16x8(phwTargetPixel);
+
+            vAccB = (vAccB * chBlurDegree + ((vPixel & 0x1F) << 3) * hwRatio) >> 8;
+            vAccG = (vAccG * chBlurDegree + (((vPixel >> 5) & 0x3F) << 2) * hwRatio) >> 8;
+            vAccR = (vAccR * chBlurDegree + ((vPixel >> 11) << 3) * hwRatio) >> 8;
+
+            vPixel = ((vAccR >> 3) << 11) | ((vAccG >> 2) << 5) | (vAccB >> 3);
+            __builtin_memcpy(phwTargetPixel, &vPixel, sizeof(vPixel));
+
+            phwTargetPixel += iTargetStride;
+        }
+
+        if (NULL != ptStatusH) {
+            for (int_fast8_t n = 0; n < 8; n++) {
+                ptStatusH[iX + n].hwB = vAccB[n];
+                ptStatusH[iX + n].hwG = vAccG[n];
+                ptStatusH[iX + n].hwR = vAccR[n];
+            }
+        }
+    }
+
+    for (; iX < iWidth; iX++) {
+        uint16_t *phwTargetPixel = &phwTarget[iX];
+        __arm_2d_iir_blur_acc_rgb565_t tAcc;
+        __arm_2d_color_fast_rgb_t tPixel;
+
+        if (bRecoverH) {
+            tAcc = ptStatusH[iX];
+        } else {
+            __arm_2d_rgb565_unpack(*phwTargetPixel, &tPixel);
+            tAcc.hwB = tPixel.B;
+            tAcc.hwG = tPixel.G;
+            tAcc.hwR = tPixel.R;
+        }
+
+        for (iY = 0; iY < iHeight; iY++) {
+            __arm_2d_rgb565_unpack(*phwTargetPixel, &tPixel);
+
+            tAcc.hwB += (tPixel.B - tAcc.hwB) * hwRatio >> 8;  tPixel.B = tAcc.hwB; 
+            tAcc.hwG += (tPixel.G - tAcc.hwG) * hwRatio >> 8;  tPixel.G = tAcc.hwG;
+            tAcc.hwR += (tPixel.R - tAcc.hwR) * hwRatio >> 8;  tPixel.R = tAcc.hwR;
+
+            *phwTargetPixel = __arm_2d_rgb565_pack(&tPixel);
+
+            phwTargetPixel += iTargetStride;
+        }
+
+        if (NULL != ptStatusH) {
+            ptStatusH[iX] = tAcc;
+        }
+    }
+}
+
+/*!
+ * \brief update the IIR accumulators of 4 cccn888 pixels, and return the
+ *        blurred pixels
+ * \note the accumulators have one lane per byte, and the alpha channels of
+ *       the pixels are kept.
+ */
+__STATIC_FORCEINLINE
+__arm_2d_u32x4_t __arm_2d_simd_cccn888_iir_blur_step(
+                                            __arm_2d_u16x16_t *__RESTRICT pvAcc,
+                                            __arm_2d_u32x4_t vPixel,
+                                            uint8_t chBlurDegree,
+                                            uint16_t hwRatio)
+{
+    const __arm_2d_u8x16_t vAlphaMask = {
+        0, 0, 0, 0xFF, 0, 0, 0, 0xFF, 0, 0, 0, 0xFF, 0, 0, 0, 0xFF,
+    };
+    __arm_2d_u8x16_t vBytes;
+
+    __builtin_memcpy(&vBytes, &vPixel, sizeof(vBytes));
+
+    *pvAcc = ((*pvAcc) * chBlurDegree
+           + __builtin_convertvector(vBytes, __arm_2d_u16x16_t) * hwRatio) >> 8;
+
+    vBytes = (__builtin_convertvector(*pvAcc, __arm_2d_u8x16_t) & ~vAlphaMask)
+           | (vBytes & vAlphaMask);
+
+    __builtin_memcpy(&vPixel, &vBytes, sizeof(vPixel));
+    return vPixel;
+}
+
+void __SIMD_WRAPPER(__arm_2d_impl_cccn888_filter_iir_blur)(
+                            uint32_t *__RESTRICT pwTarget,
+                            int16_t iTargetStride,
+                            arm_2d_region_t *__RESTRICT ptValidRegionOnVirtualScreen,
+                            arm_2d_region_t *ptTargetRegionOnVirtualScreen,
+                            uint8_t chBlurDegree,
+                            arm_2d_scratch_mem_t *ptScratchMemory)
+{
+    int_fast16_t iWidth = ptValidRegionOnVirtualScreen->tSize.iWidth;
+    int_fast16_t iHeight = ptValidRegionOnVirtualScreen->tSize.iHeight;
+
+    int_fast16_t iY, iX;
+    uint16_t hwRatio = 256 - chBlurDegree;
+    __arm_2d_iir_blur_acc_cccn888_t *ptStatusH = NULL;
+    __arm_2d_iir_blur_acc_cccn888_t *ptStatusV = NULL;
+
+    if (NULL != (void *)(ptScratchMemory->pBuffer)) {
+        ptStatusH = (__arm_2d_iir_blur_acc_cccn888_t *)ptScratchMemory->pBuffer;
+        ptStatusV = ptStatusH + ptTargetRegionOnVirtualScreen->tSize.iWidth;
+    }
+
+    /* calculate the offset between the target region and the valid region */
+    arm_2d_location_t tOffset = {
+        .iX = ptValidRegionOnVirtualScreen->tLocation.iX - ptTargetRegionOnVirtualScreen->tLocation.iX,
+        .iY = ptValidRegionOnVirtualScreen->tLocation.iY - ptTargetRegionOnVirtualScreen->tLocation.iY,
+    };
+
+    /* rows direct path */
+    if (NULL != ptStatusV) {
+        ptStatusV += tOffset.iY;
+    }
+    bool bRecoverV = (NULL != ptStatusV) && (tOffset.iX > 0);
+
+    for (iY = 0; iY + 4 <= iHeight; iY += 4) {
+        uint32_t *pwRow = &pwTarget[iY * iTargetStride];
+        __arm_2d_u32x4_t vPixel;
+        __arm_2d_u8x16_t vBytes;
+        __arm_2d_u16x16_t vAcc;
+
+        for (int_fast8_t n = 0; n < 4; n++) {
+            vPixel[n] = pwRow[n * iTargetStride];
+        }
+        __builtin_memcpy(&vBytes, &vPixel, sizeof(vBytes));
+        vAcc = __builtin_convertvector(vBytes, __arm_2d_u16x16_t);
+
+        if (bRecoverV) {
+            for (int_fast8_t n = 0; n < 4; n++) {
+                vAcc[n * 4 + 0] = ptStatusV[iY + n].hwB;
+                vAcc[n * 4 + 1] = ptStatusV[iY + n].hwG;
+                vAcc[n * 4 + 2] = ptStatusV[iY + n].hwR;
+            }
+        }
+
+        /* blocks of 4x4 pixels, transposed so that the lanes are rows */
+        for (iX = 0; iX + 4 <= iWidth; iX += 4) {
+            __arm_2d_u32x4_t vRows[4], vColumns[4];
+
+            for (int_fast8_t n = 0; n < 4; n++) {
+                vRows[n] = __arm_2d_simd_load_u32x4(&pwRow[n * iTargetStride + iX]);
+            }
+
+            __arm_2d_simd_transpose_u32x4(vColumns, vRows);
+
+            for (int_fast8_t n = 0; n < 4; n++) {
+                vColumns[n] = __arm_2d_simd_cccn888_iir_blur_step(
+                                                            &vAcc,
+                                                            vColumns[n],
+                                                            chBlurDegree,
+                                                            hwRatio);
+            }
+
+            __arm_2d_simd_transpose_u32x4(vRows, vColumns);
+
+            for (int_fast8_t n = 0; n < 4; n++) {
+                __builtin_memcpy(   &pwRow[n * iTargetStride + iX], 
+                                    &vRows[n], 
+                                    sizeof(vRows[n]));
+            }
+        }
+
+        for (; iX < iWidth; iX++) {
+            for (int_fast8_t n = 0; n < 4; n++) {
+                vPixel[n] = pwRow[n * iTargetStride + iX];
+            }
+
+            vPixel = __arm_2d_simd_cccn888_iir_blur_step(   &vAcc,
+                                                            vPixel,
+                                                            chBlurDegree,
+                                                            hwRatio);
+
+            for (int_fast8_t n = 0; n < 4; n++) {
+                pwRow[n * iTargetStride + iX] = vPixel[n];
+            }
+        }
+
+        if (NULL != ptStatusV) {
+            for (int_fast8_t n = 0; n < 4; n++) {
+                ptStatusV[iY + n].hwB = vAcc[n * 4 + 0];
+                ptStatusV[iY + n].hwG = vAcc[n * 4 + 1];
+                ptStatusV[iY + n].hwR = vAcc[n * 4 + 2];
+            }
+        }
+    }
+
+    for (; iY < iHeight; iY++) {
+        uint8_t *pchChannel = (uint8_t *)&pwTarget[iY * iTargetStride];
+        __arm_2d_iir_blur_acc_cccn888_t tAcc;
+
+        if (bRecoverV) {
+            tAcc = ptStatusV[iY];
+        } else {
+            tAcc.hwB = pchChannel[0];
+            tAcc.hwG = pchChannel[1];
+            tAcc.hwR = pchChannel[2];
+        }
+
+        for (iX = 0; iX < iWidth; iX++) {
+            tAcc.hwB += ((*pchChannel) - tAcc.hwB) * hwRatio >> 8;  *pchChannel++ = tAcc.hwB; 
+            tAcc.hwG += ((*pchChannel) - tAcc.hwG) * hwRatio >> 8;  *pchChannel++ = tAcc.hwG;
+            tAcc.hwR += ((*pchChannel) - tAcc.hwR) * hwRatio >> 8;  *pchChannel++ = tAcc.hwR;
+
+            pchChannel++;
+        }
+
+        if (NULL != ptStatusV) {
+            ptStatusV[iY] = tAcc;
+        }
+    }
+
+    /* columns direct path */
+    if (NULL != ptStatusH) {
+        ptStatusH += tOffset.iX;
+    }
+    bool bRecoverH = (NULL != ptStatusH) && (tOffset.iY > 0);
+
+    for (iX = 0; iX + 4 <= iWidth; iX += 4) {
+        uint32_t *pwTargetPixel = &pwTarget[iX];
+        __arm_2d_u8x16_t vBytes;
+        __arm_2d_u16x16_t vAcc;
+
+        __builtin_memcpy(&vBytes, pwTargetPixel, sizeof(vBytes));
+        vAcc = __builtin_convertvector(vBytes, __arm_2d_u16x16_t);
+
+        if (bRecoverH) {
+            for (int_fast8_t n = 0; n < 4; n++) {
+                vAcc[n * 4 + 0] = ptStatusH[iX + n].hwB;
+                vAcc[n * 4 + 1] = ptStatusH[iX + n].hwG;
+                vAcc[n * 4 + 2] = ptStatusH[iX + n].hwR;
+            }
+        }
+
+        for (iY = 0; iY < iHeight; iY++) {
+            __arm_2d_u32x4_t vPixel = __arm_2d_simd_cccn888_iir_blur_step(
+                                        &vAcc,
+                                        __arm_2d_simd_load_u32x4(pwTargetPixel),
+                                        chBlurDegree,
+                                        hwRatio);
+            __builtin_memcpy(pwTargetPixel, &vPixel, sizeof(vPixel));
+
+            pwTargetPixel += iTargetStride;
+        }
+
+        if (NULL != ptStatusH) {
+            for (int_fast8_t n = 0; n < 4; n++) {
+                ptStatusH[iX + n].hwB = vAcc[n * 4 + 0];
+                ptStatusH[iX + n].hwG = vAcc[n * 4 + 1];
+                ptStatusH[iX + n].hwR = vAcc[n * 4 + 2];
+            }
+        }
+    }
+
+    for (; iX < iWidth; iX++) {
+        uint8_t *pchChannel = (uint8_t *)&pwTarget[iX];
+        __arm_2d_iir_blur_acc_cccn888_t tAcc;
+
+        if (bRecoverH) {
+            tAcc = ptStatusH[iX];
+        } else {
+            tAcc.hwB = pchChannel[0];
+            tAcc.hwG = pchChannel[1];
+            tAcc.hwR = pchChannel[2];
+        }
+
+        for (iY = 0; iY < iHeight; iY++) {
+            tAcc.hwB += ((*pchChannel) - tAcc.hwB) * hwRatio >> 8;  *pchChannel++ = tAcc.hwB; 
+            tAcc.hwG += ((*pchChannel) - tAcc.hwG) * hwRatio >> 8;  *pchChannel++ = tAcc.hwG;
+            tAcc.hwR += ((*pchChannel) - tAcc.hwR) * hwRatio >> 8;  *pchChannel++ = tAcc.hwR;
+
+            pchChannel += (iTargetStride * sizeof(uint32_t)) - 3;
+        }
+
+        if (NULL != ptStatusH) {
+            ptStatusH[iX] = tAcc;
+        }
+    }
+}
+
+#endif  /* !__ARM_2D_CFG_USE_IIR_BLUR_REVERSE_PATH__ */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* __ARM_2D_HAS_PORTABLE_SIMD__ */
@@ -109,6 +109,13 @@ extern "C" {
         tPixel.A = *((uint8_t *)pTarget + 3),                   \
         __arm_2d_ccca888_pack(&tPixel))
 
+#define __API_PIXEL_AVERAGE_RESULT_CCCA8888()                   \
+    (   tPixel.R >>= 8,                                         \
+        tPixel.G >>= 8,                                         \
+        tPixel.B >>= 8,                                         \
+        tPixel.A >>= 8,                                         \
+        __arm_2d_ccca888_pack(&tPixel))
+
 
 #define __API_COLOUR                gray8
 #define __API_INT_TYPE              uint8_t
@@ -136,6 +143,16 @@ extern "C" {
 
 #include "__arm_2d_ll_transform.inc"
 
+/* premultiplied ccca8888: the alpha channel is interpolated and blended too */
+#define __API_COLOUR                ccca8888
+#define __API_INT_TYPE              uint32_t
+#define __API_INT_TYPE_BIT_NUM      32
+#define __API_PIXEL_BLENDING        __ARM_2D_PIXEL_BLENDING_OPA_CCCA8888
+#define __API_PIXEL_AVERAGE         __ARM_2D_PIXEL_AVERAGE_CCCA8888
+#define __API_PIXEL_AVERAGE_RESULT  __API_PIXEL_AVERAGE_RESULT_CCCA8888
+
+#include "__arm_2d_ll_transform.inc"
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
 /*============================ GLOBAL VARIABLES ==============================*/
@@ -288,6 +305,168 @@ __arm_2d_point_get_adjacent_alpha_q16(arm_2d_point_fx_t *ptPoint)
     return tResult;
 }
 
+/*
+ * A transformed point can only contribute to the target when it lies inside
+ * the source region extended by one pixel on each side (the neighbourhood of
+ * anti-alias sampling). Another pixel of margin absorbs the rounding errors
+ * of the regression and of the half-precision vector paths. Pixels outside
+ * the returned span are guaranteed to leave the target untouched, while the
+ * pixels inside are still checked by the get-pixel functions.
+ */
+#if __ARM_2D_CFG_FORCED_FIXED_POINT_TRANSFORM__
+
+static
+bool __arm_2d_transform_clip_span_axis(int64_t lFirst,
+                                       int64_t lLast,
+                                       int_fast16_t iWidth,
+                                       int16_t iLocation,
+                                       int16_t iSize,
+                                       int32_t *pnStart,
+                                       int32_t *pnEnd)
+{
+    int64_t lLow = (int64_t)(iLocation - 2) << 16;
+    int64_t lHigh = (int64_t)(iLocation + iSize + 1) << 16;
+    int64_t lDelta = lLast - lFirst;
+
+    if (1 == iWidth || 0 == lDelta) {
+        return (lFirst > lLow) && (lFirst < lHigh);
+    }
+
+    /* solve lLow < lFirst + lDelta * x / (iWidth - 1) < lHigh */
+    int64_t lA = (lLow - lFirst) * (iWidth - 1) / lDelta;
+    int64_t lB = (lHigh - lFirst) * (iWidth - 1) / lDelta;
+
+    if (lA > lB) {
+        int64_t lTemp = lA;
+        lA = lB;
+        lB = lTemp;
+    }
+
+    /* one column of slack for the truncation of the division */
+    *pnStart = MAX(*pnStart, (int32_t)MAX(lA - 1, -1));
+    *pnEnd = MIN(*pnEnd, (int32_t)MIN(lB + 2, iWidth));
+
+    return true;
+}
+
+__arm_2d_transform_span_t
+__arm_2d_transform_get_row_span(const arm_2d_rot_linear_regr_t regrCoefs[2],
+                                int_fast16_t iY,
+                                int_fast16_t iWidth,
+                                const arm_2d_region_t *ptOrigValidRegion)
+{
+    assert(NULL != ptOrigValidRegion);
+
+    __arm_2d_transform_span_t tSpan = {0, 0};
+    int32_t nStart = 0;
+    int32_t nEnd = iWidth;
+
+    if (!__arm_2d_transform_clip_span_axis(
+                (int64_t)regrCoefs[0].slopeX * iY + regrCoefs[0].interceptX,
+                (int64_t)regrCoefs[1].slopeX * iY + regrCoefs[1].interceptX,
+                iWidth,
+                ptOrigValidRegion->tLocation.iX,
+                ptOrigValidRegion->tSize.iWidth,
+                &nStart,
+                &nEnd)) {
+        return tSpan;
+    }
+
+    if (!__arm_2d_transform_clip_span_axis(
+                (int64_t)regrCoefs[0].slopeY * iY + regrCoefs[0].interceptY,
+                (int64_t)regrCoefs[1].slopeY * iY + regrCoefs[1].interceptY,
+                iWidth,
+                ptOrigValidRegion->tLocation.iY,
+                ptOrigValidRegion->tSize.iHeight,
+                &nStart,
+                &nEnd)) {
+        return tSpan;
+    }
+
+    if (nStart < nEnd) {
+        tSpan.iStart = (int16_t)MAX(nStart, 0);
+        tSpan.iEnd = (int16_t)nEnd;
+    }
+
+    return tSpan;
+}
+
+#else
+
+static
+bool __arm_2d_transform_clip_span_axis(float fFirst,
+                                       float fLast,
+                                       int_fast16_t iWidth,
+                                       int16_t iLocation,
+                                       int16_t iSize,
+                                       float *pfStart,
+                                       float *pfEnd)
+{
+    float fLow = (float)(iLocation - 2);
+    float fHigh = (float)(iLocation + iSize + 1);
+    float fSlope = iWidth > 1 ? (fLast - fFirst) / (float)(iWidth - 1) : 0.0f;
+
+    if (fSlope > -1e-6f && fSlope < 1e-6f) {
+        return (fFirst > fLow) && (fFirst < fHigh);
+    }
+
+    /* solve fLow < fFirst + fSlope * x < fHigh */
+    float fA = (fLow - fFirst) / fSlope;
+    float fB = (fHigh - fFirst) / fSlope;
+
+    *pfStart = MAX(*pfStart, MIN(fA, fB));
+    *pfEnd = MIN(*pfEnd, MAX(fA, fB));
+
+    return true;
+}
+
+__arm_2d_transform_span_t
+__arm_2d_transform_get_row_span(const arm_2d_rot_linear_regr_t regrCoefs[2],
+                                int_fast16_t iY,
+                                int_fast16_t iWidth,
+                                const arm_2d_region_t *ptOrigValidRegion)
+{
+    assert(NULL != ptOrigValidRegion);
+
+    __arm_2d_transform_span_t tSpan = {0, 0};
+    float fStart = 0.0f;
+    float fEnd = (float)(iWidth - 1);
+
+    if (!__arm_2d_transform_clip_span_axis(
+                regrCoefs[0].slopeX * iY + regrCoefs[0].interceptX,
+                regrCoefs[1].slopeX * iY + regrCoefs[1].interceptX,
+                iWidth,
+                ptOrigValidRegion->tLocation.iX,
+                ptOrigValidRegion->tSize.iWidth,
+                &fStart,
+                &fEnd)) {
+        return tSpan;
+    }
+
+    if (!__arm_2d_transform_clip_span_axis(
+                regrCoefs[0].slopeY * iY + regrCoefs[0].interceptY,
+                regrCoefs[1].slopeY * iY + regrCoefs[1].interceptY,
+                iWidth,
+                ptOrigValidRegion->tLocation.iY,
+                ptOrigValidRegion->tSize.iHeight,
+                &fStart,
+                &fEnd)) {
+        return tSpan;
+    }
+
+    if (fStart <= fEnd) {
+        /* fStart and fEnd are within [0, iWidth - 1] here, one column of
+         * slack is added on each side for the rounding 
+         */
+        tSpan.iStart = (int16_t)MAX((int32_t)fStart - 1, 0);
+        tSpan.iEnd = (int16_t)MIN((int32_t)fEnd + 2, iWidth);
+    }
+
+    return tSpan;
+}
+
+#endif
+
 
 
 #if __ARM_2D_CFG_FORCED_FIXED_POINT_TRANSFORM__
@@ -535,12 +714,97 @@ arm_2d_point_float_t *__arm_2d_transform_point(
 }
 
 
+#if __ARM_2D_CFG_SUPPORT_TRANSFORM_MIPMAP__
+/*
+ * When the origin tile belongs to a mip chain and the scaling factor is not 
+ * more than 0.5, replace the origin with the matching part of the level whose
+ * scaling factor falls into (0.5, 1.0]. This reduces both the aliasing and 
+ * the amount of source pixels read from the (usually slow) resource memory.
+ */
+static void __arm_2d_transform_select_mipmap_level(
+                                        arm_2d_op_trans_t *ptThis,
+                                        __arm_2d_transform_info_t *ptTransform)
+{
+    float fScale = ptTransform->fScale;
+    
+    /* the source mask, if any, has to stay aligned with the source */
+    if (    OP_CORE.ptOp->Info.Param.bHasSrcMask
+        ||  (fScale <= 0.0f)
+        ||  (fScale > 0.5f)) {
+        return ;
+    }
+
+    arm_2d_region_t tValidRegion;
+    const arm_2d_tile_t *ptRoot = arm_2d_tile_get_root( this.Origin.ptTile, 
+                                                        &tValidRegion, 
+                                                        NULL);
+    if (    (NULL == ptRoot)
+        ||  (ARM_2D_TILE_EXTENSION_MIPMAP != ptRoot->tInfo.u3ExtensionID)) {
+        return ;
+    }
+
+    const arm_2d_tile_mipmap_t *ptMipmap = (const arm_2d_tile_mipmap_t *)ptRoot;
+    uint_fast8_t chLevelCount = ptRoot->tInfo.Extension.Mipmap.chLevelCount;
+    uint_fast8_t chLevel = 0;
+
+    while((fScale <= 0.5f) && (chLevel < chLevelCount)) {
+        fScale *= 2.0f;
+        chLevel++;
+    }
+    if (0 == chLevel) {
+        return ;
+    }
+
+    /* map the valid region to the level (using root tile's coordinates) */
+    int16_t iMask = (int16_t)((1 << chLevel) - 1);
+    arm_2d_region_t tLevelRegion = {
+        .tLocation = {
+            .iX = tValidRegion.tLocation.iX >> chLevel,
+            .iY = tValidRegion.tLocation.iY >> chLevel,
+        },
+    };
+    tLevelRegion.tSize.iWidth = (int16_t)(((  tValidRegion.tLocation.iX 
+                                            + tValidRegion.tSize.iWidth 
+                                            + iMask) >> chLevel)
+                                         - tLevelRegion.tLocation.iX);
+    tLevelRegion.tSize.iHeight = (int16_t)(((  tValidRegion.tLocation.iY 
+                                             + tValidRegion.tSize.iHeight 
+                                             + iMask) >> chLevel)
+                                          - tLevelRegion.tLocation.iY);
+
+    if (NULL == arm_2d_tile_generate_child( ptMipmap->ptLevels[chLevel - 1],
+                                            &tLevelRegion,
+                                            &ptTransform->tMipmapLevel,
+                                            false)) {
+        return ;
+    }
+
+    /* map the pivot to the level */
+    arm_2d_location_t tCentre;
+    arm_2d_tile_get_absolute_location(this.Origin.ptTile, &tCentre);
+    tCentre.iX += ptTransform->tCenter.iX;
+    tCentre.iY += ptTransform->tCenter.iY;
+
+    ptTransform->tCenter.iX = (int16_t)(((tCentre.iX + (iMask >> 1) + 1) >> chLevel)
+                                        - tLevelRegion.tLocation.iX);
+    ptTransform->tCenter.iY = (int16_t)(((tCentre.iY + (iMask >> 1) + 1) >> chLevel)
+                                        - tLevelRegion.tLocation.iY);
+    ptTransform->fScale = fScale;
+
+    this.Origin.ptTile = &ptTransform->tMipmapLevel;
+}
+#endif
+
 static arm_2d_err_t __arm_2d_transform_preprocess_source(
                                         arm_2d_op_trans_t *ptThis,
                                         __arm_2d_transform_info_t *ptTransform)
 {
     arm_2d_tile_t *ptSource = (arm_2d_tile_t *)this.Source.ptTile;
 
+#if __ARM_2D_CFG_SUPPORT_TRANSFORM_MIPMAP__
+    __arm_2d_transform_select_mipmap_level(ptThis, ptTransform);
+#endif
+
     memset(ptSource, 0, sizeof(*ptSource));
 
     ptSource->tInfo = this.Origin.ptTile->tInfo;
@@ -933,6 +1197,34 @@ arm_2d_err_t arm_2dp_cccn888_tile_transform_only_prepare(
     return __arm_2d_transform_preprocess_source(ptThis, &this.tTransform);
 }
 
+ARM_NONNULL(2)
+arm_2d_err_t arm_2dp_ccca8888_tile_transform_only_prepare(
+                                            arm_2d_op_trans_t *ptOP,
+                                            const arm_2d_tile_t *ptSource,
+                                            const arm_2d_location_t tCentre,
+                                            float fAngle,
+                                            float fScale)
+{
+    assert(NULL != ptSource);
+
+    ARM_2D_IMPL(arm_2d_op_trans_t, ptOP);
+
+    if (!arm_2d_op_wait_async((arm_2d_op_core_t *)ptThis)) {
+        return ARM_2D_ERR_BUSY;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_TRANSFORM_ONLY_CCCA8888;
+
+    this.Source.ptTile = &this.Origin.tDummySource;
+    this.Origin.ptTile = ptSource;
+    this.wMode = 0;
+    this.tTransform.fAngle = fAngle;
+    this.tTransform.fScale = fScale;
+    this.tTransform.tCenter = tCentre;
+
+    return __arm_2d_transform_preprocess_source(ptThis, &this.tTransform);
+}
+
 arm_fsm_rt_t __arm_2d_gray8_sw_transform_only(__arm_2d_sub_task_t *ptTask)
 {
     ARM_2D_IMPL(arm_2d_op_trans_t, ptTask->ptOP);
@@ -975,6 +1267,20 @@ arm_fsm_rt_t __arm_2d_cccn888_sw_transform_only(__arm_2d_sub_task_t *ptTask)
     return arm_fsm_rt_cpl;
 }
 
+arm_fsm_rt_t __arm_2d_ccca8888_sw_transform_only(__arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_trans_t, ptTask->ptOP);
+    assert(ARM_2D_COLOUR_SZ_32BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    ARM_TYPE_CONVERT(ptTask->Param.tCopyOrig.tOrigin.pBuffer, intptr_t) -= 
+          ptTask->Param.tCopyOrig.tOrigin.nOffset * 4;
+
+    __arm_2d_impl_ccca8888_transform_only(&(ptTask->Param.tCopyOrig),
+                                    &this.tTransform);
+
+    return arm_fsm_rt_cpl;
+}
+
 ARM_NONNULL(2)
 arm_2d_err_t arm_2dp_gray8_tile_transform_with_colour_keying_and_opacity_prepare(
                                         arm_2d_op_trans_opa_t *ptOP,
@@ -1233,6 +1539,37 @@ arm_2d_err_t arm_2dp_cccn888_tile_transform_only_with_opacity_prepare(
                                                 &this.tTransform);
 }
 
+ARM_NONNULL(2)
+arm_2d_err_t arm_2dp_ccca8888_tile_transform_only_with_opacity_prepare(
+                                        arm_2d_op_trans_opa_t *ptOP,
+                                        const arm_2d_tile_t *ptSource,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint_fast8_t chOpacity)
+{
+    assert(NULL != ptSource);
+
+    ARM_2D_IMPL(arm_2d_op_trans_opa_t, ptOP);
+
+    if (!arm_2d_op_wait_async((arm_2d_op_core_t *)ptThis)) {
+        return ARM_2D_ERR_BUSY;
+    }
+
+    OP_CORE.ptOp = &ARM_2D_OP_TRANSFORM_ONLY_WITH_OPACITY_CCCA8888;
+
+    this.Source.ptTile = &this.Origin.tDummySource;
+    this.Origin.ptTile = ptSource;
+    this.wMode = 0;
+    this.tTransform.fAngle = fAngle;
+    this.tTransform.fScale = fScale;
+    this.tTransform.tCenter = tCentre;
+    this.chOpacity = chOpacity;
+
+    return __arm_2d_transform_preprocess_source((arm_2d_op_trans_t *)ptThis,
+                                                &this.tTransform);
+}
+
 arm_fsm_rt_t __arm_2d_gray8_sw_transform_only_with_opacity(__arm_2d_sub_task_t *ptTask)
 {
     ARM_2D_IMPL(arm_2d_op_trans_opa_t, ptTask->ptOP);
@@ -1292,6 +1629,23 @@ arm_fsm_rt_t __arm_2d_cccn888_sw_transform_only_with_opacity(__arm_2d_sub_task_t
     return arm_fsm_rt_cpl;
 }
 
+arm_fsm_rt_t __arm_2d_ccca8888_sw_transform_only_with_opacity(__arm_2d_sub_task_t *ptTask)
+{
+    ARM_2D_IMPL(arm_2d_op_trans_opa_t, ptTask->ptOP);
+    assert(ARM_2D_COLOUR_SZ_32BIT == OP_CORE.ptOp->Info.Colour.u3ColourSZ);
+
+    ARM_TYPE_CONVERT(ptTask->Param.tCopyOrig.tOrigin.pBuffer, intptr_t) -= 
+          ptTask->Param.tCopyOrig.tOrigin.nOffset * 4;
+
+    /* even a fully opaque layer is blended: its transparent pixels must not
+     * overwrite the target
+     */
+    __arm_2d_impl_ccca8888_transform_only_opacity(  &(ptTask->Param.tCopyOrig),
+                                                    &this.tTransform,
+                                                    this.chOpacity);
+    return arm_fsm_rt_cpl;
+}
+
 
 ARM_NONNULL(2)
 arm_fsm_rt_t arm_2dp_tile_transform(arm_2d_op_trans_t *ptOP,
@@ -2040,6 +2394,487 @@ arm_fsm_rt_t __arm_2d_cccn888_sw_colour_filling_with_mask_opacity_and_transform(
 }
 
 
+#if __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__
+/*----------------------------------------------------------------------------*
+ * Transform Cache                                                            *
+ *----------------------------------------------------------------------------*/
+
+ARM_NONNULL(1,2)
+arm_2d_err_t arm_2d_transform_cache_init(arm_2d_transform_cache_t *ptThis,
+                                         arm_2d_transform_cache_cfg_t *ptCFG)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptCFG);
+
+    if (    (NULL == ptCFG->pBuffer)
+        ||  (0 == ptCFG->wBufferSize)
+        ||  (NULL == ptCFG->ptItems)
+        ||  (0 == ptCFG->hwItemCount)) {
+        return ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    memset(ptThis, 0, sizeof(arm_2d_transform_cache_t));
+    this.tCFG = *ptCFG;
+
+    if (this.tCFG.fAngleStep <= 0.0f) {
+        this.tCFG.fAngleStep = ARM_2D_ANGLE(1.0f);
+    }
+    if (this.tCFG.fScaleStep <= 0.0f) {
+        this.tCFG.fScaleStep = 1.0f / 64.0f;
+    }
+
+    ARM_2D_OP_INIT(this.tTransformOP);
+    ARM_2D_OP_INIT(this.tFillOP);
+    ARM_2D_OP_INIT(this.tFallbackOP);
+
+    arm_2d_transform_cache_invalidate(ptThis);
+
+    return ARM_2D_ERR_NONE;
+}
+
+ARM_NONNULL(1)
+void arm_2d_transform_cache_invalidate(arm_2d_transform_cache_t *ptThis)
+{
+    assert(NULL != ptThis);
+
+    /* the pending OPs might still read or write the arena */
+    arm_2d_op_wait_async((arm_2d_op_core_t *)&this.tTransformOP);
+    arm_2d_op_wait_async((arm_2d_op_core_t *)&this.tFillOP);
+
+    memset(this.tCFG.ptItems, 
+           0, 
+           sizeof(arm_2d_transform_cache_item_t) * this.tCFG.hwItemCount);
+    this.wUsedSize = 0;
+}
+
+static
+void __arm_2d_transform_cache_evict(arm_2d_transform_cache_t *ptThis,
+                                    arm_2d_transform_cache_item_t *ptItem)
+{
+    uint8_t *pchBuffer = (uint8_t *)this.tCFG.pBuffer;
+    uint32_t wEnd = ptItem->wOffset + ptItem->wSize;
+
+    /* keep the arena compact, so the free space is always at the end */
+    memmove(pchBuffer + ptItem->wOffset,
+            pchBuffer + wEnd,
+            this.wUsedSize - wEnd);
+
+    arm_2d_transform_cache_item_t *ptEntry = this.tCFG.ptItems;
+    for (uint_fast16_t n = 0; n < this.tCFG.hwItemCount; n++, ptEntry++) {
+        if (ptEntry->bValid && ptEntry->wOffset > ptItem->wOffset) {
+            ptEntry->wOffset -= ptItem->wSize;
+        }
+    }
+
+    this.wUsedSize -= ptItem->wSize;
+    ptItem->bValid = false;
+}
+
+static
+arm_2d_transform_cache_item_t *__arm_2d_transform_cache_alloc(
+                                            arm_2d_transform_cache_t *ptThis,
+                                            uint32_t wSize)
+{
+    if (wSize > this.tCFG.wBufferSize) {
+        return NULL;
+    }
+
+    do {
+        arm_2d_transform_cache_item_t *ptFree = NULL;
+        arm_2d_transform_cache_item_t *ptLRU = NULL;
+        arm_2d_transform_cache_item_t *ptEntry = this.tCFG.ptItems;
+
+        for (uint_fast16_t n = 0; n < this.tCFG.hwItemCount; n++, ptEntry++) {
+            if (!ptEntry->bValid) {
+                if (NULL == ptFree) {
+                    ptFree = ptEntry;
+                }
+            } else if ( (NULL == ptLRU)
+                    ||  (ptEntry->wTimestamp < ptLRU->wTimestamp)) {
+                ptLRU = ptEntry;
+            }
+        }
+
+        if (    (NULL != ptFree)
+            &&  (this.wUsedSize + wSize <= this.tCFG.wBufferSize)) {
+            ptFree->wOffset = this.wUsedSize;
+            ptFree->wSize = wSize;
+            this.wUsedSize += wSize;
+            return ptFree;
+        }
+
+        if (NULL == ptLRU) {
+            return NULL;
+        }
+
+        __arm_2d_transform_cache_evict(ptThis, ptLRU);
+    } while(true);
+}
+
+/*
+ * find the transformed mask in the cache or render it into the cache. NULL 
+ * means the mask cannot be cached and should be drawn without the cache.
+ */
+static
+arm_2d_transform_cache_item_t *__arm_2d_transform_cache_request(
+                                            arm_2d_transform_cache_t *ptThis,
+                                            const arm_2d_tile_t *ptMask,
+                                            arm_2d_location_t tCentre,
+                                            float fAngle,
+                                            float fScale)
+{
+    arm_2d_region_t tValidRegion;
+    const arm_2d_tile_t *ptRoot = arm_2d_tile_get_root(ptMask, 
+                                                       &tValidRegion, 
+                                                       NULL);
+    if (NULL == ptRoot) {
+        return NULL;
+    }
+
+    /* the key uses the root tile's coordinates */
+    arm_2d_location_t tAbsoluteCentre = tCentre;
+    do {
+        arm_2d_location_t tLocation;
+        arm_2d_tile_get_absolute_location(ptMask, &tLocation);
+        tAbsoluteCentre.iX += tLocation.iX;
+        tAbsoluteCentre.iY += tLocation.iY;
+    } while(0);
+
+    /* quantise the angle and the scaling factor */
+    fAngle = ARM_2D_FMODF(fAngle, ARM_2D_ANGLE(360));
+    if (fAngle < 0.0f) {
+        fAngle += ARM_2D_ANGLE(360);
+    }
+    if (0.0f == fScale) {
+        fScale = 1.0f;
+    }
+    int32_t nAngle = (int32_t)(fAngle / this.tCFG.fAngleStep + 0.5f);
+    int32_t nScale = (int32_t)(fScale / this.tCFG.fScaleStep + 0.5f);
+    if (nScale <= 0) {
+        nScale = 1;
+    }
+
+    this.wTick++;
+
+    arm_2d_transform_cache_item_t *ptItem = this.tCFG.ptItems;
+    for (uint_fast16_t n = 0; n < this.tCFG.hwItemCount; n++, ptItem++) {
+        if (    ptItem->bValid
+            &&  ptItem->ptRoot == ptRoot
+            &&  ptItem->nAngle == nAngle
+            &&  ptItem->nScale == nScale
+            &&  ptItem->tCentre.iX == tAbsoluteCentre.iX
+            &&  ptItem->tCentre.iY == tAbsoluteCentre.iY
+            &&  0 == memcmp(&ptItem->tRegion, 
+                            &tValidRegion, 
+                            sizeof(arm_2d_region_t))) {
+            ptItem->wTimestamp = this.wTick;
+            this.Statistics.wHit++;
+            return ptItem;
+        }
+    }
+
+    /* miss: calculate the size of the transformed mask */
+    if (ARM_2D_ERR_NONE != arm_2dp_gray8_tile_transform_only_prepare(
+                                            &this.tTransformOP,
+                                            ptMask,
+                                            tCentre,
+                                            (float)nAngle * this.tCFG.fAngleStep,
+                                            (float)nScale * this.tCFG.fScaleStep)) {
+        return NULL;
+    }
+
+    arm_2d_size_t tSize = this.tTransformOP.Origin.tDummySource.tRegion.tSize;
+    if (tSize.iWidth <= 0 || tSize.iHeight <= 0) {
+        return NULL;
+    }
+
+    uint32_t wSize = (uint32_t)tSize.iWidth * (uint32_t)tSize.iHeight;
+    wSize = (wSize + 3) & ~(uint32_t)3;
+
+    ptItem = __arm_2d_transform_cache_alloc(ptThis, wSize);
+    if (NULL == ptItem) {
+        return NULL;
+    }
+
+    ptItem->ptRoot = ptRoot;
+    ptItem->tRegion = tValidRegion;
+    ptItem->tCentre = tAbsoluteCentre;
+    ptItem->nAngle = nAngle;
+    ptItem->nScale = nScale;
+    ptItem->tSize = tSize;
+    ptItem->tPivot.iX = this.tTransformOP.tTransform.tCenter.iX
+                      - this.tTransformOP.tTransform.tDummySourceOffset.iX;
+    ptItem->tPivot.iY = this.tTransformOP.tTransform.tCenter.iY
+                      - this.tTransformOP.tTransform.tDummySourceOffset.iY;
+    ptItem->wTimestamp = this.wTick;
+    ptItem->bValid = true;
+
+    /* render the transformed mask on a transparent background */
+    uint8_t *pchBuffer = (uint8_t *)this.tCFG.pBuffer + ptItem->wOffset;
+    memset(pchBuffer, 0, wSize);
+
+    this.tMask = (arm_2d_tile_t) {
+        .tRegion = {
+            .tSize = tSize,
+        },
+        .tInfo = {
+            .bIsRoot = true,
+            .bHasEnforcedColour = true,
+            .tColourInfo = {
+                .chScheme = ARM_2D_COLOUR_MASK_A8,
+            },
+        },
+        .pchBuffer = pchBuffer,
+    };
+
+    arm_fsm_rt_t tResult = arm_2dp_tile_transform(&this.tTransformOP,
+                                                  &this.tMask,
+                                                  NULL,
+                                                  &ptItem->tPivot);
+    if (tResult < 0) {
+        __arm_2d_transform_cache_evict(ptThis, ptItem);
+        return NULL;
+    }
+
+    this.Statistics.wMiss++;
+
+    return ptItem;
+}
+
+static
+arm_fsm_rt_t __arm_2d_transform_cache_fill_colour(
+                                        arm_2d_transform_cache_t *ptThis,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint32_t wFillColour,
+                                        uint_fast8_t chOpacity,
+                                        const arm_2d_location_t *ptTargetCentre,
+                                        uint_fast8_t chColourScheme)
+{
+    assert(NULL != ptThis);
+    assert(NULL != ptMask);
+    assert(NULL != ptTarget);
+
+    //! valid alpha mask tile
+    if (!__arm_2d_valid_mask(ptMask, __ARM_2D_MASK_ALLOW_A8 )) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_INVALID_PARAM;
+    }
+
+    /* the previous OPs might still use the arena, tMask and tTarget */
+    if (    !arm_2d_op_wait_async((arm_2d_op_core_t *)&this.tTransformOP)
+        ||  !arm_2d_op_wait_async((arm_2d_op_core_t *)&this.tFillOP)) {
+        return (arm_fsm_rt_t)ARM_2D_ERR_BUSY;
+    }
+
+    arm_2d_region_t tTargetRegion = {
+        .tSize = ptTarget->tRegion.tSize,
+    };
+    if (NULL == ptRegion) {
+        ptRegion = &tTargetRegion;
+    }
+
+    if (NULL == arm_2d_tile_generate_child( ptTarget,
+                                            ptRegion,
+                                            &this.tTarget,
+                                            false)) {
+        arm_fsm_rt_t tResult = (arm_fsm_rt_t)ARM_2D_ERR_OUT_OF_REGION;
+        if (ARM_2D_RUNTIME_FEATURE.TREAT_OUT_OF_RANGE_AS_COMPLETE) {
+            tResult = arm_fsm_rt_cpl;
+        }
+        return tResult;
+    }
+
+    arm_2d_transform_cache_item_t *ptItem = 
+        __arm_2d_transform_cache_request(ptThis, ptMask, tCentre, fAngle, fScale);
+
+    if (NULL == ptItem) {
+        /* draw without the cache */
+        arm_2d_err_t tErr;
+        this.Statistics.wBypass++;
+
+        switch (chColourScheme) {
+            case ARM_2D_COLOUR_GRAY8:
+                tErr = arm_2dp_gray8_fill_colour_with_mask_opacity_and_transform_prepare(
+                                                            &this.tFallbackOP,
+                                                            ptMask,
+                                                            tCentre,
+                                                            fAngle,
+                                                            fScale,
+                                                            (uint8_t)wFillColour,
+                                                            chOpacity);
+                break;
+            case ARM_2D_COLOUR_RGB565:
+                tErr = arm_2dp_rgb565_fill_colour_with_mask_opacity_and_transform_prepare(
+                                                            &this.tFallbackOP,
+                                                            ptMask,
+                                                            tCentre,
+                                                            fAngle,
+                                                            fScale,
+                                                            (uint16_t)wFillColour,
+                                                            chOpacity);
+                break;
+            default:
+                tErr = arm_2dp_cccn888_fill_colour_with_mask_opacity_and_transform_prepare(
+                                                            &this.tFallbackOP,
+                                                            ptMask,
+                                                            tCentre,
+                                                            fAngle,
+                                                            fScale,
+                                                            wFillColour,
+                                                            chOpacity);
+                break;
+        }
+
+        if (ARM_2D_ERR_NONE != tErr) {
+            return (arm_fsm_rt_t)tErr;
+        }
+
+        return arm_2dp_tile_transform(  (arm_2d_op_trans_t *)&this.tFallbackOP,
+                                        ptTarget,
+                                        ptRegion,
+                                        ptTargetCentre);
+    }
+
+    /* align the pivot of the cached mask with the target centre */
+    arm_2d_region_t tDrawRegion = {
+        .tSize = ptItem->tSize,
+    };
+    if (NULL != ptTargetCentre) {
+        tDrawRegion.tLocation.iX = ptTargetCentre->iX - ptRegion->tLocation.iX;
+        tDrawRegion.tLocation.iY = ptTargetCentre->iY - ptRegion->tLocation.iY;
+    } else {
+        tDrawRegion.tLocation.iX = this.tTarget.tRegion.tSize.iWidth >> 1;
+        tDrawRegion.tLocation.iY = this.tTarget.tRegion.tSize.iHeight >> 1;
+    }
+    tDrawRegion.tLocation.iX -= ptItem->tPivot.iX;
+    tDrawRegion.tLocation.iY -= ptItem->tPivot.iY;
+
+    this.tMask = (arm_2d_tile_t) {
+        .tRegion = {
+            .tSize = ptItem->tSize,
+        },
+        .tInfo = {
+            .bIsRoot = true,
+            .bHasEnforcedColour = true,
+            .tColourInfo = {
+                .chScheme = ARM_2D_COLOUR_MASK_A8,
+            },
+        },
+        .pchBuffer = (uint8_t *)this.tCFG.pBuffer + ptItem->wOffset,
+    };
+
+    switch (chColourScheme) {
+        case ARM_2D_COLOUR_GRAY8:
+            return arm_2dp_gray8_fill_colour_with_mask_and_opacity(
+                                &this.tFillOP,
+                                &this.tTarget,
+                                &tDrawRegion,
+                                &this.tMask,
+                                (arm_2d_color_gray8_t){(uint8_t)wFillColour},
+                                (uint8_t)chOpacity);
+        case ARM_2D_COLOUR_RGB565:
+            return arm_2dp_rgb565_fill_colour_with_mask_and_opacity(
+                                &this.tFillOP,
+                                &this.tTarget,
+                                &tDrawRegion,
+                                &this.tMask,
+                                (arm_2d_color_rgb565_t){(uint16_t)wFillColour},
+                                (uint8_t)chOpacity);
+        default:
+            return arm_2dp_cccn888_fill_colour_with_mask_and_opacity(
+                                &this.tFillOP,
+                                &this.tTarget,
+                                &tDrawRegion,
+                                &this.tMask,
+                                (arm_2d_color_cccn888_t){wFillColour},
+                                (uint8_t)chOpacity);
+    }
+}
+
+ARM_NONNULL(1,2,3)
+arm_fsm_rt_t arm_2d_gray8_fill_colour_with_mask_opacity_and_transform_cached(
+                                        arm_2d_transform_cache_t *ptCache,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint_fast8_t chFillColour,
+                                        uint_fast8_t chOpacity,
+                                        const arm_2d_location_t *ptTargetCentre)
+{
+    return __arm_2d_transform_cache_fill_colour(ptCache,
+                                                ptMask,
+                                                ptTarget,
+                                                ptRegion,
+                                                tCentre,
+                                                fAngle,
+                                                fScale,
+                                                chFillColour,
+                                                chOpacity,
+                                                ptTargetCentre,
+                                                ARM_2D_COLOUR_GRAY8);
+}
+
+ARM_NONNULL(1,2,3)
+arm_fsm_rt_t arm_2d_rgb565_fill_colour_with_mask_opacity_and_transform_cached(
+                                        arm_2d_transform_cache_t *ptCache,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint_fast16_t hwFillColour,
+                                        uint_fast8_t chOpacity,
+                                        const arm_2d_location_t *ptTargetCentre)
+{
+    return __arm_2d_transform_cache_fill_colour(ptCache,
+                                                ptMask,
+                                                ptTarget,
+                                                ptRegion,
+                                                tCentre,
+                                                fAngle,
+                                                fScale,
+                                                hwFillColour,
+                                                chOpacity,
+                                                ptTargetCentre,
+                                                ARM_2D_COLOUR_RGB565);
+}
+
+ARM_NONNULL(1,2,3)
+arm_fsm_rt_t arm_2d_cccn888_fill_colour_with_mask_opacity_and_transform_cached(
+                                        arm_2d_transform_cache_t *ptCache,
+                                        const arm_2d_tile_t *ptMask,
+                                        const arm_2d_tile_t *ptTarget,
+                                        const arm_2d_region_t *ptRegion,
+                                        const arm_2d_location_t tCentre,
+                                        float fAngle,
+                                        float fScale,
+                                        uint32_t wFillColour,
+                                        uint_fast8_t chOpacity,
+                                        const arm_2d_location_t *ptTargetCentre)
+{
+    return __arm_2d_transform_cache_fill_colour(ptCache,
+                                                ptMask,
+                                                ptTarget,
+                                                ptRegion,
+                                                tCentre,
+                                                fAngle,
+                                                fScale,
+                                                wFillColour,
+                                                chOpacity,
+                                                ptTargetCentre,
+                                                ARM_2D_COLOUR_CCCN888);
+}
+#endif
+
+
 /*----------------------------------------------------------------------------*
  * Accelerable Low Level APIs                                                 *
  *----------------------------------------------------------------------------*/
@@ -2111,6 +2946,10 @@ __WEAK
 def_low_lv_io(__ARM_2D_IO_TRANSFORM_ONLY_CCCN888,
                 __arm_2d_cccn888_sw_transform_only);
 
+__WEAK
+def_low_lv_io(__ARM_2D_IO_TRANSFORM_ONLY_CCCA8888,
+                __arm_2d_ccca8888_sw_transform_only);
+
 __WEAK
 def_low_lv_io(__ARM_2D_IO_TRANSFORM_WITH_COLOUR_KEYING_AND_OPACITY_GRAY8,
                 __arm_2d_gray8_sw_transform_with_colour_keying_and_opacity);
@@ -2135,6 +2974,10 @@ __WEAK
 def_low_lv_io(__ARM_2D_IO_TRANSFORM_ONLY_WITH_OPACITY_CCCN888,
                 __arm_2d_cccn888_sw_transform_only_with_opacity);
 
+__WEAK
+def_low_lv_io(__ARM_2D_IO_TRANSFORM_ONLY_WITH_OPACITY_CCCA8888,
+                __arm_2d_ccca8888_sw_transform_only_with_opacity);
+
 __WEAK
 def_low_lv_io(__ARM_2D_IO_TRANSFORM_WITH_SRC_MSK_GRAY8,
                 __arm_2d_gray8_sw_transform_with_src_mask);
@@ -2294,6 +3137,26 @@ const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_CCCN888 = {
     },
 };
 
+const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_CCCA8888 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_CCCA8888,
+        },
+        .Param = {
+            .bHasSource             = true,
+            .bHasOrigin             = true,
+            .bHasTarget             = true,
+        },
+        .chOpIndex          = __ARM_2D_OP_IDX_TRANSFORM_ONLY,
+        .chInClassOffset    = offsetof(arm_2d_op_trans_t, tTransform),
+
+        .LowLevelIO = {
+            .ptCopyOrigLike = ref_low_lv_io(__ARM_2D_IO_TRANSFORM_ONLY_CCCA8888),
+            .ptFillOrigLike = NULL,
+        },
+    },
+};
+
 const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_WITH_COLOUR_KEYING_OPACITY_GRAY8 = {
     .Info = {
         .Colour = {
@@ -2418,6 +3281,26 @@ const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_WITH_OPACITY_CCCN888 = {
     },
 };
 
+const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_ONLY_WITH_OPACITY_CCCA8888 = {
+    .Info = {
+        .Colour = {
+            .chScheme   = ARM_2D_COLOUR_CCCA8888,
+        },
+        .Param = {
+            .bHasSource             = true,
+            .bHasOrigin             = true,
+            .bHasTarget             = true,
+        },
+        .chOpIndex          = __ARM_2D_OP_IDX_TRANSFORM_ONLY_WITH_OPACITY,
+        .chInClassOffset    = offsetof(arm_2d_op_trans_opa_t, tTransform),
+
+        .LowLevelIO = {
+            .ptCopyOrigLike = ref_low_lv_io(__ARM_2D_IO_TRANSFORM_ONLY_WITH_OPACITY_CCCA8888),
+            .ptFillOrigLike = NULL,
+        },
+    },
+};
+
 const __arm_2d_op_info_t ARM_2D_OP_TRANSFORM_WITH_SRC_MSK_GRAY8 = {
     .Info = {
         .Colour = {
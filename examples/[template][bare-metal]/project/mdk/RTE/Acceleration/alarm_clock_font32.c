@@ -152,7 +152,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA1[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA1Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA1Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA1Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 17,
@@ -250,13 +250,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a1_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA1[dimof(c_tUTF8LookUpTableA1)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA1, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA1) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA1[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -271,7 +286,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a1_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -448,7 +463,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA2[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA2Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA2Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA2Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 17,
@@ -546,13 +561,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a2_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA2[dimof(c_tUTF8LookUpTableA2)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA2, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA2) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA2[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -567,7 +597,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a2_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -811,7 +841,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA4[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA4Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA4Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA4Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 17,
@@ -909,13 +939,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a4_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA4[dimof(c_tUTF8LookUpTableA4)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA4, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA4) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA4[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -930,7 +975,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a4_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -1291,7 +1336,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA8[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA8Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA8Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA8Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 17,
@@ -1389,13 +1434,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a8_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA8[dimof(c_tUTF8LookUpTableA8)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA8, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA8) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA8[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -1410,7 +1470,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a8_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -179,7 +179,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA1[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA1Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA1Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA1Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 33,
@@ -277,13 +277,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a1_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA1[dimof(c_tUTF8LookUpTableA1)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA1, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA1) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA1[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -298,7 +313,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a1_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -541,7 +556,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA2[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA2Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA2Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA2Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 33,
@@ -639,13 +654,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a2_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA2[dimof(c_tUTF8LookUpTableA2)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA2, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA2) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA2[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -660,7 +690,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a2_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -1031,7 +1061,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA4[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA4Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA4Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA4Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 33,
@@ -1129,13 +1159,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a4_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA4[dimof(c_tUTF8LookUpTableA4)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA4, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA4) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA4[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -1150,7 +1195,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a4_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -1765,7 +1810,7 @@ const static __ttf_char_descriptor_t c_tUTF8LookUpTableA8[] = {
 
 
 ARM_SECTION("arm2d.tile.c_tileUTF8UserFontA8Mask")
-static arm_2d_tile_t c_tileUTF8UserFontA8Mask = {
+static const arm_2d_tile_t c_tileUTF8UserFontA8Mask = {
     .tRegion = {
         .tSize = {
             .iWidth = 33,
@@ -1842,6 +1887,8 @@ IMPL_FONT_DRAW_CHAR(__utf8_font_a8_draw_char)
 
 }
 
+
+
 static
 IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a8_font_get_char_descriptor)
 {
@@ -1861,13 +1908,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a8_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA8[dimof(c_tUTF8LookUpTableA8)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA8, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA8) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA8[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -1882,7 +1944,7 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a8_font_get_char_descriptor)
     return ptDescriptor;
 }
 
-
+const
 struct {
     implement(arm_2d_user_font_t);
     arm_2d_char_idx_t tUTF8Table;
@@ -18,6 +18,7 @@
 
 /*============================ INCLUDES ======================================*/
 #include <stdio.h>
+#include <stdarg.h>
 #include "Virtual_TFT_Port.h"
 #include "arm_2d_helper.h"
 #include "arm_2d_scenes.h"
@@ -64,8 +65,40 @@
 /*============================ GLOBAL VARIABLES ==============================*/
 /*============================ PROTOTYPES ====================================*/
 /*============================ LOCAL VARIABLES ===============================*/
+
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+static arm_2d_profiler_record_t s_tProfilerRecords[8192];
+#endif
+
 /*============================ IMPLEMENTATION ================================*/
 
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+static int profiler_fprintf(void *pTarget, const char *pchFormat, ...)
+{
+    va_list ap;
+    va_start(ap, pchFormat);
+    int nResult = vfprintf((FILE *)pTarget, pchFormat, ap);
+    va_end(ap);
+
+    return nResult;
+}
+
+static void dump_profiler_records(void)
+{
+    FILE *ptFile = fopen("arm_2d_trace.json", "w");
+    if (NULL == ptFile) {
+        return ;
+    }
+
+    uint32_t wCount = arm_2d_helper_profiler_dump_chrome_trace(&profiler_fprintf, 
+                                                               ptFile);
+    fclose(ptFile);
+
+    printf("\r\n%u profiler records are saved to arm_2d_trace.json\r\n", 
+           (unsigned int)wCount);
+}
+#endif
+
 void scene_meter_loader(void) 
 {
     arm_2d_scene_player_set_switching_mode( &DISP0_ADAPTER,
@@ -178,6 +211,11 @@ void scene_bubble_charging_loader(void)
     arm_2d_scene_bubble_charging_init(&DISP0_ADAPTER);
 }
 
+void scene_blur_benchmark_loader(void) 
+{
+    arm_2d_scene_blur_benchmark_init(&DISP0_ADAPTER);
+}
+
 typedef void scene_loader_t(void);
 
 static scene_loader_t * const c_SceneLoaders[] = {
@@ -199,6 +237,7 @@ static scene_loader_t * const c_SceneLoaders[] = {
     scene_panel_loader,
     scene_fitness_loader,
     scene_audiomark_loader,
+    scene_blur_benchmark_loader,
 #else
     scene_basics_loader,
     scene_fan_loader,
@@ -347,6 +386,10 @@ int main(int argc, char* argv[])
         arm_2d_init();
     }
 
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    arm_2d_profiler_init(s_tProfilerRecords, dimof(s_tProfilerRecords));
+#endif
+
     disp_adapter0_init();
 
     SDL_CreateThread(app_2d_main_thread, "arm-2d thread", NULL);
@@ -358,6 +401,10 @@ int main(int argc, char* argv[])
         }
     }
 
+#if __ARM_2D_CFG_SUPPORT_PROFILER__
+    dump_profiler_records();
+#endif
+
     VT_deinit();
     return 0;
 }
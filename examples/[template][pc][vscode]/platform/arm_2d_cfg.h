@@ -45,6 +45,98 @@ extern "C" {
 #   define __ARM_2D_HAS_ASYNC__                                     0
 #endif
 
+// <o>The number of arm_2d_task() workers <1-8>
+// <i> When it is larger than 1, each worker owns a sub-task queue and idle workers steal sub-tasks from the others, so several arm_2d_task() instances (e.g. one per core or per thread) can render sub-tasks in parallel.
+// <i> Please provide arm_2d_port_enter_worker_critical_section() and arm_2d_port_leave_worker_critical_section() that work across all workers.
+// <i> This feature only works when the Asynchronous Programmers' model is enabled. Default: 1
+#ifndef __ARM_2D_CFG_ASYNC_WORKER_COUNT__
+#   define __ARM_2D_CFG_ASYNC_WORKER_COUNT__                        1
+#endif
+
+// <q>Use a lock-free sub-task pool and FIFO
+// <i> The sub-task pool becomes a Treiber stack and the sub-task FIFO becomes a bounded MPMC ring, both are built on C11 atomics (LDREX/STREX), so workers no longer disable interrupts or take the worker lock to allocate, queue and fetch sub-tasks. The multi-worker queues still use the worker critical section.
+// <i> This feature requires C11 atomics and is not available on Armv6-M. It is disabled by default.
+#ifndef __ARM_2D_CFG_ASYNC_LOCK_FREE__
+#   define __ARM_2D_CFG_ASYNC_LOCK_FREE__                           0
+#endif
+
+// <q>Enable the contention counters of the sub-task pool and FIFO
+// <i> Read them with arm_2d_async_get_contention_counters(). The RTOS port can report a busy worker critical section with arm_2d_notif_worker_lock_contention().
+// <i> This feature is disabled by default.
+#ifndef __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+#   define __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__                 0
+#endif
+
+// <q>Enable the statistics of the sub-task pool and FIFO
+// <i> Read the high-water mark of the sub-task pool, the number of booking failures (i.e. an OP has to wait for free sub-tasks) and the depth of the sub-task FIFO with arm_2d_async_get_pool_statistics(). Use them to size __ARM_2D_CFG_DEFAULT_SUB_TASK_POOL_SIZE__.
+// <i> This feature is disabled by default.
+#ifndef __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+#   define __ARM_2D_CFG_ASYNC_POOL_STATISTICS__                     0
+#endif
+
+// <q>Grow the sub-task pool on demand
+// <i> When an OP cannot book enough sub-tasks, the missing ones are taken from an arena set by arm_2d_async_set_pool_arena() instead of letting the OP wait.
+// <i> This feature is not available with the lock-free sub-task pool. It is disabled by default.
+#ifndef __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__
+#   define __ARM_2D_CFG_ASYNC_POOL_AUTO_GROW__                      0
+#endif
+
+// <q>Enable the display list
+// <i> A display list records the OPs issued by the drawing handler in the first PFB of a frame, and the PFB helper replays them for the rest PFBs (and dirty regions) of the same frame instead of calling the handler again.
+// <i> Only the OPs that use the default OP and have no origin tile (i.e. no transform) can be recorded, otherwise the PFB helper falls back to calling the handler. This feature is disabled by default.
+#ifndef __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+#   define __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__                      0
+#endif
+
+// <q>Enable the profiler
+// <i> The profiler records the OP index, the colour format, the number of target pixels, the PFB index and the elapsed time of each OP (and each sub-task in the asynchronous mode) into a ring buffer provided by arm_2d_profiler_init().
+// <i> The records can be dumped as Chrome trace-event JSON with arm_2d_helper_profiler_dump_chrome_trace(). This feature is disabled by default.
+#ifndef __ARM_2D_CFG_SUPPORT_PROFILER__
+#   define __ARM_2D_CFG_SUPPORT_PROFILER__                          0
+#endif
+
+// <q>Reject the OPs outside the current PFB early
+// <i> Before any tile root resolution and region calculation, the frontend translates the target region of an OP into the coordinates of the root tile (e.g. the current PFB) and drops the OP when they don't overlap.
+// <i> This feature is enabled by default.
+#ifndef __ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__
+#   define __ARM_2D_CFG_SUPPORT_OP_EARLY_REJECT__                   1
+#endif
+
+// <q>Enable the statistics of the early-reject stage
+// <i> Read the number of OPs checked and rejected by the early-reject stage with arm_2d_get_op_early_reject_statistics().
+// <i> This feature is disabled by default.
+#ifndef __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+#   define __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__                0
+#endif
+
+// <q>Enable the mip chain support in transform operations
+// <i> When the source of a transform is (a part of) an arm_2d_tile_mipmap_t and the scaling factor is not more than 0.5, the transform reads the half-resolution level closest to the target size instead of the full-resolution source.
+// <i> This feature is enabled by default.
+#ifndef __ARM_2D_CFG_SUPPORT_TRANSFORM_MIPMAP__
+#   define __ARM_2D_CFG_SUPPORT_TRANSFORM_MIPMAP__                  1
+#endif
+
+// <q>Enable the transform cache
+// <i> Add arm_2d_<colour>_fill_colour_with_mask_opacity_and_transform_cached(), which keeps the transformed A8 masks in a user-provided arena and reuses them when the same mask is drawn again with the same quantised angle and scaling factor.
+// <i> This feature is disabled by default.
+#ifndef __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__
+#   define __ARM_2D_CFG_SUPPORT_TRANSFORM_CACHE__                   0
+#endif
+
+// <o>The number of PFB band workers <0-8>
+// <i> When it is larger than 0, the PFB helper hands PFBs (horizontal bands) over to the band workers, and the bands of a frame are drawn in parallel and flushed as soon as they are finished.
+// <i> The drawing handlers run in several threads at the same time, so they must be re-entrant when bIsNewFrame is false: no shared states (globals or statics) should be updated. Hence the band split is opt-in: call arm_2d_helper_pfb_enable_band_split() or set bReentrantDrawing in a scene. Please also provide a PFB pool with more than one PFB.
+// <i> The RTOS port should create the band worker threads. Default: 0 (disabled)
+#ifndef __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__
+#   define __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__              0
+#endif
+
+// <o>The budget of the dirty region optimization <0-65535>
+// <i> The max number of region comparisons done by the dirty region optimization in one frame. When it runs out, the rest dirty regions are refreshed without optimization. 0 means no limit. Default: 4096
+#ifndef __ARM_2D_HELPER_CFG_DIRTY_REGION_OPTIMIZATION_BUDGET__
+#   define __ARM_2D_HELPER_CFG_DIRTY_REGION_OPTIMIZATION_BUDGET__   4096
+#endif
+
 // <q>Enable anti-alias support for all tranform operations.
 // <i> Note that enabling this feature suffers a non-negligible performance drop.
 // <i> This feature is disabled by default.
@@ -72,6 +164,13 @@ extern "C" {
 #   define __ARM_2D_CFG_USE_IIR_BLUR_REVERSE_PATH__                 0
 #endif
 
+// <q>Enable the portable SIMD acceleration
+// <i> On targets without Helium, use the Neon (Cortex-A) or SSE2 (PC) vector unit via the compiler vector extensions to accelerate some hot kernels.
+// <i> It requires GCC or Clang. This feature is enabled by default.
+#ifndef __ARM_2D_CFG_ENABLE_PORTABLE_SIMD__
+#   define __ARM_2D_CFG_ENABLE_PORTABLE_SIMD__                      1
+#endif
+
 // </h>
 
 
@@ -179,6 +278,21 @@ extern "C" {
 #   define __LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__                          80
 #endif
 
+// <o> The number of text runs cached by the LCD printf service <0-16>
+// <i> The LCD printf service keeps the line boxes and the glyph layouts of the recently used strings, so a static label is only shaped once and reused in all PFBs. 0 means disabled.
+// <i> Each run takes about (44 + 34 * the maximum number of glyphs) bytes of RAM on a 32-bit target (about 1.1KB for 32 glyphs), and the cache is duplicated for each drawing thread.
+// <i> Default: 0
+#ifndef __LCD_PRINTF_CFG_RUN_CACHE_SIZE__
+#   define __LCD_PRINTF_CFG_RUN_CACHE_SIZE__                            0
+#endif
+
+// <o> The maximum number of glyphs in a cached text run <1-256>
+// <i> Strings with more glyphs are shaped every time they are drawn.
+// <i> Default: 32
+#ifndef __LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__
+#   define __LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__                      32
+#endif
+
 // <h>Benchmark
 
 // <o>Width of the screen <8-32767>
@@ -319,8 +319,10 @@ void *disp_adapter0_3fb_get_flush_pointer(void)
 
 void disp_adapter0_insert_2d_copy_complete_event_handler(void)
 {
-    arm_2d_helper_pfb_report_rendering_complete(
-                    &DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t);
+    if (arm_2d_helper_3fb_report_2d_copy_complete(&s_tDirectModeHelper)) {
+        arm_2d_helper_pfb_report_rendering_complete(
+                        &DISP0_ADAPTER.use_as__arm_2d_helper_pfb_t);
+    }
 }
 
 /* using asynchronous flushing, e.g. using DMA + ISR to offload CPU etc. 
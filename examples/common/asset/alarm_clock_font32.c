@@ -246,13 +246,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a1_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA1[dimof(c_tUTF8LookUpTableA1)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA1, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA1) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA1[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -542,13 +557,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a2_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA2[dimof(c_tUTF8LookUpTableA2)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA2, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA2) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA2[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -905,13 +935,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a4_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA4[dimof(c_tUTF8LookUpTableA4)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA4, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA4) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA4[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
@@ -1385,13 +1430,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a8_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA8[dimof(c_tUTF8LookUpTableA8)-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA8, ptChar) {
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA8) - 2;
+
+    while(nLow <= nHigh) {
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA8[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        } else if (nResult < 0) {
+            nHigh = nMid - 1;
+        } else {
+            nLow = nMid + 1;
         }
     }
 
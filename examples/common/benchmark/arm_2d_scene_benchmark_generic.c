@@ -238,6 +238,9 @@ static void __on_scene_benchmark_generic_frame_complete(arm_2d_scene_t *ptScene)
                     "PFB Size: %d*%d, Screen Size: %d*%d, "
                 #if !(defined(__i386__) || defined(__x86_64__) || defined(__APPLE__))
                     "CPU Freq: %dMHz, "
+                #endif
+                #if __ARM_2D_HAS_ASYNC__ && __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+                    "Workers: %d, "
                 #endif
                     "Average: %d, "
                 #if !(defined(__i386__) || defined(__x86_64__) || defined(__APPLE__))
@@ -251,6 +254,9 @@ static void __on_scene_benchmark_generic_frame_complete(arm_2d_scene_t *ptScene)
                     tScreen.tSize.iHeight,
                 #if !(defined(__i386__) || defined(__x86_64__) || defined(__APPLE__))
                     SystemCoreClock / 1000000ul,
+                #endif
+                #if __ARM_2D_HAS_ASYNC__ && __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+                    __ARM_2D_CFG_ASYNC_WORKER_COUNT__,
                 #endif
                     BENCHMARK.wAverage
                 #if !(defined(__i386__) || defined(__x86_64__) || defined(__APPLE__))
@@ -259,6 +265,52 @@ static void __on_scene_benchmark_generic_frame_complete(arm_2d_scene_t *ptScene)
                 );
             } while(0);
 
+        #if __ARM_2D_CFG_ASYNC_CONTENTION_COUNTERS__
+            do {
+                arm_2d_async_contention_t tContention;
+                arm_2d_async_get_contention_counters(&tContention);
+
+                ARM_2D_LOG_INFO(
+                    STATISTICS, 
+                    0, 
+                    "BENCHMARK",
+                    "Sub-task Pool: %"PRIu32" accesses, %"PRIu32" retries, "
+                    "FIFO: %"PRIu32" accesses, %"PRIu32" retries, "
+                    "Lock Busy: %"PRIu32"\r\n",
+                    tContention.wPoolAccess,
+                    tContention.wPoolRetry,
+                    tContention.wFIFOAccess,
+                    tContention.wFIFORetry,
+                    tContention.wLockBusy
+                );
+            } while(0);
+        #endif
+
+        #if __ARM_2D_CFG_ASYNC_POOL_STATISTICS__
+            do {
+                arm_2d_async_pool_statistics_t tPool;
+                arm_2d_async_get_pool_statistics(&tPool);
+
+                ARM_2D_LOG_INFO(
+                    STATISTICS, 
+                    0, 
+                    "BENCHMARK",
+                    "Sub-task Pool: %d/%d at peak (%d grown), "
+                    "%"PRIu32" booking failures, "
+                    "FIFO Depth: %d at peak, %4.2f on average\r\n",
+                    tPool.hwHighWaterMark,
+                    tPool.hwPoolSize,
+                    tPool.hwGrowCount,
+                    tPool.wBookingFailure,
+                    tPool.hwFIFOMaxDepth,
+                    (0 == tPool.wFIFOSampleCount) 
+                        ?   0.0 
+                        :   (double)tPool.wFIFODepthSum 
+                        /   (double)tPool.wFIFOSampleCount
+                );
+            } while(0);
+        #endif
+
             /* resume low level flush */
             arm_2d_helper_resume_low_level_flush(ptHelper);
 
@@ -300,6 +352,7 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_benchmark_generic_handler)
             
             arm_lcd_text_set_font(NULL);
             arm_lcd_text_set_draw_region(NULL);
+            arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
 
             arm_lcd_text_location( (uint8_t)(tScreen.tSize.iHeight / 8 - 7), 0);
             arm_lcd_puts(  "All-in-One Test, running "
@@ -315,6 +368,9 @@ IMPL_PFB_ON_DRAW(__pfb_draw_scene_benchmark_generic_handler)
             arm_lcd_printf( "\r\nCPU Freq: N/A\r\n");
 #else
             arm_lcd_printf( "\r\nCPU Freq: %dMHz\r\n", SystemCoreClock / 1000000ul);
+#endif
+#if __ARM_2D_HAS_ASYNC__ && __ARM_2D_CFG_ASYNC_WORKER_COUNT__ > 1
+            arm_lcd_printf( "Workers: %d\r\n", __ARM_2D_CFG_ASYNC_WORKER_COUNT__);
 #endif
             arm_lcd_puts( "Benchmark Report:\r\n");
             
@@ -366,6 +422,9 @@ user_scene_benchmark_generic_t *__arm_2d_scene_benchmark_generic_init(   arm_2d_
             //.fnBeforeSwitchOut = &__before_scene_benchmark_generic_switching_out,
             .fnOnFrameCPL   = &__on_scene_benchmark_generic_frame_complete,
             .fnDepose       = &__on_scene_benchmark_generic_depose,
+
+            /* the scene only updates its states when bIsNewFrame is true */
+            .bReentrantDrawing = true,
         },
         .bUserAllocated = bUserAllocated,
     };
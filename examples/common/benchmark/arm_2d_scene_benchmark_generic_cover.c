@@ -237,6 +237,9 @@ user_scene_benchmark_generic_cover_t *
             .fnBeforeSwitchOut = &__before_scene_benchmark_generic_cover_switching_out,
             .fnOnFrameCPL   = &__on_scene_benchmark_generic_cover_frame_complete,
             .fnDepose       = &__on_scene_benchmark_generic_cover_depose,
+
+            /* the cover only draws with the ptTile passed in */
+            .bReentrantDrawing = true,
         },
         .bUserAllocated = bUserAllocated,
     };
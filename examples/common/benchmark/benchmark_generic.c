@@ -651,43 +651,47 @@ static void __draw_layers(  const arm_2d_tile_t *ptTile,
     } while(0);
 
 #if !defined(__ARM_2D_CFG_BENCHMARK_TINY_MODE__) || !__ARM_2D_CFG_BENCHMARK_TINY_MODE__
-    arm_2d_fill_colour( s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile, 
-                        NULL, 
-                        GLCD_COLOR_GREEN);
+    /* the content of the layer tile only changes between frames, and updating
+     * it in the first PFB keeps this handler re-entrant for the band workers
+     */
+    if (bIsNewFrame) {
+        arm_2d_fill_colour( s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile, 
+                            NULL, 
+                            GLCD_COLOR_GREEN);
 
     
-    //!< fill a given tile with the sun icon (with colour-keying)
-    switch(s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].wMode) {
-        case ARM_2D_CP_MODE_FILL:
-            arm_2d_tile_fill_with_colour_keying_only(
-                &c_tilePictureSun,
-                s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
-                NULL,
-                GLCD_COLOR_WHITE);
-                break;
-        case ARM_2D_CP_MODE_FILL | ARM_2D_CP_MODE_X_MIRROR:
-            arm_2d_tile_fill_with_colour_keying_and_x_mirror(
-                &c_tilePictureSun,
-                s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
-                NULL,
-                GLCD_COLOR_WHITE);
-                break;
-        case ARM_2D_CP_MODE_FILL | ARM_2D_CP_MODE_Y_MIRROR:
-            arm_2d_tile_fill_with_colour_keying_and_y_mirror(
-                &c_tilePictureSun,
-                s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
-                NULL,
-                GLCD_COLOR_WHITE);
-                break;
-        case ARM_2D_CP_MODE_FILL | ARM_2D_CP_MODE_XY_MIRROR:
-            arm_2d_tile_fill_with_colour_keying_and_xy_mirror(
-                &c_tilePictureSun,
-                s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
-                NULL,
-                GLCD_COLOR_WHITE);
-                break;
+        //!< fill a given tile with the sun icon (with colour-keying)
+        switch(s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].wMode) {
+            case ARM_2D_CP_MODE_FILL:
+                arm_2d_tile_fill_with_colour_keying_only(
+                    &c_tilePictureSun,
+                    s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
+                    NULL,
+                    GLCD_COLOR_WHITE);
+                    break;
+            case ARM_2D_CP_MODE_FILL | ARM_2D_CP_MODE_X_MIRROR:
+                arm_2d_tile_fill_with_colour_keying_and_x_mirror(
+                    &c_tilePictureSun,
+                    s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
+                    NULL,
+                    GLCD_COLOR_WHITE);
+                    break;
+            case ARM_2D_CP_MODE_FILL | ARM_2D_CP_MODE_Y_MIRROR:
+                arm_2d_tile_fill_with_colour_keying_and_y_mirror(
+                    &c_tilePictureSun,
+                    s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
+                    NULL,
+                    GLCD_COLOR_WHITE);
+                    break;
+            case ARM_2D_CP_MODE_FILL | ARM_2D_CP_MODE_XY_MIRROR:
+                arm_2d_tile_fill_with_colour_keying_and_xy_mirror(
+                    &c_tilePictureSun,
+                    s_ptRefreshLayers[BENCHMARK_LAYER_FILL_ICON_WITH_COLOUR_KEYING].ptTile,
+                    NULL,
+                    GLCD_COLOR_WHITE);
+                    break;
+        }
     }
-
 #endif
 
     arm_2d_op_wait_async(NULL);
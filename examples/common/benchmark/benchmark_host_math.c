@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The CMSIS-DSP fast math functions used by arm-2d, implemented with the
+ * host C library, so the host benchmark runner links without CMSIS-DSP.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include <stdint.h>
+#include <math.h>
+
+/*============================ MACROS ========================================*/
+#ifndef M_PI
+#   define M_PI         3.14159265358979323846
+#endif
+
+/*============================ IMPLEMENTATION ================================*/
+
+float arm_sin_f32(float x)
+{
+    return sinf(x);
+}
+
+float arm_cos_f32(float x)
+{
+    return cosf(x);
+}
+
+/* the Q31 input in the range of [0, 1) is mapped to [0, 2*pi) */
+int32_t arm_sin_q31(int32_t x)
+{
+    return (int32_t)(sin((double)x / 2147483648.0 * 2.0 * M_PI) * 2147483647.0);
+}
+
+int32_t arm_cos_q31(int32_t x)
+{
+    return (int32_t)(cos((double)x / 2147483648.0 * 2.0 * M_PI) * 2147483647.0);
+}
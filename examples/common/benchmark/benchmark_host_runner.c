@@ -0,0 +1,634 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Headless host runner for the generic and the watch-panel benchmarks.
+ *
+ * The selected benchmark is rendered into an in-memory framebuffer through
+ * the PFB helper for a fixed number of frames. The system timestamp seen by
+ * arm-2d is a virtual clock advanced by a fixed period per frame, hence the
+ * animation (and therefore every frame) is deterministic between runs. The
+ * wall-clock cost of each frame is measured with the host monotonic clock.
+ *
+ * Usage:
+ *      arm2d_benchmark_host [--benchmark=generic|watch_panel|static_page]
+ *                           [--frames=N] [--frame-period-ms=N]
+ *                           [--display-list]
+ *
+ * The option --display-list is only available when the display list is
+ * enabled (__ARM_2D_CFG_SUPPORT_DISPLAY_LIST__), it draws the PFBs by
+ * replaying the OPs recorded in the first PFB of each frame.
+ *
+ * The result is written to stdout as JSON.
+ */
+
+/*============================ INCLUDES ======================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arm_2d.h"
+#include "arm_2d_helper.h"
+
+#if defined(RTE_Acceleration_Arm_2D_Extra_LCD_printf__)
+#   include "arm_2d_example_controls.h"
+#   include "arm_extra_lcd_printf.h"
+#endif
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wmissing-field-initializers"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wgnu-statement-expression"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#elif __IS_COMPILER_GCC__
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wformat="
+#   pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+/*============================ MACROS ========================================*/
+#ifndef __GLCD_CFG_SCEEN_WIDTH__
+#   warning Please specify the screen width by defining the macro __GLCD_CFG_SCEEN_WIDTH__, default value 320 is used for now
+#   define __GLCD_CFG_SCEEN_WIDTH__      320
+#endif
+
+#ifndef __GLCD_CFG_SCEEN_HEIGHT__
+#   warning Please specify the screen height by defining the macro __GLCD_CFG_SCEEN_HEIGHT__, default value 240 is used for now
+#   define __GLCD_CFG_SCEEN_HEIGHT__      240
+#endif
+
+#if __GLCD_CFG_COLOUR_DEPTH__ == 8
+#   define __BENCHMARK_HOST_COLOUR_FORMAT__     ARM_2D_COLOUR_GRAY8
+#elif __GLCD_CFG_COLOUR_DEPTH__ == 16
+#   define __BENCHMARK_HOST_COLOUR_FORMAT__     ARM_2D_COLOUR_RGB565
+#elif __GLCD_CFG_COLOUR_DEPTH__ == 32
+#   define __BENCHMARK_HOST_COLOUR_FORMAT__     ARM_2D_COLOUR_CCCN888
+#else
+#   error Unsupported colour depth!
+#endif
+
+#ifndef __BENCHMARK_HOST_CFG_PFB_BLOCK_WIDTH__
+#   define __BENCHMARK_HOST_CFG_PFB_BLOCK_WIDTH__   __GLCD_CFG_SCEEN_WIDTH__
+#endif
+
+#ifndef __BENCHMARK_HOST_CFG_PFB_BLOCK_HEIGHT__
+#   define __BENCHMARK_HOST_CFG_PFB_BLOCK_HEIGHT__  16
+#endif
+
+/* each band worker needs a PFB of its own */
+#ifndef __BENCHMARK_HOST_CFG_PFB_HEAP_SIZE__
+#   define __BENCHMARK_HOST_CFG_PFB_HEAP_SIZE__                                 \
+                (__ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ + 1)
+#endif
+
+/* the default number of frames, the same as the on-target benchmark */
+#ifndef __BENCHMARK_HOST_CFG_FRAMES__
+#   ifdef ITERATION_CNT
+#       define __BENCHMARK_HOST_CFG_FRAMES__        ITERATION_CNT
+#   else
+#       define __BENCHMARK_HOST_CFG_FRAMES__        1000
+#   endif
+#endif
+
+/* the memory of the display list, used by --display-list */
+#ifndef __BENCHMARK_HOST_CFG_DISPLAY_LIST_SIZE__
+#   define __BENCHMARK_HOST_CFG_DISPLAY_LIST_SIZE__     (64 * 1024)
+#endif
+
+/* the virtual time between two frames */
+#ifndef __BENCHMARK_HOST_CFG_FRAME_PERIOD_MS__
+#   define __BENCHMARK_HOST_CFG_FRAME_PERIOD_MS__   33
+#endif
+
+/* the virtual system timestamp ticks in microseconds */
+#define __BENCHMARK_HOST_VIRTUAL_CLOCK_HZ__         1000000ul
+
+/* frame costs are reported in nanoseconds, i.e. cycles of a 1GHz reference */
+#define __BENCHMARK_HOST_REFERENCE_CLOCK_HZ__       1000000000ull
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+/*============================ TYPES =========================================*/
+typedef struct benchmark_host_item_t {
+    const char *pchName;
+    void (*fnInit)(void);
+    void (*fnDoEvents)(void);
+    void (*fnDraw)(const arm_2d_tile_t *ptTile, bool bIsNewFrame);
+    bool bReentrantDrawing;         //!< fnDraw can be called by the band workers in parallel
+} benchmark_host_item_t;
+
+typedef struct benchmark_host_frame_t {
+    uint64_t dwCycles;
+    uint32_t wChecksum;
+} benchmark_host_frame_t;
+
+/*============================ GLOBAL VARIABLES ==============================*/
+/*============================ PROTOTYPES ====================================*/
+#ifdef RTE_Acceleration_Arm_2D_Extra_Benchmark_Generic
+extern
+void benchmark_generic_init(void);
+
+extern
+void benchmark_generic_draw(const arm_2d_tile_t *ptTile, bool bIsNewFrame);
+
+extern
+void benchmark_generic_do_events(void);
+#endif
+
+#ifdef RTE_Acceleration_Arm_2D_Extra_Benchmark_Watch_Panel
+extern
+void benchmark_watch_panel_init(arm_2d_region_t tScreen);
+
+extern
+void benchmark_watch_panel_draw(const arm_2d_tile_t *ptTile, bool bIsNewFrame);
+
+extern
+void benchmark_watch_panel_do_events(void);
+
+static void __benchmark_watch_panel_init(void);
+#endif
+
+#if defined(RTE_Acceleration_Arm_2D_Extra_LCD_printf__)
+static void __benchmark_static_page_init(void);
+static void __benchmark_static_page_do_events(void);
+static void __benchmark_static_page_draw(   const arm_2d_tile_t *ptTile,
+                                            bool bIsNewFrame);
+#endif
+
+/*============================ LOCAL VARIABLES ===============================*/
+static const benchmark_host_item_t c_tBenchmarks[] = {
+#ifdef RTE_Acceleration_Arm_2D_Extra_Benchmark_Generic
+    {
+        .pchName    = "generic",
+        .fnInit     = &benchmark_generic_init,
+        .fnDoEvents = &benchmark_generic_do_events,
+        .fnDraw     = &benchmark_generic_draw,
+        .bReentrantDrawing = true,
+    },
+#endif
+#ifdef RTE_Acceleration_Arm_2D_Extra_Benchmark_Watch_Panel
+    {
+        .pchName    = "watch_panel",
+        .fnInit     = &__benchmark_watch_panel_init,
+        .fnDoEvents = &benchmark_watch_panel_do_events,
+        .fnDraw     = &benchmark_watch_panel_draw,
+    },
+#endif
+#if defined(RTE_Acceleration_Arm_2D_Extra_LCD_printf__)
+    {
+        .pchName    = "static_page",
+        .fnInit     = &__benchmark_static_page_init,
+        .fnDoEvents = &__benchmark_static_page_do_events,
+        .fnDraw     = &__benchmark_static_page_draw,
+        .bReentrantDrawing = true,
+    },
+#endif
+};
+
+static struct {
+    const benchmark_host_item_t *ptBenchmark;
+    int64_t lVirtualTimestamp;
+    uint32_t wFramePeriodMS;
+    uint32_t wFrames;
+    benchmark_host_frame_t *ptFrames;
+
+    arm_2d_helper_pfb_t tPFBHelper;
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+    bool bUseDisplayList;
+    arm_2d_display_list_t tDisplayList;
+    uint64_t dwDisplayListBuffer[__BENCHMARK_HOST_CFG_DISPLAY_LIST_SIZE__ / 8];
+#endif
+
+    COLOUR_INT tFrameBuffer[   __GLCD_CFG_SCEEN_WIDTH__
+                            *   __GLCD_CFG_SCEEN_HEIGHT__];
+} s_tRunner = {
+    .wFramePeriodMS = __BENCHMARK_HOST_CFG_FRAME_PERIOD_MS__,
+    .wFrames = __BENCHMARK_HOST_CFG_FRAMES__,
+};
+
+/*============================ IMPLEMENTATION ================================*/
+
+/*
+ * The virtual system clock: it only moves between frames, so the time based
+ * animations in the benchmarks produce the same frames on every run.
+ */
+int64_t arm_2d_helper_get_system_timestamp(void)
+{
+    return s_tRunner.lVirtualTimestamp;
+}
+
+uint32_t arm_2d_helper_get_reference_clock_frequency(void)
+{
+    return __BENCHMARK_HOST_VIRTUAL_CLOCK_HZ__;
+}
+
+static uint64_t __benchmark_host_get_cycles(void)
+{
+    struct timespec tNow;
+    clock_gettime(CLOCK_MONOTONIC, &tNow);
+
+    return (uint64_t)tNow.tv_sec * __BENCHMARK_HOST_REFERENCE_CLOCK_HZ__
+         + (uint64_t)tNow.tv_nsec;
+}
+
+#ifdef RTE_Acceleration_Arm_2D_Extra_Benchmark_Watch_Panel
+static void __benchmark_watch_panel_init(void)
+{
+    benchmark_watch_panel_init((arm_2d_region_t) {
+        .tSize = {
+            .iWidth = __GLCD_CFG_SCEEN_WIDTH__,
+            .iHeight = __GLCD_CFG_SCEEN_HEIGHT__,
+        },
+    });
+}
+#endif
+
+#if defined(RTE_Acceleration_Arm_2D_Extra_LCD_printf__)
+/*
+ * A static status page: a banner, lines of text, boxes and progress bars which
+ * are the same in every frame. All of its OPs can be recorded, hence it shows
+ * the cost of drawing the PFBs with a display list (--display-list).
+ */
+static void __benchmark_static_page_init(void)
+{
+    arm_extra_controls_init();
+}
+
+static void __benchmark_static_page_do_events(void)
+{
+}
+
+static void __benchmark_static_page_draw(   const arm_2d_tile_t *ptTile,
+                                            bool bIsNewFrame)
+{
+    arm_2d_canvas(ptTile, __top_canvas) {
+
+        arm_2d_fill_colour(ptTile, NULL, GLCD_COLOR_BLACK);
+
+        arm_lcd_text_set_font(&ARM_2D_FONT_6x8.use_as__arm_2d_font_t);
+        arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
+        arm_lcd_text_set_colour(GLCD_COLOR_GREEN, GLCD_COLOR_BLACK);
+
+        arm_2d_layout(__top_canvas) {
+            __item_line_vertical(__top_canvas.tSize.iWidth, 24) {
+                arm_print_banner("Arm-2D Static Page", __item_region);
+            }
+
+            for (int_fast16_t n = 0; n < 4; n++) {
+                __item_line_vertical(__top_canvas.tSize.iWidth - 8, 48, 4, 4, 4, 4) {
+
+                    draw_round_corner_box(  ptTile,
+                                            &__item_region,
+                                            GLCD_COLOR_DARK_GREY,
+                                            64,
+                                            bIsNewFrame);
+
+                    arm_2d_dock_vertical(__item_region, 24) {
+                        arm_lcd_text_set_draw_region(&__vertical_region);
+                        arm_lcd_text_set_colour(GLCD_COLOR_WHITE,
+                                                GLCD_COLOR_BLACK);
+                        arm_lcd_text_location(0, 1);
+                        arm_lcd_printf("Channel %d: %3d%%  %4dmV",
+                                       (int)n,
+                                       (int)(n * 25 + 10),
+                                       (int)(n * 600 + 1200));
+                    }
+
+                    arm_2d_dock_bottom(__item_region, 12) {
+                        progress_bar_simple_show(ptTile,
+                                                 &__bottom_region,
+                                                 n * 250 + 100);
+                    }
+                }
+            }
+        }
+
+        arm_lcd_text_set_draw_region(NULL);
+    }
+    arm_2d_op_wait_async(NULL);
+}
+#endif
+
+/* FNV-1a over the whole framebuffer */
+static uint32_t __benchmark_host_checksum(void)
+{
+    const uint8_t *pchData = (const uint8_t *)s_tRunner.tFrameBuffer;
+    uint32_t wHash = 2166136261ul;
+
+    for (size_t n = 0; n < sizeof(s_tRunner.tFrameBuffer); n++) {
+        wHash ^= pchData[n];
+        wHash *= 16777619ul;
+    }
+
+    return wHash;
+}
+
+static
+IMPL_PFB_ON_DRAW(__benchmark_host_draw_handler)
+{
+    ARM_2D_PARAM(pTarget);
+
+    s_tRunner.ptBenchmark->fnDraw(ptTile, bIsNewFrame);
+    arm_2d_op_wait_async(NULL);
+
+    return arm_fsm_rt_cpl;
+}
+
+static
+IMPL_PFB_ON_LOW_LV_RENDERING(__benchmark_host_render_handler)
+{
+    const arm_2d_tile_t *ptTile = &(ptPFB->tTile);
+
+    ARM_2D_PARAM(pTarget);
+    ARM_2D_PARAM(bIsNewFrame);
+
+    int16_t iX = ptTile->tRegion.tLocation.iX;
+    int16_t iY = ptTile->tRegion.tLocation.iY;
+    int16_t iWidth = ptTile->tRegion.tSize.iWidth;
+    int16_t iHeight = ptTile->tRegion.tSize.iHeight;
+
+    const COLOUR_INT *ptSource = (const COLOUR_INT *)ptTile->pchBuffer;
+    COLOUR_INT *ptTarget = s_tRunner.tFrameBuffer
+                         + (int32_t)iY * __GLCD_CFG_SCEEN_WIDTH__ + iX;
+
+    for (int_fast16_t y = 0; y < iHeight; y++) {
+        memcpy(ptTarget, ptSource, (size_t)iWidth * sizeof(COLOUR_INT));
+        ptTarget += __GLCD_CFG_SCEEN_WIDTH__;
+        ptSource += iWidth;
+    }
+
+    arm_2d_helper_pfb_report_rendering_complete(&s_tRunner.tPFBHelper);
+}
+
+static bool __benchmark_host_parse_args(int argc, char *argv[])
+{
+    if (dimof(c_tBenchmarks) > 0) {
+        s_tRunner.ptBenchmark = &c_tBenchmarks[0];
+    }
+
+    for (int n = 1; n < argc; n++) {
+        const char *pchArg = argv[n];
+
+        if (0 == strncmp(pchArg, "--benchmark=", 12)) {
+            s_tRunner.ptBenchmark = NULL;
+            for (size_t i = 0; i < dimof(c_tBenchmarks); i++) {
+                if (0 == strcmp(&pchArg[12], c_tBenchmarks[i].pchName)) {
+                    s_tRunner.ptBenchmark = &c_tBenchmarks[i];
+                    break;
+                }
+            }
+            if (NULL == s_tRunner.ptBenchmark) {
+                fprintf(stderr, "unknown benchmark: %s\n", &pchArg[12]);
+                return false;
+            }
+        } else if (0 == strncmp(pchArg, "--frames=", 9)) {
+            s_tRunner.wFrames = (uint32_t)strtoul(&pchArg[9], NULL, 0);
+        } else if (0 == strncmp(pchArg, "--frame-period-ms=", 18)) {
+            s_tRunner.wFramePeriodMS = (uint32_t)strtoul(&pchArg[18], NULL, 0);
+    #if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+        } else if (0 == strcmp(pchArg, "--display-list")) {
+            s_tRunner.bUseDisplayList = true;
+    #endif
+        } else {
+            fprintf(stderr,
+                    "usage: %s [--benchmark=<name>] [--frames=N] "
+                    "[--frame-period-ms=N]"
+    #if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+                    " [--display-list]"
+    #endif
+                    "\n"
+                    "available benchmarks:",
+                    argv[0]);
+            for (size_t i = 0; i < dimof(c_tBenchmarks); i++) {
+                fprintf(stderr, " %s", c_tBenchmarks[i].pchName);
+            }
+            fprintf(stderr, "\n");
+            return false;
+        }
+    }
+
+    if (NULL == s_tRunner.ptBenchmark) {
+        fprintf(stderr, "no benchmark is available in this build\n");
+        return false;
+    }
+
+    if (0 == s_tRunner.wFrames) {
+        fprintf(stderr, "the number of frames should be at least 1\n");
+        return false;
+    }
+
+    return true;
+}
+
+static void __benchmark_host_report(void)
+{
+    uint64_t dwTotal = 0;
+    uint64_t dwMin = UINT64_MAX;
+    uint64_t dwMax = 0;
+
+    printf("{\n");
+    printf("  \"benchmark\": \"%s\",\n", s_tRunner.ptBenchmark->pchName);
+    printf("  \"screen\": {\"width\": %d, \"height\": %d, \"colour_depth\": %d},\n",
+           __GLCD_CFG_SCEEN_WIDTH__,
+           __GLCD_CFG_SCEEN_HEIGHT__,
+           __GLCD_CFG_COLOUR_DEPTH__);
+    printf("  \"pfb\": {\"width\": %d, \"height\": %d, \"count\": %d},\n",
+           __BENCHMARK_HOST_CFG_PFB_BLOCK_WIDTH__,
+           __BENCHMARK_HOST_CFG_PFB_BLOCK_HEIGHT__,
+           __BENCHMARK_HOST_CFG_PFB_HEAP_SIZE__);
+    printf("  \"async_workers\": %d,\n", __ARM_2D_CFG_ASYNC_WORKER_COUNT__);
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    printf("  \"band_workers\": %d,\n", 
+           s_tRunner.ptBenchmark->bReentrantDrawing 
+                ?   __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ 
+                :   0);
+#else
+    printf("  \"band_workers\": 0,\n");
+#endif
+    printf("  \"frame_period_ms\": %u,\n", s_tRunner.wFramePeriodMS);
+    printf("  \"reference_clock_hz\": %llu,\n",
+           (unsigned long long)__BENCHMARK_HOST_REFERENCE_CLOCK_HZ__);
+    printf("  \"per_frame\": [\n");
+
+    for (uint32_t n = 0; n < s_tRunner.wFrames; n++) {
+        benchmark_host_frame_t *ptFrame = &s_tRunner.ptFrames[n];
+
+        dwTotal += ptFrame->dwCycles;
+        dwMin = MIN(dwMin, ptFrame->dwCycles);
+        dwMax = MAX(dwMax, ptFrame->dwCycles);
+
+        printf("    {\"frame\": %u, \"cycles\": %llu, \"checksum\": \"0x%08x\"}%s\n",
+               n,
+               (unsigned long long)ptFrame->dwCycles,
+               ptFrame->wChecksum,
+               (n + 1 < s_tRunner.wFrames) ? "," : "");
+    }
+
+    uint64_t dwAverage = dwTotal / s_tRunner.wFrames;
+    double dFPS = (0 == dwAverage)
+                ?   0.0
+                :   (double)__BENCHMARK_HOST_REFERENCE_CLOCK_HZ__
+                  / (double)dwAverage;
+
+    printf("  ],\n");
+    printf("  \"frames\": %u,\n", s_tRunner.wFrames);
+    printf("  \"total_cycles\": %llu,\n", (unsigned long long)dwTotal);
+    printf("  \"min_cycles\": %llu,\n", (unsigned long long)dwMin);
+    printf("  \"max_cycles\": %llu,\n", (unsigned long long)dwMax);
+    printf("  \"average_cycles\": %llu,\n", (unsigned long long)dwAverage);
+    printf("  \"fps\": %.2f,\n", dFPS);
+#if __ARM_2D_CFG_OP_EARLY_REJECT_STATISTICS__
+    do {
+        arm_2d_op_early_reject_statistics_t tStatistics;
+        arm_2d_get_op_early_reject_statistics(&tStatistics);
+
+        printf("  \"op_early_reject\": {\"checked\": %u, \"rejected\": %u},\n",
+               tStatistics.wChecked,
+               tStatistics.wRejected);
+    } while(0);
+#endif
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+    if (s_tRunner.bUseDisplayList) {
+        arm_2d_display_list_statistics_t tStatistics;
+        arm_2d_display_list_get_statistics(&s_tRunner.tDisplayList,
+                                           &tStatistics);
+
+        printf("  \"display_list\": {\"recordings\": %u, \"reused\": %u, "
+               "\"invalid\": %u, \"replays\": %u, \"replayed_ops\": %u, "
+               "\"culled_ops\": %u, \"records\": %u, \"used_bytes\": %u},\n",
+               tStatistics.wRecordings,
+               tStatistics.wReused,
+               tStatistics.wInvalid,
+               tStatistics.wReplays,
+               tStatistics.wReplayedOPs,
+               tStatistics.wCulledOPs,
+               (unsigned)tStatistics.hwCount,
+               tStatistics.wUsed);
+    }
+#endif
+    printf("  \"checksum\": \"0x%08x\"\n",
+           s_tRunner.ptFrames[s_tRunner.wFrames - 1].wChecksum);
+    printf("}\n");
+}
+
+int main(int argc, char *argv[])
+{
+    if (!__benchmark_host_parse_args(argc, argv)) {
+        return EXIT_FAILURE;
+    }
+
+    s_tRunner.ptFrames = (benchmark_host_frame_t *)
+        calloc(s_tRunner.wFrames, sizeof(benchmark_host_frame_t));
+    if (NULL == s_tRunner.ptFrames) {
+        fprintf(stderr, "failed to allocate the frame records\n");
+        return EXIT_FAILURE;
+    }
+
+    arm_irq_safe {
+        arm_2d_init();
+    }
+
+    if (ARM_2D_HELPER_PFB_INIT(
+            &s_tRunner.tPFBHelper,                      //!< FPB Helper object
+            __GLCD_CFG_SCEEN_WIDTH__,                   //!< screen width
+            __GLCD_CFG_SCEEN_HEIGHT__,                  //!< screen height
+            COLOUR_INT,                                 //!< colour date type
+            __BENCHMARK_HOST_COLOUR_FORMAT__,           //!< colour format
+            __BENCHMARK_HOST_CFG_PFB_BLOCK_WIDTH__,     //!< PFB block width
+            __BENCHMARK_HOST_CFG_PFB_BLOCK_HEIGHT__,    //!< PFB block height
+            __BENCHMARK_HOST_CFG_PFB_HEAP_SIZE__,       //!< number of PFB in the PFB pool
+            {
+                .evtOnLowLevelRendering = {
+                    .fnHandler = &__benchmark_host_render_handler,
+                },
+                .evtOnDrawing = {
+                    .fnHandler = &__benchmark_host_draw_handler,
+                },
+            }
+        ) < 0) {
+        fprintf(stderr, "failed to initialise the PFB helper\n");
+        return EXIT_FAILURE;
+    }
+
+#if __ARM_2D_HELPER_CFG_PFB_BAND_WORKER_COUNT__ > 0
+    if (s_tRunner.ptBenchmark->bReentrantDrawing) {
+        arm_2d_helper_pfb_enable_band_split(&s_tRunner.tPFBHelper);
+    }
+#endif
+
+#if __ARM_2D_CFG_SUPPORT_DISPLAY_LIST__
+    if (s_tRunner.bUseDisplayList) {
+        if (ARM_2D_ERR_NONE != arm_2d_display_list_init(
+                                    &s_tRunner.tDisplayList,
+                                    s_tRunner.dwDisplayListBuffer,
+                                    sizeof(s_tRunner.dwDisplayListBuffer))) {
+            fprintf(stderr, "failed to initialise the display list\n");
+            return EXIT_FAILURE;
+        }
+        arm_2d_helper_pfb_use_display_list(&s_tRunner.tPFBHelper,
+                                           &s_tRunner.tDisplayList);
+    }
+#endif
+
+    s_tRunner.ptBenchmark->fnInit();
+
+    for (uint32_t n = 0; n < s_tRunner.wFrames; n++) {
+        arm_fsm_rt_t tResult;
+
+        s_tRunner.ptBenchmark->fnDoEvents();
+
+        uint64_t dwStart = __benchmark_host_get_cycles();
+        do {
+            tResult = arm_2d_helper_pfb_task(&s_tRunner.tPFBHelper, NULL);
+        } while (arm_fsm_rt_cpl != tResult && tResult >= 0);
+        uint64_t dwCycles = __benchmark_host_get_cycles() - dwStart;
+
+        if (tResult < 0) {
+            fprintf(stderr, "frame %u failed with error %d\n", n, (int)tResult);
+            return EXIT_FAILURE;
+        }
+
+        s_tRunner.ptFrames[n].dwCycles = dwCycles;
+        s_tRunner.ptFrames[n].wChecksum = __benchmark_host_checksum();
+
+        s_tRunner.lVirtualTimestamp += (int64_t)s_tRunner.wFramePeriodMS
+                                     * (int64_t)(__BENCHMARK_HOST_VIRTUAL_CLOCK_HZ__ / 1000ul);
+    }
+
+    __benchmark_host_report();
+
+    free(s_tRunner.ptFrames);
+
+    return EXIT_SUCCESS;
+}
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#elif __IS_COMPILER_GCC__
+#   pragma GCC diagnostic pop
+#endif
@@ -148,6 +148,11 @@ arm_2d_font_get_char_descriptor_handler_t
 
 /*!
  * \brief initialize lcd text display service
+ * \note Each drawing thread (see arm_2d_port_get_default_op_index()) keeps its
+ *       own text settings. The other threads copy the settings of thread 0
+ *       whenever thread 0 has changed them, hence thread 0 should only change
+ *       the settings when the other threads are not drawing, e.g. in the first
+ *       PFB of a frame.
  * \param[in] ptScreen the default display area
  */
 extern
@@ -232,6 +237,16 @@ arm_2d_err_t arm_lcd_text_set_font(const arm_2d_font_t *ptFont);
 extern
 arm_2d_size_t __arm_lcd_get_string_line_box(const char *str, const arm_2d_font_t *ptFont);
 
+/*!
+ * \brief flush the text run cache
+ * \note the text run cache keeps the line boxes and the glyph layouts of the
+ *       recently used strings, please flush it when the content of a font
+ *       changes at runtime
+ * \note each drawing thread flushes its own cache the next time it uses it
+ */
+extern
+void arm_lcd_text_flush_run_cache(void);
+
 #if defined(__clang__)
 #   pragma clang diagnostic pop
 #elif __IS_COMPILER_GCC__
@@ -61,6 +61,11 @@
 #undef this
 #define this    (*ptThis)
 
+/* the number of particles sent to the draw-points OP in one go */
+#ifndef DYNAMIC_NEBULA_CFG_PARTICLE_BATCH_SIZE
+#   define DYNAMIC_NEBULA_CFG_PARTICLE_BATCH_SIZE   32
+#endif
+
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
 /*============================ GLOBAL VARIABLES ==============================*/
@@ -120,10 +125,9 @@ void dynamic_nebula_show(   dynamic_nebula_t *ptThis,
 
     arm_2d_container(ptTile, __control, ptRegion) {
 
-        arm_2d_region_t tValidRegionInRoot;
-        arm_2d_location_t tOffset;
-        arm_2d_tile_get_root( &__control, &tValidRegionInRoot, &tOffset);
-        tValidRegionInRoot.tLocation = tOffset;
+        arm_2d_location_t tPoints[DYNAMIC_NEBULA_CFG_PARTICLE_BATCH_SIZE];
+        uint8_t chPointOpacity[DYNAMIC_NEBULA_CFG_PARTICLE_BATCH_SIZE];
+        uint_fast16_t hwPointCount = 0;
 
         arm_2d_align_centre(__control_canvas, this.tCFG.iRadius * 2, this.tCFG.iRadius * 2) {
 
@@ -166,14 +170,18 @@ void dynamic_nebula_show(   dynamic_nebula_t *ptThis,
                 uint16_t hwOpacity = (uint16_t)((float)(ptParticle->fOffset * this.fOpacityStep) * chOpacity) >> 8;
 
                 if (NULL == this.tCFG.evtOnDrawParticles.fnHandler) {
-                    if (arm_2d_is_point_inside_region(  &tValidRegionInRoot, 
-                                                    &tParicleLocation)) {
-                        arm_2d_draw_point(  &__control, 
-                                                tParicleLocation,
-                                                tColour,
-                                                (uint8_t)hwOpacity);
-                        
+                    /* the draw-points OP clips the whole batch at once */
+                    tPoints[hwPointCount] = tParicleLocation;
+                    chPointOpacity[hwPointCount] = (uint8_t)hwOpacity;
+
+                    if (++hwPointCount >= dimof(tPoints)) {
+                        arm_2d_draw_points( &__control,
+                                            tPoints,
+                                            hwPointCount,
+                                            tColour,
+                                            chPointOpacity);
                         ARM_2D_OP_WAIT_ASYNC();
+                        hwPointCount = 0;
                     }
                     
                 } else {
@@ -205,6 +213,14 @@ void dynamic_nebula_show(   dynamic_nebula_t *ptThis,
                 ptParticle++;
             } while(--n);
 
+            if (hwPointCount > 0) {
+                arm_2d_draw_points( &__control,
+                                    tPoints,
+                                    hwPointCount,
+                                    tColour,
+                                    chPointOpacity);
+            }
+
             /* make sure the operation is complete */
             arm_2d_op_wait_async(NULL);
         }
@@ -50,20 +50,78 @@
 #   define __LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__              256
 #endif
 
+/* the number of shaped text runs kept in the run cache, 0 means disabled.
+ * NOTE: On a 32-bit target, each run takes about 
+ *       (44 + 34 * __LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__) bytes of RAM, i.e.
+ *       about 1.1KB with the default 32 glyphs, and the whole cache is 
+ *       duplicated for each drawing thread (__ARM_2D_CFG_DEFAULT_OP_COUNT__).
+ *       For example, 4 runs take about 4.5KB RAM per thread.
+ */
+#ifndef __LCD_PRINTF_CFG_RUN_CACHE_SIZE__
+#   define __LCD_PRINTF_CFG_RUN_CACHE_SIZE__                0
+#endif
+
+/* the maximum number of glyphs in a cached text run */
+#ifndef __LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__
+#   define __LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__          32
+#endif
+
+#define __LCD_TEXT_RUN_TEXT_SIZE                                                \
+            (__LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__ * 2)
+
+/* each thread that draws at the same time has its own text control */
+#if __ARM_2D_CFG_DEFAULT_OP_COUNT__ > 1
+#   define __LCD_PRINTF_THREAD_COUNT        __ARM_2D_CFG_DEFAULT_OP_COUNT__
+#   define __LCD_PRINTF_THREAD_INDEX()      arm_2d_port_get_default_op_index()
+#else
+#   define __LCD_PRINTF_THREAD_COUNT        1
+#   define __LCD_PRINTF_THREAD_INDEX()      0
+#endif
+
 #undef this
 #define this    (*ptThis)
 
 /*============================ MACROFIED FUNCTIONS ===========================*/
 /*============================ TYPES =========================================*/
-/*============================ GLOBAL VARIABLES ==============================*/
-extern
-const uint8_t Font_6x8_h[(144-32)*8];
 
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+typedef struct __lcd_text_glyph_t {
+    arm_2d_location_t tOffset;                  //!< the offset inside the draw region
+    arm_2d_char_descriptor_t tDescriptor;
+} __lcd_text_glyph_t;
 
-/*============================ PROTOTYPES ====================================*/
-/*============================ LOCAL VARIABLES ===============================*/
+/*!
+ * \brief a shaped text run, i.e. the line box and the glyph positions of a
+ *        string which are reused when the same string is drawn again in other
+ *        PFBs or frames
+ */
+typedef struct __lcd_text_run_t {
+    /* the key of the run */
+    const arm_2d_font_t *ptFont;
+    uint32_t wHash;
+    float fScale;
+    uint16_t hwLength;
+    uint16_t hwGlyphCount;
+
+    uint8_t bForceAllCharUseSameWidth   : 1;
+    uint8_t bLineBoxValid               : 1;
+    uint8_t bLayoutValid                : 1;
+    uint8_t                             : 5;
+
+    uint32_t wLastUsed;
+    arm_2d_size_t tLineBox;
+
+    /* the layout is only valid for the same draw region size and start offset */
+    arm_2d_size_t tRegionSize;
+    arm_2d_location_t tStartOffset;
+    arm_2d_location_t tEndOffset;
+
+    char chText[__LCD_TEXT_RUN_TEXT_SIZE];
+    __lcd_text_glyph_t tGlyphs[__LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__];
+} __lcd_text_run_t;
+#endif
 
-static struct {
+typedef struct __lcd_text_control_t {
     arm_2d_region_t tScreen;
     arm_2d_region_t tRegion;
 
@@ -83,91 +141,204 @@ static struct {
     uint32_t                            : 31;
 
     const arm_2d_font_t *ptFont;
-} s_tLCDTextControl = {
-    .tScreen = {
-        .tSize = {
-            .iWidth = 320,
-            .iHeight = 240,
+
+    uint32_t wVersion;                          //!< the version of the settings of thread 0 copied
+} __lcd_text_control_t;
+
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+typedef struct __lcd_text_run_cache_t {
+    __lcd_text_run_t tRuns[__LCD_PRINTF_CFG_RUN_CACHE_SIZE__];
+    uint32_t wTick;
+    uint32_t wFlushCount;                       //!< the flush requests handled
+} __lcd_text_run_cache_t;
+#endif
+
+/*============================ GLOBAL VARIABLES ==============================*/
+extern
+const uint8_t Font_6x8_h[(144-32)*8];
+
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+/*!
+ * \brief the text control of each drawing thread
+ * \note  Only the first one is initialised here, the others copy it whenever
+ *        thread 0 has changed its settings since their last copy.
+ */
+static __lcd_text_control_t s_tLCDTextControl[__LCD_PRINTF_THREAD_COUNT] = {
+    [0] = {
+        .tScreen = {
+            .tSize = {
+                .iWidth = 320,
+                .iHeight = 240,
+            },
         },
-    },
-    .tRegion = { 
-        .tSize = {
-            .iWidth = 320,
-            .iHeight = 240,
+        .tRegion = { 
+            .tSize = {
+                .iWidth = 320,
+                .iHeight = 240,
+            },
         },
+        .tColour = {
+            .tForeground = GLCD_COLOR_GREEN,
+            .tBackground = GLCD_COLOR_BLACK,
+        },
+        .ptTargetFB = (arm_2d_tile_t *)(-1),
+        .wMode = ARM_2D_DRW_PATN_MODE_COPY,
+                //| ARM_2D_DRW_PATN_MODE_NO_FG_COLOR    
+                //| ARM_2D_DRW_PATH_MODE_COMP_FG_COLOUR 
+        .ptFont = &ARM_2D_FONT_6x8.use_as__arm_2d_font_t,
+        .chOpacity = 255,
     },
-    .tColour = {
-        .tForeground = GLCD_COLOR_GREEN,
-        .tBackground = GLCD_COLOR_BLACK,
-    },
-    .ptTargetFB = (arm_2d_tile_t *)(-1),
-    .wMode = ARM_2D_DRW_PATN_MODE_COPY,
-            //| ARM_2D_DRW_PATN_MODE_NO_FG_COLOR    
-            //| ARM_2D_DRW_PATH_MODE_COMP_FG_COLOUR 
-    .ptFont = &ARM_2D_FONT_6x8.use_as__arm_2d_font_t,
-    .chOpacity = 255,
 };
 
+/* increased each time thread 0 changes its settings, it starts from 1 so the
+ * other threads always copy the settings of thread 0 before the first use
+ */
+static volatile uint32_t s_wLCDTextSettingsVersion = 1;
+
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+static __lcd_text_run_cache_t s_tLCDTextRunCache[__LCD_PRINTF_THREAD_COUNT];
+
+/* increased each time arm_lcd_text_flush_run_cache() is called */
+static volatile uint32_t s_wLCDTextRunCacheFlushCount = 0;
+#endif
+
+static char s_chTextBuffer[__LCD_PRINTF_THREAD_COUNT]
+                          [__LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__ + 1];
+
 /*============================ IMPLEMENTATION ================================*/
 
+static
+__lcd_text_control_t *__arm_lcd_text_control(void)
+{
+    uint_fast8_t chIndex = __LCD_PRINTF_THREAD_INDEX();
+    assert(chIndex < __LCD_PRINTF_THREAD_COUNT);
+
+    __lcd_text_control_t *ptThis = &s_tLCDTextControl[chIndex];
+
+    /*! \note thread 0 only changes its settings when the other threads are 
+     *!       not drawing, e.g. in the first PFB of a frame before the bands 
+     *!       are dispatched, hence the copy is safe.
+     */
+    if ((chIndex > 0) && (this.wVersion != s_wLCDTextSettingsVersion)) {
+        /* inherit the latest settings of thread 0 */
+        *ptThis = s_tLCDTextControl[0];
+        this.wVersion = s_wLCDTextSettingsVersion;
+    }
+
+    return ptThis;
+}
+
+/*!
+ * \brief get the text control of the current thread for changing the settings
+ * \note  the changes made by thread 0 are passed on to the other threads
+ */
+static
+__lcd_text_control_t *__arm_lcd_text_control_update(void)
+{
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
+    if (ptThis == &s_tLCDTextControl[0]) {
+        s_wLCDTextSettingsVersion++;
+    }
+
+    return ptThis;
+}
+
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+static
+__lcd_text_run_cache_t *__arm_lcd_text_run_cache(void)
+{
+    __lcd_text_run_cache_t *ptCache 
+        = &s_tLCDTextRunCache[__LCD_PRINTF_THREAD_INDEX()];
+    uint32_t wFlushCount = s_wLCDTextRunCacheFlushCount;
+
+    /* each thread only flushes its own cache */
+    if (ptCache->wFlushCount != wFlushCount) {
+        memset(ptCache, 0, sizeof(__lcd_text_run_cache_t));
+        ptCache->wFlushCount = wFlushCount;
+    }
+
+    return ptCache;
+}
+#endif
+
 void arm_lcd_text_init(arm_2d_region_t *ptScreen)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
     assert(NULL != ptScreen);
-    s_tLCDTextControl.tScreen = *ptScreen;
+    this.tScreen = *ptScreen;
 }
 
 
 void arm_lcd_text_set_colour(COLOUR_INT_TYPE wForeground, COLOUR_INT_TYPE wBackground)
 {
-    s_tLCDTextControl.tColour.tForeground = wForeground;
-    s_tLCDTextControl.tColour.tBackground = wBackground;
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
+    this.tColour.tForeground = wForeground;
+    this.tColour.tBackground = wBackground;
 }
 
 void arm_lcd_text_set_target_framebuffer(const arm_2d_tile_t *ptFrameBuffer)
 {
-    s_tLCDTextControl.ptTargetFB = (arm_2d_tile_t *)ptFrameBuffer;
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
+    this.ptTargetFB = (arm_2d_tile_t *)ptFrameBuffer;
 
     if (NULL == ptFrameBuffer) {
         // use default framebuffer
-        s_tLCDTextControl.ptTargetFB = (arm_2d_tile_t *)(-1);
+        this.ptTargetFB = (arm_2d_tile_t *)(-1);
     }
 }
 
 void arm_lcd_text_set_display_mode(uint32_t wMode)
 {
-    s_tLCDTextControl.wMode = wMode;
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
+    this.wMode = wMode;
 }
 
 void arm_lcd_text_set_opacity(uint8_t chOpacity)
 {
-    s_tLCDTextControl.chOpacity = chOpacity;
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
+    this.chOpacity = chOpacity;
 }
 
 void arm_lcd_text_set_scale(float fScale)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
     if ((fScale != 0.0f) && ABS(fScale - 1.0f) > 0.01f) {
-        s_tLCDTextControl.fScale = ABS(fScale);
+        this.fScale = ABS(fScale);
     } else {
-        s_tLCDTextControl.fScale = 0.0f;
+        this.fScale = 0.0f;
     }
 }
 
 bool arm_lcd_text_force_char_use_same_width(bool bForced)
 {
-    bool bOriginalValue = s_tLCDTextControl.bForceAllCharUseSameWidth;
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
+    bool bOriginalValue = this.bForceAllCharUseSameWidth;
 
-    s_tLCDTextControl.bForceAllCharUseSameWidth = bForced;
+    this.bForceAllCharUseSameWidth = bForced;
 
     return bOriginalValue;
 }
 
 void arm_lcd_text_set_draw_region(arm_2d_region_t *ptRegion)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
     if (NULL == ptRegion) {
-        ptRegion =  &s_tLCDTextControl.tScreen;
+        ptRegion =  &this.tScreen;
     }
     
-    s_tLCDTextControl.tRegion = *ptRegion;
+    this.tRegion = *ptRegion;
     
     /* reset draw pointer */
     arm_lcd_text_location(0,0);
@@ -175,25 +346,29 @@ void arm_lcd_text_set_draw_region(arm_2d_region_t *ptRegion)
 
 void arm_lcd_text_location(uint8_t chY, uint8_t chX)
 {
-    arm_2d_size_t tSize = s_tLCDTextControl.ptFont->tCharSize;
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
+    arm_2d_size_t tSize = this.ptFont->tCharSize;
     
-    s_tLCDTextControl.tDrawOffset.iX 
-        = tSize.iWidth * chX % s_tLCDTextControl.tRegion.tSize.iWidth;
-    s_tLCDTextControl.tDrawOffset.iY 
+    this.tDrawOffset.iX 
+        = tSize.iWidth * chX % this.tRegion.tSize.iWidth;
+    this.tDrawOffset.iY 
         = tSize.iHeight * 
         (   chY + tSize.iWidth * chX 
-        /   s_tLCDTextControl.tRegion.tSize.iWidth);
+        /   this.tRegion.tSize.iWidth);
 
-    s_tLCDTextControl.tDrawOffset.iY %= s_tLCDTextControl.tRegion.tSize.iHeight;
+    this.tDrawOffset.iY %= this.tRegion.tSize.iHeight;
 }
 
 arm_2d_err_t arm_lcd_text_set_font(const arm_2d_font_t *ptFont)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control_update();
+
     if (NULL == ptFont) {
         ptFont = &ARM_2D_FONT_6x8.use_as__arm_2d_font_t;   /* use default font */
     }
 
-    if (s_tLCDTextControl.ptFont == ptFont) {
+    if (this.ptFont == ptFont) {
         return ARM_2D_ERR_NONE;
     }
 
@@ -207,7 +382,7 @@ arm_2d_err_t arm_lcd_text_set_font(const arm_2d_font_t *ptFont)
             break;
         }
         
-        s_tLCDTextControl.ptFont = ptFont;
+        this.ptFont = ptFont;
 
         /* reset draw pointer */
         arm_lcd_text_location(0,0);
@@ -220,6 +395,76 @@ arm_2d_err_t arm_lcd_text_set_font(const arm_2d_font_t *ptFont)
     return ARM_2D_ERR_INVALID_PARAM;
 }
 
+void arm_lcd_text_flush_run_cache(void)
+{
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+    /* the cache of each thread is flushed by its owner when it is used next */
+    s_wLCDTextRunCacheFlushCount++;
+#endif
+}
+
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+/*!
+ * \brief find the cached run of a given string, or reuse the least recently
+ *        used run for it
+ * \param[in] str the target string
+ * \param[in] ptFont the font used to shape the string
+ * \return __lcd_text_run_t* the run, NULL means the string is too long to cache
+ */
+static
+__lcd_text_run_t *__arm_lcd_text_run_get(const char *str, 
+                                         const arm_2d_font_t *ptFont)
+{
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
+    /* FNV-1a */
+    uint32_t wHash = 2166136261UL;
+    size_t tLength = 0;
+
+    while(str[tLength]) {
+        if (tLength >= __LCD_TEXT_RUN_TEXT_SIZE) {
+            return NULL;
+        }
+        wHash ^= (uint8_t)str[tLength++];
+        wHash *= 16777619UL;
+    }
+
+    bool bForceAllCharUseSameWidth = this.bForceAllCharUseSameWidth;
+    __lcd_text_run_cache_t *ptCache = __arm_lcd_text_run_cache();
+    __lcd_text_run_t *ptVictim = &ptCache->tRuns[0];
+
+    arm_foreach(__lcd_text_run_t, ptCache->tRuns, ptRun) {
+        if (    (ptRun->ptFont == ptFont)
+            &&  (ptRun->wHash == wHash)
+            &&  (ptRun->hwLength == tLength)
+            &&  (ptRun->fScale == this.fScale)
+            &&  (ptRun->bForceAllCharUseSameWidth == bForceAllCharUseSameWidth)
+            &&  (0 == memcmp(ptRun->chText, str, tLength))) {
+            ptRun->wLastUsed = ++ptCache->wTick;
+            return ptRun;
+        }
+
+        if (ptRun->wLastUsed < ptVictim->wLastUsed) {
+            ptVictim = ptRun;
+        }
+    }
+
+    /* replace the least recently used run */
+    ptVictim->ptFont = ptFont;
+    ptVictim->wHash = wHash;
+    ptVictim->hwLength = (uint16_t)tLength;
+    ptVictim->fScale = this.fScale;
+    ptVictim->bForceAllCharUseSameWidth = bForceAllCharUseSameWidth;
+    ptVictim->bLineBoxValid = false;
+    ptVictim->bLayoutValid = false;
+    ptVictim->hwGlyphCount = 0;
+    ptVictim->wLastUsed = ++ptCache->wTick;
+    memcpy(ptVictim->chText, str, tLength);
+
+    return ptVictim;
+}
+#endif
+
 
 arm_2d_char_descriptor_t *
 ARM_2D_A1_FONT_GET_CHAR_DESCRIPTOR_HANDLER(
@@ -257,6 +502,8 @@ arm_2d_char_descriptor_t *__arm_lcd_get_char_descriptor(const arm_2d_font_t *ptF
                                                         arm_2d_char_descriptor_t *ptDescriptor, 
                                                         uint8_t *pchCharCode)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
     assert(NULL != pchCharCode);
 
     if (NULL == arm_2d_helper_get_char_descriptor(ptFont, ptDescriptor, pchCharCode)) {
@@ -265,11 +512,11 @@ arm_2d_char_descriptor_t *__arm_lcd_get_char_descriptor(const arm_2d_font_t *ptF
     }
 
     /* NOTE: when the FONT mask insn't ARM_2D_COLOUR_8BIT, the scaling behaviour is unpredicted */
-    if (s_tLCDTextControl.fScale > 0.0f) {
-        ptDescriptor->iAdvance = (int16_t)((float)ptDescriptor->iAdvance * s_tLCDTextControl.fScale);
+    if (this.fScale > 0.0f) {
+        ptDescriptor->iAdvance = (int16_t)((float)ptDescriptor->iAdvance * this.fScale);
         /* NOTE: No need to adjust bearings in the following way. */
-        //ptDescriptor->iBearingX = (int16_t)((float)ptDescriptor->iBearingX * s_tLCDTextControl.fScale);
-        //ptDescriptor->iBearingY = (int16_t)((float)ptDescriptor->iBearingY * s_tLCDTextControl.fScale);
+        //ptDescriptor->iBearingX = (int16_t)((float)ptDescriptor->iBearingX * this.fScale);
+        //ptDescriptor->iBearingY = (int16_t)((float)ptDescriptor->iBearingY * this.fScale);
     }
 
     return ptDescriptor;
@@ -279,10 +526,12 @@ arm_2d_char_descriptor_t *__arm_lcd_get_char_descriptor(const arm_2d_font_t *ptF
 static
 int16_t __arm_lcd_get_char_advance(const arm_2d_font_t *ptFont, arm_2d_char_descriptor_t *ptDescriptor, uint8_t *pchChar)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
     int16_t iAdvance = ptFont->tCharSize.iWidth;
 
     do {
-        if (s_tLCDTextControl.bForceAllCharUseSameWidth) {
+        if (this.bForceAllCharUseSameWidth) {
             break;
         }
         if (NULL != ptDescriptor) {
@@ -304,87 +553,121 @@ int16_t __arm_lcd_get_char_advance(const arm_2d_font_t *ptFont, arm_2d_char_desc
 
 
     /* NOTE: when the FONT mask insn't ARM_2D_COLOUR_8BIT, the scaling behaviour is unpredicted */
-    if (s_tLCDTextControl.fScale > 0.0f) {
-        iAdvance = (int16_t)((float)iAdvance * s_tLCDTextControl.fScale);
+    if (this.fScale > 0.0f) {
+        iAdvance = (int16_t)((float)iAdvance * this.fScale);
         /* NOTE: No need to adjust bearings in the following way. */
-        //ptDescriptor->iBearingX = (int16_t)((float)ptDescriptor->iBearingX * s_tLCDTextControl.fScale);
-        //ptDescriptor->iBearingY = (int16_t)((float)ptDescriptor->iBearingY * s_tLCDTextControl.fScale);
+        //ptDescriptor->iBearingX = (int16_t)((float)ptDescriptor->iBearingX * this.fScale);
+        //ptDescriptor->iBearingY = (int16_t)((float)ptDescriptor->iBearingY * this.fScale);
     }
 
     return iAdvance;
 
 }
 
-int16_t lcd_draw_char(int16_t iX, int16_t iY, uint8_t **ppchCharCode, uint_fast8_t chOpacity)
+static
+arm_2d_char_descriptor_t *__arm_lcd_get_char(   uint8_t **ppchCharCode, 
+                                                arm_2d_char_descriptor_t *ptDescriptor)
 {
-    arm_2d_char_descriptor_t tCharDescriptor;
-    
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
     int8_t chCodeLength = arm_2d_helper_get_utf8_byte_valid_length(*ppchCharCode);
     if (chCodeLength <= 0) {
         chCodeLength = 1;
     }
 
-    if (NULL == arm_2d_helper_get_char_descriptor(  s_tLCDTextControl.ptFont, 
-                                                    &tCharDescriptor,
-                                                    *ppchCharCode)){
-        (*ppchCharCode) += chCodeLength;
-
-        return __arm_lcd_get_char_advance(s_tLCDTextControl.ptFont, NULL, NULL);
-    }
+    ptDescriptor = arm_2d_helper_get_char_descriptor(   this.ptFont, 
+                                                        ptDescriptor,
+                                                        *ppchCharCode);
 
     //(*ppchCharCode) += tCharDescriptor.chCodeLength;
     (*ppchCharCode) += chCodeLength;
 
-    arm_2d_size_t tBBoxSize = s_tLCDTextControl.ptFont->tCharSize;
+    return ptDescriptor;
+}
+
+static
+void __arm_lcd_draw_glyph(  int16_t iX, 
+                            int16_t iY, 
+                            arm_2d_char_descriptor_t *ptDescriptor, 
+                            uint_fast8_t chOpacity)
+{
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
+    arm_2d_size_t tBBoxSize = this.ptFont->tCharSize;
 
     arm_2d_region_t tDrawRegion = {
         .tLocation = {
-            .iX = iX + tCharDescriptor.iBearingX,
-            .iY = iY + (tBBoxSize.iHeight - tCharDescriptor.iBearingY),
+            .iX = iX + ptDescriptor->iBearingX,
+            .iY = iY + (tBBoxSize.iHeight - ptDescriptor->iBearingY),
          },
-        .tSize = tCharDescriptor.tileChar.tRegion.tSize,
+        .tSize = ptDescriptor->tileChar.tRegion.tSize,
     };
 
-    if (NULL != s_tLCDTextControl.ptFont->fnDrawChar) {
-        s_tLCDTextControl.ptFont->fnDrawChar(   
-                                    s_tLCDTextControl.ptTargetFB,
+    if (NULL != this.ptFont->fnDrawChar) {
+        this.ptFont->fnDrawChar(   
+                                    this.ptTargetFB,
                                     &tDrawRegion,
-                                    &tCharDescriptor.tileChar,
-                                    s_tLCDTextControl.tColour.tForeground,
+                                    &ptDescriptor->tileChar,
+                                    this.tColour.tForeground,
                                     chOpacity,
-                                    s_tLCDTextControl.fScale);
+                                    this.fScale);
     } else {
-        arm_2d_draw_pattern(&tCharDescriptor.tileChar, 
-                            s_tLCDTextControl.ptTargetFB, 
+        arm_2d_draw_pattern(&ptDescriptor->tileChar, 
+                            this.ptTargetFB, 
                             &tDrawRegion,
-                            s_tLCDTextControl.wMode,
-                            s_tLCDTextControl.tColour.tForeground,
-                            s_tLCDTextControl.tColour.tBackground);
+                            this.wMode,
+                            this.tColour.tForeground,
+                            this.tColour.tBackground);
     }
 
     arm_2d_op_wait_async(NULL);
+}
 
-    return __arm_lcd_get_char_advance(s_tLCDTextControl.ptFont, &tCharDescriptor, NULL);
+int16_t lcd_draw_char(int16_t iX, int16_t iY, uint8_t **ppchCharCode, uint_fast8_t chOpacity)
+{
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
+    arm_2d_char_descriptor_t tCharDescriptor;
+
+    if (NULL == __arm_lcd_get_char(ppchCharCode, &tCharDescriptor)) {
+        return __arm_lcd_get_char_advance(this.ptFont, NULL, NULL);
+    }
+
+    __arm_lcd_draw_glyph(iX, iY, &tCharDescriptor, chOpacity);
+
+    return __arm_lcd_get_char_advance(this.ptFont, &tCharDescriptor, NULL);
 }
 
 static void __arm_lcd_draw_region_line_wrapping(arm_2d_size_t *ptCharSize, 
                                                 arm_2d_size_t *ptDrawRegionSize)
 {
-    if (s_tLCDTextControl.tDrawOffset.iX >= ptDrawRegionSize->iWidth) {
-        s_tLCDTextControl.tDrawOffset.iX = 0;
-        s_tLCDTextControl.tDrawOffset.iY += ptCharSize->iHeight;
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
+    if (this.tDrawOffset.iX >= ptDrawRegionSize->iWidth) {
+        this.tDrawOffset.iX = 0;
+        this.tDrawOffset.iY += ptCharSize->iHeight;
 
-        if (s_tLCDTextControl.tDrawOffset.iY >= ptDrawRegionSize->iHeight) {
-            s_tLCDTextControl.tDrawOffset.iY = 0;
+        if (this.tDrawOffset.iY >= ptDrawRegionSize->iHeight) {
+            this.tDrawOffset.iY = 0;
         }
     }
 }
 
 arm_2d_size_t __arm_lcd_get_string_line_box(const char *str, const arm_2d_font_t *ptFont)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
     if (NULL == ptFont) {
-        ptFont = s_tLCDTextControl.ptFont;
+        ptFont = this.ptFont;
+    }
+
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+    __lcd_text_run_t *ptRun = __arm_lcd_text_run_get(str, ptFont);
+    if (NULL != ptRun && ptRun->bLineBoxValid) {
+        return ptRun->tLineBox;
     }
+#endif
+
     arm_2d_size_t tCharSize = ptFont->tCharSize;
     arm_2d_region_t tDrawBox = {
         .tSize.iHeight = tCharSize.iHeight,
@@ -429,91 +712,165 @@ arm_2d_size_t __arm_lcd_get_string_line_box(const char *str, const arm_2d_font_t
         str++;
     }
 
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+    if (NULL != ptRun) {
+        ptRun->tLineBox = tDrawBox.tSize;
+        ptRun->bLineBoxValid = true;
+    }
+#endif
+
     return tDrawBox.tSize;
 }
 
 void arm_lcd_putchar(const char *str)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
 
-    if (!arm_2d_helper_pfb_is_region_active(s_tLCDTextControl.ptTargetFB, &s_tLCDTextControl.tRegion, true)) {
+    if (!arm_2d_helper_pfb_is_region_active(this.ptTargetFB, &this.tRegion, true)) {
         return ;
     }
 
-    arm_2d_size_t tCharSize = s_tLCDTextControl.ptFont->tCharSize;
-    arm_2d_size_t tDrawRegionSize = s_tLCDTextControl.tRegion.tSize;
+    arm_2d_size_t tCharSize = this.ptFont->tCharSize;
+    arm_2d_size_t tDrawRegionSize = this.tRegion.tSize;
 
     if (*str) {
         if (*str == '\r') {
-            s_tLCDTextControl.tDrawOffset.iX = 0;
+            this.tDrawOffset.iX = 0;
         } else if (*str == '\n') {
-            s_tLCDTextControl.tDrawOffset.iX = 0;
-            s_tLCDTextControl.tDrawOffset.iY += tCharSize.iHeight;
-            if (s_tLCDTextControl.tDrawOffset.iY >= tDrawRegionSize.iHeight) {
-                s_tLCDTextControl.tDrawOffset.iY = 0;
+            this.tDrawOffset.iX = 0;
+            this.tDrawOffset.iY += tCharSize.iHeight;
+            if (this.tDrawOffset.iY >= tDrawRegionSize.iHeight) {
+                this.tDrawOffset.iY = 0;
             }
         } else if (*str == '\t') { 
-            s_tLCDTextControl.tDrawOffset.iX += tCharSize.iWidth * 4;
-            s_tLCDTextControl.tDrawOffset.iX -= s_tLCDTextControl.tDrawOffset.iX 
+            this.tDrawOffset.iX += tCharSize.iWidth * 4;
+            this.tDrawOffset.iX -= this.tDrawOffset.iX 
                                               % (tCharSize.iWidth * 4);
 
             __arm_lcd_draw_region_line_wrapping(&tCharSize, &tDrawRegionSize);
 
         }else if (*str == '\b') {
-            if (s_tLCDTextControl.tDrawOffset.iX >= tCharSize.iWidth) {
-                s_tLCDTextControl.tDrawOffset.iX -= tCharSize.iWidth;
+            if (this.tDrawOffset.iX >= tCharSize.iWidth) {
+                this.tDrawOffset.iX -= tCharSize.iWidth;
             } else {
-                s_tLCDTextControl.tDrawOffset.iX = 0;
+                this.tDrawOffset.iX = 0;
             }
         } else {
-            int16_t iX = s_tLCDTextControl.tDrawOffset.iX + s_tLCDTextControl.tRegion.tLocation.iX;
-            int16_t iY = s_tLCDTextControl.tDrawOffset.iY + s_tLCDTextControl.tRegion.tLocation.iY; 
+            int16_t iX = this.tDrawOffset.iX + this.tRegion.tLocation.iX;
+            int16_t iY = this.tDrawOffset.iY + this.tRegion.tLocation.iY; 
 
-            s_tLCDTextControl.tDrawOffset.iX 
-                += lcd_draw_char(   iX, iY, (uint8_t **)&str, s_tLCDTextControl.chOpacity);
+            this.tDrawOffset.iX 
+                += lcd_draw_char(   iX, iY, (uint8_t **)&str, this.chOpacity);
 
             __arm_lcd_draw_region_line_wrapping(&tCharSize, &tDrawRegionSize);
         }
     }
 }
 
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+static void __arm_lcd_text_run_replay(__lcd_text_run_t *ptRun)
+{
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
+    int16_t iX = this.tRegion.tLocation.iX;
+    int16_t iY = this.tRegion.tLocation.iY;
+
+    for (uint_fast16_t n = 0; n < ptRun->hwGlyphCount; n++) {
+        __lcd_text_glyph_t *ptGlyph = &ptRun->tGlyphs[n];
+
+        __arm_lcd_draw_glyph(   iX + ptGlyph->tOffset.iX, 
+                                iY + ptGlyph->tOffset.iY, 
+                                &ptGlyph->tDescriptor,
+                                this.chOpacity);
+    }
+
+    this.tDrawOffset = ptRun->tEndOffset;
+}
+#endif
+
 void arm_lcd_puts(const char *str)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
     
-    if (!arm_2d_helper_pfb_is_region_active(s_tLCDTextControl.ptTargetFB, &s_tLCDTextControl.tRegion, true)) {
+    if (!arm_2d_helper_pfb_is_region_active(this.ptTargetFB, &this.tRegion, true)) {
         return ;
     }
 
-    arm_2d_size_t tCharSize = s_tLCDTextControl.ptFont->tCharSize;
-    arm_2d_size_t tDrawRegionSize = s_tLCDTextControl.tRegion.tSize;
+    arm_2d_size_t tCharSize = this.ptFont->tCharSize;
+    arm_2d_size_t tDrawRegionSize = this.tRegion.tSize;
+
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+    __lcd_text_run_t *ptRun = __arm_lcd_text_run_get(str, this.ptFont);
+    if (NULL != ptRun) {
+        if (    ptRun->bLayoutValid
+            &&  (ptRun->tRegionSize.iWidth == tDrawRegionSize.iWidth)
+            &&  (ptRun->tRegionSize.iHeight == tDrawRegionSize.iHeight)
+            &&  (ptRun->tStartOffset.iX == this.tDrawOffset.iX)
+            &&  (ptRun->tStartOffset.iY == this.tDrawOffset.iY)) {
+            /* the string has been shaped before, only draw the glyphs */
+            __arm_lcd_text_run_replay(ptRun);
+            return ;
+        }
+
+        /* record the layout */
+        ptRun->bLayoutValid = false;
+        ptRun->hwGlyphCount = 0;
+        ptRun->tRegionSize = tDrawRegionSize;
+        ptRun->tStartOffset = this.tDrawOffset;
+    }
+#endif
 
     while(*str) {
         if (*str == '\r') {
-            s_tLCDTextControl.tDrawOffset.iX = 0;
+            this.tDrawOffset.iX = 0;
         } else if (*str == '\n') {
-            s_tLCDTextControl.tDrawOffset.iX = 0;
-            s_tLCDTextControl.tDrawOffset.iY += tCharSize.iHeight;
-            if (s_tLCDTextControl.tDrawOffset.iY >= tDrawRegionSize.iHeight) {
-                s_tLCDTextControl.tDrawOffset.iY = 0;
+            this.tDrawOffset.iX = 0;
+            this.tDrawOffset.iY += tCharSize.iHeight;
+            if (this.tDrawOffset.iY >= tDrawRegionSize.iHeight) {
+                this.tDrawOffset.iY = 0;
             }
         } else if (*str == '\t') { 
-            s_tLCDTextControl.tDrawOffset.iX += tCharSize.iWidth * 4;
-            s_tLCDTextControl.tDrawOffset.iX -= s_tLCDTextControl.tDrawOffset.iX 
+            this.tDrawOffset.iX += tCharSize.iWidth * 4;
+            this.tDrawOffset.iX -= this.tDrawOffset.iX 
                                               % tCharSize.iWidth;
 
             __arm_lcd_draw_region_line_wrapping(&tCharSize, &tDrawRegionSize);
 
         }else if (*str == '\b') {
-            if (s_tLCDTextControl.tDrawOffset.iX >= tCharSize.iWidth) {
-                s_tLCDTextControl.tDrawOffset.iX -= tCharSize.iWidth;
+            if (this.tDrawOffset.iX >= tCharSize.iWidth) {
+                this.tDrawOffset.iX -= tCharSize.iWidth;
             } else {
-                s_tLCDTextControl.tDrawOffset.iX = 0;
+                this.tDrawOffset.iX = 0;
             }
         } else {
-            int16_t iX = s_tLCDTextControl.tDrawOffset.iX + s_tLCDTextControl.tRegion.tLocation.iX;
-            int16_t iY = s_tLCDTextControl.tDrawOffset.iY + s_tLCDTextControl.tRegion.tLocation.iY; 
+            int16_t iX = this.tDrawOffset.iX + this.tRegion.tLocation.iX;
+            int16_t iY = this.tDrawOffset.iY + this.tRegion.tLocation.iY; 
+
+            arm_2d_char_descriptor_t tCharDescriptor;
+            arm_2d_char_descriptor_t *ptDescriptor 
+                = __arm_lcd_get_char((uint8_t **)&str, &tCharDescriptor);
+
+            if (NULL != ptDescriptor) {
+                __arm_lcd_draw_glyph(iX, iY, ptDescriptor, this.chOpacity);
+
+            #if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+                if (NULL == ptRun) {
+                    /* the string is not cached */
+                } else if (ptRun->hwGlyphCount < __LCD_PRINTF_CFG_RUN_CACHE_MAX_GLYPHS__) {
+                    __lcd_text_glyph_t *ptGlyph = &ptRun->tGlyphs[ptRun->hwGlyphCount++];
+                    ptGlyph->tOffset = this.tDrawOffset;
+                    ptGlyph->tDescriptor = *ptDescriptor;
+                } else {
+                    /* too many glyphs to cache */
+                    ptRun = NULL;
+                }
+            #endif
+            }
 
-            s_tLCDTextControl.tDrawOffset.iX 
-                += lcd_draw_char(   iX, iY, (uint8_t **)&str, s_tLCDTextControl.chOpacity);
+            this.tDrawOffset.iX 
+                += __arm_lcd_get_char_advance(  this.ptFont, 
+                                                ptDescriptor, 
+                                                NULL);
 
             __arm_lcd_draw_region_line_wrapping(&tCharSize, &tDrawRegionSize);
 
@@ -522,6 +879,13 @@ void arm_lcd_puts(const char *str)
         
         str++;
     }
+
+#if __LCD_PRINTF_CFG_RUN_CACHE_SIZE__ > 0
+    if (NULL != ptRun) {
+        ptRun->tEndOffset = this.tDrawOffset;
+        ptRun->bLayoutValid = true;
+    }
+#endif
 }
 
 #if defined(__IS_COMPILER_IAR__) && __IS_COMPILER_IAR__
@@ -531,14 +895,14 @@ void arm_lcd_puts(const char *str)
 int arm_lcd_printf(const char *format, ...)
 {
     int real_size;
-    static char s_chBuffer[__LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__ + 1];
+    char *pchBuffer = s_chTextBuffer[__LCD_PRINTF_THREAD_INDEX()];
     __va_list ap;
     va_start(ap, format);
-        real_size = vsnprintf(s_chBuffer, sizeof(s_chBuffer)-1, format, ap);
+        real_size = vsnprintf(pchBuffer, __LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__, format, ap);
     va_end(ap);
-    real_size = MIN(sizeof(s_chBuffer)-1, real_size);
-    s_chBuffer[real_size] = '\0';
-    arm_lcd_puts(s_chBuffer);
+    real_size = MIN(__LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__, real_size);
+    pchBuffer[real_size] = '\0';
+    arm_lcd_puts(pchBuffer);
     return real_size;
 }
 
@@ -570,18 +934,20 @@ typedef enum {
 int arm_lcd_printf_label(   arm_2d_align_t tAlignment, 
                             const char *format, ...)
 {
+    __lcd_text_control_t *ptThis = __arm_lcd_text_control();
+
     int real_size;
-    static char s_chBuffer[__LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__ + 1];
+    char *pchBuffer = s_chTextBuffer[__LCD_PRINTF_THREAD_INDEX()];
     __va_list ap;
     va_start(ap, format);
-        real_size = vsnprintf(s_chBuffer, sizeof(s_chBuffer)-1, format, ap);
+        real_size = vsnprintf(pchBuffer, __LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__, format, ap);
     va_end(ap);
-    real_size = MIN(sizeof(s_chBuffer)-1, real_size);
-    s_chBuffer[real_size] = '\0';
+    real_size = MIN(__LCD_PRINTF_CFG_TEXT_BUFFER_SIZE__, real_size);
+    pchBuffer[real_size] = '\0';
 
-    arm_2d_size_t tLabelSize = arm_lcd_get_string_line_box(s_chBuffer);
+    arm_2d_size_t tLabelSize = arm_lcd_get_string_line_box(pchBuffer);
 
-    arm_2d_region_t tOriginalDrawRegion = s_tLCDTextControl.tRegion;
+    arm_2d_region_t tOriginalDrawRegion = this.tRegion;
 
     arm_2d_region_t tLabelRegion = {
         .tLocation = tOriginalDrawRegion.tLocation,
@@ -611,7 +977,7 @@ int arm_lcd_printf_label(   arm_2d_align_t tAlignment,
     }
 
     arm_lcd_text_set_draw_region(&tLabelRegion);
-    arm_lcd_puts(s_chBuffer);
+    arm_lcd_puts(pchBuffer);
     arm_lcd_text_set_draw_region(&tOriginalDrawRegion);
 
     return real_size;
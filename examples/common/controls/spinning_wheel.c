@@ -124,8 +124,10 @@ void spinning_wheel_show(const arm_2d_tile_t *ptTarget, bool bIsNewFrame)
             };
 
             arm_2d_align_centre(__top_container, c_tileSpinWheelMask.tRegion.tSize) {
-                arm_2dp_fill_colour_with_mask_opacity_and_transform(
-                                                &s_tMaskRotateCB[0],
+                /* use the default OP of the current thread, so the wheel can
+                 * be drawn by several band workers at the same time 
+                 */
+                arm_2d_fill_colour_with_mask_opacity_and_transform(
                                                 &c_tileSpinWheelMask,
                                                 ptTarget,
                                                 &__centre_region,
@@ -135,7 +137,7 @@ void spinning_wheel_show(const arm_2d_tile_t *ptTarget, bool bIsNewFrame)
                                                 GLCD_COLOR_WHITE,
                                                 254);
 
-                ARM_2D_OP_WAIT_ASYNC(&s_tMaskRotateCB[0].use_as__arm_2d_op_core_t);
+                ARM_2D_OP_WAIT_ASYNC();
             }
         } while(0);
     }
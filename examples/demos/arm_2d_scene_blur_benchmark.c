@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2009-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*============================ INCLUDES ======================================*/
+
+#if defined(_RTE_)
+#   include "RTE_Components.h"
+#endif
+
+#if defined(RTE_Acceleration_Arm_2D_Helper_PFB)
+#include "arm_2d.h"
+
+#define __USER_SCENE_BLUR_BENCHMARK_IMPLEMENT__
+#include "arm_2d_scene_blur_benchmark.h"
+
+#include "arm_2d_helper.h"
+#include "arm_2d_example_controls.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunknown-warning-option"
+#   pragma clang diagnostic ignored "-Wreserved-identifier"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wcast-qual"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wmissing-field-initializers"
+#   pragma clang diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
+#   pragma clang diagnostic ignored "-Wmissing-prototypes"
+#   pragma clang diagnostic ignored "-Wunused-variable"
+#   pragma clang diagnostic ignored "-Wgnu-statement-expression"
+#   pragma clang diagnostic ignored "-Wdeclaration-after-statement"
+#   pragma clang diagnostic ignored "-Wunused-function"
+#   pragma clang diagnostic ignored "-Wmissing-declarations"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#elif __IS_COMPILER_ARM_COMPILER_5__
+#   pragma diag_suppress 64,177
+#elif __IS_COMPILER_IAR__
+#   pragma diag_suppress=Pa089,Pe188,Pe177,Pe174
+#elif __IS_COMPILER_GCC__
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wformat="
+#   pragma GCC diagnostic ignored "-Wpedantic"
+#   pragma GCC diagnostic ignored "-Wunused-function"
+#   pragma GCC diagnostic ignored "-Wunused-variable"
+#   pragma GCC diagnostic ignored "-Wincompatible-pointer-types"
+#endif
+
+/*============================ MACROS ========================================*/
+
+/*
+ * NOTE: The scene calls the low level implementations of the IIR blur
+ *       directly. When the library is compiled with __SIMD_DEBUG__, the scalar
+ *       version keeps the default name and the vector version gets a "_simd"
+ *       suffix, so both of them can be measured side by side. Otherwise, only
+ *       the linked version is measured.
+ */
+#if __GLCD_CFG_COLOUR_DEPTH__ == 8
+
+#   define __arm_2d_impl_filter_iir_blur                                        \
+                __arm_2d_impl_gray8_filter_iir_blur
+#   define __arm_2d_impl_filter_iir_blur_simd                                   \
+                __arm_2d_impl_gray8_filter_iir_blur_simd
+#   define __BLUR_BENCHMARK_COLOUR_NAME         "GRAY8"
+
+#elif __GLCD_CFG_COLOUR_DEPTH__ == 16
+
+#   define __arm_2d_impl_filter_iir_blur                                        \
+                __arm_2d_impl_rgb565_filter_iir_blur
+#   define __arm_2d_impl_filter_iir_blur_simd                                   \
+                __arm_2d_impl_rgb565_filter_iir_blur_simd
+#   define __BLUR_BENCHMARK_COLOUR_NAME         "RGB565"
+
+#elif __GLCD_CFG_COLOUR_DEPTH__ == 32
+
+#   define __arm_2d_impl_filter_iir_blur                                        \
+                __arm_2d_impl_cccn888_filter_iir_blur
+#   define __arm_2d_impl_filter_iir_blur_simd                                   \
+                __arm_2d_impl_cccn888_filter_iir_blur_simd
+#   define __BLUR_BENCHMARK_COLOUR_NAME         "CCCN888"
+
+#else
+#   error Unsupported colour depth!
+#endif
+
+#if defined(__SIMD_DEBUG__) && __SIMD_DEBUG__                                   \
+ && defined(__ARM_2D_HAS_PORTABLE_SIMD__) && __ARM_2D_HAS_PORTABLE_SIMD__       \
+ && (   !defined(__ARM_2D_CFG_USE_IIR_BLUR_REVERSE_PATH__)                      \
+    ||  !__ARM_2D_CFG_USE_IIR_BLUR_REVERSE_PATH__)
+#   define __BLUR_BENCHMARK_HAS_VECTOR__        1
+#else
+#   define __BLUR_BENCHMARK_HAS_VECTOR__        0
+#endif
+
+#ifndef __BLUR_BENCHMARK_CFG_TILE_SIZE__
+#   define __BLUR_BENCHMARK_CFG_TILE_SIZE__     64
+#endif
+
+#ifndef __BLUR_BENCHMARK_CFG_ITERATIONS__
+#   define __BLUR_BENCHMARK_CFG_ITERATIONS__    8
+#endif
+
+/*============================ MACROFIED FUNCTIONS ===========================*/
+#undef this
+#define this (*ptThis)
+
+/*============================ TYPES =========================================*/
+
+typedef void __blur_benchmark_impl_t(  COLOUR_INT *pTarget,
+                                        int16_t iTargetStride,
+                                        arm_2d_region_t *ptValidRegionOnVirtualScreen,
+                                        arm_2d_region_t *ptTargetRegionOnVirtualScreen,
+                                        uint8_t chBlurDegree,
+                                        arm_2d_scratch_mem_t *ptScratchMemory);
+
+/*============================ GLOBAL VARIABLES ==============================*/
+
+extern
+__blur_benchmark_impl_t __arm_2d_impl_filter_iir_blur;
+
+#if __BLUR_BENCHMARK_HAS_VECTOR__
+extern
+__blur_benchmark_impl_t __arm_2d_impl_filter_iir_blur_simd;
+#endif
+
+/*============================ PROTOTYPES ====================================*/
+/*============================ LOCAL VARIABLES ===============================*/
+
+static const uint8_t c_chBlurDegrees[__BLUR_BENCHMARK_DEGREE_COUNT] = {
+    16, 64, 128, 192, 240,
+};
+
+static __blur_benchmark_impl_t * const c_fnBlurImpl[__BLUR_BENCHMARK_IMPL_COUNT] = {
+    [BLUR_BENCHMARK_IMPL_DEFAULT] = &__arm_2d_impl_filter_iir_blur,
+#if __BLUR_BENCHMARK_HAS_VECTOR__
+    [BLUR_BENCHMARK_IMPL_VECTOR] = &__arm_2d_impl_filter_iir_blur_simd,
+#endif
+};
+
+static COLOUR_INT s_tBlurBuffer[  __BLUR_BENCHMARK_CFG_TILE_SIZE__
+                                * __BLUR_BENCHMARK_CFG_TILE_SIZE__];
+
+/*============================ IMPLEMENTATION ================================*/
+
+static void __on_scene_blur_benchmark_depose(arm_2d_scene_t *ptScene)
+{
+    user_scene_blur_benchmark_t *ptThis = (user_scene_blur_benchmark_t *)ptScene;
+    ARM_2D_UNUSED(ptThis);
+
+    ptScene->ptPlayer = NULL;
+
+    if (!this.bUserAllocated) {
+        __arm_2d_free_scratch_memory(ARM_2D_MEM_TYPE_UNSPECIFIED, ptScene);
+    }
+}
+
+/*----------------------------------------------------------------------------*
+ * Scene blur_benchmark                                                       *
+ *----------------------------------------------------------------------------*/
+
+static void __blur_benchmark_measure(user_scene_blur_benchmark_t *ptThis)
+{
+    arm_2d_region_t tRegion = {
+        .tSize = {
+            .iWidth = __BLUR_BENCHMARK_CFG_TILE_SIZE__,
+            .iHeight = __BLUR_BENCHMARK_CFG_TILE_SIZE__,
+        },
+    };
+    arm_2d_scratch_mem_t tScratchMemory = {0};
+    uint_fast8_t chIndex = this.chDegreeIndex;
+
+    for (uint_fast8_t n = 0; n < __BLUR_BENCHMARK_IMPL_COUNT; n++) {
+        __blur_benchmark_impl_t *fnBlur = c_fnBlurImpl[n];
+        if (NULL == fnBlur) {
+            continue;
+        }
+
+        /* the IIR blur is data independent, no need to restore the buffer */
+        int64_t lStart = arm_2d_helper_get_system_timestamp();
+        for (uint_fast8_t i = 0; i < __BLUR_BENCHMARK_CFG_ITERATIONS__; i++) {
+            fnBlur( s_tBlurBuffer,
+                    __BLUR_BENCHMARK_CFG_TILE_SIZE__,
+                    &tRegion,
+                    &tRegion,
+                    c_chBlurDegrees[chIndex],
+                    &tScratchMemory);
+        }
+
+        this.tResult[chIndex][n].lTicks
+            += arm_2d_helper_get_system_timestamp() - lStart;
+        this.tResult[chIndex][n].wPixels
+            +=  __BLUR_BENCHMARK_CFG_TILE_SIZE__
+            *   __BLUR_BENCHMARK_CFG_TILE_SIZE__
+            *   __BLUR_BENCHMARK_CFG_ITERATIONS__;
+    }
+
+    this.chDegreeIndex = (chIndex + 1) % __BLUR_BENCHMARK_DEGREE_COUNT;
+}
+
+static float __blur_benchmark_get_throughput(   user_scene_blur_benchmark_t *ptThis,
+                                                uint_fast8_t chDegreeIndex,
+                                                uint_fast8_t chImpl)
+{
+    int64_t lTicks = this.tResult[chDegreeIndex][chImpl].lTicks;
+    if (lTicks <= 0) {
+        return 0.0f;
+    }
+
+    /* M pixels per second */
+    return  (float)this.tResult[chDegreeIndex][chImpl].wPixels
+        *   (float)arm_2d_helper_get_reference_clock_frequency()
+        /   ((float)lTicks * 1000000.0f);
+}
+
+static void __on_scene_blur_benchmark_frame_start(arm_2d_scene_t *ptScene)
+{
+    user_scene_blur_benchmark_t *ptThis = (user_scene_blur_benchmark_t *)ptScene;
+
+    __blur_benchmark_measure(ptThis);
+}
+
+static void __on_scene_blur_benchmark_frame_complete(arm_2d_scene_t *ptScene)
+{
+    user_scene_blur_benchmark_t *ptThis = (user_scene_blur_benchmark_t *)ptScene;
+    ARM_2D_UNUSED(ptThis);
+
+}
+
+static
+IMPL_PFB_ON_DRAW(__pfb_draw_scene_blur_benchmark_handler)
+{
+    ARM_2D_PARAM(pTarget);
+    ARM_2D_PARAM(ptTile);
+    ARM_2D_PARAM(bIsNewFrame);
+
+    user_scene_blur_benchmark_t *ptThis = (user_scene_blur_benchmark_t *)pTarget;
+    arm_2d_size_t tScreenSize = ptTile->tRegion.tSize;
+
+    ARM_2D_UNUSED(tScreenSize);
+
+    arm_2d_canvas(ptTile, __top_canvas) {
+    /*-----------------------draw the foreground begin-----------------------*/
+
+        arm_lcd_text_set_target_framebuffer((arm_2d_tile_t *)ptTile);
+        arm_lcd_text_set_font(&ARM_2D_FONT_6x8.use_as__arm_2d_font_t);
+        arm_lcd_text_set_draw_region(NULL);
+        arm_lcd_text_set_colour(GLCD_COLOR_GREEN, GLCD_COLOR_BLACK);
+        arm_lcd_text_location(0,0);
+
+        arm_lcd_printf( "IIR Blur, %dx%d " __BLUR_BENCHMARK_COLOUR_NAME "\r\n"
+                        "Throughput in MPixel/s\r\n\r\n",
+                        __BLUR_BENCHMARK_CFG_TILE_SIZE__,
+                        __BLUR_BENCHMARK_CFG_TILE_SIZE__);
+
+    #if __BLUR_BENCHMARK_HAS_VECTOR__
+        arm_lcd_puts("Degree  Scalar  Vector  Ratio\r\n");
+    #else
+        arm_lcd_puts("Degree  Current\r\n");
+    #endif
+
+        for (uint_fast8_t n = 0; n < __BLUR_BENCHMARK_DEGREE_COUNT; n++) {
+            float fDefault = __blur_benchmark_get_throughput(
+                                                ptThis,
+                                                n,
+                                                BLUR_BENCHMARK_IMPL_DEFAULT);
+
+        #if __BLUR_BENCHMARK_HAS_VECTOR__
+            float fVector = __blur_benchmark_get_throughput(
+                                                ptThis,
+                                                n,
+                                                BLUR_BENCHMARK_IMPL_VECTOR);
+
+            arm_lcd_printf( "%6d  %6.2f  %6.2f  %4.2fx\r\n",
+                            c_chBlurDegrees[n],
+                            fDefault,
+                            fVector,
+                            (fDefault > 0.0f) ? fVector / fDefault : 0.0f);
+        #else
+            arm_lcd_printf( "%6d  %7.2f\r\n",
+                            c_chBlurDegrees[n],
+                            fDefault);
+        #endif
+        }
+
+    /*-----------------------draw the foreground end  -----------------------*/
+    }
+    arm_2d_op_wait_async(NULL);
+
+    return arm_fsm_rt_cpl;
+}
+
+ARM_NONNULL(1)
+user_scene_blur_benchmark_t *__arm_2d_scene_blur_benchmark_init(
+                                        arm_2d_scene_player_t *ptDispAdapter,
+                                        user_scene_blur_benchmark_t *ptThis)
+{
+    bool bUserAllocated = false;
+    assert(NULL != ptDispAdapter);
+
+    if (NULL == ptThis) {
+        ptThis = (user_scene_blur_benchmark_t *)
+                    __arm_2d_allocate_scratch_memory(   sizeof(user_scene_blur_benchmark_t),
+                                                        __alignof__(user_scene_blur_benchmark_t),
+                                                        ARM_2D_MEM_TYPE_UNSPECIFIED);
+        assert(NULL != ptThis);
+        if (NULL == ptThis) {
+            return NULL;
+        }
+    } else {
+        bUserAllocated = true;
+    }
+
+    memset(ptThis, 0, sizeof(user_scene_blur_benchmark_t));
+
+    *ptThis = (user_scene_blur_benchmark_t){
+        .use_as__arm_2d_scene_t = {
+
+            /* the canvas colour */
+            .tCanvas = {GLCD_COLOR_BLACK},
+
+            .fnScene        = &__pfb_draw_scene_blur_benchmark_handler,
+            .fnOnFrameStart = &__on_scene_blur_benchmark_frame_start,
+            .fnOnFrameCPL   = &__on_scene_blur_benchmark_frame_complete,
+            .fnDepose       = &__on_scene_blur_benchmark_depose,
+        },
+        .bUserAllocated = bUserAllocated,
+    };
+
+    /* ------------   initialize members of user_scene_blur_benchmark_t begin ---------------*/
+
+    /* a deterministic pattern, the content doesn't affect the performance */
+    for (int_fast16_t n = 0; n < dimof(s_tBlurBuffer); n++) {
+        s_tBlurBuffer[n] = (COLOUR_INT)(n * 2654435761ul);
+    }
+
+    /* ------------   initialize members of user_scene_blur_benchmark_t end   ---------------*/
+
+    arm_2d_scene_player_append_scenes(  ptDispAdapter,
+                                        &this.use_as__arm_2d_scene_t,
+                                        1);
+
+    return ptThis;
+}
+
+
+#if defined(__clang__)
+#   pragma clang diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,159 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+# *************************************************************************************************
+#  Arm 2D project
+#  @file        benchmark_sweep.py
+#  @brief       build and run the host benchmark runner for a range of configurations
+#
+# *************************************************************************************************
+#
+# * Copyright (C) 2010-2024 ARM Limited or its affiliates. All rights reserved.
+# *
+# * SPDX-License-Identifier: Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the License); you may
+# * not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# * www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+# */
+
+#
+# Most of the arm-2d features are selected at compile time, hence, to compare
+# configurations (e.g. 1, 2 and 4 async workers), the host runner
+# (arm2d_benchmark_host) has to be built once for each of them. This script
+# builds one runner for each value of the swept macro, runs them in turn and
+# prints a markdown table of the average frame cost.
+#
+# Example: the scaling of the generic benchmark with the number of workers
+#
+#   python tools/benchmark_sweep.py --benchmark=generic --frames=300 \
+#          --cmake ARM2D_PTHREAD=ON -D __ARM_2D_HAS_ASYNC__=1 \
+#          --sweep __ARM_2D_CFG_ASYNC_WORKER_COUNT__=1,2,4
+#
+
+import sys
+import argparse
+import json
+import os
+import subprocess
+
+
+def build_runner(args, build_folder, defines):
+    c_flags = " ".join(f"-D{name}={value}" for name, value in defines)
+
+    cmake_args = [  "cmake", "-S", args.source, "-B", build_folder,
+                    "-DCMAKE_BUILD_TYPE=Release",
+                    "-DARM2D_HOST=ON",
+                    "-DARM2D_HELPER=ON",
+                    "-DARM2D_CONTROLS=ON",
+                    "-DARM2D_LCD_PRINTF=ON",
+                    "-DARM2D_BENCHMARK_GENERIC=ON",
+                    "-DARM2D_BENCHMARK_WATCHPANEL=ON",
+                    f"-DCMAKE_C_FLAGS={c_flags}"]
+    cmake_args += [f"-D{option}" for option in args.cmake]
+
+    subprocess.run(cmake_args, check=True, stdout=subprocess.DEVNULL)
+    subprocess.run( ["cmake", "--build", build_folder,
+                     "--target", "arm2d_benchmark_host",
+                     "-j", str(os.cpu_count() or 1)],
+                    check=True,
+                    stdout=subprocess.DEVNULL)
+
+    return os.path.join(build_folder, "arm2d_benchmark_host")
+
+
+def run_runner(args, runner):
+    results = []
+    for _ in range(args.repeat):
+        output = subprocess.run([runner,
+                                 f"--benchmark={args.benchmark}",
+                                 f"--frames={args.frames}",
+                                 f"--frame-period-ms={args.frame_period_ms}"],
+                                check=True,
+                                capture_output=True,
+                                text=True).stdout
+        results.append(json.loads(output))
+
+    # use the run with the median average cost to filter out the noise
+    results.sort(key=lambda result: result["average_cycles"])
+    return results[len(results) // 2], [r["average_cycles"] for r in results]
+
+
+def main(argv):
+
+    # Parse the input
+    parser = argparse.ArgumentParser(description='Sweep a compile-time option of the arm-2d host benchmark runner (v1.0.0)')
+
+    parser.add_argument("--sweep",              type = str, help="the swept macro and its values, e.g. __ARM_2D_CFG_ASYNC_WORKER_COUNT__=1,2,4", required=True)
+    parser.add_argument("-D",   "--define",     type = str, help="a macro shared by all builds, e.g. __ARM_2D_HAS_ASYNC__=1", action="append", default=[])
+    parser.add_argument("--cmake",              type = str, help="an extra CMake option, e.g. ARM2D_PTHREAD=ON", action="append", default=[])
+    parser.add_argument("--benchmark",          type = str, help="the benchmark to run: generic, watch_panel or static_page", default="generic")
+    parser.add_argument("--frames",             type = int, help="the number of frames of each run", default=300)
+    parser.add_argument("--frame-period-ms",    type = int, help="the virtual time between two frames", default=33)
+    parser.add_argument("--repeat",             type = int, help="the number of runs for each value, the median one is reported", default=3)
+    parser.add_argument("--source",             type = str, help="the root of the arm-2d repository", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    parser.add_argument("--build-folder",       type = str, help="the folder for the builds", default="build_sweep")
+    parser.add_argument("--json",               type = str, help="an optional path to save all the results as JSON", required=False)
+
+    args = parser.parse_args(argv)
+
+    if "=" not in args.sweep:
+        parser.print_help()
+        sys.exit(1)
+
+    sweep_name, sweep_values = args.sweep.split("=", 1)
+    sweep_values = [value for value in sweep_values.split(",") if value != ""]
+    defines = [tuple(define.split("=", 1)) if "=" in define else (define, "1")
+               for define in args.define]
+
+    rows = []
+    for value in sweep_values:
+        build_folder = os.path.join(args.build_folder, f"{sweep_name}_{value}")
+        print(f"building {sweep_name}={value} ...", file=sys.stderr)
+        runner = build_runner(args, build_folder, defines + [(sweep_name, value)])
+
+        print(f"running {sweep_name}={value} ...", file=sys.stderr)
+        result, averages = run_runner(args, runner)
+        rows.append({"value": value, "result": result, "averages": averages})
+
+    baseline = rows[0]["result"]["average_cycles"]
+
+    print(f"| `{sweep_name}` | Average (ns) | Min (ns) | FPS | Speed-up | Checksum |")
+    print("| --- | --- | --- | --- | --- | --- |")
+    for row in rows:
+        result = row["result"]
+        print(f"| {row['value']} "
+              f"| {result['average_cycles']} "
+              f"| {result['min_cycles']} "
+              f"| {result['fps']:.2f} "
+              f"| {baseline / result['average_cycles']:.2f} "
+              f"| {result['checksum']} |")
+
+    if args.json:
+        with open(args.json, "w") as file:
+            json.dump({ "sweep": sweep_name,
+                        "defines": dict(defines),
+                        "cmake": args.cmake,
+                        "benchmark": args.benchmark,
+                        "frames": args.frames,
+                        "cpu_count": os.cpu_count(),
+                        "rows": [{  "value": row["value"],
+                                    "averages": row["averages"],
+                                    "average_cycles": row["result"]["average_cycles"],
+                                    "min_cycles": row["result"]["min_cycles"],
+                                    "checksum": row["result"]["checksum"]}
+                                 for row in rows]},
+                      file,
+                      indent=2)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -247,6 +247,37 @@ const arm_2d_tile_t c_tile{0}Mask2 = {{
 """
 
 
+tailMipmap="""
+
+static const arm_2d_tile_t *const c_tile{0}{4}MipmapLevels[] = {{
+{7}}};
+
+extern const arm_2d_tile_mipmap_t c_tile{0}{4}Mipmap;
+
+ARM_SECTION(\"arm2d.tile.c_tile{0}{4}Mipmap\")
+const arm_2d_tile_mipmap_t c_tile{0}{4}Mipmap = {{
+    .tTile = {{
+        .tRegion = {{
+            .tSize = {{
+                .iWidth = {1},
+                .iHeight = {2},
+            }},
+        }},
+        .tInfo = {{
+            .bIsRoot = true,
+            .bHasEnforcedColour = true,
+            .u3ExtensionID = ARM_2D_TILE_EXTENSION_MIPMAP,
+            .tColourInfo = {{
+                .chScheme = {5},
+            }},
+            .Extension.Mipmap.chLevelCount = {6},
+        }},
+        {3},
+    }},
+    .ptLevels = c_tile{0}{4}MipmapLevels,
+}};
+"""
+
 tail="""
 
 #if defined(__clang__)
@@ -257,6 +288,267 @@ tail="""
 
 """
 
+def write_tiles(o, args, mode, image, arr_name):
+
+    (row, col) = image.size
+    data = np.asarray(image)
+
+    # C Array format width
+    WIDTH_ALPHA = 16
+    WIDTH_GRAY8 = 32
+    WIDTH_RGB565 = 16
+    WIDTH_RGB32 = 16
+
+
+    if mode == "RGBA":
+        print('ARM_ALIGN(4) ARM_SECTION(\"arm2d.asset.c_bmp%sAlpha\")' % (arr_name), file=o)
+        # alpha channel array available
+        print('static const uint8_t c_bmp%sAlpha[%d*%d] = {' % (arr_name, row, col),file=o)
+        cnt = 0
+        for eachRow in data:
+            lineWidth=0
+            print("/* -%d- */" % (cnt), file=o)
+            for eachPix in eachRow:
+                alpha = eachPix[3]
+                if lineWidth % WIDTH_ALPHA == (WIDTH_ALPHA - 1):
+                    print("0x%02x," %(alpha) ,file=o)
+                else:
+                    print("0x%02x" %(alpha), end =", ",file=o)
+                lineWidth+=1
+            cnt+=1
+            print('',file=o)
+        print('};', file=o)
+
+        # 2-bit Alpha channel
+        if args.a2 or args.format == 'all':
+
+            def RevBitPairPerByte(byteArr):
+                return ((byteArr & 0x03) << 6) |  ((byteArr & 0xc0) >> 6) | ((byteArr & 0x30) >> 2 ) | ((byteArr & 0x0c) << 2)
+
+
+            print('ARM_ALIGN(4) ARM_SECTION(\"arm2d.asset.c_bmp%sA2Alpha\")' % (arr_name), file=o)
+            print('static const uint8_t c_bmp%sA2Alpha[%d*%d] = {' % (arr_name, (row+3)/4, col),file=o)
+            cnt = 0
+            alpha = data[...,3].astype(np.uint8)
+            for eachRow in alpha:
+                lineWidth=0
+                print("/* -%d- */" % (cnt), file=o)
+
+                bitsArr = np.unpackbits(eachRow.astype(np.uint8))
+
+                # generate indexes for MSB bit pair every byte
+                idx = np.arange(0, np.size(bitsArr), 8)
+                idx=np.reshape(np.column_stack((idx+0, idx+1)), (1,-1))
+
+                # extraction + endianness conversion
+                packedBytes = RevBitPairPerByte(np.packbits(bitsArr[idx]))
+
+                for elt in packedBytes:
+                    if lineWidth % WIDTH_ALPHA == (WIDTH_ALPHA-1):
+                        print("0x%02x," %(elt) ,file=o)
+                    else:
+                        print("0x%02x" %(elt), end =", ",file=o)
+                    lineWidth+=1
+                cnt+=1
+                print('',file=o)
+            print('};', file=o)
+
+        # 4-bit Alpha channel
+        if args.a4 or args.format == 'all':
+
+            def RevBitQuadPerByte(byteArr):
+                return ((byteArr & 0x0f) << 4) |  ((byteArr & 0xf0) >> 4)
+
+
+            print('ARM_ALIGN(4) ARM_SECTION(\"arm2d.asset.c_bmp%sA4Alpha\")' % (arr_name), file=o)
+            print('static const uint8_t c_bmp%sA4Alpha[%d*%d] = {' % (arr_name, (row+1)/2, col),file=o)
+            cnt = 0
+            alpha = data[...,3].astype(np.uint8)
+            for eachRow in alpha:
+                lineWidth=0
+                print("/* -%d- */" % (cnt), file=o)
+
+                bitsArr = np.unpackbits(eachRow.astype(np.uint8))
+
+                # generate indexes for MSB bit quadruplet every byte
+                idx = np.arange(0, np.size(bitsArr), 8)
+                idx=np.reshape(np.column_stack(
+                        (np.column_stack((idx+0, idx+1)), np.column_stack((idx+2, idx+3)))),
+                        (1,-1)),
+
+                # extraction + endianness conversion
+                packedBytes = RevBitQuadPerByte(np.packbits(bitsArr[idx]))
+
+                for elt in packedBytes:
+                    if lineWidth % WIDTH_ALPHA == (WIDTH_ALPHA - 1):
+                        print("0x%02x," %(elt) ,file=o)
+                    else:
+                        print("0x%02x" %(elt), end =", ",file=o)
+                    lineWidth+=1
+                cnt+=1
+                print('',file=o)
+            print('};', file=o)
+
+
+    # Gray8 channel array
+    if args.format == 'gray8' or args.format == 'all':
+
+        R = (data[...,0]).astype(np.uint16)
+        G = (data[...,1]).astype(np.uint16)
+        B = (data[...,2]).astype(np.uint16)
+        # merge
+        RGB = np.rint((R + G + B)/3).astype(np.uint8)
+
+        print('',file=o)
+        print('ARM_SECTION(\"arm2d.asset.c_bmp%sGRAY8\")' % (arr_name), file=o)
+        print('const uint8_t c_bmp%sGRAY8[%d*%d] = {' % (arr_name, row, col), file=o)
+        cnt = 0
+        for eachRow in RGB:
+            lineWidth=0
+            print("/* -%d- */" % (cnt), file=o)
+            for eachPix in eachRow:
+                if lineWidth % WIDTH_GRAY8 == (WIDTH_GRAY8 - 1):
+                    print("0x%02x," %(eachPix) ,file=o)
+                else:
+                    print("0x%02x" %(eachPix), end =", ", file=o)
+                lineWidth+=1
+            print('',file=o)
+            cnt+=1
+        print('};', file=o)
+        buffStr='pchBuffer'
+        typStr='uint8_t'
+
+    # RGB565 channel array
+    if args.format == 'rgb565' or args.format == 'all':
+        R = (data[...,0]>>3).astype(np.uint16) << 11
+        G = (data[...,1]>>2).astype(np.uint16) << 5
+        B = (data[...,2]>>3).astype(np.uint16)
+        # merge
+        RGB = R | G | B
+
+        print('',file=o)
+        print('ARM_SECTION(\"arm2d.asset.c_bmp%sRGB565\")' % (arr_name), file=o)
+        print('const uint16_t c_bmp%sRGB565[%d*%d] = {' % (arr_name, row, col), file=o)
+        cnt = 0
+        for eachRow in RGB:
+            lineWidth=0
+            print("/* -%d- */" % (cnt), file=o)
+            for eachPix in eachRow:
+                if lineWidth % WIDTH_RGB565 == (WIDTH_RGB565 - 1):
+                    print("0x%04x," %(eachPix) ,file=o)
+                else:
+                    print("0x%04x" %(eachPix), end =", ", file=o)
+                lineWidth+=1
+            print('',file=o)
+            cnt+=1
+        print('};', file=o)
+        buffStr='phwBuffer'
+        typStr='uint16_t'
+
+
+
+    if args.format == 'rgb32' or args.format == 'all':
+        R = data[...,0].astype(np.uint32) << 16
+        G = data[...,1].astype(np.uint32) << 8
+        B = data[...,2].astype(np.uint32)
+        if mode == "RGBA":
+            A = data[...,3].astype(np.uint32) << 24
+        else:
+            # alpha chanel forced to 0xFF
+            A = 0xff << 24
+        # merge
+        RGB = R | G | B | A
+
+        print('',file=o)
+
+        if mode == "RGBA":
+            print('ARM_SECTION(\"arm2d.asset.c_bmp%sCCCA8888\")' % (arr_name), file=o)
+            print('const uint32_t c_bmp%sCCCA8888[%d*%d] = {' % (arr_name, row, col), file=o)
+        else:
+            print('ARM_SECTION(\"arm2d.asset.c_bmp%sCCCN888\")' % (arr_name), file=o)
+            print('const uint32_t c_bmp%sCCCN888[%d*%d]= {' % (arr_name, row, col), file=o)
+
+        cnt = 0
+        for eachRow in RGB:
+            lineWidth=0
+            print("/* -%d- */" % (cnt), file=o)
+            for eachPix in eachRow:
+                if lineWidth % WIDTH_RGB32 == (WIDTH_RGB32 - 1):
+                    print("0x%08x," %(eachPix) ,file=o)
+                else:
+                    print("0x%08x" %(eachPix), end =", ", file=o)
+                lineWidth+=1
+            print('',file=o)
+            cnt+=1
+        print('};', file=o)
+        buffStr='pwBuffer'
+        typStr='uint32_t'
+
+    # insert tail
+    if args.format == 'gray8' or args.format == 'all':
+        buffStr='pchBuffer'
+        typStr='uint8_t'
+        print(tailDataGRAY8.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
+
+    if args.format == 'rgb565' or args.format == 'all':
+        buffStr='phwBuffer'
+        typStr='uint16_t'
+        print(tailDataRGB565.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
+
+    if args.format == 'rgb32' or args.format == 'all':
+        buffStr='pwBuffer'
+        typStr='uint32_t'
+        if mode == "RGBA":
+            print(tailDataRGBA8888.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
+            print(tailAlpha2.format(arr_name, str(row), str(col)), file=o)
+        else :
+            print(tailDataRGB888.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
+
+
+    if mode == "RGBA":
+        print(tailAlpha.format(arr_name, str(row), str(col)), file=o)
+
+        if args.a2 or args.format == 'all':
+            print(tail2BitAlpha.format(arr_name, str(row), str(col)), file=o)
+
+        if args.a4 or args.format == 'all':
+            print(tail4BitAlpha.format(arr_name, str(row), str(col)), file=o)
+
+
+def write_mipmaps(o, args, mode, images):
+
+    arr_name = images[0][0]
+    (row, col) = images[0][1].size
+    formats = []
+
+    if args.format == 'gray8' or args.format == 'all':
+        formats.append(('GRAY8', 'ARM_2D_COLOUR_GRAY8', 'pchBuffer', 'uint8_t'))
+    if args.format == 'rgb565' or args.format == 'all':
+        formats.append(('RGB565', 'ARM_2D_COLOUR_RGB565', 'phwBuffer', 'uint16_t'))
+    if args.format == 'rgb32' or args.format == 'all':
+        if mode == "RGBA":
+            formats.append(('CCCA8888', 'ARM_2D_COLOUR_BGRA8888', 'pwBuffer', 'uint32_t'))
+        else:
+            formats.append(('CCCN888', 'ARM_2D_COLOUR_RGB888', 'pwBuffer', 'uint32_t'))
+    if mode == "RGBA":
+        formats.append(('Mask', 'ARM_2D_COLOUR_8BIT', 'pchBuffer', 'uint8_t'))
+
+    for (suffix, scheme, buffStr, typStr) in formats:
+        if suffix == 'Mask':
+            bmpName = "c_bmp%sAlpha" % (arr_name)
+        else:
+            bmpName = "c_bmp%s%s" % (arr_name, suffix)
+        levels = ''.join('    &c_tile%s%s,\n' % (name, suffix) for (name, image) in images[1:])
+        print(tailMipmap.format(arr_name,
+                                str(row),
+                                str(col),
+                                "."+buffStr+" = ("+typStr+"*)"+bmpName,
+                                suffix,
+                                scheme,
+                                str(len(images) - 1),
+                                levels), file=o)
+
+
 def main(argv):
 
     parser = argparse.ArgumentParser(description='image to C array converter (v1.2.2)')
@@ -270,6 +562,7 @@ def main(argv):
     parser.add_argument('--rot', nargs='?',type = float, default=0.0, help="Rotate the image with the given angle in degrees")
     parser.add_argument('--a2', action='store_true', help="Generate 2bit alpha-mask")
     parser.add_argument('--a4', action='store_true', help="Generate 4bit alpha-mask")
+    parser.add_argument('--mipmap', nargs='?', type = int, default=0, help="Generate the given number of half-resolution levels and arm_2d_tile_mipmap_t descriptors")
 
     args = parser.parse_args()
 
@@ -350,236 +643,28 @@ def main(argv):
     if mode == 'L':
         image = image.convert('RGB')
         mode = 'RGB'
-    (row, col) = image.size
-    data = np.asarray(image)
 
-    # C Array format width
-    WIDTH_ALPHA = 16
-    WIDTH_GRAY8 = 32
-    WIDTH_RGB565 = 16
-    WIDTH_RGB32 = 16
+    # mip chain: each level is half the size of the previous one
+    images = [(arr_name, image)]
+    for level in range(1, args.mipmap + 1):
+        (width, height) = images[-1][1].size
+        if width < 2 or height < 2:
+            break
+        images.append((arr_name + "Mip%d" % (level),
+                       images[-1][1].resize((width // 2, height // 2), Image.BOX)))
 
     with open(outputfile,"w") as o:
 
         # insert header
         print(hdr.format(time.asctime( time.localtime(time.time())), argv[0], resized, args.rot), file=o)
 
-        if mode == "RGBA":
-            print('ARM_ALIGN(4) ARM_SECTION(\"arm2d.asset.c_bmp%sAlpha\")' % (arr_name), file=o)
-            # alpha channel array available
-            print('static const uint8_t c_bmp%sAlpha[%d*%d] = {' % (arr_name, row, col),file=o)
-            cnt = 0
-            for eachRow in data:
-                lineWidth=0
-                print("/* -%d- */" % (cnt), file=o)
-                for eachPix in eachRow:
-                    alpha = eachPix[3]
-                    if lineWidth % WIDTH_ALPHA == (WIDTH_ALPHA - 1):
-                        print("0x%02x," %(alpha) ,file=o)
-                    else:
-                        print("0x%02x" %(alpha), end =", ",file=o)
-                    lineWidth+=1
-                cnt+=1
-                print('',file=o)
-            print('};', file=o)
-
-            # 2-bit Alpha channel
-            if args.a2 or args.format == 'all':
-
-                def RevBitPairPerByte(byteArr):
-                    return ((byteArr & 0x03) << 6) |  ((byteArr & 0xc0) >> 6) | ((byteArr & 0x30) >> 2 ) | ((byteArr & 0x0c) << 2)
-
-
-                print('ARM_ALIGN(4) ARM_SECTION(\"arm2d.asset.c_bmp%sA2Alpha\")' % (arr_name), file=o)
-                print('static const uint8_t c_bmp%sA2Alpha[%d*%d] = {' % (arr_name, (row+3)/4, col),file=o)
-                cnt = 0
-                alpha = data[...,3].astype(np.uint8)
-                for eachRow in alpha:
-                    lineWidth=0
-                    print("/* -%d- */" % (cnt), file=o)
-
-                    bitsArr = np.unpackbits(eachRow.astype(np.uint8))
-
-                    # generate indexes for MSB bit pair every byte
-                    idx = np.arange(0, np.size(bitsArr), 8)
-                    idx=np.reshape(np.column_stack((idx+0, idx+1)), (1,-1))
-
-                    # extraction + endianness conversion
-                    packedBytes = RevBitPairPerByte(np.packbits(bitsArr[idx]))
-
-                    for elt in packedBytes:
-                        if lineWidth % WIDTH_ALPHA == (WIDTH_ALPHA-1):
-                            print("0x%02x," %(elt) ,file=o)
-                        else:
-                            print("0x%02x" %(elt), end =", ",file=o)
-                        lineWidth+=1
-                    cnt+=1
-                    print('',file=o)
-                print('};', file=o)
-
-            # 4-bit Alpha channel
-            if args.a4 or args.format == 'all':
-
-                def RevBitQuadPerByte(byteArr):
-                    return ((byteArr & 0x0f) << 4) |  ((byteArr & 0xf0) >> 4)
-
-
-                print('ARM_ALIGN(4) ARM_SECTION(\"arm2d.asset.c_bmp%sA4Alpha\")' % (arr_name), file=o)
-                print('static const uint8_t c_bmp%sA4Alpha[%d*%d] = {' % (arr_name, (row+1)/2, col),file=o)
-                cnt = 0
-                alpha = data[...,3].astype(np.uint8)
-                for eachRow in alpha:
-                    lineWidth=0
-                    print("/* -%d- */" % (cnt), file=o)
-
-                    bitsArr = np.unpackbits(eachRow.astype(np.uint8))
-
-                    # generate indexes for MSB bit quadruplet every byte
-                    idx = np.arange(0, np.size(bitsArr), 8)
-                    idx=np.reshape(np.column_stack(
-                            (np.column_stack((idx+0, idx+1)), np.column_stack((idx+2, idx+3)))),
-                            (1,-1)),
-
-                    # extraction + endianness conversion
-                    packedBytes = RevBitQuadPerByte(np.packbits(bitsArr[idx]))
-
-                    for elt in packedBytes:
-                        if lineWidth % WIDTH_ALPHA == (WIDTH_ALPHA - 1):
-                            print("0x%02x," %(elt) ,file=o)
-                        else:
-                            print("0x%02x" %(elt), end =", ",file=o)
-                        lineWidth+=1
-                    cnt+=1
-                    print('',file=o)
-                print('};', file=o)
-
-
-        # Gray8 channel array
-        if args.format == 'gray8' or args.format == 'all':
-
-            R = (data[...,0]).astype(np.uint16)
-            G = (data[...,1]).astype(np.uint16)
-            B = (data[...,2]).astype(np.uint16)
-            # merge
-            RGB = np.rint((R + G + B)/3).astype(np.uint8)
-
-            print('',file=o)
-            print('ARM_SECTION(\"arm2d.asset.c_bmp%sGRAY8\")' % (arr_name), file=o)
-            print('const uint8_t c_bmp%sGRAY8[%d*%d] = {' % (arr_name, row, col), file=o)
-            cnt = 0
-            for eachRow in RGB:
-                lineWidth=0
-                print("/* -%d- */" % (cnt), file=o)
-                for eachPix in eachRow:
-                    if lineWidth % WIDTH_GRAY8 == (WIDTH_GRAY8 - 1):
-                        print("0x%02x," %(eachPix) ,file=o)
-                    else:
-                        print("0x%02x" %(eachPix), end =", ", file=o)
-                    lineWidth+=1
-                print('',file=o)
-                cnt+=1
-            print('};', file=o)
-            buffStr='pchBuffer'
-            typStr='uint8_t'
-
-        # RGB565 channel array
-        if args.format == 'rgb565' or args.format == 'all':
-            R = (data[...,0]>>3).astype(np.uint16) << 11
-            G = (data[...,1]>>2).astype(np.uint16) << 5
-            B = (data[...,2]>>3).astype(np.uint16)
-            # merge
-            RGB = R | G | B
-
-            print('',file=o)
-            print('ARM_SECTION(\"arm2d.asset.c_bmp%sRGB565\")' % (arr_name), file=o)
-            print('const uint16_t c_bmp%sRGB565[%d*%d] = {' % (arr_name, row, col), file=o)
-            cnt = 0
-            for eachRow in RGB:
-                lineWidth=0
-                print("/* -%d- */" % (cnt), file=o)
-                for eachPix in eachRow:
-                    if lineWidth % WIDTH_RGB565 == (WIDTH_RGB565 - 1):
-                        print("0x%04x," %(eachPix) ,file=o)
-                    else:
-                        print("0x%04x" %(eachPix), end =", ", file=o)
-                    lineWidth+=1
-                print('',file=o)
-                cnt+=1
-            print('};', file=o)
-            buffStr='phwBuffer'
-            typStr='uint16_t'
-
-
-
-        if args.format == 'rgb32' or args.format == 'all':
-            R = data[...,0].astype(np.uint32) << 16
-            G = data[...,1].astype(np.uint32) << 8
-            B = data[...,2].astype(np.uint32)
-            if mode == "RGBA":
-                A = data[...,3].astype(np.uint32) << 24
-            else:
-                # alpha chanel forced to 0xFF
-                A = 0xff << 24
-            # merge
-            RGB = R | G | B | A
-
-            print('',file=o)
-
-            if mode == "RGBA":
-                print('ARM_SECTION(\"arm2d.asset.c_bmp%sCCCA8888\")' % (arr_name), file=o)
-                print('const uint32_t c_bmp%sCCCA8888[%d*%d] = {' % (arr_name, row, col), file=o)
-            else:
-                print('ARM_SECTION(\"arm2d.asset.c_bmp%sCCCN888\")' % (arr_name), file=o)
-                print('const uint32_t c_bmp%sCCCN888[%d*%d]= {' % (arr_name, row, col), file=o)
-
-            cnt = 0
-            for eachRow in RGB:
-                lineWidth=0
-                print("/* -%d- */" % (cnt), file=o)
-                for eachPix in eachRow:
-                    if lineWidth % WIDTH_RGB32 == (WIDTH_RGB32 - 1):
-                        print("0x%08x," %(eachPix) ,file=o)
-                    else:
-                        print("0x%08x" %(eachPix), end =", ", file=o)
-                    lineWidth+=1
-                print('',file=o)
-                cnt+=1
-            print('};', file=o)
-            buffStr='pwBuffer'
-            typStr='uint32_t'
-
-        # insert tail
-        if args.format == 'gray8' or args.format == 'all':
-            buffStr='pchBuffer'
-            typStr='uint8_t'
-            print(tailDataGRAY8.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
-
-        if args.format == 'rgb565' or args.format == 'all':
-            buffStr='phwBuffer'
-            typStr='uint16_t'
-            print(tailDataRGB565.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
-
-        if args.format == 'rgb32' or args.format == 'all':
-            buffStr='pwBuffer'
-            typStr='uint32_t'
-            if mode == "RGBA":
-                print(tailDataRGBA8888.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
-                print(tailAlpha2.format(arr_name, str(row), str(col)), file=o)
-            else :
-                print(tailDataRGB888.format(arr_name, str(row), str(col), "."+buffStr+" = ("+typStr+"*)"), file=o)
-
-
-        if mode == "RGBA":
-            print(tailAlpha.format(arr_name, str(row), str(col)), file=o)
-
-            if args.a2 or args.format == 'all':
-                print(tail2BitAlpha.format(arr_name, str(row), str(col)), file=o)
-
-            if args.a4 or args.format == 'all':
-                print(tail4BitAlpha.format(arr_name, str(row), str(col)), file=o)
+        for (name, level) in images:
+            write_tiles(o, args, mode, level, name)
 
+        if len(images) > 1:
+            write_mipmaps(o, args, mode, images)
 
-        print(tail.format(arr_name, str(row), str(col)), file=o)
+        print(tail, file=o)
 
 if __name__ == '__main__':
     main(sys.argv[1:])
@@ -177,13 +177,28 @@ IMPL_FONT_GET_CHAR_DESCRIPTOR(__utf8_a{5}_font_get_char_descriptor)
     __ttf_char_descriptor_t *ptUTF8Char =
         (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA{5}[dimof(c_tUTF8LookUpTableA{5})-1];
 
-    arm_foreach(__ttf_char_descriptor_t, c_tUTF8LookUpTableA{5}, ptChar) {{
-        if (0 == strncmp(   (char *)pchCharCode,
-                            (char *)ptChar->chUTF8,
-                            ptChar->chCodeLength)) {{
+    /* the glyphs (except the white space at the end) are sorted by their UTF8
+     * encodings, i.e. by code points, hence we can use a binary search
+     */
+    int32_t nLow = 0;
+    int32_t nHigh = (int32_t)dimof(c_tUTF8LookUpTableA{5}) - 2;
+
+    while(nLow <= nHigh) {{
+        int32_t nMid = (nLow + nHigh) >> 1;
+        __ttf_char_descriptor_t *ptChar =
+            (__ttf_char_descriptor_t *)&c_tUTF8LookUpTableA{5}[nMid];
+
+        int nResult = strncmp(  (char *)pchCharCode,
+                                (char *)ptChar->chUTF8,
+                                ptChar->chCodeLength);
+        if (0 == nResult) {{
             /* found the UTF8 char */
             ptUTF8Char = ptChar;
             break;
+        }} else if (nResult < 0) {{
+            nHigh = nMid - 1;
+        }} else {{
+            nLow = nMid + 1;
         }}
     }}
 
@@ -269,6 +284,8 @@ def generate_glyphs_data(input_file, text, pixel_size, font_bit_size):
         height_max = max(bitmap.rows, height_max)
 
 
+    # NOTE: the glyphs must be sorted by code points (i.e. by UTF8 encodings),
+    #       as the generated lookup uses a binary search
     for char in sorted(set(text)):
         face.load_char(char)
         bitmap = face.glyph.bitmap
@@ -419,7 +436,7 @@ def write_c_code(glyphs_data, output_file, name, char_max_width, char_max_height
 
 
 def main():
-    parser = argparse.ArgumentParser(description='TrueTypeFont to C array converter (v1.1.4)')
+    parser = argparse.ArgumentParser(description='TrueTypeFont to C array converter (v1.2.0)')
     parser.add_argument("-i", "--input",    type=str,   help="Path to the TTF file",            required=True)
     parser.add_argument("-t", "--text",     type=str,   help="Path to the text file",           required=True)
     parser.add_argument("-n", "--name",     type=str,   help="The customized UTF8 font name",   required=False,     default="UTF8")